@@ -15,32 +15,68 @@
 
 
 #include <fcntl.h> //stat stat_buf
+#include <sys/stat.h>
 #include "tinysegmenterxx.hpp"
 
 const unsigned int MAX_BUF_SIZ = 65536;
 
-void printUsage(std::string& fileName)
+void printUsage(std::string& fileName, int status = 0)
 {
   std::cerr << std::endl;
   std::cerr << fileName << " : Super compact Japanese tokenizer in C++." << std::endl;
   std::cerr << "  " << fileName <<  " [options] filepath" << std::endl;
-  std::cerr << "  " << fileName <<  " < filepath" << std::endl;
+  std::cerr << "  " << fileName <<  " [options] < filepath" << std::endl;
   std::cerr << "    -s, --separator=[tab|zero|return(default)]" << std::endl;
+  std::cerr << "    -e, --encoding=[utf8(default)|sjis|eucjp]" << std::endl;
+  std::cerr << "    -t, --transcode : write segmentes in utf8" << std::endl;
   std::cerr << "    -h, --help" << std::endl;
   std::cerr << "    -v, --version" << std::endl;
-  exit(0);
+  exit(status);
 }
 
-void procArgs(int argc, char** argv, std::string& separator, std::string& inputPath)
+/*!
+  @brief This function is used in order to get the value following the
+  option argv[i], printing usage if there is none.
+ */
+const char* getOptionValue(int argc, char** argv, int& i, std::string& fileName)
+{
+  if(i + 1 >= argc) printUsage(fileName, 1);
+  return argv[++i];
+}
+
+tinysegmenterxx::Encoding getEncoding(const std::string& encoding)
+{
+  if(encoding == "utf8"){
+    return tinysegmenterxx::ENCODING_UTF8;
+  } else if(encoding == "sjis"){
+    return tinysegmenterxx::ENCODING_SJIS;
+  } else if(encoding == "eucjp"){
+    return tinysegmenterxx::ENCODING_EUCJP;
+  }
+  std::cerr << "unknown option: -e " << encoding << std::endl;
+  std::cerr << "-e needs [utf8|sjis|eucjp]" << std::endl;
+  exit(1);
+}
+
+
+void procArgs(int argc, char** argv, std::string& separator,
+              tinysegmenterxx::Encoding& encoding, bool& transcode, std::string& inputPath)
 {
   std::string fileName = argv[0];
   for(int i = 1; i < argc; i++){
     std::string argBuf = argv[i];
     if(argBuf == "-s"){
-      separator = argv[++i];
+      separator = getOptionValue(argc, argv, i, fileName);
     } else if((argBuf.find("--separator=")) != std::string::npos){
       unsigned int idx = argBuf.find("=");
       separator = argv[i] + idx + 1;
+    } else if(argBuf == "-e"){
+      encoding = getEncoding(getOptionValue(argc, argv, i, fileName));
+    } else if((argBuf.find("--encoding=")) != std::string::npos){
+      unsigned int idx = argBuf.find("=");
+      encoding = getEncoding(argv[i] + idx + 1);
+    } else if(argBuf == "-t" || argBuf == "--transcode"){
+      transcode = true;
     } else if(argBuf == "--help" || argBuf == "-h"){
       printUsage(fileName);
     } else if(argBuf == "--version" || argBuf == "-v"){
@@ -56,10 +92,6 @@ void procArgs(int argc, char** argv, std::string& separator, std::string& inputP
       printUsage(fileName);
     }
   }
-  if(inputPath.size() < 1){
-    printUsage(fileName);
-  }
-
   if(separator.size() < 1){
     separator = '\n';
   } else if(separator == "zero"){
@@ -77,12 +109,14 @@ void procArgs(int argc, char** argv, std::string& separator, std::string& inputP
 
 int main(int argc, char** argv)
 {
-  std::string fileName = argv[0];
   tinysegmenterxx::Segmenter sg;
-  if(argc > 1){
-    std::string inputPath;
-    std::string separator;
-    procArgs(argc, argv, separator, inputPath);
+  std::string inputPath;
+  std::string separator;
+  tinysegmenterxx::Encoding inputEncoding = tinysegmenterxx::ENCODING_UTF8;
+  bool transcode = false;
+  procArgs(argc, argv, separator, inputEncoding, transcode, inputPath);
+  std::string input;
+  if(inputPath.size() > 0){
     struct stat stat_buf;
     size_t fileSiz = 0;
     if(stat(inputPath.c_str(), &stat_buf) == 0){
@@ -104,26 +138,20 @@ int main(int argc, char** argv)
     }
     ifs.read(buf, fileSiz);
     buf[fileSiz] = '\0';
-    std::string line = buf;
-    tinysegmenterxx::Segmentes segs;
-    sg.segment(line, segs);
-    for(unsigned int i = 0; i < segs.size(); i++){
-      std::cout << segs[i] << separator;
-    }
+    input = buf;
     if(buf != inputBuf) delete[] buf;
   } else {
-    std::string buf;
     while(std::cin){
       std::string line;
       std::cin >> line;
-      buf.append(line);
-      buf.append("\n");
-    }
-    tinysegmenterxx::Segmentes segs;
-    sg.segment(buf, segs);
-    for(unsigned int i = 0; i < segs.size(); i++){
-      std::cout << segs[i] << std::endl;
+      input.append(line);
+      input.append("\n");
     }
   }
+  tinysegmenterxx::Segmentes segs;
+  sg.segment(input, inputEncoding, segs, transcode);
+  for(unsigned int i = 0; i < segs.size(); i++){
+    std::cout << segs[i] << separator;
+  }
   return 0;
 }
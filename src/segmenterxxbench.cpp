@@ -0,0 +1,268 @@
+/*
+ * Copyright (C) Shunya KIMURA <brmtrain@gmail.com>
+ * Use and distribution of this program is licensed under the
+ * BSD license. See the COPYING file for full text.
+ *
+ * Original version TinySegmenter was written by Taku Kudo <taku@chasen.org>
+ * The license is below.
+ *   TinySegmenter 0.1 -- Super compact Japanese tokenizer in Javascript
+ *   (c) 2008 Taku Kudo <taku@chasen.org>
+ *   TinySegmenter is freely distributable under the terms of a new BSD licence.
+ *   For details, see http://chasen.org/~taku/software/TinySegmenter/LICENCE.txt
+ *   http://www.chasen.org/~taku/software/TinySegmenter/
+ *
+ */
+
+#include "tinysegmenterxx.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+
+namespace tinysegmenterxx {
+
+  namespace bench {
+
+    const unsigned int MISS_NUM  = 1 << 20;
+    const unsigned int TEXT_KEYS = 200000;
+
+    double getSeconds(std::chrono::steady_clock::time_point start)
+    {
+      std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+      return d.count();
+    }
+
+    /*!
+      @brief This method is used in order to build n-gram keys of characters
+      known to the model which are not in it, and their TrainHash strings.
+     */
+    void createMisses(std::vector<uint64_t>& keys, std::vector<std::string>& strs)
+    {
+      const model::FeatureModel& m = model::getFeatureModel();
+      const model::PerfectHash& table = m.getWordTable();
+      std::srand(1);
+      while(keys.size() < MISS_NUM){
+        int tmpl = model::T_BW1 + std::rand() % (model::T_TW4 - model::T_BW1 + 1);
+        int num = tmpl >= model::T_TW1 ? 3 : 2;
+        int ids[3] = {0, 0, 0};
+        std::string str = model::TEMPLATES[tmpl].name;
+        for(int i = 0; i < num; ++i){
+          ids[i] = model::CHARID_FIRST +
+            std::rand() % (m.getCharNum() - model::CHARID_FIRST);
+          uint16_t c = m.getCharCode(ids[i]);
+          char utf[4];
+          util::ucstoutf(&c, 1, utf);
+          str.append(utf);
+        }
+        uint64_t key = model::packKey(tmpl, ids[0], ids[1], ids[2]);
+        if(table.get(key) != 0) continue;
+        keys.push_back(key);
+        strs.push_back(str);
+      }
+    }
+
+    void benchMisses()
+    {
+      const model::FeatureModel& m = model::getFeatureModel();
+      const model::PerfectHash& table = m.getWordTable();
+      const model::KeyFilter& filter = m.getWordFilter();
+      std::vector<uint64_t> keys;
+      std::vector<std::string> strs;
+      createMisses(keys, strs);
+
+      TrainHash train;
+      long sum = 0;
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      for(unsigned int i = 0; i < MISS_NUM; ++i){
+        const Train* rv = train.in_word_set(strs[i].c_str(), strs[i].size());
+        if(rv) sum += rv->val;
+      }
+      double gperf = getSeconds(start);
+
+      start = std::chrono::steady_clock::now();
+      for(unsigned int i = 0; i < MISS_NUM; ++i){
+        sum += table.get(keys[i]);
+      }
+      double direct = getSeconds(start);
+
+      start = std::chrono::steady_clock::now();
+      unsigned int passed = 0;
+      for(unsigned int i = 0; i < MISS_NUM; ++i){
+        if(filter.mayContain(keys[i])){
+          passed++;
+          sum += table.get(keys[i]);
+        }
+      }
+      double filtered = getSeconds(start);
+
+      std::cout << "n-gram miss path, " << MISS_NUM << " lookups" << std::endl;
+      std::cout << "  TrainHash::in_word_set  : " << gperf * 1e9 / MISS_NUM << " ns" << std::endl;
+      std::cout << "  PerfectHash::get        : " << direct * 1e9 / MISS_NUM << " ns" << std::endl;
+      std::cout << "  KeyFilter + PerfectHash : " << filtered * 1e9 / MISS_NUM << " ns" << std::endl;
+      std::cout << "  table size " << table.getSize() << " bytes" << std::endl;
+      std::cout << "  filter size " << filter.getSize() << " bytes, false positives "
+                << 100.0 * passed / MISS_NUM << "%" << std::endl;
+      if(sum != 0) std::cout << "  unexpected hits: " << sum << std::endl;
+    }
+
+    const int DECODE_REPEAT = 20;
+
+    /*! @brief Best of DECODE_REPEAT runs of a decoder, in MB/s. */
+    template<class Decode>
+    double getDecodeSpeed(const std::string& input, Decode decode)
+    {
+      double best = 0;
+      for(int i = 0; i < DECODE_REPEAT; ++i){
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        decode();
+        double speed = input.size() / getSeconds(start) / 1e6;
+        if(speed > best) best = speed;
+      }
+      return best;
+    }
+
+    void benchSegment(const std::string& input)
+    {
+      const char* names[] = {"gperf", "feature-id", "dense", "bounded"};
+      std::cout << "segment, " << input.size() << " bytes, model tables "
+                << model::getFeatureModel().getSize() << " bytes" << std::endl;
+      for(int e = ENGINE_GPERF; e <= ENGINE_BOUNDED; ++e){
+        Segmenter sg((ScoreEngine)e);
+        Segmentes segs;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        sg.segment(input, segs);
+        double sec = getSeconds(start);
+        std::cout << "  " << names[e] << "\t: " << input.size() / sec / 1e6
+                  << " MB/s, " << segs.size() << " segmentes" << std::endl;
+      }
+      Segmenter sg;
+      SegmentViews views;
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      sg.segment(std::string_view(input), views);
+      double sec = getSeconds(start);
+      std::cout << "  dense, views\t: " << input.size() / sec / 1e6
+                << " MB/s, " << views.size() << " segmentes" << std::endl;
+      // The second fill of a buffer, which allocates no more.
+      TokenBuffer buffer;
+      sg.segment(std::string_view(input), buffer);
+      buffer.clear();
+      start = std::chrono::steady_clock::now();
+      sg.segment(std::string_view(input), buffer);
+      sec = getSeconds(start);
+      std::cout << "  dense, buffer\t: " << input.size() / sec / 1e6
+                << " MB/s, " << buffer.size() << " segmentes" << std::endl;
+      size_t num = 0;
+      start = std::chrono::steady_clock::now();
+      sg.segment(input, [&num](std::string_view){ num++; });
+      sec = getSeconds(start);
+      std::cout << "  dense, sink\t: " << input.size() / sec / 1e6
+                << " MB/s, " << num << " segmentes" << std::endl;
+      size_t wordNum = util::getBitmapWordNum(input.size());
+      std::vector<uint64_t> bits(wordNum);
+      start = std::chrono::steady_clock::now();
+      sg.segment(input, &bits[0]);
+      sec = getSeconds(start);
+      std::cout << "  dense, bitmap\t: " << input.size() / sec / 1e6
+                << " MB/s, " << util::countBits(&bits[0], wordNum) << " segmentes"
+                << std::endl;
+      std::vector<uint32_t> positions(input.size() + 1);
+      std::cout << "  getBitPositions\t: " << getDecodeSpeed(input, [&](){
+          util::getBitPositions(&bits[0], wordNum, &positions[0]);
+        }) << " MB/s" << std::endl;
+    }
+
+    void benchDecode(const std::string& input)
+    {
+      std::vector<uint16_t> ary16(input.size() + 1);
+      std::vector<uint32_t> ary(input.size() + 1);
+      std::vector<uint32_t> offsets(input.size() + 1);
+      const char* str = input.c_str();
+      size_t len = input.size();
+      int num = 0;
+      std::cout << "decode, " << len << " bytes" << std::endl;
+      std::cout << "  utftoucs\t\t\t: " << getDecodeSpeed(input, [&](){
+          util::utftoucs(str, &ary16[0], &num);
+        }) << " MB/s" << std::endl;
+      std::cout << "  decodeUtf8Scalar\t\t: " << getDecodeSpeed(input, [&](){
+          util::decodeUtf8Scalar(str, len, &ary[0], NULL);
+        }) << " MB/s" << std::endl;
+      std::cout << "  decodeUtf8\t\t\t: " << getDecodeSpeed(input, [&](){
+          util::decodeUtf8(str, len, &ary[0], NULL);
+        }) << " MB/s" << std::endl;
+      std::cout << "  decodeUtf8Scalar, offsets\t: " << getDecodeSpeed(input, [&](){
+          util::decodeUtf8Scalar(str, len, &ary[0], &offsets[0]);
+        }) << " MB/s" << std::endl;
+      std::cout << "  decodeUtf8, offsets\t\t: " << getDecodeSpeed(input, [&](){
+          util::decodeUtf8(str, len, &ary[0], &offsets[0]);
+        }) << " MB/s" << std::endl;
+#if defined(__SSE2__)
+      if(util::getSimdLevel() >= util::SIMD_SSSE3){
+        std::cout << "  decodeUtf8Ssse3, offsets\t: " << getDecodeSpeed(input, [&](){
+            util::decodeUtf8Ssse3(str, len, &ary[0], &offsets[0]);
+          }) << " MB/s" << std::endl;
+      }
+      if(util::getSimdLevel() >= util::SIMD_AVX2){
+        std::cout << "  decodeUtf8Avx2, offsets\t: " << getDecodeSpeed(input, [&](){
+            util::decodeUtf8Avx2(str, len, &ary[0], &offsets[0]);
+          }) << " MB/s" << std::endl;
+      }
+#endif
+      // The same charcters in utf-16, speed still per byte of utf-8.
+      size_t num16 = util::decodeUtf8(str, len, &ary[0], NULL);
+      std::u16string str16(ary.begin(), ary.begin() + num16);
+      std::cout << "  decodeUtf16, offsets\t\t: " << getDecodeSpeed(input, [&](){
+          util::decodeUtf16(str16.data(), num16, &ary[0], &offsets[0]);
+        }) << " MB/s" << std::endl;
+    }
+
+    void benchClassify(const std::string& input)
+    {
+      std::vector<uint32_t> ary(input.size() + 1);
+      std::vector<int> classes(input.size() + 1);
+      size_t num = util::decodeUtf8(input.data(), input.size(), &ary[0], NULL);
+      const model::CharClassMap& map = model::getDefaultCharClassMap();
+      std::cout << "classify, " << num << " charcters" << std::endl;
+      std::cout << "  getClass\t\t\t: " << getDecodeSpeed(input, [&](){
+          for(size_t i = 0; i < num; ++i) classes[i] = map.getClass(ary[i]);
+        }) << " MB/s" << std::endl;
+      std::cout << "  getClasses\t\t\t: " << getDecodeSpeed(input, [&](){
+          map.getClasses(&ary[0], num, &classes[0]);
+        }) << " MB/s" << std::endl;
+    }
+
+    /*! @brief Text made of the keys of the word features. */
+    std::string createText()
+    {
+      std::string rv;
+      std::srand(2);
+      for(unsigned int i = 0; i < TEXT_KEYS; ++i){
+        const char* key = wordlist[std::rand() % TOTAL_KEYWORDS].key;
+        if(key[1] == 'W') rv.append(key + 5);
+      }
+      return rv;
+    }
+  }
+}
+
+int main(int argc, char** argv)
+{
+  std::string input;
+  if(argc > 1){
+    std::ifstream ifs(argv[1]);
+    if(!ifs){
+      std::cerr << "cant open file:" << argv[1] << std::endl;
+      return 1;
+    }
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    input = ss.str();
+  } else {
+    input = tinysegmenterxx::bench::createText();
+  }
+  tinysegmenterxx::bench::benchMisses();
+  tinysegmenterxx::bench::benchDecode(input);
+  tinysegmenterxx::bench::benchClassify(input);
+  tinysegmenterxx::bench::benchSegment(input);
+  return 0;
+}
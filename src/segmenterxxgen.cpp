@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) Shunya KIMURA <brmtrain@gmail.com>
+ * Use and distribution of this program is licensed under the
+ * BSD license. See the COPYING file for full text.
+ *
+ * Original version TinySegmenter was written by Taku Kudo <taku@chasen.org>
+ * The license is below.
+ *   TinySegmenter 0.1 -- Super compact Japanese tokenizer in Javascript
+ *   (c) 2008 Taku Kudo <taku@chasen.org>
+ *   TinySegmenter is freely distributable under the terms of a new BSD licence.
+ *   For details, see http://chasen.org/~taku/software/TinySegmenter/LICENCE.txt
+ *   http://www.chasen.org/~taku/software/TinySegmenter/
+ *
+ */
+
+#include "tinysegmenterxx_builder.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <iconv.h>
+
+void usage(const char* prog)
+{
+  std::cerr << "usage: " << prog << " [--fold] train_file" << std::endl;
+  std::cerr << "  writes the model tables of train_file to stdout" << std::endl;
+  std::cerr << "  --fold: fold half-width and full-width forms" << std::endl;
+  std::cerr << "usage: " << prog << " --jis" << std::endl;
+  std::cerr << "  writes the JIS X 0208 table of iconv to stdout" << std::endl;
+}
+
+/*!
+  @brief This function is used in order to write the codepoint of every
+  JIS X 0208 row and cell, 0 where iconv maps none.
+ */
+bool writeJisTable(std::ostream& os)
+{
+  iconv_t cd = iconv_open("UTF-16LE", "EUC-JP");
+  if(cd == (iconv_t)-1) return false;
+  os << "/*\n"
+     << " * Generated by segmenterxxgen from the EUC-JP table of iconv. Do not\n"
+     << " * edit, run \"make jis\" in src instead.\n"
+     << " */\n\n"
+     << "#ifndef TINYSEGMENTERXX_JIS_H\n"
+     << "#define TINYSEGMENTERXX_JIS_H\n\n"
+     << "#include <stdint.h>\n\n"
+     << "namespace tinysegmenterxx {\n\n"
+     << "  namespace util {\n\n"
+     << "    namespace jis {\n\n"
+     << "      /*! @brief Codepoints of JIS X 0208, 94 rows of 94 cells. */\n"
+     << "      constexpr uint16_t JIS0208_CODES[] = {";
+  for(int i = 0; i < 94 * 94; ++i){
+    char in[2] = {(char)(0xA1 + i / 94), (char)(0xA1 + i % 94)};
+    unsigned char out[4] = {0, 0, 0, 0};
+    char* ip = in;
+    char* op = (char*)out;
+    size_t il = sizeof(in);
+    size_t ol = sizeof(out);
+    iconv(cd, NULL, NULL, NULL, NULL);
+    unsigned int c = 0;
+    if(iconv(cd, &ip, &il, &op, &ol) != (size_t)-1 && ol == 2){
+      c = out[0] | out[1] << 8;
+    }
+    os << (i % 10 == 0 ? "\n        " : " ") << "0x" << std::hex
+       << std::setw(4) << std::setfill('0') << c << std::dec
+       << (i + 1 < 94 * 94 ? "," : "");
+  }
+  os << "\n      };\n"
+     << "    }\n"
+     << "  }\n"
+     << "}\n\n"
+     << "#endif /* TINYSEGMENTERXX_JIS_H */\n";
+  iconv_close(cd);
+  return true;
+}
+
+int main(int argc, char** argv)
+{
+  bool fold = argc == 3 && std::string(argv[1]) == "--fold";
+  if(argc != 2 && !fold){
+    usage(argv[0]);
+    return 1;
+  }
+  if(std::string(argv[1]) == "--jis"){
+    if(!writeJisTable(std::cout)){
+      std::cerr << "cant open iconv for EUC-JP" << std::endl;
+      return 1;
+    }
+    return 0;
+  }
+  const char* path = argv[argc - 1];
+  tinysegmenterxx::model::ModelBuilder builder;
+  builder.setFoldWidth(fold);
+  if(!builder.read(path)){
+    std::cerr << "cant read train file:" << path << std::endl;
+    return 1;
+  }
+  builder.build();
+  builder.write(std::cout, path);
+  return 0;
+}
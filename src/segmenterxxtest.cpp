@@ -14,12 +14,19 @@
  */
 
 #include "tinysegmenterxx.hpp"
+#include "tinysegmenterxx_builder.hpp"
 
 #include <iostream>
 #include <ctime>
+#include <algorithm>
+#include <cstdlib>
+#include <new>
 #include <unistd.h>
 
 namespace {
+  /*! @brief Number of calls of operator new, see testNoAllocation. */
+  size_t allocNum = 0;
+
   class Initilizer {
   public:
     Initilizer()
@@ -31,6 +38,44 @@ namespace {
   Initilizer init;
 }
 
+/*!
+  @brief The global allocation functions, counting every allocation in
+  allocNum. All of them are replaced so that each new is freed by a
+  matching delete, and none is inlined into its caller.
+ */
+__attribute__((noinline)) void* operator new(size_t siz)
+{
+  ++allocNum;
+  void* p = std::malloc(siz ? siz : 1);
+  if(!p) throw std::bad_alloc();
+  return p;
+}
+
+__attribute__((noinline)) void* operator new[](size_t siz)
+{
+  return operator new(siz);
+}
+
+__attribute__((noinline)) void operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+__attribute__((noinline)) void operator delete[](void* p) noexcept
+{
+  operator delete(p);
+}
+
+__attribute__((noinline)) void operator delete(void* p, size_t) noexcept
+{
+  operator delete(p);
+}
+
+__attribute__((noinline)) void operator delete[](void* p, size_t) noexcept
+{
+  operator delete(p);
+}
+
 namespace tinysegmenterxx {
 
   namespace test {
@@ -141,6 +186,1000 @@ namespace tinysegmenterxx {
       return rv;
     }
 
+    std::string createRandomModelString(int cnum = 5)
+    {
+      std::string rv;
+      for(int i = 0; i < cnum; i++){
+        const char* key = wordlist[createRandomInt(0, TOTAL_KEYWORDS - 1)].key;
+        if(key[1] == 'W') rv.append(key + 5);
+      }
+      return rv;
+    }
+
+    std::string createRandomBytes(int cnum = 5)
+    {
+      std::string rv;
+      for(int i = 0; i < cnum; i++){
+        rv.push_back((char)createRandomInt(1, 255));
+      }
+      return rv;
+    }
+
+    bool compareEngines(tinysegmenterxx::ScoreEngine engine, const std::string& input)
+    {
+      tinysegmenterxx::Segmenter expected(tinysegmenterxx::ENGINE_GPERF);
+      tinysegmenterxx::Segmenter actual(engine);
+      tinysegmenterxx::Segmentes expectedSegs;
+      tinysegmenterxx::Segmentes actualSegs;
+      expected.segment(input, expectedSegs);
+      actual.segment(input, actualSegs);
+      if(expectedSegs != actualSegs){
+        std::cerr << "engine " << engine << " differs on: " << input << std::endl;
+        return false;
+      }
+      return true;
+    }
+
+    bool testEngine(tinysegmenterxx::ScoreEngine engine)
+    {
+      std::cerr << "Start Engine " << engine << " TEST" << std::endl;
+      for(unsigned int i = 1; i < CHAR_MAX_SIZ; i++){
+        if(!compareEngines(engine, createRandomString(i)) ||
+           !compareEngines(engine, createRandomModelString(i)) ||
+           !compareEngines(engine, createRandomBytes(i))){
+          std::cerr << "test error: testEngine()" << std::endl;
+          return false;
+        }
+        if(i % 100 == 0){
+          std::cerr << "[" << i << "/" << CHAR_MAX_SIZ << "]" << std::endl;
+        } else if(i % 10 == 0){
+          std::cerr << ".";
+        }
+      }
+      std::cerr << std::endl;
+      return true;
+    }
+
+    bool testBoundStats()
+    {
+      std::cerr << "Start Bound Stats TEST" << std::endl;
+      tinysegmenterxx::Segmenter sg(tinysegmenterxx::ENGINE_BOUNDED);
+      tinysegmenterxx::Segmentes segs;
+      std::string input = createRandomString(CHAR_MAX_SIZ);
+      sg.segment(input, segs);
+      const tinysegmenterxx::BoundStats& stats = sg.getBoundStats();
+      if(stats.windows != CHAR_MAX_SIZ - 1 ||
+         stats.lookups + stats.skipped !=
+         stats.windows * tinysegmenterxx::model::TERM_NUM ||
+         stats.skipped == 0){
+        std::cerr << "test error: testBoundStats()" << std::endl;
+        return false;
+      }
+      std::cerr << stats.skipped << " of "
+                << stats.windows * tinysegmenterxx::model::TERM_NUM
+                << " lookups skipped" << std::endl;
+      return true;
+    }
+
+    template<class Cache>
+    bool compareWithCache(Cache& cache, const std::string& input)
+    {
+      tinysegmenterxx::Segmenter expected(tinysegmenterxx::ENGINE_GPERF);
+      tinysegmenterxx::Segmentes expectedSegs;
+      expected.segment(input, expectedSegs);
+      for(int e = tinysegmenterxx::ENGINE_FEATURE_ID;
+          e <= tinysegmenterxx::ENGINE_BOUNDED; e++){
+        tinysegmenterxx::Segmenter actual((tinysegmenterxx::ScoreEngine)e);
+        actual.setWindowCache(&cache);
+        // The second run is served from the cache.
+        for(int i = 0; i < 2; i++){
+          tinysegmenterxx::Segmentes actualSegs;
+          actual.segment(input, actualSegs);
+          if(actualSegs != expectedSegs){
+            std::cerr << "cached engine " << e << " differs on: " << input << std::endl;
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    bool testWindowCache()
+    {
+      std::cerr << "Start Window Cache TEST" << std::endl;
+      tinysegmenterxx::WindowCache local(256);
+      tinysegmenterxx::SharedWindowCache shared(1024);
+      for(unsigned int i = 1; i < CHAR_MAX_SIZ; i += 7){
+        std::string input = createRandomString(i);
+        if(!compareWithCache(local, input) || !compareWithCache(shared, input) ||
+           !compareWithCache(tinysegmenterxx::WindowCache::getThreadCache(), input)){
+          std::cerr << "test error: testWindowCache()" << std::endl;
+          return false;
+        }
+      }
+      tinysegmenterxx::CacheStats stats = shared.getStats();
+      if(local.getStats().hits == 0 || stats.hits == 0){
+        std::cerr << "test error: testWindowCache() no hits" << std::endl;
+        return false;
+      }
+      std::cerr << "hit rate: " << local.getStats().getHitRate() << " local, "
+                << stats.getHitRate() << " shared" << std::endl;
+      return true;
+    }
+
+    /*!
+      @brief This method is used in order to compare the compiled in model
+      with one built from TrainHash. Character IDs depend on the order of the
+      features, so windows are made of codepoints.
+     */
+    bool testModelBuilder()
+    {
+      std::cerr << "Start Model Builder TEST" << std::endl;
+      tinysegmenterxx::model::ModelBuilder builder;
+      for(int i = 0; i < TOTAL_KEYWORDS; ++i){
+        builder.add(wordlist[i].key, wordlist[i].val);
+      }
+      builder.build();
+      tinysegmenterxx::model::FeatureModel built(builder.getTables());
+      const tinysegmenterxx::model::FeatureModel& compiled =
+        tinysegmenterxx::model::getFeatureModel();
+      if(built.getCharNum() != compiled.getCharNum()){
+        std::cerr << "test error: testModelBuilder() char num" << std::endl;
+        return false;
+      }
+      for(int n = 0; n < 100000; ++n){
+        int w1[6], w2[6], c[6];
+        for(int i = 0; i < 6; ++i){
+          int id = createRandomInt(0, compiled.getCharNum() - 1);
+          if(id < tinysegmenterxx::model::CHARID_FIRST){
+            w1[i] = w2[i] = id;
+          } else {
+            uint16_t code = compiled.getCharCode(id);
+            w1[i] = compiled.getCharId(code);
+            w2[i] = built.getCharId(code);
+          }
+          c[i] = createRandomInt(0, tinysegmenterxx::model::CLASS_NUM - 1);
+        }
+        int p1 = createRandomInt(0, 2);
+        int p2 = createRandomInt(0, 2);
+        int p3 = createRandomInt(0, 2);
+        if(compiled.getScore(w1, c, p1, p2, p3) != built.getScore(w2, c, p1, p2, p3)){
+          std::cerr << "test error: testModelBuilder() score" << std::endl;
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /*!
+      @brief This method is used in order to compare decodeUtf8 with
+      decodeUtf8Scalar and utftoucs, on inputs mixing ASCII runs, three byte
+      runs, broken bytes and NUL bytes.
+     */
+    bool testDecoder()
+    {
+      std::cerr << "Start Decoder TEST" << std::endl;
+      for(int n = 0; n < 2000; ++n){
+        std::string input;
+        while(input.size() < CHAR_MAX_SIZ){
+          switch(createRandomInt(0, 40)){
+          case 0: input.push_back('\0'); break;
+          case 1: input.append(createRandomBytes(createRandomInt(1, 4))); break;
+          case 2: case 3: case 4:
+            input.append(createRandomKana(createRandomInt(1, 3))); break;
+          default:
+            if(createRandomInt(0, 1)){
+              input.append(createRandomAlphabet(createRandomInt(1, 40)));
+            } else {
+              input.append(createRandomKanji(createRandomInt(1, 10)));
+            }
+          }
+        }
+        size_t len = createRandomInt(0, input.size());
+        std::vector<uint32_t> ary1(len + 1), ary2(len + 1);
+        std::vector<uint32_t> off1(len + 1), off2(len + 1);
+        size_t num1 = tinysegmenterxx::util::decodeUtf8Scalar(input.data(), len,
+                                                              &ary1[0], &off1[0]);
+        size_t num2 = tinysegmenterxx::util::decodeUtf8(input.data(), len,
+                                                        &ary2[0], &off2[0]);
+        std::string prefix = input.substr(0, len);
+        std::vector<uint16_t> ary3(len + 1);
+        int num3;
+        tinysegmenterxx::util::utftoucs(prefix.c_str(), &ary3[0], &num3);
+        bool ok = num1 == num2 && num1 == (size_t)num3 && off1[num1] == off2[num2];
+        for(size_t i = 0; ok && i < num1; ++i){
+          ok = ary1[i] == ary2[i] && ary1[i] == ary3[i] && off1[i] == off2[i];
+        }
+#if defined(__SSE2__)
+        // The decoders decodeUtf8 does not pick on this cpu.
+        tinysegmenterxx::util::SimdLevel level = tinysegmenterxx::util::getSimdLevel();
+        if(ok && level >= tinysegmenterxx::util::SIMD_SSSE3){
+          num2 = tinysegmenterxx::util::decodeUtf8Ssse3(input.data(), len, &ary2[0], &off2[0]);
+          ok = num1 == num2 && std::equal(ary1.begin(), ary1.begin() + num1, ary2.begin()) &&
+            std::equal(off1.begin(), off1.begin() + num1 + 1, off2.begin());
+        }
+        if(ok && level >= tinysegmenterxx::util::SIMD_AVX2){
+          num2 = tinysegmenterxx::util::decodeUtf8Avx2(input.data(), len, &ary2[0], &off2[0]);
+          ok = num1 == num2 && std::equal(ary1.begin(), ary1.begin() + num1, ary2.begin()) &&
+            std::equal(off1.begin(), off1.begin() + num1 + 1, off2.begin());
+        }
+#endif
+        if(!ok){
+          std::cerr << "test error: testDecoder() " << prefix << std::endl;
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /*!
+      @brief This method is used in order to check the arrays of CharBuffer
+      against decodeUtf8, getCharClass and getCharId, and its words against
+      ucstoutf, with and without broken bytes.
+     */
+    bool testCharBuffer()
+    {
+      std::cerr << "Start CharBuffer TEST" << std::endl;
+      const tinysegmenterxx::model::FeatureModel& m =
+        tinysegmenterxx::model::getFeatureModel();
+      tinysegmenterxx::CharBuffer chars(m);
+      for(int n = 0; n < 2000; ++n){
+        std::string input = createRandomKana(createRandomInt(1, 20));
+        input.append(createRandomAlphabet(createRandomInt(0, 20)));
+        if(n % 2) input.append(createRandomBytes(createRandomInt(1, 4)));
+        input.append(createRandomKanji(createRandomInt(0, 20)));
+        int num = chars.fill(input.data(), input.size());
+        std::vector<uint32_t> ary(input.size() + 1), off(input.size() + 1);
+        bool ok = (size_t)num == tinysegmenterxx::util::decodeUtf8Scalar(
+          input.data(), input.size(), &ary[0], &off[0]);
+        const uint32_t* codes = chars.getCodes() + 2;
+        for(int i = 0; ok && i < num; ++i){
+          ok = codes[i] == ary[i] && chars.getOffsets()[i] == off[i] &&
+            chars.getCharIds()[i + 2] == m.getCharId(ary[i]) &&
+            chars.getClasses()[i + 2] == tinysegmenterxx::model::getClassCode(
+              tinysegmenterxx::util::getCharClass(ary[i]));
+        }
+        for(int i = 0; ok && i < num; ++i){
+          int end = createRandomInt(i, num);
+          // One charcter at a time, as U+0000 is written as an empty string.
+          std::string word;
+          char utf[5];
+          for(int j = i; j < end; ++j){
+            tinysegmenterxx::util::ucstoutf(codes + j, 1, utf);
+            word.append(utf);
+          }
+          ok = chars.getWord(i, end) == word;
+        }
+        if(!ok){
+          std::cerr << "test error: testCharBuffer() " << input << std::endl;
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /*! @brief The branch chain util::getCharClass was before its table. */
+    const char* getCharClassChain(uint32_t c)
+    {
+      if(c >= 'a' && c <= 'z') return "A";
+      if(c >= 'A' && c <= 'Z') return "A";
+      if(c >= '0' && c <= '9') return "N";
+      if(c >= 0x3040 && c <= 0x309F) return "I";
+      if(c >= 0x30A0 && c <= 0x30FA) return "K";
+      if(c >= 0x4E00 && c <= 0x9FFF) return "H";
+      return "O";
+    }
+
+    /*!
+      @brief This method is used in order to compare getClasses, which
+      compares ranges in vector registers where it can, with getClass.
+     */
+    bool compareClasses(const tinysegmenterxx::model::CharClassMap& map)
+    {
+      static const uint32_t codes[] = {
+        0, '0', '9', '@', 'A', 'Z', '[', '`', 'a', 'z', '{', 0xC1, 0x303F, 0x3040,
+        0x309F, 0x30A0, 0x30FA, 0x30FB, 0x4DFF, 0x4E00, 0x4E09, 0x9FFF, 0xA000,
+        0xFFFF, 0x10FFF0, 0x10FFF4, 0x110000, 0x80000041, 0xFFFFFFFF
+      };
+      const size_t num = sizeof(codes) / sizeof(codes[0]);
+      for(int n = 0; n < 1000; ++n){
+        std::vector<uint32_t> ary(createRandomInt(0, 100));
+        for(size_t i = 0; i < ary.size(); ++i){
+          ary[i] = createRandomInt(0, 1) ? codes[createRandomInt(0, num - 1)] :
+            (uint32_t)createRandomInt(0, 0xA000);
+        }
+        std::vector<int> classes(ary.size() + 1);
+        map.getClasses(ary.data(), ary.size(), &classes[0]);
+        for(size_t i = 0; i < ary.size(); ++i){
+          if(classes[i] != map.getClass(ary[i])) return false;
+        }
+      }
+#if defined(__SSE2__)
+      return map.hasRangeClasses();
+#else
+      return true;
+#endif
+    }
+
+    /*!
+      @brief This method is used in order to check the default class map on
+      every codepoint, and the engines with a map giving "M" to the numbers
+      in Kanji.
+     */
+    bool testCharClassMap()
+    {
+      std::cerr << "Start CharClassMap TEST" << std::endl;
+      const tinysegmenterxx::model::CharClassMap& map =
+        tinysegmenterxx::model::getDefaultCharClassMap();
+      for(uint32_t c = 0; c < 0x110010; ++c){
+        if(map.getClass(c) != tinysegmenterxx::model::getClassCode(getCharClassChain(c)) ||
+           std::strcmp(tinysegmenterxx::util::getCharClass(c), getCharClassChain(c)) != 0){
+          std::cerr << "test error: testCharClassMap() " << c << std::endl;
+          return false;
+        }
+      }
+      using tinysegmenterxx::model::CharRange;
+      using tinysegmenterxx::model::CLASS_M;
+      static const CharRange ranges[] = {
+        {'0', '9', tinysegmenterxx::model::CLASS_N},
+        {'A', 'Z', tinysegmenterxx::model::CLASS_A},
+        {'a', 'z', tinysegmenterxx::model::CLASS_A},
+        {0x3040, 0x309F, tinysegmenterxx::model::CLASS_I},
+        {0x30A0, 0x30FA, tinysegmenterxx::model::CLASS_K},
+        {0x4E00, 0x9FFF, tinysegmenterxx::model::CLASS_H},
+        {0x4E00, 0x4E00, CLASS_M}, {0x4E8C, 0x4E8C, CLASS_M},
+        {0x4E09, 0x4E09, CLASS_M}, {0x56DB, 0x56DB, CLASS_M},
+        {0x5341, 0x5341, CLASS_M}, {0x767E, 0x767E, CLASS_M}
+      };
+      static const tinysegmenterxx::model::CharClassMap numerals(ranges, 12);
+      if(numerals.getClass(0x4E09) != CLASS_M ||
+         numerals.getClass(0x4E0A) != tinysegmenterxx::model::CLASS_H ||
+         numerals.getClass('a') != tinysegmenterxx::model::CLASS_A){
+        std::cerr << "test error: testCharClassMap() numerals" << std::endl;
+        return false;
+      }
+      if(!compareClasses(map) || !compareClasses(numerals)){
+        std::cerr << "test error: testCharClassMap() getClasses" << std::endl;
+        return false;
+      }
+      // One distinct page per range, past the default pages.
+      std::vector<CharRange> pageRanges;
+      for(uint32_t p = 0; p < tinysegmenterxx::model::CLASS_PAGE_MAX; ++p){
+        uint32_t c = 0x20000 + (p << tinysegmenterxx::model::CLASS_PAGE_BITS) + p;
+        pageRanges.push_back({c, c, tinysegmenterxx::model::CLASS_K});
+      }
+      tinysegmenterxx::model::CharClassMap* full =
+        new tinysegmenterxx::model::CharClassMap(&pageRanges[0], pageRanges.size() - 1);
+      tinysegmenterxx::model::CharClassMap* over =
+        new tinysegmenterxx::model::CharClassMap(&pageRanges[0], pageRanges.size());
+      tinysegmenterxx::Segmenter rejected;
+      bool ok = full->isValid() && full->getClass(0x20000) == tinysegmenterxx::model::CLASS_K &&
+        !over->isValid() && over->getClass(0x20000) == tinysegmenterxx::model::CLASS_O &&
+        over->getClass('a') == tinysegmenterxx::model::CLASS_O &&
+        rejected.setCharClassMap(full) && !rejected.setCharClassMap(over);
+      delete full;
+      delete over;
+      if(!ok){
+        std::cerr << "test error: testCharClassMap() pages" << std::endl;
+        return false;
+      }
+      tinysegmenterxx::Segmenter expected(tinysegmenterxx::ENGINE_GPERF);
+      tinysegmenterxx::Segmenter actual;
+      expected.setCharClassMap(&numerals);
+      actual.setCharClassMap(&numerals);
+      for(unsigned int i = 1; i < CHAR_MAX_SIZ; i += 10){
+        std::string input = createRandomKanji(i) + "\xe4\xb8\x89\xe7\x99\xbe";
+        tinysegmenterxx::Segmentes expectedSegs;
+        tinysegmenterxx::Segmentes actualSegs;
+        expected.segment(input, expectedSegs);
+        actual.segment(input, actualSegs);
+        if(expectedSegs != actualSegs){
+          std::cerr << "test error: testCharClassMap() " << input << std::endl;
+          return false;
+        }
+      }
+      return true;
+    }
+
+    std::u16string toUtf16(const std::string& str)
+    {
+      std::vector<uint32_t> ary(str.size() + 1);
+      size_t num = tinysegmenterxx::util::decodeUtf8(str.data(), str.size(), &ary[0], NULL);
+      std::u16string rv;
+      for(size_t i = 0; i < num; ++i){
+        if(ary[i] >= 0x10000){
+          rv.push_back(0xD800 + ((ary[i] - 0x10000) >> 10));
+          rv.push_back(0xDC00 + ((ary[i] - 0x10000) & 0x3FF));
+        } else {
+          rv.push_back(ary[i]);
+        }
+      }
+      return rv;
+    }
+
+    /*!
+      @brief This method is used in order to compare the segmentes of utf-16
+      input with those of the same input in utf-8, and check that they cover
+      the input.
+     */
+    bool testUtf16()
+    {
+      std::cerr << "Start UTF-16 TEST" << std::endl;
+      for(int e = tinysegmenterxx::ENGINE_GPERF; e <= tinysegmenterxx::ENGINE_BOUNDED; e++){
+        tinysegmenterxx::Segmenter sg((tinysegmenterxx::ScoreEngine)e);
+        for(unsigned int i = 1; i < CHAR_MAX_SIZ; i += 7){
+          std::string input = createRandomString(i);
+          std::u16string input16 = toUtf16(input);
+          tinysegmenterxx::Segmentes segs;
+          tinysegmenterxx::Segmentes16 segs16;
+          sg.segment(input, segs);
+          sg.segment(input16.data(), input16.size(), segs16);
+          bool ok = segs.size() == segs16.size();
+          for(size_t j = 0; ok && j < segs.size(); ++j){
+            ok = toUtf16(segs[j]) == std::u16string(segs16[j]) &&
+              segs16[j].data() >= input16.data() &&
+              segs16[j].data() + segs16[j].size() <= input16.data() + input16.size();
+          }
+          if(!ok){
+            std::cerr << "test error: testUtf16() " << input << std::endl;
+            return false;
+          }
+        }
+      }
+      // Surrogate pairs, lone surrogates and a sentinel codepoint stay in
+      // the segmentes.
+      tinysegmenterxx::Segmenter sg;
+      const char16_t input[] = {
+        0x65E5, 0x672C, 0xD83D, 0xDE00, 0x8A9E, 0xDC00, 0x3067, 0xDBFF, 0xDFF0,
+        0x3059, 0xD800
+      };
+      tinysegmenterxx::Segmentes16 segs16;
+      sg.segment(input, 11, segs16);
+      std::u16string joined;
+      for(size_t j = 0; j < segs16.size(); ++j) joined.append(segs16[j]);
+      if(joined != std::u16string(input, 11)){
+        std::cerr << "test error: testUtf16() surrogates" << std::endl;
+        return false;
+      }
+      return true;
+    }
+
+    /*!
+      @brief This method is used in order to compare the boundaries of
+      codepoint input with the segmentes of the same input in utf-8.
+     */
+    bool testCodepoints()
+    {
+      std::cerr << "Start Codepoints TEST" << std::endl;
+      for(int e = tinysegmenterxx::ENGINE_GPERF; e <= tinysegmenterxx::ENGINE_BOUNDED; e++){
+        tinysegmenterxx::Segmenter sg((tinysegmenterxx::ScoreEngine)e);
+        for(unsigned int i = 1; i < CHAR_MAX_SIZ; i += 7){
+          std::string input = createRandomString(i);
+          std::vector<uint32_t> ary(input.size() + 1);
+          size_t num = tinysegmenterxx::util::decodeUtf8(input.data(), input.size(),
+                                                         &ary[0], NULL);
+          std::u32string input32(ary.begin(), ary.begin() + num);
+          tinysegmenterxx::Segmentes segs;
+          tinysegmenterxx::Boundaries ends;
+          tinysegmenterxx::Boundaries ends32;
+          sg.segment(input, segs);
+          sg.segment(&ary[0], num, ends);
+          sg.segment(input32.data(), num, ends32);
+          bool ok = segs.size() == ends.size() && ends == ends32;
+          uint32_t begin = 0;
+          for(size_t j = 0; ok && j < segs.size(); ++j){
+            std::vector<uint32_t> seg(segs[j].size() + 1);
+            ok = tinysegmenterxx::util::decodeUtf8(segs[j].data(), segs[j].size(),
+                                                   &seg[0], NULL) == ends[j] - begin;
+            begin = ends[j];
+          }
+          if(!ok || begin != num){
+            std::cerr << "test error: testCodepoints() " << input << std::endl;
+            return false;
+          }
+        }
+      }
+      tinysegmenterxx::Segmenter sg;
+      const uint32_t input[] = {0x65E5, 0x10FFF0, 0x10FFF4, 0x8A9E, 0xFFFFFFFF, 0x3067};
+      tinysegmenterxx::Boundaries ends;
+      sg.segment(input, 6, ends);
+      if(ends.empty() || ends.back() != 6){
+        std::cerr << "test error: testCodepoints() sentinels" << std::endl;
+        return false;
+      }
+      return true;
+    }
+
+    /*!
+      @brief This method is used in order to compare the segmentes of random
+      JIS X 0208 text in Shift_JIS and EUC-JP with those of the same text in
+      utf-8, and check that the segmentes in the original encoding cover the
+      input, broken bytes too.
+     */
+    bool testLegacyEncodings()
+    {
+      std::cerr << "Start Legacy Encodings TEST" << std::endl;
+      // Bytes made by iconv -t SHIFT_JIS and -t EUC-JP, apart from JIS0208_CODES.
+      static const char* vectors[][3] = {
+        {"\x93\xfa\x96\x7b\x8c\xea", "\xc6\xfc\xcb\xdc\xb8\xec", "日本語"},
+        {"\x83\x41", "\xa5\xa2", "ア"},
+        {"\xb1\xdd", "\x8e\xb1\x8e\xdd", "ｱﾝ"},
+        {"\x81\x75\x81\x5b\x81\x76", "\xa1\xd6\xa1\xbc\xa1\xd7", "「ー」"},
+        {"\xea\xa4", "\xf4\xa6", "熙"},
+        {"\x41\x82\xa0\x31", "\x41\xa4\xa2\x31", "Aあ1"}
+      };
+      for(size_t n = 0; n < sizeof(vectors) / sizeof(vectors[0]); ++n){
+        uint32_t expected[8], fromSjis[8], fromEuc[8];
+        const char* sjis = vectors[n][0];
+        const char* euc = vectors[n][1];
+        size_t num = tinysegmenterxx::util::decodeUtf8Scalar(vectors[n][2],
+                                                             std::strlen(vectors[n][2]),
+                                                             expected, NULL);
+        bool ok = tinysegmenterxx::util::decodeShiftJis(sjis, std::strlen(sjis),
+                                                        fromSjis, NULL) == num &&
+          tinysegmenterxx::util::decodeEucJp(euc, std::strlen(euc), fromEuc, NULL) == num &&
+          std::equal(expected, expected + num, fromSjis) &&
+          std::equal(expected, expected + num, fromEuc);
+        if(!ok){
+          std::cerr << "test error: testLegacyEncodings() " << vectors[n][2] << std::endl;
+          return false;
+        }
+      }
+      tinysegmenterxx::Segmenter sg;
+      for(int n = 0; n < 2000; ++n){
+        std::string utf8, sjis, euc;
+        int cnum = createRandomInt(1, 40);
+        for(int i = 0; i < cnum; ++i){
+          uint32_t c;
+          int kind = createRandomInt(0, 9);
+          if(kind == 0){
+            c = createRandomInt('A', 'z');
+            sjis.push_back(c);
+            euc.push_back(c);
+          } else if(kind == 1){
+            int b = createRandomInt(0xA1, 0xDF);
+            c = 0xFF61 + b - 0xA1;
+            sjis.push_back(b);
+            euc.push_back((char)0x8E);
+            euc.push_back(b);
+          } else {
+            int row, cell;
+            do {
+              row = createRandomInt(0, 93);
+              cell = createRandomInt(0, 93);
+              c = tinysegmenterxx::util::jis::JIS0208_CODES[row * 94 + cell];
+            } while(c == 0);
+            euc.push_back(0xA1 + row);
+            euc.push_back(0xA1 + cell);
+            sjis.push_back(row < 62 ? 0x81 + row / 2 : 0xC1 + row / 2);
+            sjis.push_back(row % 2 ? 0x9F + cell : 0x40 + cell + (cell >= 63));
+          }
+          char utf[5];
+          tinysegmenterxx::util::ucstoutf(&c, 1, utf);
+          utf8.append(utf);
+        }
+        tinysegmenterxx::Segmentes expected, fromSjis, fromEuc, sjisSegs, eucSegs;
+        sg.segment(utf8, expected);
+        sg.segment(sjis, tinysegmenterxx::ENCODING_SJIS, fromSjis, true);
+        sg.segment(euc, tinysegmenterxx::ENCODING_EUCJP, fromEuc, true);
+        if(n % 2) sjis.append(createRandomBytes(createRandomInt(1, 3)));
+        if(n % 2) euc.append(createRandomBytes(createRandomInt(1, 3)));
+        sg.segment(sjis, tinysegmenterxx::ENCODING_SJIS, sjisSegs);
+        sg.segment(euc, tinysegmenterxx::ENCODING_EUCJP, eucSegs);
+        std::string sjisJoined, eucJoined;
+        for(size_t i = 0; i < sjisSegs.size(); ++i) sjisJoined.append(sjisSegs[i]);
+        for(size_t i = 0; i < eucSegs.size(); ++i) eucJoined.append(eucSegs[i]);
+        if(fromSjis != expected || fromEuc != expected ||
+           sjisJoined != sjis || eucJoined != euc){
+          std::cerr << "test error: testLegacyEncodings() " << utf8 << std::endl;
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /*!
+      @brief This method is used in order to check that a model built with
+      ModelBuilder::setFoldWidth gives half-width and full-width forms of
+      charcters the IDs of the canonical ones and scores canonical windows
+      like an unfolded model, even with keys only in other width forms, and
+      that the compiled in model does not fold, so that every engine
+      segments them like ENGINE_GPERF.
+     */
+    bool testWidthFolding()
+    {
+      std::cerr << "Start Width Folding TEST" << std::endl;
+      tinysegmenterxx::model::ModelBuilder plainBuilder;
+      tinysegmenterxx::model::ModelBuilder builder;
+      builder.setFoldWidth(true);
+      for(int i = 0; i < TOTAL_KEYWORDS; ++i){
+        plainBuilder.add(wordlist[i].key, wordlist[i].val);
+        builder.add(wordlist[i].key, wordlist[i].val);
+      }
+      // Keys only in half-width or full-width forms.
+      const char* variantKeys[] = {"UW4__\xef\xbd\xa6", "UW3__\xef\xbc\xa1",
+                                   "BW2__\xef\xbd\xb1\xef\xbd\xb2"};
+      for(int i = 0; i < 3; ++i){
+        plainBuilder.add(variantKeys[i], 3000);
+        builder.add(variantKeys[i], 3000);
+      }
+      plainBuilder.build();
+      builder.build();
+      tinysegmenterxx::model::FeatureModel plain(plainBuilder.getTables());
+      tinysegmenterxx::model::FeatureModel folded(builder.getTables());
+      const tinysegmenterxx::model::FeatureModel& m =
+        tinysegmenterxx::model::getFeatureModel();
+      const tinysegmenterxx::model::CharClassMap& map =
+        tinysegmenterxx::model::getDefaultCharClassMap();
+      std::vector<uint32_t> variants(0x10000, 0);
+      bool unfolded = false;
+      for(uint32_t c = 0; c < 0x10000; ++c){
+        uint32_t f = tinysegmenterxx::util::foldWidth(c);
+        if(f == c) continue;
+        if(folded.getCharId(c) != folded.getCharId(f)){
+          std::cerr << "test error: testWidthFolding() id " << c << std::endl;
+          return false;
+        }
+        if(m.getCharId(c) != m.getCharId(f)) unfolded = true;
+        if(map.getClass(c) == map.getClass(f)) variants[f] = c;
+      }
+      if(!unfolded){
+        std::cerr << "test error: testWidthFolding() compiled" << std::endl;
+        return false;
+      }
+      for(int id = tinysegmenterxx::model::CHARID_FIRST; id < folded.getCharNum(); ++id){
+        uint32_t c = folded.getCharCode(id);
+        if(tinysegmenterxx::util::foldWidth(c) != c){
+          std::cerr << "test error: testWidthFolding() code " << c << std::endl;
+          return false;
+        }
+      }
+      for(int n = 0; n < 100000; ++n){
+        int w1[6], w2[6], c[6];
+        for(int i = 0; i < 6; ++i){
+          int id = createRandomInt(0, plain.getCharNum() - 1);
+          if(id < tinysegmenterxx::model::CHARID_FIRST){
+            w1[i] = w2[i] = id;
+          } else {
+            uint16_t code = tinysegmenterxx::util::foldWidth(plain.getCharCode(id));
+            w1[i] = plain.getCharId(code);
+            w2[i] = folded.getCharId(code);
+          }
+          c[i] = createRandomInt(0, tinysegmenterxx::model::CLASS_NUM - 1);
+        }
+        int p1 = createRandomInt(0, 2);
+        int p2 = createRandomInt(0, 2);
+        int p3 = createRandomInt(0, 2);
+        if(plain.getScore(w1, c, p1, p2, p3) != folded.getScore(w2, c, p1, p2, p3)){
+          std::cerr << "test error: testWidthFolding() score" << std::endl;
+          return false;
+        }
+      }
+      tinysegmenterxx::Segmenter ref(tinysegmenterxx::ENGINE_GPERF);
+      for(unsigned int i = 1; i < CHAR_MAX_SIZ; i += 7){
+        std::string input = i % 2 ? createRandomString(i) : createRandomModelString(i);
+        std::vector<uint32_t> ary(input.size() + 1);
+        size_t num = tinysegmenterxx::util::decodeUtf8(input.data(), input.size(),
+                                                       &ary[0], NULL);
+        for(size_t j = 0; j < num; ++j){
+          if(ary[j] < 0x10000 && variants[ary[j]] && createRandomInt(0, 1))
+            ary[j] = variants[ary[j]];
+        }
+        tinysegmenterxx::Boundaries expected;
+        ref.segment(&ary[0], num, expected);
+        for(int e = tinysegmenterxx::ENGINE_FEATURE_ID; e <= tinysegmenterxx::ENGINE_BOUNDED; e++){
+          tinysegmenterxx::Segmenter sg((tinysegmenterxx::ScoreEngine)e);
+          tinysegmenterxx::Boundaries ends;
+          sg.segment(&ary[0], num, ends);
+          if(ends != expected){
+            std::cerr << "test error: testWidthFolding() " << e << " " << input << std::endl;
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    /*!
+      @brief This method is used in order to compare SegmentViews with
+      Segmentes, and check that the views follow one another in the input,
+      broken bytes too.
+     */
+    bool testSegmentViews()
+    {
+      std::cerr << "Start Segment Views TEST" << std::endl;
+      for(int e = tinysegmenterxx::ENGINE_GPERF; e <= tinysegmenterxx::ENGINE_BOUNDED; e++){
+        tinysegmenterxx::Segmenter sg((tinysegmenterxx::ScoreEngine)e);
+        for(unsigned int i = 1; i < CHAR_MAX_SIZ; i += 7){
+          std::string input = createRandomString(i);
+          if(i % 3 == 0) input.append(createRandomBytes(createRandomInt(1, 4)));
+          tinysegmenterxx::Segmentes segs;
+          tinysegmenterxx::SegmentViews views;
+          sg.segment(input, segs);
+          sg.segment(std::string_view(input), views);
+          bool ok = segs.size() == views.size();
+          const char* rp = input.data();
+          for(size_t j = 0; ok && j < views.size(); ++j){
+            ok = views[j].data() == rp && (i % 3 == 0 || views[j] == segs[j]);
+            rp += views[j].size();
+          }
+          if(!ok || rp > input.data() + input.size()){
+            std::cerr << "test error: testSegmentViews() " << input << std::endl;
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    /*! @brief A sink counting segmentes and their bytes. */
+    struct CountSink {
+      size_t num;
+      size_t bytes;
+
+      void operator()(std::string_view word)
+      {
+        num++;
+        bytes += word.size();
+      }
+    };
+
+    /*!
+      @brief This method is used in order to compare the segmentes given to
+      a sink with SegmentViews.
+     */
+    bool testSegmentSink()
+    {
+      std::cerr << "Start Segment Sink TEST" << std::endl;
+      for(int e = tinysegmenterxx::ENGINE_GPERF; e <= tinysegmenterxx::ENGINE_BOUNDED; e++){
+        tinysegmenterxx::Segmenter sg((tinysegmenterxx::ScoreEngine)e);
+        for(unsigned int i = 1; i < CHAR_MAX_SIZ; i += 7){
+          std::string input = createRandomString(i);
+          if(i % 3 == 0) input.append(createRandomBytes(createRandomInt(1, 4)));
+          tinysegmenterxx::SegmentViews views;
+          tinysegmenterxx::SegmentViews sunk;
+          CountSink count = {0, 0};
+          sg.segment(std::string_view(input), views);
+          sg.segment(input, [&](std::string_view word){ sunk.push_back(word); });
+          sg.segment(input, count);
+          size_t bytes = 0;
+          for(size_t j = 0; j < views.size(); ++j) bytes += views[j].size();
+          if(sunk != views || count.num != views.size() || count.bytes != bytes){
+            std::cerr << "test error: testSegmentSink() " << input << std::endl;
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    /*!
+      @brief This method is used in order to compare the segmentes of
+      Segmenter::tokens with SegmentViews, and check that reading the first
+      ones scores only the windows up to them.
+     */
+    bool testTokens()
+    {
+      std::cerr << "Start Tokens TEST" << std::endl;
+      for(int e = tinysegmenterxx::ENGINE_GPERF; e <= tinysegmenterxx::ENGINE_BOUNDED; e++){
+        tinysegmenterxx::Segmenter sg((tinysegmenterxx::ScoreEngine)e);
+        for(unsigned int i = 0; i < CHAR_MAX_SIZ; i += 7){
+          std::string input = createRandomString(i);
+          if(i % 3 == 0) input.append(createRandomBytes(createRandomInt(0, 4)));
+          tinysegmenterxx::SegmentViews views;
+          sg.segment(std::string_view(input), views);
+          tinysegmenterxx::SegmentViews tokens;
+          tinysegmenterxx::Segmenter::TokenRange range = sg.tokens(input);
+          for(std::string_view token : range) tokens.push_back(token);
+          tinysegmenterxx::Segmenter::TokenRange::iterator it = range.begin();
+          tinysegmenterxx::Segmenter::TokenRange::iterator copy = it;
+          bool ok = tokens == views;
+          for(size_t j = 0; ok && it != range.end(); ++j, ++it){
+            ok = *it == views[j];
+          }
+          for(size_t j = 0; ok && copy != range.end(); ++j){
+            ok = *copy++ == views[j];
+          }
+          // An iterator outlives the range it was taken from.
+          tinysegmenterxx::Segmenter::TokenRange::iterator last = range.end();
+          tinysegmenterxx::Segmenter::TokenRange::iterator first = sg.tokens(input).begin();
+          for(size_t j = 0; ok && first != last; ++j, ++first){
+            ok = *first == views[j];
+          }
+          if(!ok){
+            std::cerr << "test error: testTokens() " << input << std::endl;
+            return false;
+          }
+        }
+      }
+      tinysegmenterxx::Segmenter sg(tinysegmenterxx::ENGINE_BOUNDED);
+      std::string input = createRandomKana(CHAR_MAX_SIZ);
+      tinysegmenterxx::Segmenter::TokenRange range = sg.tokens(input);
+      tinysegmenterxx::Segmenter::TokenRange::iterator it = range.begin();
+      // Three segmentes of kana, three bytes a charcter, one window each.
+      size_t len = (*it).size();
+      len += (*++it).size();
+      len += (*++it).size();
+      if(sg.getBoundStats().windows * 3 != len){
+        std::cerr << "test error: testTokens() windows "
+                  << sg.getBoundStats().windows << std::endl;
+        return false;
+      }
+      return true;
+    }
+
+    /*!
+      @brief This method is used in order to compare boundary bitmaps of
+      bytes with the ends of SegmentViews and bitmaps of charcters with
+      Boundaries, and the positions read back from them.
+     */
+    bool testBoundaryBitmap()
+    {
+      std::cerr << "Start Boundary Bitmap TEST" << std::endl;
+      for(int e = tinysegmenterxx::ENGINE_GPERF; e <= tinysegmenterxx::ENGINE_BOUNDED; e++){
+        tinysegmenterxx::Segmenter sg((tinysegmenterxx::ScoreEngine)e);
+        for(unsigned int i = 0; i < CHAR_MAX_SIZ; i += 7){
+          std::string input = createRandomString(i);
+          if(i % 3 == 0) input.append(createRandomBytes(createRandomInt(0, 4)));
+          size_t wordNum = tinysegmenterxx::util::getBitmapWordNum(input.size());
+          std::vector<uint64_t> bits(wordNum, ~(uint64_t)0);
+          std::vector<uint64_t> charBits(wordNum, ~(uint64_t)0);
+          std::vector<uint32_t> ary(input.size() + 1);
+          size_t num = tinysegmenterxx::util::decodeUtf8(input.data(), input.size(),
+                                                         &ary[0], NULL);
+          tinysegmenterxx::SegmentViews views;
+          tinysegmenterxx::Boundaries ends;
+          sg.segment(std::string_view(input), views);
+          sg.segment(&ary[0], num, ends);
+          sg.segment(input, &bits[0]);
+          sg.segment(&ary[0], num, &charBits[0]);
+          tinysegmenterxx::Boundaries viewEnds;
+          for(size_t j = 0; j < views.size(); ++j){
+            viewEnds.push_back(views[j].data() + views[j].size() - input.data());
+          }
+          tinysegmenterxx::Boundaries positions(input.size() + 1);
+          tinysegmenterxx::Boundaries charPositions(input.size() + 1);
+          positions.resize(tinysegmenterxx::util::getBitPositions(&bits[0], wordNum,
+                                                                  &positions[0]));
+          charPositions.resize(tinysegmenterxx::util::getBitPositions(
+                                 &charBits[0], tinysegmenterxx::util::getBitmapWordNum(num),
+                                 &charPositions[0]));
+          bool ok = positions == viewEnds && charPositions == ends &&
+            tinysegmenterxx::util::countBits(&bits[0], wordNum) == positions.size() &&
+            tinysegmenterxx::util::selectBit(&bits[0], wordNum, positions.size()) ==
+            (size_t)-1;
+          for(size_t j = 0; ok && j < positions.size(); ++j){
+            ok = tinysegmenterxx::util::selectBit(&bits[0], wordNum, j) == positions[j] &&
+              tinysegmenterxx::util::getBit(&bits[0], positions[j]);
+          }
+          if(!ok){
+            std::cerr << "test error: testBoundaryBitmap() " << input << std::endl;
+            return false;
+          }
+        }
+        const std::string singles[] = {std::string("a\0xyz", 5),
+                                       std::string("\xe3\x81\x82\0\xe3\x81\x84", 7)};
+        const size_t singleEnds[] = {1, 3};
+        for(int j = 0; j < 2; ++j){
+          std::vector<uint64_t> bits(tinysegmenterxx::util::getBitmapWordNum(singles[j].size()));
+          sg.segment(singles[j], &bits[0]);
+          tinysegmenterxx::Boundaries positions(singles[j].size() + 1);
+          positions.resize(tinysegmenterxx::util::getBitPositions(&bits[0], bits.size(),
+                                                                  &positions[0]));
+          if(positions != tinysegmenterxx::Boundaries(1, singleEnds[j])){
+            std::cerr << "test error: testBoundaryBitmap() single " << j << std::endl;
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    /*!
+      @brief This method is used in order to compare a TokenBuffer with
+      Segmentes, and check that a cleared buffer is filled again with no
+      allocation.
+     */
+    bool testTokenBuffer()
+    {
+      std::cerr << "Start Token Buffer TEST" << std::endl;
+      tinysegmenterxx::TokenBuffer buffer;
+      for(int e = tinysegmenterxx::ENGINE_GPERF; e <= tinysegmenterxx::ENGINE_BOUNDED; e++){
+        tinysegmenterxx::Segmenter sg((tinysegmenterxx::ScoreEngine)e);
+        for(unsigned int i = 0; i < CHAR_MAX_SIZ; i += 7){
+          std::string input = createRandomString(i);
+          if(i % 3 == 0) input.append(createRandomBytes(createRandomInt(0, 4)));
+          tinysegmenterxx::Encoding encoding = i % 2 ? tinysegmenterxx::ENCODING_UTF8 :
+            tinysegmenterxx::ENCODING_SJIS;
+          bool transcode = i % 4 == 0;
+          tinysegmenterxx::Segmentes segs;
+          sg.segment(input, encoding, segs, transcode);
+          buffer.clear();
+          sg.segment(input, encoding, buffer, transcode);
+          const char* arena = buffer.getArena().data();
+          buffer.clear();
+          sg.segment(input, encoding, buffer, transcode);
+          bool ok = buffer.size() == segs.size() && buffer.getArena().data() == arena;
+          for(size_t j = 0; ok && j < segs.size(); ++j){
+            ok = buffer[j] == segs[j];
+          }
+          if(!ok){
+            std::cerr << "test error: testTokenBuffer() " << input << std::endl;
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    /*!
+      @brief This method is used in order to check that segmenting into a
+      TokenBuffer again, after the buffers have grown, calls no operator new
+      with any engine.
+     */
+    bool testNoAllocation()
+    {
+      std::cerr << "Start No Allocation TEST" << std::endl;
+      std::vector<std::string> inputs;
+      for(unsigned int i = 0; i < CHAR_MAX_SIZ; i += 7){
+        inputs.push_back(i % 2 ? createRandomString(i) : createRandomModelString(i));
+      }
+      for(int e = tinysegmenterxx::ENGINE_GPERF; e <= tinysegmenterxx::ENGINE_BOUNDED; e++){
+        tinysegmenterxx::Segmenter sg((tinysegmenterxx::ScoreEngine)e);
+        tinysegmenterxx::TokenBuffer buffer;
+        for(size_t i = 0; i < inputs.size(); ++i){
+          buffer.clear();
+          sg.segment(inputs[i], buffer);
+        }
+        size_t before = allocNum;
+        for(int n = 0; n < 3; ++n){
+          for(size_t i = 0; i < inputs.size(); ++i){
+            buffer.clear();
+            sg.segment(inputs[i], buffer);
+          }
+        }
+        if(allocNum != before){
+          std::cerr << "test error: testNoAllocation() " << e << " "
+                    << allocNum - before << std::endl;
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /*!
+      @brief This method is used in order to check that Segmenter objects
+      can be copied, assigned and kept in a vector, and that copies segment
+      apart from each other.
+     */
+    bool testSegmenterCopy()
+    {
+      std::cerr << "Start Segmenter Copy TEST" << std::endl;
+      tinysegmenterxx::Segmenter sg;
+      std::vector<tinysegmenterxx::Segmenter> sgs(3, sg);
+      sgs.push_back(tinysegmenterxx::Segmenter(tinysegmenterxx::ENGINE_BOUNDED));
+      for(unsigned int i = 1; i < CHAR_MAX_SIZ; i += 7){
+        std::string input1 = createRandomString(i);
+        std::string input2 = createRandomString(i);
+        tinysegmenterxx::Segmentes expected1, expected2;
+        sg.segment(input1, expected1);
+        sg.segment(input2, expected2);
+        tinysegmenterxx::Segmenter copy(sg);
+        copy = sgs[i % sgs.size()];
+        tinysegmenterxx::SegmentViews views1, views2;
+        sgs[i % sgs.size()].segment(std::string_view(input1), views1);
+        copy.segment(std::string_view(input2), views2);
+        bool ok = views1.size() == expected1.size() && views2.size() == expected2.size();
+        for(size_t j = 0; ok && j < views1.size(); ++j) ok = views1[j] == expected1[j];
+        for(size_t j = 0; ok && j < views2.size(); ++j) ok = views2[j] == expected2[j];
+        if(!ok){
+          std::cerr << "test error: testSegmenterCopy() " << input1 << std::endl;
+          return false;
+        }
+      }
+      return true;
+    }
+
     bool testKatakana()
     {
       std::cerr << "Start Katakana TEST" << std::endl;
@@ -297,6 +1336,26 @@ int main()
   if(!tinysegmenterxx::test::testAlphabet()) ok = false;
   if(!tinysegmenterxx::test::testNumber()) ok = false;
   if(!tinysegmenterxx::test::testRandomString()) ok = false;
+  if(!tinysegmenterxx::test::testEngine(tinysegmenterxx::ENGINE_FEATURE_ID)) ok = false;
+  if(!tinysegmenterxx::test::testEngine(tinysegmenterxx::ENGINE_DENSE)) ok = false;
+  if(!tinysegmenterxx::test::testEngine(tinysegmenterxx::ENGINE_BOUNDED)) ok = false;
+  if(!tinysegmenterxx::test::testBoundStats()) ok = false;
+  if(!tinysegmenterxx::test::testWindowCache()) ok = false;
+  if(!tinysegmenterxx::test::testModelBuilder()) ok = false;
+  if(!tinysegmenterxx::test::testDecoder()) ok = false;
+  if(!tinysegmenterxx::test::testCharBuffer()) ok = false;
+  if(!tinysegmenterxx::test::testCharClassMap()) ok = false;
+  if(!tinysegmenterxx::test::testUtf16()) ok = false;
+  if(!tinysegmenterxx::test::testCodepoints()) ok = false;
+  if(!tinysegmenterxx::test::testLegacyEncodings()) ok = false;
+  if(!tinysegmenterxx::test::testWidthFolding()) ok = false;
+  if(!tinysegmenterxx::test::testSegmentViews()) ok = false;
+  if(!tinysegmenterxx::test::testSegmentSink()) ok = false;
+  if(!tinysegmenterxx::test::testTokens()) ok = false;
+  if(!tinysegmenterxx::test::testBoundaryBitmap()) ok = false;
+  if(!tinysegmenterxx::test::testTokenBuffer()) ok = false;
+  if(!tinysegmenterxx::test::testNoAllocation()) ok = false;
+  if(!tinysegmenterxx::test::testSegmenterCopy()) ok = false;
 
   return !ok;
 
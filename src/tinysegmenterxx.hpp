@@ -17,6 +17,11 @@
 #define TINYSEGMENTERXX_TINYSEGMENTERXX_H
 
 #include <vector>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <iterator>
+#include <cstddef>
 #include <iostream>
 #include <fstream>
 #include <cstring>
@@ -24,6 +29,12 @@
 #include <cstdlib>
 #include <stdint.h>
 #include "tinysegmenterxx_train.hpp"
+#include "tinysegmenterxx_model.hpp"
+#include "tinysegmenterxx_tables.hpp"
+#include "tinysegmenterxx_cache.hpp"
+#include "tinysegmenterxx_decode.hpp"
+#include "tinysegmenterxx_class.hpp"
+#include "tinysegmenterxx_bits.hpp"
 
 #ifdef HAVE_CONFIG_H
 #include "../config.h"
@@ -33,9 +44,134 @@
 
 namespace tinysegmenterxx {
 
+  namespace model {
+
+    /*!
+      @brief This method is used in order to get the model shared by every
+      Segmenter, the one of tools/train compiled in.
+     */
+    inline const FeatureModel& getFeatureModel()
+    {
+      static constexpr FeatureModel model(tables::TABLES);
+      return model;
+    }
+  }
+
   /*! @brief The vector object for storing segment result. */
   typedef std::vector<std::string> Segmentes;
 
+  /*!
+    @brief The vector object for storing segment result of utf-16 input,
+    views of the input.
+   */
+  typedef std::vector<std::u16string_view> Segmentes16;
+
+  /*!
+    @brief The vector object for storing segment result as views of the
+    input, the bytes of every segment in the encoding of the input.
+   */
+  typedef std::vector<std::string_view> SegmentViews;
+
+  /*!
+    @brief The vector object for storing segment result of codepoint input,
+    the end of every segment as the index of the codepoint after it. The
+    last one is the number of codepoints.
+   */
+  typedef std::vector<uint32_t> Boundaries;
+
+  /*!
+    @brief The positions of a boundary bitmap, the charcters like Boundaries
+    or the bytes of the input like the ends of SegmentViews.
+   */
+  enum BitmapUnit {
+    BITMAP_CHARS, BITMAP_BYTES
+  };
+
+  /*!
+    @brief The container for storing segment result with no allocation per
+    segment, indexable like Segmentes: the bytes of every segment one after
+    another in one string, and the end of every segment in it. clear keeps
+    the capacity, so a buffer reused between calls stops allocating once it
+    has grown to the largest result.
+   */
+  class TokenBuffer {
+
+  public:
+    TokenBuffer() : bytes(), ends(){}
+
+    size_t size() const
+    {
+      return ends.size();
+    }
+
+    bool empty() const
+    {
+      return ends.empty();
+    }
+
+    /*! @brief The bytes of a segment, valid until the buffer is changed. */
+    std::string_view operator[](size_t i) const
+    {
+      uint32_t begin = i ? ends[i - 1] : 0;
+      return std::string_view(bytes.data() + begin, ends[i] - begin);
+    }
+
+    std::string_view back() const
+    {
+      return (*this)[ends.size() - 1];
+    }
+
+    void push_back(std::string_view word)
+    {
+      bytes.append(word.data(), word.size());
+      ends.push_back(bytes.size());
+    }
+
+    void pop_back()
+    {
+      ends.pop_back();
+      bytes.resize(ends.empty() ? 0 : ends.back());
+    }
+
+    /*!
+      @brief This method is used in order to get the bytes of every
+      segment. Bytes appended to it make a segment with endWord.
+     */
+    std::string& getArena()
+    {
+      return bytes;
+    }
+
+    const std::string& getArena() const
+    {
+      return bytes;
+    }
+
+    /*! @brief End the segment of the bytes appended since the last one. */
+    void endWord()
+    {
+      ends.push_back(bytes.size());
+    }
+
+    void reserve(size_t byteNum, size_t num)
+    {
+      bytes.reserve(byteNum);
+      ends.reserve(num);
+    }
+
+    /*! @brief Remove every segment, keeping the capacity. */
+    void clear()
+    {
+      bytes.clear();
+      ends.clear();
+    }
+
+  private:
+    std::string bytes;
+
+    std::vector<uint32_t> ends;
+  };
+
   const unsigned int INPUT_MAX_BUF_SIZ = 65536;
   const unsigned int GETSCORE_BUF_SIZ  = 65536;
   const unsigned int SEGMENT_STACK_SIZ = 6;
@@ -110,41 +246,13 @@ namespace tinysegmenterxx {
       - Number          : "N"
       - Kana            : "I"
       - Katakana        : "K"
-      - Number in Kanji : "M"
-      - Kanji           : "H"
+      - Kanji           : "H", numbers in Kanji too
       - Other           : "O"
+      The classes are looked up in model::getDefaultCharClassMap.
      */
-    const char* getCharClass(uint16_t c)
-    {
-      const char* rv = O__;
-      if (c <= 0x007F ) {
-        // ASCII
-        if(c >= 'a' && c <= 'z'){
-          rv = A__;
-        } else if(c >= 'A' && c <= 'Z'){
-          rv = A__;
-        } else if(c >= '0' && c <= '9'){
-          rv = N__;
-        }
-      } else if (c >= 0x3040 && c <= 0x309F) {
-        // Kana
-        rv = I__;
-      } else if (c >= 0x30A0 && c <= 0x30FA) {
-        // Katakana
-        rv = K__;
-      } else if (c >= 0x4E00 && c <= 0x9FFF) {
-        // Kanji
-        if(c == 0x4E00 || c == 0x4E8C || c == 0x4E09 || c == 0x56DB ||
-           c == 0x4E94 || c == 0x516D || c == 0x4E03 || c == 0x516B ||
-           c == 0x4E5D || c == 0x5341 || c == 0x767E || c == 0x5343 ||
-           c == 0x4E07 || c == 0x5104 || c == 0x5146){
-          rv = M__;
-        }
-        rv = H__;
-      } else {
-        rv = O__;
-      }
-      return rv;
+    const char* getCharClass(uint32_t c)
+    {
+      return model::getClassName(model::getDefaultCharClassMap().getClass(c));
     }
 
     /*!
@@ -152,8 +260,10 @@ namespace tinysegmenterxx {
       @param str : The pointer to the utf charcters.
       @param ary : The region for stroing the unicode charcters.
       @param np  : The pointer for storing num of charcters.
+      @attention T is uint16_t or uint32_t. Four byte charcters are skipped.
      */
-    void utftoucs(const char *str, uint16_t *ary, int *np)
+    template<class T>
+    void utftoucs(const char *str, T *ary, int *np)
     {
       const unsigned char *rp = (unsigned char *)str;
       unsigned int wi = 0;
@@ -182,8 +292,11 @@ namespace tinysegmenterxx {
       @param ary  : The pointer to the unicode charcters.
       @param num  : Number of charcters in ary.
       @param str  : The region for storing utf charcters.
+      @attention T is uint16_t or uint32_t. Charcters above U+FFFF take four
+      bytes in str.
      */
-    int ucstoutf(const uint16_t *ary, int num, char *str)
+    template<class T>
+    int ucstoutf(const T *ary, int num, char *str)
     {
       unsigned char *wp = (unsigned char *)str;
       for(int i = 0; i < num; i++){
@@ -193,10 +306,15 @@ namespace tinysegmenterxx {
         } else if(c < 0x800){
           *(wp++) = 0xc0 | (c >> 6);
           *(wp++) = 0x80 | (c & 0x3f);
-        } else {
+        } else if(c < 0x10000){
           *(wp++) = 0xe0 | (c >> 12);
           *(wp++) = 0x80 | ((c & 0xfff) >> 6);
           *(wp++) = 0x80 | (c & 0x3f);
+        } else {
+          *(wp++) = 0xf0 | (c >> 18);
+          *(wp++) = 0x80 | ((c >> 12) & 0x3f);
+          *(wp++) = 0x80 | ((c >> 6) & 0x3f);
+          *(wp++) = 0x80 | (c & 0x3f);
         }
       }
       *wp = '\0';
@@ -211,16 +329,335 @@ namespace tinysegmenterxx {
     }
   }
 
+  /*!
+    @brief Structure of arrays filled in one pass over the input: the
+    codepoint, class code and character ID of every charcter between the
+    sentinels, and the byte offset of every charcter of the input. The
+    scoring loops read only these arrays, and words are copied from the
+    input by their offsets.
+   */
+  class CharBuffer {
+
+  public:
+    /*!
+      @brief Constructor of CharBuffer object.
+      @param featureModel : The model giving the character IDs.
+     */
+    explicit CharBuffer(const model::FeatureModel& featureModel) :
+      featureModel(&featureModel), classMap(&model::getDefaultCharClassMap()),
+      codes(), classes(), charIds(), offsets(), str(NULL), str16(NULL), num(0),
+      exact(true), exactChecked(true){}
+
+    /*!
+      @brief This method is used in order to set the class map of the
+      following fills.
+      @param map : The map, or NULL for model::getDefaultCharClassMap().
+      @return Return false, keeping the map, if map is not valid.
+     */
+    bool setCharClassMap(const model::CharClassMap* map)
+    {
+      if(map && !map->isValid()) return false;
+      classMap = map ? map : &model::getDefaultCharClassMap();
+      return true;
+    }
+
+    const model::CharClassMap& getCharClassMap() const
+    {
+      return *classMap;
+    }
+
+    /*!
+      @brief This method is used in order to decode, classify and look up
+      every charcter of str.
+      @param str : The pointer to the utf charcters. It must outlive the
+      use of the words of this object.
+      @param len : Number of bytes in str.
+      @return Number of charcters of the input.
+     */
+    int fill(const char* str, size_t len)
+    {
+      reserve(len);
+      this->str = str;
+      str16 = NULL;
+      num = util::decodeUtf8(str, len, &codes[model::SENTINEL_HEAD_NUM],
+                             &offsets[0]);
+      lookUp();
+      exactChecked = false;
+      return num;
+    }
+
+    /*!
+      @brief This method is used in order to decode, classify and look up
+      every charcter of str in any encoding.
+      @param str : The pointer to the charcters.
+      @param len : Number of bytes in str.
+      @param encoding : The encoding of str.
+      @param transcode : Whether getWord gives utf charcters instead of the
+      bytes of str. Words of utf-8 input are the bytes of str either way.
+      @return Number of charcters of the input.
+     */
+    int fill(const char* str, size_t len, Encoding encoding, bool transcode)
+    {
+      if(encoding == ENCODING_UTF8) return fill(str, len);
+      reserve(len);
+      this->str = str;
+      str16 = NULL;
+      if(encoding == ENCODING_SJIS){
+        num = util::decodeShiftJis(str, len, &codes[model::SENTINEL_HEAD_NUM],
+                                   &offsets[0]);
+      } else {
+        num = util::decodeEucJp(str, len, &codes[model::SENTINEL_HEAD_NUM],
+                                &offsets[0]);
+      }
+      lookUp();
+      exact = !transcode;
+      exactChecked = true;
+      return num;
+    }
+
+    /*!
+      @brief This method is used in order to decode, classify and look up
+      every charcter of utf-16 charcters, see util::decodeUtf16. The offsets
+      are then in code units.
+      @param str : The pointer to the utf-16 charcters. It must outlive the
+      use of the words of this object.
+      @param len : Number of code units in str.
+      @return Number of charcters of the input.
+     */
+    int fill(const char16_t* str, size_t len)
+    {
+      reserve(len);
+      this->str = NULL;
+      str16 = str;
+      num = util::decodeUtf16(str, len, &codes[model::SENTINEL_HEAD_NUM],
+                              &offsets[0]);
+      lookUp();
+      return num;
+    }
+
+    /*!
+      @brief This method is used in order to classify and look up every
+      codepoint of decoded charcters. Codepoints of the sentinels are taken
+      as the codepoint before them, which is classified the same.
+      @param str : The pointer to the codepoints, char32_t or uint32_t.
+      @param len : Number of codepoints in str.
+      @return len.
+     */
+    template<class T>
+    int fill(const T* str, size_t len)
+    {
+      reserve(len);
+      this->str = NULL;
+      str16 = NULL;
+      num = len;
+      uint32_t* ary = &codes[model::SENTINEL_HEAD_NUM];
+      for(size_t i = 0; i < len; ++i){
+        uint32_t c = str[i];
+        ary[i] = c >= model::SENTINEL_B2 && c <= model::SENTINEL_E3 ?
+          model::SENTINEL_B2 - 1 : c;
+        offsets[i] = i;
+      }
+      offsets[len] = len;
+      lookUp();
+      return num;
+    }
+
+    /*!
+      @brief This method is used in order to get the codepoints, beginning
+      with the B2 and B1 sentinels and ending with E1, E2 and E3.
+     */
+    const uint32_t* getCodes() const
+    {
+      return &codes[0];
+    }
+
+    /*! @brief The class codes, laid out like getCodes. */
+    const int* getClasses() const
+    {
+      return &classes[0];
+    }
+
+    /*! @brief The character IDs, laid out like getCodes. */
+    const int* getCharIds() const
+    {
+      return &charIds[0];
+    }
+
+    /*!
+      @brief This method is used in order to get the byte offset of every
+      charcter of the input, without the sentinels, and after the last one
+      the offset where decoding stopped.
+     */
+    const uint32_t* getOffsets() const
+    {
+      return &offsets[0];
+    }
+
+    /*!
+      @brief This method is used in order to get the charcters begin to
+      end - 1 of the input as utf charcters. They are copied from the input
+      unless some charcter was not decoded from its exact encoding. Words of
+      Shift_JIS and EUC-JP input are copied unless they are transcoded.
+     */
+    std::string getWord(int begin, int end) const
+    {
+      std::string word;
+      appendWord(begin, end, word);
+      return word;
+    }
+
+    /*! @brief The charcters of getWord, appended to word. */
+    void appendWord(int begin, int end, std::string& word) const
+    {
+      if(str && isExact()){
+        word.append(str + offsets[begin], offsets[end] - offsets[begin]);
+        return;
+      }
+      char utf[5];
+      for(int i = begin; i < end; ++i){
+        util::ucstoutf(&codes[i + model::SENTINEL_HEAD_NUM], 1, utf);
+        word.append(utf);
+      }
+    }
+
+    /*!
+      @brief This method is used in order to get the bytes of the charcters
+      begin to end - 1 of an input filled from bytes, with no copy.
+     */
+    std::string_view getWordView(int begin, int end) const
+    {
+      return std::string_view(str + offsets[begin], offsets[end] - offsets[begin]);
+    }
+
+    /*!
+      @brief This method is used in order to get the code units of the
+      charcters begin to end - 1 of an input filled as utf-16.
+     */
+    std::u16string_view getWord16(int begin, int end) const
+    {
+      return std::u16string_view(str16 + offsets[begin],
+                                 offsets[end] - offsets[begin]);
+    }
+
+  private:
+    const model::FeatureModel* featureModel;
+
+    const model::CharClassMap* classMap;
+
+    std::vector<uint32_t> codes;
+
+    std::vector<int> classes;
+
+    std::vector<int> charIds;
+
+    std::vector<uint32_t> offsets;
+
+    const char* str;
+
+    const char16_t* str16;
+
+    int num;
+
+    /*! @brief Whether words are copied from str, once exactChecked. */
+    mutable bool exact;
+
+    /*! @brief Whether exact is known for the charcters of the last fill. */
+    mutable bool exactChecked;
+
+    /*!
+      @brief This method is used in order to tell whether words are copied
+      from str. The charcters of utf-8 input are checked on the first call
+      after the fill, so outputs which never copy words do not pay for it.
+     */
+    bool isExact() const
+    {
+      if(exactChecked) return exact;
+      exactChecked = true;
+      exact = true;
+      for(int i = 0; i < num; ++i){
+        if(!util::isExactUtf8(str, codes[i + 2], offsets[i], offsets[i + 1])){
+          exact = false;
+          break;
+        }
+      }
+      return exact;
+    }
+
+    /*! @brief At most one charcter per code unit, between the sentinels. */
+    void reserve(size_t len)
+    {
+      if(codes.size() < len + model::SENTINEL_NUM){
+        codes.resize(len + model::SENTINEL_NUM);
+        classes.resize(len + model::SENTINEL_NUM);
+        charIds.resize(len + model::SENTINEL_NUM);
+        offsets.resize(len + 1);
+      }
+    }
+
+    /*!
+      @brief This method is used in order to put the sentinels around the
+      decoded charcters and get the class codes and IDs of all of them.
+     */
+    void lookUp()
+    {
+      uint32_t* ary = &codes[0];
+      ary[0] = model::SENTINEL_B2;
+      ary[1] = model::SENTINEL_B1;
+      ary[num + 2] = model::SENTINEL_E1;
+      ary[num + 3] = model::SENTINEL_E2;
+      ary[num + 4] = model::SENTINEL_E3;
+      int siz = num + model::SENTINEL_NUM;
+      classMap->getClasses(ary, siz, &classes[0]);
+      for(int i = 0; i < siz; ++i){
+        charIds[i] = featureModel->getCharId(ary[i]);
+      }
+    }
+  };
+
+  /*! @brief The scoring engines of Segmenter. */
+  enum ScoreEngine {
+    /*! String keys looked up in TrainHash, the original implementation. */
+    ENGINE_GPERF,
+    /*! Integer feature IDs looked up in model::FeatureModel. */
+    ENGINE_FEATURE_ID,
+    /*! Dense per character and per class tables, scored in a static pass
+      over the whole input and a sequential pass for the p-state features. */
+    ENGINE_DENSE,
+    /*! The tables of ENGINE_DENSE, read per window in descending order of
+      their largest score and only until the sign of the score is settled. */
+    ENGINE_BOUNDED
+  };
+
+  /*! @brief Lookup counts of ENGINE_BOUNDED. */
+  struct BoundStats {
+    /*! Number of windows scored. */
+    uint64_t windows;
+    /*! Number of terms read, at most model::TERM_NUM per window. */
+    uint64_t lookups;
+    /*! Number of terms skipped. */
+    uint64_t skipped;
+  };
+
   /*!
     @brief Class for getting segmentes from Japanese sentense.
+    A Segmenter keeps the charcters of the input it segments, so one object
+    must not segment in two threads at once: give every thread its own
+    Segmenter, or a copy of one. Copies are independent but for the window
+    cache set with setWindowCache, which they share.
    */
   class Segmenter {
 
   public:
     /*!
       @brief Constructor of Segmentr objetc.
+      @param engine : The scoring engine.
      */
-    Segmenter() : train(){}
+    Segmenter(ScoreEngine engine = ENGINE_DENSE) :
+      train(), featureModel(&model::getFeatureModel()), chars(*featureModel),
+      engine(engine), stats(), localCache(NULL), sharedCache(NULL), denseScores()
+    {
+      resetBoundStats();
+    }
 
     /*!
       @brief Destructor of Segmentr objetc.
@@ -237,100 +674,829 @@ namespace tinysegmenterxx {
      */
     void segment(const std::string& input, Segmentes& result)
     {
-      char seg[SEGMENT_STACK_SIZ][4];
-      char ctype[SEGMENT_STACK_SIZ][4];
+      segment(input, ENCODING_UTF8, result);
+    }
 
-      std::strcpy(seg[0], B2__);
-      std::strcpy(seg[1], B1__);
-      std::strcpy(ctype[0], O__);
-      std::strcpy(ctype[1], O__);
+    /*!
+      @brief This method is extract segmentes from Japanese sentense in
+      utf-8, Shift_JIS or EUC-JP, see util::decodeShiftJis and
+      util::decodeEucJp.
+      @param input : String object of input sentense.
+      @param encoding : The encoding of input.
+      @param result : The results of segment will be stored this object, in
+      the encoding of input.
+      @param transcode : Store the segmentes in utf-8 instead.
+     */
+    void segment(const std::string& input, Encoding encoding, Segmentes& result,
+                 bool transcode = false)
+    {
+      transcode = transcode && encoding != ENCODING_UTF8;
+      int anum = chars.fill(input.data(), input.size(), encoding, transcode);
+      if(anum == 1){
+        result.push_back(transcode ? chars.getWord(0, 1) : input);
+      } else if(anum > 1){
+        segmentChars(anum, result);
+      }
+    }
 
-      unsigned int inputSiz = input.size();
+    /*!
+      @brief This method is extract segmentes from Japanese sentense into a
+      TokenBuffer, the same segmentes as Segmentes. They are appended, so
+      clear a buffer before reusing it.
+      @param input : The utf-8 input sentense.
+      @param result : The results of segment will be stored this object.
+     */
+    void segment(std::string_view input, TokenBuffer& result)
+    {
+      segment(input, ENCODING_UTF8, result);
+    }
 
-      int stackSiz = inputSiz + 1;
-      uint16_t* ary = NULL;
-      if(inputSiz + 1 >= INPUT_MAX_BUF_SIZ){
-        stackSiz = 0;
-        ary = new uint16_t[inputSiz];
+    /*!
+      @brief This method is extract segmentes from Japanese sentense in
+      utf-8, Shift_JIS or EUC-JP into a TokenBuffer.
+      @param input : The input sentense.
+      @param encoding : The encoding of input.
+      @param result : The results of segment will be stored this object, in
+      the encoding of input.
+      @param transcode : Store the segmentes in utf-8 instead.
+     */
+    void segment(std::string_view input, Encoding encoding, TokenBuffer& result,
+                 bool transcode = false)
+    {
+      transcode = transcode && encoding != ENCODING_UTF8;
+      int anum = chars.fill(input.data(), input.size(), encoding, transcode);
+      if(anum == 1){
+        if(transcode){
+          chars.appendWord(0, 1, result.getArena());
+          result.endWord();
+        } else {
+          result.push_back(input);
+        }
+      } else if(anum > 1){
+        segmentChars(anum, result);
       }
-      uint16_t stack[stackSiz + 1];
-      if(!ary) ary = stack;
-      int anum;
-      util::utftoucs(input.c_str(), ary, &anum);
-      if(anum < 1) return;
+    }
+
+    /*!
+      @brief This method is extract segmentes from Japanese sentense as views
+      of the input, with no copy of any segment. A segment is the bytes its
+      charcters were decoded from, even bytes of no exact utf-8 charcter
+      which Segmentes would hold re-encoded.
+      @param input : The utf-8 input sentense. It must outlive the use of
+      result.
+      @param result : The results of segment will be stored this object.
+     */
+    void segment(std::string_view input, SegmentViews& result)
+    {
+      segment(input, ENCODING_UTF8, result);
+    }
+
+    /*!
+      @brief This method is extract segmentes from Japanese sentense in
+      utf-8, Shift_JIS or EUC-JP as views of the input.
+      @param input : The input sentense. It must outlive the use of result.
+      @param encoding : The encoding of input.
+      @param result : The results of segment will be stored this object.
+     */
+    void segment(std::string_view input, Encoding encoding, SegmentViews& result)
+    {
+      int anum = chars.fill(input.data(), input.size(), encoding, false);
       if(anum == 1){
         result.push_back(input);
-        return;
+      } else if(anum > 1){
+        segmentChars(anum, result);
       }
-      ary[anum] = 0x0000;
-      if(anum < 4){
-        for(int i = 0; i < anum; ++i){
-          uint16_t ucsChar = ary[i];
-          const uint16_t* ucsCharPtr = &ucsChar;
-          std::strcpy(ctype[i + 2], util::getCharClass(ucsChar));
-          util::ucstoutf(ucsCharPtr, 1, seg[i + 2]);
+    }
+
+    /*!
+      @brief This method is extract segmentes from Japanese sentense and
+      gives every segment to sink as soon as it is decided, as a view of the
+      input like SegmentViews. The sink is called inline, so segmentes can
+      be hashed or counted with no container between.
+      @param input : The utf-8 input sentense.
+      @param sink : Any callable taking a std::string_view, for example a
+      lambda. The views are valid while input is.
+     */
+    template<class Sink, class = typename std::enable_if<
+               std::is_invocable<Sink&, std::string_view>::value>::type>
+    void segment(std::string_view input, Sink&& sink)
+    {
+      segment(input, ENCODING_UTF8, sink);
+    }
+
+    /*!
+      @brief This method is extract segmentes from Japanese sentense in
+      utf-8, Shift_JIS or EUC-JP and gives every segment to sink.
+      @param input : The input sentense.
+      @param encoding : The encoding of input.
+      @param sink : Any callable taking a std::string_view.
+     */
+    template<class Sink, class = typename std::enable_if<
+               std::is_invocable<Sink&, std::string_view>::value>::type>
+    void segment(std::string_view input, Encoding encoding, Sink&& sink)
+    {
+      int anum = chars.fill(input.data(), input.size(), encoding, false);
+      if(anum == 1){
+        sink(input);
+      } else if(anum > 1){
+        WordSink<Sink> result = {sink};
+        segmentChars(anum, result);
+      }
+    }
+
+    /*!
+      @brief This method is extract segmentes from Japanese sentense as a
+      bitmap, the bit of a position set where a segment ends. The end of the
+      last segment is set too. See util::getBitPositions and util::selectBit.
+      @param input : The utf-8 input sentense.
+      @param bits : The bitmap of util::getBitmapWordNum(input.size())
+      words, which are cleared first.
+      @param unit : Whether the positions are charcters or bytes.
+     */
+    void segment(std::string_view input, uint64_t* bits,
+                 BitmapUnit unit = BITMAP_BYTES)
+    {
+      segment(input, ENCODING_UTF8, bits, unit);
+    }
+
+    /*!
+      @brief This method is extract segmentes from Japanese sentense in
+      utf-8, Shift_JIS or EUC-JP as a bitmap.
+      @param input : The input sentense.
+      @param encoding : The encoding of input.
+      @param bits : The bitmap of util::getBitmapWordNum(input.size()) words.
+      @param unit : Whether the positions are charcters or bytes.
+     */
+    void segment(std::string_view input, Encoding encoding, uint64_t* bits,
+                 BitmapUnit unit)
+    {
+      std::memset(bits, 0, util::getBitmapWordNum(input.size()) * sizeof(uint64_t));
+      int anum = chars.fill(input.data(), input.size(), encoding, false);
+      BoundaryBitmap result = {bits, unit == BITMAP_BYTES ? chars.getOffsets() : NULL};
+      if(anum == 1){
+        pushLastWord(0, anum, result);
+      } else if(anum > 1){
+        segmentChars(anum, result);
+      }
+    }
+
+    /*!
+      @brief This method is extract segmentes from the codepoints of Japanese
+      sentense as a bitmap of the positions of Boundaries.
+      @param input : The pointer to the codepoints.
+      @param len : Number of codepoints in input.
+      @param bits : The bitmap of util::getBitmapWordNum(len) words.
+     */
+    void segment(const char32_t* input, size_t len, uint64_t* bits)
+    {
+      segmentCodes(input, len, bits);
+    }
+
+    void segment(const uint32_t* input, size_t len, uint64_t* bits)
+    {
+      segmentCodes(input, len, bits);
+    }
+
+    /*!
+      @brief The segmentes of an input as views of it, each decided when the
+      iterator reaches it. The charcters are decoded up front, but a window
+      is scored only when it is read, so a reader which stops early pays
+      only for the segmentes it read. A range reads the charcters of its
+      Segmenter, so it is valid until the Segmenter segments again.
+     */
+    class TokenRange {
+
+    public:
+      /*!
+        @brief Forward iterator over the segmentes of a TokenRange. It keeps
+        what it reads itself, so it stays valid when the range is gone.
+       */
+      class iterator {
+
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef std::string_view value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const std::string_view* pointer;
+        typedef std::string_view reference;
+
+        iterator() : segmenter(NULL), input(), anum(0), begin(0), end(0), pwindow(0){}
+
+        /*! @brief A single charcter is the whole input, like segment. */
+        std::string_view operator*() const
+        {
+          if(anum == 1) return input;
+          return segmenter->chars.getWordView(begin, end);
+        }
+
+        /*! @brief Decide the next segment, scoring the windows up to its end. */
+        iterator& operator++()
+        {
+          begin = end;
+          if(begin < anum) end = segmenter->getNextEnd(begin, anum, &pwindow);
+          return *this;
         }
-        if(anum == 2){
-          std::strcpy(ctype[4], O__);
-          std::strcpy(ctype[5], O__);
-          std::strcpy(seg[4], E1__);
-          std::strcpy(seg[5], E2__);
-        } else if(anum == 3){
-          std::strcpy(seg[5], E1__);
-          std::strcpy(ctype[5], O__);
+
+        iterator operator++(int)
+        {
+          iterator rv = *this;
+          ++*this;
+          return rv;
+        }
+
+        bool operator==(const iterator& it) const
+        {
+          return begin == it.begin;
         }
+
+        bool operator!=(const iterator& it) const
+        {
+          return begin != it.begin;
+        }
+
+      private:
+        friend class TokenRange;
+
+        Segmenter* segmenter;
+
+        std::string_view input;
+
+        int anum;
+
+        /*! @brief The charcters of the segment, begin to end - 1. */
+        int begin;
+        int end;
+
+        /*! @brief The p1 to p3 window of the next window scored. */
+        int pwindow;
+      };
+
+      iterator begin() const
+      {
+        iterator it = getIterator();
+        it.pwindow = model::getPStateWindow(model::PSTATE_U, model::PSTATE_U,
+                                            model::PSTATE_U);
+        it.end = anum > 1 ? segmenter->getNextEnd(0, anum, &it.pwindow) : anum;
+        return it;
+      }
+
+      iterator end() const
+      {
+        iterator it = getIterator();
+        it.begin = it.end = anum;
+        return it;
+      }
+
+    private:
+      friend class Segmenter;
+
+      Segmenter* segmenter;
+
+      std::string_view input;
+
+      int anum;
+
+      TokenRange(Segmenter* segmenter, std::string_view input, int anum) :
+        segmenter(segmenter), input(input), anum(anum){}
+
+      iterator getIterator() const
+      {
+        iterator it;
+        it.segmenter = segmenter;
+        it.input = input;
+        it.anum = anum;
+        return it;
+      }
+    };
+
+    /*!
+      @brief This method is used in order to get the segmentes of Japanese
+      sentense lazily, the same as segment gives as SegmentViews.
+      ENGINE_GPERF is read with the tables of ENGINE_DENSE, which decide the
+      same, and the window cache is not used.
+      @param input : The input sentense. It must outlive the range.
+      @param encoding : The encoding of input.
+      @return The range of the segmentes, valid until the next segment.
+     */
+    TokenRange tokens(std::string_view input, Encoding encoding = ENCODING_UTF8)
+    {
+      int anum = chars.fill(input.data(), input.size(), encoding, false);
+      return TokenRange(this, input, anum);
+    }
+
+    /*!
+      @brief This method is extract segmentes from utf-16 Japanese sentense,
+      with the results of segment for utf-8 where the input has no surrogate
+      pairs. Charcters beyond U+FFFF are kept, see util::decodeUtf16.
+      @param input : The utf-16 charcters of input sentense.
+      @param result : The results of segment will be stored this object, as
+      views of input.
+     */
+    void segment(std::u16string_view input, Segmentes16& result)
+    {
+      int anum = chars.fill(input.data(), input.size());
+      if(anum == 1){
+        result.push_back(input);
+      } else if(anum > 1){
+        segmentChars(anum, result);
+      }
+    }
+
+    /*!
+      @brief This method is extract segmentes from utf-16 Japanese sentense.
+      @param input : The pointer to the utf-16 charcters.
+      @param len : Number of code units in input.
+      @param result : The results of segment will be stored this object.
+     */
+    void segment(const char16_t* input, size_t len, Segmentes16& result)
+    {
+      segment(std::u16string_view(input, len), result);
+    }
+
+    /*!
+      @brief This method is extract segmentes from the codepoints of Japanese
+      sentense, for input decoded already.
+      @param input : The pointer to the codepoints.
+      @param len : Number of codepoints in input.
+      @param result : The end of every segment will be stored this object.
+     */
+    void segment(const char32_t* input, size_t len, Boundaries& result)
+    {
+      segmentCodes(input, len, result);
+    }
+
+    void segment(const uint32_t* input, size_t len, Boundaries& result)
+    {
+      segmentCodes(input, len, result);
+    }
+
+    /*!
+      @brief This method is used in order to get the scoring engine.
+     */
+    ScoreEngine getEngine() const
+    {
+      return engine;
+    }
+
+    /*!
+      @brief This method is used in order to get the lookup counts of
+      ENGINE_BOUNDED since the last resetBoundStats.
+     */
+    const BoundStats& getBoundStats() const
+    {
+      return stats;
+    }
+
+    void resetBoundStats()
+    {
+      stats.windows = 0;
+      stats.lookups = 0;
+      stats.skipped = 0;
+    }
+
+    /*!
+      @brief This method is used in order to remember window scores in a
+      cache of one thread, for example WindowCache::getThreadCache().
+      Windows found in the cache are not scored again. The results do not
+      change. Not used by ENGINE_GPERF.
+      @param cache : The cache, or NULL for none. It must outlive its use
+      by this object.
+     */
+    void setWindowCache(WindowCache* cache)
+    {
+      localCache = cache;
+      sharedCache = NULL;
+    }
+
+    /*!
+      @brief This method is used in order to remember window scores in a
+      cache shared with other threads.
+      @param cache : The cache, or NULL for none.
+     */
+    void setWindowCache(SharedWindowCache* cache)
+    {
+      localCache = NULL;
+      sharedCache = cache;
+    }
+
+    /*!
+      @brief This method is used in order to classify charcters with another
+      map than that of util::getCharClass, for example one with "M" for the
+      numbers in Kanji. The map is read the same way, so it costs nothing.
+      @param map : The map, or NULL for model::getDefaultCharClassMap(). It
+      must outlive its use by this object.
+      @return Return false, keeping the map, if map is not
+      model::CharClassMap::isValid.
+     */
+    bool setCharClassMap(const model::CharClassMap* map)
+    {
+      return chars.setCharClassMap(map);
+    }
+
+  private:
+
+    /*! @brief Trainig data object.Perfect hashing. */
+    TrainHash train;
+
+    /*! @brief Trainig data keyed by integer feature IDs. */
+    const model::FeatureModel* featureModel;
+
+    /*! @brief The charcters of the input being segmented. */
+    CharBuffer chars;
+
+    ScoreEngine engine;
+
+    BoundStats stats;
+
+    WindowCache* localCache;
+
+    SharedWindowCache* sharedCache;
+
+    /*!
+      @brief The static scores and class windows of ENGINE_DENSE. It only
+      grows, so segmenting again allocates nothing.
+     */
+    std::vector<int> denseScores;
+
+    /*!
+      @brief The result of segment as a bitmap, of the byte offsets of the
+      ends if offsets is not NULL, of the charcter indexes otherwise.
+     */
+    struct BoundaryBitmap {
+      uint64_t* bits;
+      const uint32_t* offsets;
+    };
+
+    /*! @brief The result of segment with a sink, which gets every word. */
+    template<class Sink>
+    struct WordSink {
+      Sink& sink;
+    };
+
+    template<class T>
+    void segmentCodes(const T* input, size_t len, Boundaries& result)
+    {
+      int anum = chars.fill(input, len);
+      if(anum == 1){
+        result.push_back(1);
+      } else if(anum > 1){
+        segmentChars(anum, result);
+      }
+    }
+
+    template<class T>
+    void segmentCodes(const T* input, size_t len, uint64_t* bits)
+    {
+      std::memset(bits, 0, util::getBitmapWordNum(len) * sizeof(uint64_t));
+      int anum = chars.fill(input, len);
+      BoundaryBitmap result = {bits, NULL};
+      if(anum == 1){
+        pushLastWord(0, anum, result);
+      } else if(anum > 1){
+        segmentChars(anum, result);
+      }
+    }
+
+    /*!
+      @brief This method is used in order to segment the charcters in chars
+      with the engine.
+      @param anum : Number of charcters of the input in chars, at least 2.
+      @param result : Segmentes, TokenBuffer, SegmentViews, Segmentes16,
+      Boundaries, a BoundaryBitmap or a WordSink.
+     */
+    template<class Result>
+    void segmentChars(int anum, Result& result)
+    {
+      if(engine == ENGINE_GPERF){
+        segmentGperf(anum, result);
+      } else if(localCache){
+        segmentCached(anum, *localCache, result);
+      } else if(sharedCache){
+        segmentCached(anum, *sharedCache, result);
+      } else if(engine == ENGINE_FEATURE_ID){
+        segmentFeatureId(anum, result);
+      } else if(engine == ENGINE_BOUNDED){
+        segmentBounded(anum, result);
       } else {
-        for(int i = 0; i < 4; ++i){
-          uint16_t ucsChar = ary[i];
-          const uint16_t* ucsCharPtr = &ucsChar;
-          std::strcpy(ctype[i + 2], util::getCharClass(ucsChar));
-          util::ucstoutf(ucsCharPtr, 1, seg[i + 2]);
+        segmentDense(anum, result);
+      }
+    }
+
+    /*!
+      @brief This method is extract segmentes with the integer feature IDs.
+      @param anum : Number of charcters of the input in chars, at least 2.
+      @param result : The results of segment will be stored this object.
+     */
+    template<class Result>
+    void segmentFeatureId(int anum, Result& result)
+    {
+      const int* wid = chars.getCharIds();
+      const int* ctype = chars.getClasses();
+      int begin = 0;
+      int p1 = model::PSTATE_U;
+      int p2 = model::PSTATE_U;
+      int p3 = model::PSTATE_U;
+      for(int d = 0; d < anum - 1; ++d){
+        int score = DEFAULT_SCORE +
+          featureModel->getScore(wid + d, ctype + d, p1, p2, p3);
+        int p = model::PSTATE_O;
+        if(score > 0){
+          pushWord(begin, d + 1, result);
+          begin = d + 1;
+          p     = model::PSTATE_B;
+        }
+        p1 = p2;
+        p2 = p3;
+        p3 = p;
+      }
+      pushLastWord(begin, anum, result);
+    }
+
+    /*!
+      @brief This method is extract segmentes in two passes. The first one
+      gets the scores of every window which do not depend on earlier
+      decisions, the second one adds the p-state features and decides.
+      @param anum : Number of charcters of the input in chars, at least 2.
+      @param result : The results of segment will be stored this object.
+     */
+    template<class Result>
+    void segmentDense(int anum, Result& result)
+    {
+      int num = anum - 1;
+      if(denseScores.size() < (size_t)num * 2) denseScores.resize(num * 2);
+      int* scores = &denseScores[0];
+      int* windows = scores + num;
+      featureModel->getStaticScores(chars.getCharIds(), chars.getClasses(), num,
+                                    scores, windows);
+
+      int begin = 0;
+      int pwindow = model::getPStateWindow(model::PSTATE_U, model::PSTATE_U,
+                                           model::PSTATE_U);
+      for(int d = 0; d < num; ++d){
+        int score = DEFAULT_SCORE + scores[d] +
+          featureModel->getClassScore(pwindow, windows[d]);
+        int p = model::PSTATE_O;
+        if(score > 0){
+          pushWord(begin, d + 1, result);
+          begin = d + 1;
+          p     = model::PSTATE_B;
+        }
+        pwindow = pwindow % (model::PSTATE_NUM * model::PSTATE_NUM) *
+          model::PSTATE_NUM + p;
+      }
+      pushLastWord(begin, anum, result);
+    }
+
+    /*!
+      @brief This method is extract segmentes, looking every window up in a
+      cache before scoring it with the engine.
+      @param anum : Number of charcters of the input in chars, at least 2.
+      @param cache : WindowCache or SharedWindowCache.
+      @param result : The results of segment will be stored this object.
+     */
+    template<class Cache, class Result>
+    void segmentCached(int anum, Cache& cache, Result& result)
+    {
+      int num = anum - 1;
+      const int* wid = chars.getCharIds();
+      const int* ctype = chars.getClasses();
+
+      int begin = 0;
+      int pwindow = model::getPStateWindow(model::PSTATE_U, model::PSTATE_U,
+                                           model::PSTATE_U);
+      for(int d = 0; d < num; ++d){
+        WindowKey key(wid + d, ctype + d, pwindow);
+        int score;
+        if(!cache.get(key, &score)){
+          score = getWindowScore(wid + d, ctype + d, pwindow);
+          cache.put(key, score);
+        }
+        int p = model::PSTATE_O;
+        if(score > 0){
+          pushWord(begin, d + 1, result);
+          begin = d + 1;
+          p     = model::PSTATE_B;
+        }
+        pwindow = pwindow % (model::PSTATE_NUM * model::PSTATE_NUM) *
+          model::PSTATE_NUM + p;
+      }
+      pushLastWord(begin, anum, result);
+    }
+
+    /*!
+      @brief This method is used in order to decide the segment beginning at
+      a charcter, scoring the windows from there on.
+      @param begin : The first charcter of the segment.
+      @param anum : Number of charcters of the input in chars, at least 2.
+      @param pwindow : The p1 to p3 window, updated for every window scored.
+      @return The end of the segment.
+     */
+    int getNextEnd(int begin, int anum, int* pwindow)
+    {
+      const int* wid = chars.getCharIds();
+      const int* ctype = chars.getClasses();
+      for(int d = begin; d < anum - 1; ++d){
+        int p = getWindowScore(wid + d, ctype + d, *pwindow) > 0 ?
+          model::PSTATE_B : model::PSTATE_O;
+        *pwindow = *pwindow % (model::PSTATE_NUM * model::PSTATE_NUM) *
+          model::PSTATE_NUM + p;
+        if(p == model::PSTATE_B) return d + 1;
+      }
+      return anum;
+    }
+
+    /*!
+      @brief This method is used in order to score one window with the
+      engine. The sign is that of the full score.
+      @param w : IDs of the six characters of the window.
+      @param c : Class codes of the six characters of the window.
+      @param pwindow : The p1 to p3 window.
+     */
+    int getWindowScore(const int* w, const int* c, int pwindow)
+    {
+      if(engine == ENGINE_FEATURE_ID){
+        int p1 = pwindow / (model::PSTATE_NUM * model::PSTATE_NUM);
+        int p2 = pwindow / model::PSTATE_NUM % model::PSTATE_NUM;
+        int p3 = pwindow % model::PSTATE_NUM;
+        return DEFAULT_SCORE + featureModel->getScore(w, c, p1, p2, p3);
+      } else if(engine == ENGINE_BOUNDED){
+        int n;
+        int score = featureModel->getBoundedScore(w, c, pwindow, DEFAULT_SCORE, &n);
+        stats.windows++;
+        stats.lookups += n;
+        stats.skipped += model::TERM_NUM - n;
+        return score;
+      }
+      int score;
+      int cwindow;
+      featureModel->getStaticScores(w, c, 1, &score, &cwindow);
+      return DEFAULT_SCORE + score + featureModel->getClassScore(pwindow, cwindow);
+    }
+
+    /*!
+      @brief This method is extract segmentes with the bounded scores of
+      model::FeatureModel::getBoundedScore.
+      @param anum : Number of charcters of the input in chars, at least 2.
+      @param result : The results of segment will be stored this object.
+     */
+    template<class Result>
+    void segmentBounded(int anum, Result& result)
+    {
+      int num = anum - 1;
+      const int* wid = chars.getCharIds();
+      const int* ctype = chars.getClasses();
+
+      int begin = 0;
+      int pwindow = model::getPStateWindow(model::PSTATE_U, model::PSTATE_U,
+                                           model::PSTATE_U);
+      uint64_t lookups = 0;
+      for(int d = 0; d < num; ++d){
+        int n;
+        int score = featureModel->getBoundedScore(wid + d, ctype + d, pwindow,
+                                                  DEFAULT_SCORE, &n);
+        lookups += n;
+        int p = model::PSTATE_O;
+        if(score > 0){
+          pushWord(begin, d + 1, result);
+          begin = d + 1;
+          p     = model::PSTATE_B;
         }
+        pwindow = pwindow % (model::PSTATE_NUM * model::PSTATE_NUM) *
+          model::PSTATE_NUM + p;
       }
-      std::string word = seg[2];
+      pushLastWord(begin, anum, result);
+      stats.windows += num;
+      stats.lookups += lookups;
+      stats.skipped += (uint64_t)num * model::TERM_NUM - lookups;
+    }
+
+    /*!
+      @brief This method is used in order to store the last word, the
+      charcters begin to anum - 1, unless it is empty.
+     */
+    template<class Result>
+    void pushLastWord(int begin, int anum, Result& result)
+    {
+      pushWord(begin, anum, result);
+      if(result.back().size() == 0)
+        result.pop_back();
+    }
+
+    /*!
+      @brief This method is used in order to store the charcters begin to
+      end - 1 as a word.
+     */
+    void pushWord(int begin, int end, Segmentes& result)
+    {
+      result.push_back(chars.getWord(begin, end));
+    }
+
+    void pushWord(int begin, int end, TokenBuffer& result)
+    {
+      chars.appendWord(begin, end, result.getArena());
+      result.endWord();
+    }
+
+    void pushWord(int begin, int end, SegmentViews& result)
+    {
+      result.push_back(chars.getWordView(begin, end));
+    }
+
+    void pushWord(int, int end, BoundaryBitmap& result)
+    {
+      util::setBit(result.bits, result.offsets ? result.offsets[end] : end);
+    }
+
+    /*! @brief The end of the input is always set. */
+    void pushLastWord(int begin, int anum, BoundaryBitmap& result)
+    {
+      pushWord(begin, anum, result);
+    }
+
+    template<class Sink>
+    void pushWord(int begin, int end, WordSink<Sink>& result)
+    {
+      result.sink(chars.getWordView(begin, end));
+    }
+
+    /*! @brief A view of bytes is never empty. */
+    template<class Sink>
+    void pushLastWord(int begin, int anum, WordSink<Sink>& result)
+    {
+      pushWord(begin, anum, result);
+    }
+
+    void pushWord(int begin, int end, Segmentes16& result)
+    {
+      result.push_back(chars.getWord16(begin, end));
+    }
+
+    void pushWord(int, int end, Boundaries& result)
+    {
+      result.push_back(end);
+    }
+
+    /*! @brief A segment of codepoints is never empty. */
+    void pushLastWord(int, int anum, Boundaries& result)
+    {
+      result.push_back(anum);
+    }
+
+    /*!
+      @brief This method is extract segmentes with the string keys of TrainHash.
+      @param anum : Number of charcters of the input in chars, at least 2.
+      @param result : The results of segment will be stored this object.
+     */
+    template<class Result>
+    void segmentGperf(int anum, Result& result)
+    {
+      const uint32_t* ary = chars.getCodes();
+      char seg[SEGMENT_STACK_SIZ][5];
+      char ctype[SEGMENT_STACK_SIZ][4];
+      for(unsigned int i = 0; i < SEGMENT_STACK_SIZ; ++i){
+        getSegment(ary[i], seg[i], ctype[i]);
+      }
+      int begin = 0;
       const char* p1 = U__;
       const char* p2 = U__;
       const char* p3 = U__;
-      for(int i = 4; i < anum + 3 ; ++i){
+      for(int d = 0; d < anum - 1; ++d){
         int score = getScore(seg, ctype, p1, p2, p3);
         const char* p = O__;
         if(score > 0){
-          result.push_back(word);
-          word = "";
-          p    = B__;
+          pushWord(begin, d + 1, result);
+          begin = d + 1;
+          p     = B__;
         }
         p1 = p2;
         p2 = p3;
         p3 = p;
-        word.append(seg[3]);
         std::memmove(seg, seg + 1, sizeof(seg) - sizeof(seg[0]));
         std::memmove(ctype, ctype + 1, sizeof(ctype) - sizeof(ctype[0]));
-        if(i < anum){
-          uint16_t ucsChar = ary[i];
-          const uint16_t* ucsCharPtr = &ucsChar;
-          std::strcpy(ctype[5], util::getCharClass(ucsChar));
-          util::ucstoutf(ucsCharPtr, 1, seg[5]);
-        } else {
-          std::strcpy(ctype[5], O__);
-          if(i >= anum + 1){
-            std::strcpy(seg[5], E2__);
-          } else if(i >= anum ){
-            std::strcpy(seg[5], E1__);
-          } else {
-            std::strcpy(seg[5], E3__);
-          }
-        }
+        getSegment(ary[d + SEGMENT_STACK_SIZ], seg[5], ctype[5]);
       }
-      if(word.size() > 0)
-        result.push_back(word);
-
-      if(ary != stack) delete[] ary;
+      pushLastWord(begin, anum, result);
     }
 
-  private:
-
-    /*! @brief Trainig data object.Perfect hashing. */
-    TrainHash train;
+    /*!
+      @brief This method is used in order to get the TrainHash strings of a
+      charcter, the marker name and "O" for a sentinel.
+      @param c : The unicode charcter or sentinel.
+      @param seg : The region for storing the charcter.
+      @param ctype : The region for storing the charcter class.
+     */
+    void getSegment(uint32_t c, char* seg, char* ctype)
+    {
+      static const char* markers[] = {B2__, B1__, E1__, E2__, E3__};
+      if(c >= model::SENTINEL_B2 && c <= model::SENTINEL_E3){
+        std::strcpy(seg, markers[c - model::SENTINEL_B2]);
+        std::strcpy(ctype, O__);
+      } else {
+        util::ucstoutf(&c, 1, seg);
+        int code = chars.getCharClassMap().getClass(c);
+        std::strcpy(ctype, model::getClassName(code));
+      }
+    }
 
     /*!
       @brief This method is used in order to get score of
@@ -339,7 +1505,7 @@ namespace tinysegmenterxx {
       @param ctype[][4] : The pointer for the char type stack.
       @return The score.
     */
-    int getScore(char seg[][4], char ctype[][4],
+    int getScore(char seg[][5], char ctype[][4],
                  const char* p1, const char* p2, const char* p3)
     {
       int score = DEFAULT_SCORE;
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) Shunya KIMURA <brmtrain@gmail.com>
+ * Use and distribution of this program is licensed under the
+ * BSD license. See the COPYING file for full text.
+ *
+ * Original version TinySegmenter was written by Taku Kudo <taku@chasen.org>
+ * The license is below.
+ *   TinySegmenter 0.1 -- Super compact Japanese tokenizer in Javascript
+ *   (c) 2008 Taku Kudo <taku@chasen.org>
+ *   TinySegmenter is freely distributable under the terms of a new BSD licence.
+ *   For details, see http://chasen.org/~taku/software/TinySegmenter/LICENCE.txt
+ *   http://www.chasen.org/~taku/software/TinySegmenter/
+ *
+ */
+
+#ifndef TINYSEGMENTERXX_BITS_H
+#define TINYSEGMENTERXX_BITS_H
+
+#include <cstddef>
+#include <stdint.h>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace tinysegmenterxx {
+
+  namespace util {
+
+    /*!
+      @brief This method is used in order to get the number of words of a
+      bitmap of the positions 0 to num.
+      @param num : The last position, the length of the input.
+     */
+    inline size_t getBitmapWordNum(size_t num)
+    {
+      return num / 64 + 1;
+    }
+
+    inline void setBit(uint64_t* bits, size_t pos)
+    {
+      bits[pos / 64] |= (uint64_t)1 << (pos % 64);
+    }
+
+    inline bool getBit(const uint64_t* bits, size_t pos)
+    {
+      return (bits[pos / 64] >> (pos % 64)) & 1;
+    }
+
+    /*!
+      @brief This method is used in order to get the positions of the set
+      bits of a bitmap in order, one trailing zero count per bit.
+      @param bits : The bitmap.
+      @param wordNum : Number of words of bits.
+      @param positions : The region for storing the positions, at least as
+      many as the set bits.
+      @return Number of positions.
+     */
+    inline size_t getBitPositions(const uint64_t* bits, size_t wordNum,
+                                  uint32_t* positions)
+    {
+      size_t num = 0;
+      for(size_t i = 0; i < wordNum; ++i){
+        uint64_t w = bits[i];
+        while(w){
+          positions[num++] = i * 64 + __builtin_ctzll(w);
+          w &= w - 1;
+        }
+      }
+      return num;
+    }
+
+    /*! @brief Number of set bits of a bitmap. */
+    inline size_t countBits(const uint64_t* bits, size_t wordNum)
+    {
+      size_t num = 0;
+      for(size_t i = 0; i < wordNum; ++i){
+        num += __builtin_popcountll(bits[i]);
+      }
+      return num;
+    }
+
+    /*!
+      @brief This method is used in order to get the position of the n-th set
+      bit of a bitmap, with no scan of the bits before it in its word.
+      @param bits : The bitmap.
+      @param wordNum : Number of words of bits.
+      @param n : The set bit, from 0.
+      @return The position, or (size_t)-1 if there are n set bits or less.
+     */
+    inline size_t selectBit(const uint64_t* bits, size_t wordNum, size_t n)
+    {
+      for(size_t i = 0; i < wordNum; ++i){
+        size_t cnt = __builtin_popcountll(bits[i]);
+        if(n >= cnt){
+          n -= cnt;
+          continue;
+        }
+#if defined(__BMI2__)
+        return i * 64 + __builtin_ctzll(_pdep_u64((uint64_t)1 << n, bits[i]));
+#else
+        uint64_t w = bits[i];
+        for(; n > 0; --n) w &= w - 1;
+        return i * 64 + __builtin_ctzll(w);
+#endif
+      }
+      return (size_t)-1;
+    }
+  }
+}
+
+#endif /* TINYSEGMENTERXX_BITS_H */
@@ -0,0 +1,590 @@
+/*
+ * Copyright (C) Shunya KIMURA <brmtrain@gmail.com>
+ * Use and distribution of this program is licensed under the
+ * BSD license. See the COPYING file for full text.
+ *
+ * Original version TinySegmenter was written by Taku Kudo <taku@chasen.org>
+ * The license is below.
+ *   TinySegmenter 0.1 -- Super compact Japanese tokenizer in Javascript
+ *   (c) 2008 Taku Kudo <taku@chasen.org>
+ *   TinySegmenter is freely distributable under the terms of a new BSD licence.
+ *   For details, see http://chasen.org/~taku/software/TinySegmenter/LICENCE.txt
+ *   http://www.chasen.org/~taku/software/TinySegmenter/
+ *
+ */
+
+#ifndef TINYSEGMENTERXX_BUILDER_H
+#define TINYSEGMENTERXX_BUILDER_H
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <ostream>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include "tinysegmenterxx_model.hpp"
+#include "tinysegmenterxx_decode.hpp"
+
+namespace tinysegmenterxx {
+
+  namespace model {
+
+    /*!
+      @brief Open addressing hash table from non-zero integer keys to scores.
+      Missing keys have the score 0, like a miss in TrainHash.
+     */
+    class FeatureTable {
+
+    public:
+      FeatureTable() : mask(0), keys(1, 0), vals(1, 0){}
+
+      /*!
+        @brief This method is used in order to size the table.
+        Must be called before put.
+        @param num : Number of keys which will be stored.
+       */
+      void reserve(size_t num)
+      {
+        size_t cap = 8;
+        while(cap < num * 2) cap <<= 1;
+        mask = cap - 1;
+        keys.assign(cap, 0);
+        vals.assign(cap, 0);
+      }
+
+      void put(uint64_t key, int val)
+      {
+        size_t i = hash(key) & mask;
+        while(keys[i] != 0 && keys[i] != key) i = (i + 1) & mask;
+        keys[i] = key;
+        vals[i] = val;
+      }
+
+      int get(uint64_t key) const
+      {
+        size_t i = hash(key) & mask;
+        while(true){
+          uint64_t k = keys[i];
+          if(k == key) return vals[i];
+          if(k == 0) return 0;
+          i = (i + 1) & mask;
+        }
+      }
+
+      /*! @brief Number of slots, used or not. */
+      size_t getSlotNum() const
+      {
+        return keys.size();
+      }
+
+      /*! @brief The key of a slot, 0 if the slot is not used. */
+      uint64_t getSlotKey(size_t i) const
+      {
+        return keys[i];
+      }
+
+      int getSlotValue(size_t i) const
+      {
+        return vals[i];
+      }
+
+    private:
+      size_t mask;
+      std::vector<uint64_t> keys;
+      std::vector<int> vals;
+
+      static size_t hash(uint64_t key)
+      {
+        key *= 0x9E3779B97F4A7C15ULL;
+        return (size_t)(key >> 32);
+      }
+    };
+
+    /*!
+      @brief Maker of the tables of a FeatureModel from string features, the
+      ones of tools/train or of TrainHash. segmenterxxgen writes the tables it
+      makes from tools/train into tinysegmenterxx_tables.hpp.
+     */
+    class ModelBuilder {
+
+    public:
+      ModelBuilder() :
+        keys(), vals(), charIds(), charCodes(CHARID_FIRST, 0), features(),
+        charPages(), charPageIds(), unigramScores(), classScores(), tailScores(),
+        wordSeeds(), wordSlots(), filterWords(), charNum(CHARID_FIRST),
+        foldWidth(false){}
+
+      /*!
+        @brief This method is used in order to add a feature.
+        @param key : The TrainHash key, template name and body, e.g. "UW3__あ".
+        @param val : The score.
+       */
+      void add(const std::string& key, int val)
+      {
+        keys.push_back(key);
+        vals.push_back(val);
+      }
+
+      /*!
+        @brief This method is used in order to add the features of a training
+        file, lines of the form this.UW3__ = {"あ":-100,...};
+        @param path : The path of the file.
+        @return Return false if the file cannot be read or is malformed.
+       */
+      bool read(const char* path)
+      {
+        std::ifstream ifs(path);
+        if(!ifs) return false;
+        std::string line;
+        while(std::getline(ifs, line)){
+          if(line.empty()) continue;
+          if(!readLine(line)) return false;
+        }
+        return true;
+      }
+
+      /*!
+        @brief This method is used in order to fold half-width and full-width
+        forms of charcters by util::foldWidth. Off by default: a folded model
+        scores width-variant text with the canonical features, so its output
+        differs from TrainHash and ENGINE_GPERF there. Text with no width
+        variants scores the same either way. Call before build.
+        @param fold : Whether to fold.
+       */
+      void setFoldWidth(bool fold)
+      {
+        foldWidth = fold;
+      }
+
+      /*!
+        @brief This method is used in order to make the tables of the
+        features added so far. Must be called once, after every add.
+        When folding, every key holding a half-width or full-width form is
+        dropped, whether or not its canonical key is there, so the weights
+        of canonical keys are kept as they are.
+       */
+      void build()
+      {
+        charIds.reserve(keys.size() * 3);
+        features.reserve(keys.size() * 2);
+        for(size_t i = 0; i < keys.size(); ++i){
+          if(isCanonical(keys[i].c_str())) addFeature(keys[i].c_str(), vals[i]);
+        }
+        buildCharPages();
+        buildUnigramTable();
+        buildWordTable();
+        buildClassTables();
+        buildTermBounds();
+      }
+
+      /*! @brief The tables made by build, valid while the builder lives. */
+      ModelTables getTables() const
+      {
+        ModelTables t = {
+          charNum, &charPages[0], &charPageIds[0], (uint32_t)charPageIds.size(),
+          &charCodes[0], &unigramScores[0], &classScores[0], &tailScores[0],
+          &wordSeeds[0], &wordSlots[0], (uint32_t)wordSlots.size(),
+          &filterWords[0], (uint32_t)filterWords.size(),
+          termOrder, termMinRest, termMaxRest
+        };
+        return t;
+      }
+
+      /*!
+        @brief This method is used in order to write the tables made by build
+        as a header of constexpr arrays, in namespace model::tables.
+        @param os : The stream for writing.
+        @param source : The name of the training data, for the comment.
+       */
+      void write(std::ostream& os, const char* source) const
+      {
+        os << "/*\n"
+           << " * Generated by segmenterxxgen from " << source << ". Do not edit,\n"
+           << " * run \"make model\" in src instead.\n"
+           << " */\n\n"
+           << "#ifndef TINYSEGMENTERXX_TABLES_H\n"
+           << "#define TINYSEGMENTERXX_TABLES_H\n\n"
+           << "#include \"tinysegmenterxx_model.hpp\"\n\n"
+           << "namespace tinysegmenterxx {\n\n"
+           << "  namespace model {\n\n"
+           << "    namespace tables {\n\n";
+        os << "      constexpr int CHAR_NUM = " << charNum << ";\n\n";
+        writeArray(os, "uint32_t", "CHAR_PAGES", charPages);
+        writeArray(os, "uint16_t", "CHAR_PAGE_IDS", charPageIds);
+        writeArray(os, "uint16_t", "CHAR_CODES", charCodes);
+        writeArray(os, "Weight", "UNIGRAM_SCORES", unigramScores);
+        writeArray(os, "Weight", "CLASS_SCORES", classScores);
+        writeArray(os, "Weight", "TAIL_SCORES", tailScores);
+        writeArray(os, "uint32_t", "WORD_SEEDS", wordSeeds);
+        os << "      constexpr PerfectHashSlot WORD_SLOTS[] = {";
+        for(size_t i = 0; i < wordSlots.size(); ++i){
+          os << (i % 6 == 0 ? "\n        " : " ")
+             << "{" << wordSlots[i].check << "u, " << wordSlots[i].val << "}"
+             << (i + 1 < wordSlots.size() ? "," : "");
+        }
+        os << "\n      };\n\n";
+        writeArray(os, "uint64_t", "FILTER_WORDS", filterWords);
+        writeArray(os, "int", "TERM_ORDER", std::vector<int>(termOrder, termOrder + TERM_NUM));
+        writeArray(os, "int", "TERM_MIN_REST",
+                   std::vector<int>(termMinRest, termMinRest + TERM_NUM + 1));
+        writeArray(os, "int", "TERM_MAX_REST",
+                   std::vector<int>(termMaxRest, termMaxRest + TERM_NUM + 1));
+        os << "      constexpr ModelTables TABLES = {\n"
+           << "        CHAR_NUM, CHAR_PAGES, CHAR_PAGE_IDS, " << charPageIds.size() << ",\n"
+           << "        CHAR_CODES, UNIGRAM_SCORES, CLASS_SCORES, TAIL_SCORES,\n"
+           << "        WORD_SEEDS, WORD_SLOTS, " << wordSlots.size() << ",\n"
+           << "        FILTER_WORDS, " << filterWords.size() << ",\n"
+           << "        TERM_ORDER, TERM_MIN_REST, TERM_MAX_REST\n"
+           << "      };\n"
+           << "    }\n"
+           << "  }\n"
+           << "}\n\n"
+           << "#endif /* TINYSEGMENTERXX_TABLES_H */\n";
+      }
+
+    private:
+      std::vector<std::string> keys;
+      std::vector<int> vals;
+
+      /*! @brief Codepoint + 1 to character ID. */
+      FeatureTable charIds;
+
+      std::vector<uint16_t> charCodes;
+
+      /*! @brief Packed feature key to score. */
+      FeatureTable features;
+
+      std::vector<uint32_t> charPages;
+      std::vector<uint16_t> charPageIds;
+      std::vector<Weight> unigramScores;
+      std::vector<Weight> classScores;
+      std::vector<Weight> tailScores;
+      std::vector<uint32_t> wordSeeds;
+      std::vector<PerfectHashSlot> wordSlots;
+      std::vector<uint64_t> filterWords;
+      int charNum;
+      int termOrder[TERM_NUM];
+      int termMinRest[TERM_NUM + 1];
+      int termMaxRest[TERM_NUM + 1];
+      bool foldWidth;
+
+      bool readLine(const std::string& line)
+      {
+        size_t pos = line.find("this.");
+        size_t eq = line.find(" = {");
+        if(pos == std::string::npos || eq == std::string::npos) return false;
+        std::string name = line.substr(pos + 5, eq - pos - 5);
+        const char* rp = line.c_str() + eq + 4;
+        while(*rp == '"'){
+          const char* end = std::strchr(rp + 1, '"');
+          if(!end || end[1] != ':') return false;
+          std::string key = name + std::string(rp + 1, end);
+          char* np;
+          long val = std::strtol(end + 2, &np, 10);
+          if(np == end + 2) return false;
+          add(key, (int)val);
+          rp = *np == ',' ? np + 1 : np;
+        }
+        return *rp == '}';
+      }
+
+      template<class T>
+      static void writeArray(std::ostream& os, const char* type, const char* name,
+                             const std::vector<T>& ary)
+      {
+        os << "      constexpr " << type << " " << name << "[] = {";
+        for(size_t i = 0; i < ary.size(); ++i){
+          os << (i % 12 == 0 ? "\n        " : " ") << writeValue(ary[i])
+             << (i + 1 < ary.size() ? "," : "");
+        }
+        os << "\n      };\n\n";
+      }
+
+      static std::string writeValue(uint64_t val)
+      {
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "0x%016llxULL", (unsigned long long)val);
+        return buf;
+      }
+
+      template<class T>
+      static long writeValue(T val)
+      {
+        return (long)val;
+      }
+
+      /*!
+        @brief This method is used in order to make the pages of the
+        character IDs. The other width forms of a character get its ID, so
+        the lookup folds them with no work while segmenting, when folding.
+       */
+      void buildCharPages()
+      {
+        charPages.assign(CHAR_PAGE_NUM, 0);
+        charPageIds.assign(CHAR_PAGE_SIZ, CHARID_UNKNOWN);
+        for(int id = CHARID_FIRST; id < charNum; ++id){
+          setCharPageId(charCodes[id], id);
+        }
+        if(!foldWidth) return;
+        for(uint32_t c = 0; c < 0x10000; ++c){
+          uint32_t f = util::foldWidth(c);
+          if(f == c) continue;
+          int id = charIds.get((uint64_t)f + 1);
+          if(id != CHARID_UNKNOWN) setCharPageId(c, id);
+        }
+      }
+
+      void setCharPageId(uint32_t c, int id)
+      {
+        if(charPages[c >> CHAR_PAGE_BITS] == 0){
+          charPages[c >> CHAR_PAGE_BITS] = charPageIds.size();
+          charPageIds.resize(charPageIds.size() + CHAR_PAGE_SIZ, CHARID_UNKNOWN);
+        }
+        charPageIds[charPages[c >> CHAR_PAGE_BITS] + (c & CHAR_PAGE_MASK)] = id;
+      }
+
+      void buildUnigramTable()
+      {
+        unigramScores.assign(charNum * 6, 0);
+        for(int t = 0; t < 6; ++t){
+          for(int id = CHARID_UNKNOWN; id < charNum; ++id){
+            unigramScores[charNum * t + id] = toWeight(features.get(packKey(T_UW1 + t, id)));
+          }
+        }
+      }
+
+      void buildWordTable()
+      {
+        std::vector<uint64_t> keys;
+        std::vector<int> vals;
+        for(size_t i = 0; i < features.getSlotNum(); ++i){
+          uint64_t key = features.getSlotKey(i);
+          int tmpl = getKeyTemplate(key);
+          if(tmpl < T_UW1 || tmpl > T_TW4) continue;
+          keys.push_back(key);
+          vals.push_back(features.getSlotValue(i));
+        }
+        PerfectHash::build(keys, vals, &wordSeeds, &wordSlots);
+        KeyFilter::build(keys, &filterWords);
+      }
+
+      void buildTermBounds()
+      {
+        int lo[TERM_NUM];
+        int hi[TERM_NUM];
+        for(int i = 0; i < TERM_NUM; ++i){
+          lo[i] = hi[i] = 0;
+        }
+        for(int t = 0; t < 6; ++t){
+          for(int id = 0; id < charNum; ++id){
+            updateBounds(unigramScores[charNum * t + id], &lo[TERM_UW1 + t],
+                         &hi[TERM_UW1 + t]);
+          }
+        }
+        for(size_t i = 0; i < features.getSlotNum(); ++i){
+          int tmpl = getKeyTemplate(features.getSlotKey(i));
+          if(tmpl < T_BW1 || tmpl > T_TW4) continue;
+          int term = TERM_BW1 + tmpl - T_BW1;
+          updateBounds(features.getSlotValue(i), &lo[term], &hi[term]);
+        }
+        for(size_t i = 0; i < tailScores.size(); ++i){
+          updateBounds(tailScores[i], &lo[TERM_TAIL], &hi[TERM_TAIL]);
+        }
+        for(size_t i = 0; i < classScores.size(); ++i){
+          updateBounds(classScores[i], &lo[TERM_CLASS], &hi[TERM_CLASS]);
+        }
+        for(int i = 0; i < TERM_NUM; ++i){
+          int j = i;
+          while(j > 0 && getBoundWidth(lo, hi, termOrder[j - 1]) <
+                getBoundWidth(lo, hi, i)){
+            termOrder[j] = termOrder[j - 1];
+            j--;
+          }
+          termOrder[j] = i;
+        }
+        termMinRest[TERM_NUM] = termMaxRest[TERM_NUM] = 0;
+        for(int i = TERM_NUM - 1; i >= 0; --i){
+          termMinRest[i] = termMinRest[i + 1] + lo[termOrder[i]];
+          termMaxRest[i] = termMaxRest[i + 1] + hi[termOrder[i]];
+        }
+      }
+
+      static void updateBounds(int val, int* lo, int* hi)
+      {
+        if(val < *lo) *lo = val;
+        if(val > *hi) *hi = val;
+      }
+
+      static int getBoundWidth(const int* lo, const int* hi, int term)
+      {
+        return -lo[term] > hi[term] ? -lo[term] : hi[term];
+      }
+
+      void buildClassTables()
+      {
+        const FeatureTable& f = features;
+        classScores.assign(PSTATE_WINDOW_NUM * CLASS_WINDOW_NUM, 0);
+        tailScores.assign(CLASS_WINDOW_NUM, 0);
+        for(unsigned int i = 0; i < CLASS_WINDOW_NUM; ++i){
+          int c[4];
+          for(int j = 3, k = i; j >= 0; --j, k /= CLASS_NUM) c[j] = k % CLASS_NUM;
+          int tail = 0;
+          tail += f.get(packKey(T_UC5, c[2]));
+          tail += f.get(packKey(T_UC6, c[3]));
+          tail += f.get(packKey(T_BC3, c[1], c[2]));
+          tail += f.get(packKey(T_TC3, c[0], c[1], c[2]));
+          tail += f.get(packKey(T_TC4, c[1], c[2], c[3]));
+          tailScores[i] = toWeight(tail);
+          int head = 0;
+          head += f.get(packKey(T_UC1, c[0]));
+          head += f.get(packKey(T_UC2, c[1]));
+          head += f.get(packKey(T_UC3, c[2]));
+          head += f.get(packKey(T_UC4, c[3]));
+          head += f.get(packKey(T_BC1, c[1], c[2]));
+          head += f.get(packKey(T_BC2, c[2], c[3]));
+          head += f.get(packKey(T_TC1, c[0], c[1], c[2]));
+          head += f.get(packKey(T_TC2, c[1], c[2], c[3]));
+          for(unsigned int j = 0; j < PSTATE_WINDOW_NUM; ++j){
+            int p1 = j / (PSTATE_NUM * PSTATE_NUM);
+            int p2 = j / PSTATE_NUM % PSTATE_NUM;
+            int p3 = j % PSTATE_NUM;
+            int score = head;
+            score += f.get(packKey(T_UP1, p1));
+            score += f.get(packKey(T_UP2, p2));
+            score += f.get(packKey(T_UP3, p3));
+            score += f.get(packKey(T_BP1, p1, p2));
+            score += f.get(packKey(T_BP2, p2, p3));
+            score += f.get(packKey(T_UQ1, p1, c[0]));
+            score += f.get(packKey(T_UQ2, p2, c[1]));
+            score += f.get(packKey(T_UQ3, p3, c[2]));
+            score += f.get(packKey(T_BQ1, p2, c[1], c[2]));
+            score += f.get(packKey(T_BQ2, p2, c[2], c[3]));
+            score += f.get(packKey(T_BQ3, p3, c[1], c[2]));
+            score += f.get(packKey(T_BQ4, p3, c[2], c[3]));
+            score += f.get(packKey(T_TQ1, p2, c[0], c[1], c[2]));
+            score += f.get(packKey(T_TQ2, p2, c[1], c[2], c[3]));
+            score += f.get(packKey(T_TQ3, p3, c[0], c[1], c[2]));
+            score += f.get(packKey(T_TQ4, p3, c[1], c[2], c[3]));
+            classScores[j * CLASS_WINDOW_NUM + i] = toWeight(score);
+          }
+        }
+      }
+
+      void addFeature(const char* key, int val)
+      {
+        for(int t = 0; t < TEMPLATE_NUM; ++t){
+          if(std::strncmp(key, TEMPLATES[t].name, TEMPLATE_NAME_SIZ) != 0)
+            continue;
+          const char* kinds = TEMPLATES[t].kinds;
+          const char* body = key + TEMPLATE_NAME_SIZ;
+          if(kinds[0] == 'W'){
+            int ids[3] = {0, 0, 0};
+            addWordFeature(t, std::strlen(kinds), body, ids, 0, val);
+          } else {
+            uint64_t codes[4] = {0, 0, 0, 0};
+            int len = std::strlen(kinds);
+            if((int)std::strlen(body) != len) return;
+            for(int i = 0; i < len; ++i){
+              int code = kinds[i] == 'P' ? getPStateCode(body + i)
+                                         : getClassCode(body + i);
+              if(code < 0) return;
+              codes[i] = code;
+            }
+            features.put(packKey(t, codes[0], codes[1], codes[2], codes[3]), val);
+          }
+          return;
+        }
+      }
+
+      /*!
+        @brief This method is used in order to store a word feature under
+        every way its string can be split into window slots. A slot holds one
+        character, a "B1", "B2", "E1" or "E2" marker, or nothing when the
+        window holds U+0000, which ucstoutf writes as an empty string.
+        @param tmpl : The feature template.
+        @param num : Number of slots.
+        @param str : The rest of the key string.
+        @param ids : The IDs of the slots filled so far.
+        @param slot : The slot to fill.
+        @param val : The score.
+       */
+      void addWordFeature(int tmpl, int num, const char* str,
+                          int* ids, int slot, int val)
+      {
+        if(slot == num){
+          if(*str == '\0') features.put(packKey(tmpl, ids[0], ids[1], ids[2]), val);
+          return;
+        }
+        ids[slot] = internChar(0);
+        addWordFeature(tmpl, num, str, ids, slot + 1, val);
+        static const char* markers[] = {"B2", "B1", "E1", "E2"};
+        for(int i = 0; i < 4; ++i){
+          if(std::strncmp(str, markers[i], 2) == 0){
+            ids[slot] = CHARID_B2 + i;
+            addWordFeature(tmpl, num, str + 2, ids, slot + 1, val);
+          }
+        }
+        int len = 0;
+        int c = decodeChar(str, &len);
+        if(c >= 0){
+          ids[slot] = internChar(c);
+          addWordFeature(tmpl, num, str + len, ids, slot + 1, val);
+        }
+      }
+
+      int internChar(uint16_t c)
+      {
+        int id = charIds.get((uint64_t)c + 1);
+        if(id == CHARID_UNKNOWN){
+          id = charNum++;
+          charIds.put((uint64_t)c + 1, id);
+          charCodes.push_back(c);
+        }
+        return id;
+      }
+
+      /*! @brief Whether str has no charcter which folding would change. */
+      bool isCanonical(const char* str) const
+      {
+        if(!foldWidth) return true;
+        while(*str != '\0'){
+          int len = 1;
+          int c = decodeChar(str, &len);
+          if(c >= 0 && util::foldWidth(c) != (uint32_t)c) return false;
+          str += len;
+        }
+        return true;
+      }
+
+      /*!
+        @brief This method is used in order to decode the first character of
+        str the way util::ucstoutf would have encoded it.
+        @return The codepoint, or -1 if there is none.
+       */
+      static int decodeChar(const char* str, int* np)
+      {
+        const unsigned char* rp = (const unsigned char*)str;
+        if(rp[0] == 0) return -1;
+        if(rp[0] < 0x80){
+          *np = 1;
+          return rp[0];
+        }
+        if(rp[0] >= 0xc2 && rp[0] < 0xe0 && (rp[1] & 0xc0) == 0x80){
+          *np = 2;
+          return ((rp[0] & 0x1f) << 6) | (rp[1] & 0x3f);
+        }
+        if(rp[0] >= 0xe0 && rp[0] < 0xf0 &&
+           (rp[1] & 0xc0) == 0x80 && (rp[2] & 0xc0) == 0x80){
+          int c = ((rp[0] & 0xf) << 12) | ((rp[1] & 0x3f) << 6) | (rp[2] & 0x3f);
+          if(c < 0x800) return -1;
+          *np = 3;
+          return c;
+        }
+        return -1;
+      }
+    };
+  }
+}
+
+#endif /* TINYSEGMENTERXX_BUILDER_H */
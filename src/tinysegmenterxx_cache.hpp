@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) Shunya KIMURA <brmtrain@gmail.com>
+ * Use and distribution of this program is licensed under the
+ * BSD license. See the COPYING file for full text.
+ *
+ * Original version TinySegmenter was written by Taku Kudo <taku@chasen.org>
+ * The license is below.
+ *   TinySegmenter 0.1 -- Super compact Japanese tokenizer in Javascript
+ *   (c) 2008 Taku Kudo <taku@chasen.org>
+ *   TinySegmenter is freely distributable under the terms of a new BSD licence.
+ *   For details, see http://chasen.org/~taku/software/TinySegmenter/LICENCE.txt
+ *   http://www.chasen.org/~taku/software/TinySegmenter/
+ *
+ */
+
+#ifndef TINYSEGMENTERXX_CACHE_H
+#define TINYSEGMENTERXX_CACHE_H
+
+#include <vector>
+#include <mutex>
+#include <stdint.h>
+
+namespace tinysegmenterxx {
+
+  /*! @brief Hit and miss counts of a window cache. */
+  struct CacheStats {
+    uint64_t hits;
+    uint64_t misses;
+
+    /*! @brief This method is used in order to get hits / (hits + misses). */
+    double getHitRate() const
+    {
+      uint64_t total = hits + misses;
+      return total > 0 ? (double)hits / total : 0.0;
+    }
+  };
+
+  /*!
+    @brief Key of a window: the character ID and class code of its six
+    characters, and the p1 to p3 window. Every character unknown to the
+    training data has the same ID, so windows differing only in such
+    characters of the same class share an entry.
+   */
+  struct WindowKey {
+    uint64_t head;
+    uint64_t tail;
+
+    /*!
+      @param w : IDs of the six characters of the window.
+      @param c : Class codes of the six characters of the window.
+      @param pwindow : The p1 to p3 window, see model::getPStateWindow.
+     */
+    WindowKey(const int* w, const int* c, int pwindow)
+    {
+      head = getSlot(w[0], c[0]) | getSlot(w[1], c[1]) << 19 |
+        getSlot(w[2], c[2]) << 38;
+      tail = getSlot(w[3], c[3]) | getSlot(w[4], c[4]) << 19 |
+        getSlot(w[5], c[5]) << 38 | (uint64_t)pwindow << 57 | VALID_BIT;
+    }
+
+    WindowKey() : head(0), tail(0){}
+
+    bool operator==(const WindowKey& key) const
+    {
+      return head == key.head && tail == key.tail;
+    }
+
+    size_t hash() const
+    {
+      uint64_t h = (head ^ (tail * 0x9E3779B97F4A7C15ULL)) * 0xC2B2AE3D27D4EB4FULL;
+      return (size_t)(h >> 32);
+    }
+
+  private:
+    /*! @brief Set in every key, so that an empty entry matches none. */
+    static const uint64_t VALID_BIT = (uint64_t)1 << 63;
+
+    static uint64_t getSlot(int id, int ctype)
+    {
+      return (uint64_t)id | (uint64_t)ctype << 16;
+    }
+  };
+
+  const unsigned int WINDOW_CACHE_DEFAULT_SIZ = 1 << 16;
+
+  /*!
+    @brief Bounded cache from windows to their scores, for one thread.
+    Direct mapped: a new window replaces the one in its entry.
+   */
+  class WindowCache {
+
+  public:
+    /*!
+      @brief Constructor of WindowCache object.
+      @param num : Number of entries, rounded up to a power of 2.
+     */
+    explicit WindowCache(size_t num = WINDOW_CACHE_DEFAULT_SIZ) :
+      mask(0), entries(), stats()
+    {
+      size_t cap = 1;
+      while(cap < num) cap <<= 1;
+      mask = cap - 1;
+      entries.resize(cap);
+      resetStats();
+    }
+
+    /*!
+      @brief This method is used in order to get the score of a window.
+      @return Return true if the window is cached.
+     */
+    bool get(const WindowKey& key, int* score)
+    {
+      const Entry& e = entries[key.hash() & mask];
+      if(e.key == key){
+        *score = e.score;
+        stats.hits++;
+        return true;
+      }
+      stats.misses++;
+      return false;
+    }
+
+    void put(const WindowKey& key, int score)
+    {
+      Entry& e = entries[key.hash() & mask];
+      e.key = key;
+      e.score = score;
+    }
+
+    /*! @brief This method is used in order to forget every window. */
+    void clear()
+    {
+      entries.assign(entries.size(), Entry());
+    }
+
+    const CacheStats& getStats() const
+    {
+      return stats;
+    }
+
+    void resetStats()
+    {
+      stats.hits = 0;
+      stats.misses = 0;
+    }
+
+    /*!
+      @brief This method is used in order to get the cache of the calling
+      thread, created with the default size on first use.
+     */
+    static WindowCache& getThreadCache()
+    {
+      static thread_local WindowCache cache;
+      return cache;
+    }
+
+  private:
+    struct Entry {
+      WindowKey key;
+      int score;
+
+      Entry() : key(), score(0){}
+    };
+
+    size_t mask;
+    std::vector<Entry> entries;
+    CacheStats stats;
+  };
+
+  const unsigned int WINDOW_CACHE_SHARD_NUM = 16;
+
+  /*!
+    @brief Bounded cache from windows to their scores, shared by threads.
+    Windows are spread by hash over shards, each a WindowCache behind its
+    own mutex.
+   */
+  class SharedWindowCache {
+
+  public:
+    /*!
+      @brief Constructor of SharedWindowCache object.
+      @param num : Number of entries of all shards together.
+     */
+    explicit SharedWindowCache(size_t num = WINDOW_CACHE_DEFAULT_SIZ * 4) :
+      shards()
+    {
+      for(unsigned int i = 0; i < WINDOW_CACHE_SHARD_NUM; ++i){
+        shards.push_back(new Shard(num / WINDOW_CACHE_SHARD_NUM));
+      }
+    }
+
+    ~SharedWindowCache()
+    {
+      for(unsigned int i = 0; i < shards.size(); ++i){
+        delete shards[i];
+      }
+    }
+
+    bool get(const WindowKey& key, int* score)
+    {
+      Shard& s = getShard(key);
+      std::lock_guard<std::mutex> lock(s.mutex);
+      return s.cache.get(key, score);
+    }
+
+    void put(const WindowKey& key, int score)
+    {
+      Shard& s = getShard(key);
+      std::lock_guard<std::mutex> lock(s.mutex);
+      s.cache.put(key, score);
+    }
+
+    void clear()
+    {
+      for(unsigned int i = 0; i < shards.size(); ++i){
+        std::lock_guard<std::mutex> lock(shards[i]->mutex);
+        shards[i]->cache.clear();
+      }
+    }
+
+    /*! @brief This method is used in order to get the counts of all shards. */
+    CacheStats getStats()
+    {
+      CacheStats rv = {0, 0};
+      for(unsigned int i = 0; i < shards.size(); ++i){
+        std::lock_guard<std::mutex> lock(shards[i]->mutex);
+        rv.hits += shards[i]->cache.getStats().hits;
+        rv.misses += shards[i]->cache.getStats().misses;
+      }
+      return rv;
+    }
+
+    void resetStats()
+    {
+      for(unsigned int i = 0; i < shards.size(); ++i){
+        std::lock_guard<std::mutex> lock(shards[i]->mutex);
+        shards[i]->cache.resetStats();
+      }
+    }
+
+  private:
+    struct Shard {
+      std::mutex mutex;
+      WindowCache cache;
+
+      explicit Shard(size_t num) : mutex(), cache(num){}
+    };
+
+    std::vector<Shard*> shards;
+
+    SharedWindowCache(const SharedWindowCache&);
+    SharedWindowCache& operator=(const SharedWindowCache&);
+
+    Shard& getShard(const WindowKey& key)
+    {
+      // The low bits pick the entry inside the shard.
+      return *shards[(key.hash() >> 24) % WINDOW_CACHE_SHARD_NUM];
+    }
+  };
+}
+
+#endif /* TINYSEGMENTERXX_CACHE_H */
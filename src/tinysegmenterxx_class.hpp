@@ -0,0 +1,353 @@
+/*
+ * Copyright (C) Shunya KIMURA <brmtrain@gmail.com>
+ * Use and distribution of this program is licensed under the
+ * BSD license. See the COPYING file for full text.
+ *
+ * Original version TinySegmenter was written by Taku Kudo <taku@chasen.org>
+ * The license is below.
+ *   TinySegmenter 0.1 -- Super compact Japanese tokenizer in Javascript
+ *   (c) 2008 Taku Kudo <taku@chasen.org>
+ *   TinySegmenter is freely distributable under the terms of a new BSD licence.
+ *   For details, see http://chasen.org/~taku/software/TinySegmenter/LICENCE.txt
+ *   http://www.chasen.org/~taku/software/TinySegmenter/
+ *
+ */
+
+#ifndef TINYSEGMENTERXX_CLASS_H
+#define TINYSEGMENTERXX_CLASS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "tinysegmenterxx_model.hpp"
+#include "tinysegmenterxx_decode.hpp"
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace tinysegmenterxx {
+
+  namespace model {
+
+    /*! @brief Codepoints first to last, both included, of class ctype. */
+    struct CharRange {
+      uint32_t first;
+      uint32_t last;
+      int ctype;
+    };
+
+    /*!
+      @brief The ranges of util::getCharClass. The kanji numerals are "H"
+      like the rest of the kanji, as getCharClass has always returned.
+     */
+    constexpr CharRange DEFAULT_CHAR_RANGES[] = {
+      {'0', '9', CLASS_N},
+      {'A', 'Z', CLASS_A},
+      {'a', 'z', CLASS_A},
+      {0x3040, 0x309F, CLASS_I},
+      {0x30A0, 0x30FA, CLASS_K},
+      {0x4E00, 0x9FFF, CLASS_H}
+    };
+
+    const size_t DEFAULT_CHAR_RANGE_NUM =
+      sizeof(DEFAULT_CHAR_RANGES) / sizeof(DEFAULT_CHAR_RANGES[0]);
+
+    /*! @brief The CJK block, whose pages are all "H" in the default map. */
+    const uint32_t CJK_FIRST = 0x4E00;
+    const uint32_t CJK_LAST  = 0x9FFF;
+
+    const unsigned int CLASS_PAGE_BITS = 8;
+    const unsigned int CLASS_PAGE_SIZ  = 1 << CLASS_PAGE_BITS;
+    const unsigned int CLASS_PAGE_MASK = CLASS_PAGE_SIZ - 1;
+    const unsigned int CLASS_PAGE_NUM  = 0x110000 >> CLASS_PAGE_BITS;
+
+    /*! @brief Number of distinct pages a CharClassMap can hold. */
+    const unsigned int CLASS_PAGE_MAX  = 64;
+
+    /*!
+      @brief Two level table from every codepoint to its class code. The
+      first level maps the high bits of a codepoint to one of the distinct
+      pages of the second level. Page 0 is all CLASS_O.
+      @attention The sentinels are always CLASS_O. Codepoints above U+10FFFF
+      read the last page. A map of ranges needing more than CLASS_PAGE_MAX
+      distinct pages is not valid, see isValid.
+
+      A map agreeing with DEFAULT_CHAR_RANGES outside the CJK block, such as
+      the default one or one with "M" for the numbers in Kanji, classifies
+      buffers with range compares in vector registers. Where such a map is
+      not all "H" in the CJK block, vectors holding CJK codepoints fall back
+      to the table.
+     */
+    class CharClassMap {
+
+    public:
+      /*!
+        @brief Constructor of CharClassMap object, usable at compile time.
+        @param ranges : The ranges of the classes. A later range overrides
+        an earlier one, codepoints in none are CLASS_O.
+        @param num : Number of ranges.
+       */
+      constexpr CharClassMap(const CharRange* ranges, size_t num) :
+        pageIds(), pages(), pageNum(1), rangeClasses(true), hanClasses(true),
+        valid(true)
+      {
+        for(uint32_t p = 0; p < CLASS_PAGE_NUM; ++p){
+          bool cjk = p >= CJK_FIRST >> CLASS_PAGE_BITS && p <= CJK_LAST >> CLASS_PAGE_BITS;
+          if(!isCovered(ranges, num, p)){
+            if(cjk){
+              hanClasses = false;
+            } else if(isCovered(DEFAULT_CHAR_RANGES, DEFAULT_CHAR_RANGE_NUM, p)){
+              rangeClasses = false;
+            }
+            continue;
+          }
+          // The page after the last one is room for the new page.
+          uint8_t* page = pages + pageNum * CLASS_PAGE_SIZ;
+          for(uint32_t i = 0; i < CLASS_PAGE_SIZ; ++i){
+            page[i] = getRangeClass(ranges, num, p << CLASS_PAGE_BITS | i);
+          }
+          unsigned int id = 0;
+          while(id < pageNum && !isSamePage(pages + id * CLASS_PAGE_SIZ, page)) id++;
+          if(id == pageNum){
+            if(pageNum == CLASS_PAGE_MAX){
+              reject();
+              return;
+            }
+            pageNum++;
+          }
+          pageIds[p] = id;
+          for(uint32_t i = 0; i < CLASS_PAGE_SIZ; ++i){
+            uint32_t c = p << CLASS_PAGE_BITS | i;
+            if(cjk){
+              if(page[i] != CLASS_H) hanClasses = false;
+            } else if(page[i] != getRangeClass(DEFAULT_CHAR_RANGES,
+                                               DEFAULT_CHAR_RANGE_NUM, c)){
+              rangeClasses = false;
+            }
+          }
+        }
+      }
+
+      int getClass(uint32_t c) const
+      {
+        uint32_t p = c >> CLASS_PAGE_BITS;
+        if(p >= CLASS_PAGE_NUM) p = CLASS_PAGE_NUM - 1;
+        return pages[pageIds[p] << CLASS_PAGE_BITS | (c & CLASS_PAGE_MASK)];
+      }
+
+      /*!
+        @brief This method is used in order to get the class codes of a
+        buffer of codepoints. Ranges are compared 16 codepoints at a time,
+        or 32 if util::getSimdLevel finds AVX2.
+        @param ary : The codepoints.
+        @param num : Number of codepoints in ary.
+        @param classes : The region for storing num class codes.
+       */
+      void getClasses(const uint32_t* ary, size_t num, int* classes) const
+      {
+        size_t i = 0;
+#if defined(__SSE2__)
+        if(rangeClasses && util::getSimdLevel() >= util::SIMD_AVX2){
+          i = getClassesAvx2(ary, num, classes);
+        } else if(rangeClasses){
+          for(; i + 16 <= num; i += 16){
+            for(size_t j = i; j < i + 16; j += 4){
+              __m128i c = _mm_loadu_si128((const __m128i*)(ary + j));
+              __m128i cjk;
+              _mm_storeu_si128((__m128i*)(classes + j), getRangeClasses(c, &cjk));
+              if(!hanClasses && _mm_movemask_epi8(cjk)) getTableClasses(ary, j, 4, classes);
+            }
+          }
+        }
+#endif
+        getTableClasses(ary, i, num - i, classes);
+      }
+
+      /*!
+        @brief This method is used in order to tell whether getClasses
+        compares ranges in vector registers for this map.
+       */
+      bool hasRangeClasses() const
+      {
+#if defined(__SSE2__)
+        return rangeClasses;
+#else
+        return false;
+#endif
+      }
+
+      /*!
+        @brief This method is used in order to tell whether the ranges fit in
+        CLASS_PAGE_MAX pages. A map which is not valid is all CLASS_O, and
+        Segmenter::setCharClassMap refuses it.
+       */
+      constexpr bool isValid() const
+      {
+        return valid;
+      }
+
+      /*! @brief This method is used in order to get the size of the tables. */
+      size_t getSize() const
+      {
+        return sizeof(pageIds) + pageNum * CLASS_PAGE_SIZ;
+      }
+
+    private:
+      uint8_t pageIds[CLASS_PAGE_NUM];
+
+      uint8_t pages[(CLASS_PAGE_MAX + 1) * CLASS_PAGE_SIZ];
+
+      unsigned int pageNum;
+
+      /*! @brief Whether the map is DEFAULT_CHAR_RANGES outside the CJK block. */
+      bool rangeClasses;
+
+      /*! @brief Whether the CJK block is all "H". */
+      bool hanClasses;
+
+      bool valid;
+
+      /*! @brief Make the map all CLASS_O, for ranges which do not fit. */
+      constexpr void reject()
+      {
+        for(uint32_t p = 0; p < CLASS_PAGE_NUM; ++p) pageIds[p] = 0;
+        for(uint32_t i = 0; i < CLASS_PAGE_SIZ; ++i) pages[i] = CLASS_O;
+        pageNum = 1;
+        rangeClasses = false;
+        hanClasses = false;
+        valid = false;
+      }
+
+      void getTableClasses(const uint32_t* ary, size_t begin, size_t num,
+                           int* classes) const
+      {
+        for(size_t i = begin; i < begin + num; ++i){
+          classes[i] = getClass(ary[i]);
+        }
+      }
+
+#if defined(__SSE2__)
+      /*!
+        @brief This method is used in order to get the class codes of the
+        codepoints of ary 32 at a time, like getClasses. Needs AVX2.
+        @return Number of the codepoints classified.
+       */
+      __attribute__((target("avx2")))
+      size_t getClassesAvx2(const uint32_t* ary, size_t num, int* classes) const
+      {
+        size_t i = 0;
+        for(; i + 32 <= num; i += 32){
+          for(size_t j = i; j < i + 32; j += 8){
+            __m256i c = _mm256_loadu_si256((const __m256i*)(ary + j));
+            __m256i cjk;
+            _mm256_storeu_si256((__m256i*)(classes + j), getRangeClasses(c, &cjk));
+            if(!hanClasses && !_mm256_testz_si256(cjk, cjk)) getTableClasses(ary, j, 8, classes);
+          }
+        }
+        return i;
+      }
+
+      __attribute__((target("avx2")))
+      static __m256i isInRange(__m256i c, int first, int last)
+      {
+        return _mm256_and_si256(_mm256_cmpgt_epi32(c, _mm256_set1_epi32(first - 1)),
+                                _mm256_cmpgt_epi32(_mm256_set1_epi32(last + 1), c));
+      }
+
+      /*!
+        @brief This method is used in order to get the class codes of 8
+        codepoints by the ranges of DEFAULT_CHAR_RANGES.
+        @param cjk : The region for storing the mask of the CJK codepoints.
+       */
+      __attribute__((target("avx2")))
+      static __m256i getRangeClasses(__m256i c, __m256i* cjk)
+      {
+        // 'A' to 'Z' are 'a' to 'z' with bit 5 set, and no other codepoint is.
+        __m256i letter = _mm256_or_si256(c, _mm256_set1_epi32(0x20));
+        *cjk = isInRange(c, CJK_FIRST, CJK_LAST);
+        __m256i rv = _mm256_and_si256(isInRange(letter, 'a', 'z'), _mm256_set1_epi32(CLASS_A));
+        rv = _mm256_or_si256(rv, _mm256_and_si256(isInRange(c, '0', '9'),
+                                                  _mm256_set1_epi32(CLASS_N)));
+        rv = _mm256_or_si256(rv, _mm256_and_si256(isInRange(c, 0x3040, 0x309F),
+                                                  _mm256_set1_epi32(CLASS_I)));
+        rv = _mm256_or_si256(rv, _mm256_and_si256(isInRange(c, 0x30A0, 0x30FA),
+                                                  _mm256_set1_epi32(CLASS_K)));
+        return _mm256_or_si256(rv, _mm256_and_si256(*cjk, _mm256_set1_epi32(CLASS_H)));
+      }
+
+      static __m128i isInRange(__m128i c, int first, int last)
+      {
+        return _mm_and_si128(_mm_cmpgt_epi32(c, _mm_set1_epi32(first - 1)),
+                             _mm_cmplt_epi32(c, _mm_set1_epi32(last + 1)));
+      }
+
+      /*!
+        @brief This method is used in order to get the class codes of 4
+        codepoints by the ranges of DEFAULT_CHAR_RANGES.
+        @param cjk : The region for storing the mask of the CJK codepoints.
+       */
+      static __m128i getRangeClasses(__m128i c, __m128i* cjk)
+      {
+        // 'A' to 'Z' are 'a' to 'z' with bit 5 set, and no other codepoint is.
+        __m128i letter = _mm_or_si128(c, _mm_set1_epi32(0x20));
+        *cjk = isInRange(c, CJK_FIRST, CJK_LAST);
+        __m128i rv = _mm_and_si128(isInRange(letter, 'a', 'z'), _mm_set1_epi32(CLASS_A));
+        rv = _mm_or_si128(rv, _mm_and_si128(isInRange(c, '0', '9'),
+                                            _mm_set1_epi32(CLASS_N)));
+        rv = _mm_or_si128(rv, _mm_and_si128(isInRange(c, 0x3040, 0x309F),
+                                            _mm_set1_epi32(CLASS_I)));
+        rv = _mm_or_si128(rv, _mm_and_si128(isInRange(c, 0x30A0, 0x30FA),
+                                            _mm_set1_epi32(CLASS_K)));
+        return _mm_or_si128(rv, _mm_and_si128(*cjk, _mm_set1_epi32(CLASS_H)));
+      }
+#endif
+
+      static constexpr bool isCovered(const CharRange* ranges, size_t num, uint32_t p)
+      {
+        for(size_t i = 0; i < num; ++i){
+          if(ranges[i].first >> CLASS_PAGE_BITS <= p &&
+             ranges[i].last >> CLASS_PAGE_BITS >= p) return true;
+        }
+        return false;
+      }
+
+      static constexpr uint8_t getRangeClass(const CharRange* ranges, size_t num,
+                                             uint32_t c)
+      {
+        int ctype = CLASS_O;
+        if(c >= SENTINEL_B2) return ctype;
+        for(size_t i = 0; i < num; ++i){
+          if(c >= ranges[i].first && c <= ranges[i].last) ctype = ranges[i].ctype;
+        }
+        return ctype;
+      }
+
+      static constexpr bool isSamePage(const uint8_t* a, const uint8_t* b)
+      {
+        for(uint32_t i = 0; i < CLASS_PAGE_SIZ; ++i){
+          if(a[i] != b[i]) return false;
+        }
+        return true;
+      }
+    };
+
+    /*!
+      @brief This method is used in order to get the map of util::getCharClass,
+      built at compile time.
+     */
+    inline const CharClassMap& getDefaultCharClassMap()
+    {
+      static constexpr CharClassMap map(DEFAULT_CHAR_RANGES, DEFAULT_CHAR_RANGE_NUM);
+      return map;
+    }
+
+    /*! @brief This method is used in order to get the name of a class code. */
+    inline const char* getClassName(int ctype)
+    {
+      static const char* names[CLASS_NUM] = {"O", "A", "N", "I", "K", "M", "H"};
+      return names[ctype];
+    }
+  }
+}
+
+#endif /* TINYSEGMENTERXX_CLASS_H */
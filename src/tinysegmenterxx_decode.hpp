@@ -0,0 +1,519 @@
+/*
+ * Copyright (C) Shunya KIMURA <brmtrain@gmail.com>
+ * Use and distribution of this program is licensed under the
+ * BSD license. See the COPYING file for full text.
+ *
+ * Original version TinySegmenter was written by Taku Kudo <taku@chasen.org>
+ * The license is below.
+ *   TinySegmenter 0.1 -- Super compact Japanese tokenizer in Javascript
+ *   (c) 2008 Taku Kudo <taku@chasen.org>
+ *   TinySegmenter is freely distributable under the terms of a new BSD licence.
+ *   For details, see http://chasen.org/~taku/software/TinySegmenter/LICENCE.txt
+ *   http://www.chasen.org/~taku/software/TinySegmenter/
+ *
+ */
+
+#ifndef TINYSEGMENTERXX_DECODE_H
+#define TINYSEGMENTERXX_DECODE_H
+
+#include <cstddef>
+#include <stdint.h>
+#include "tinysegmenterxx_jis.hpp"
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace tinysegmenterxx {
+
+  /*! @brief Encodings of byte input. */
+  enum Encoding {
+    ENCODING_UTF8, ENCODING_SJIS, ENCODING_EUCJP
+  };
+
+  namespace util {
+
+    /*!
+      @brief This method is used in order to decode the charcter at pos the
+      way utftoucs does, and move pos past it. Bytes from len on read as NUL.
+      An invalid lead byte or a lead byte missing its continuation bytes is
+      skipped alone, and four byte charcters are skipped byte by byte.
+     */
+    inline void decodeUtf8Char(const unsigned char* rp, size_t len, size_t* pos,
+                               uint32_t* ary, uint32_t* offsets, size_t* wi)
+    {
+      size_t i = *pos;
+      unsigned int c = rp[i];
+      unsigned int c1 = i + 1 < len ? rp[i + 1] : 0;
+      if(c < 0x80){
+        if(offsets) offsets[*wi] = i;
+        ary[(*wi)++] = c;
+        *pos = i + 1;
+      } else if(c < 0xe0){
+        if(c1 >= 0x80){
+          if(offsets) offsets[*wi] = i;
+          ary[(*wi)++] = ((c & 0x1f) << 6) | (c1 & 0x3f);
+          *pos = i + 2;
+        } else {
+          *pos = i + 1;
+        }
+      } else if(c < 0xf0){
+        unsigned int c2 = i + 2 < len ? rp[i + 2] : 0;
+        if(c1 >= 0x80 && c2 >= 0x80){
+          if(offsets) offsets[*wi] = i;
+          ary[(*wi)++] = ((c & 0xf) << 12) | ((c1 & 0x3f) << 6) | (c2 & 0x3f);
+          *pos = i + 3;
+        } else {
+          *pos = i + 1;
+        }
+      } else {
+        *pos = i + 1;
+      }
+    }
+
+    /*!
+      @brief This method is used in order to decode utf charcters one at a
+      time, with the results of utftoucs. It is the reference of decodeUtf8.
+      @param str : The pointer to the utf charcters.
+      @param len : Number of bytes in str. Decoding also stops at a NUL byte,
+      like utftoucs.
+      @param ary : The region for storing the unicode charcters, len entries.
+      @param offsets : The region for storing the byte offset of every
+      charcter and, after the last one, the offset where decoding stopped.
+      len + 1 entries, or NULL.
+      @return Number of charcters.
+     */
+    inline size_t decodeUtf8Scalar(const char* str, size_t len, uint32_t* ary,
+                                   uint32_t* offsets)
+    {
+      const unsigned char* rp = (const unsigned char*)str;
+      size_t pos = 0;
+      size_t wi = 0;
+      while(pos < len && rp[pos] != 0){
+        decodeUtf8Char(rp, len, &pos, ary, offsets, &wi);
+      }
+      if(offsets) offsets[wi] = pos;
+      return wi;
+    }
+
+#if defined(__SSE2__)
+    /*! @brief This method is used in order to store 16 bytes as 16 codepoints. */
+    inline void storeAscii(__m128i v, uint32_t* ary)
+    {
+      __m128i zero = _mm_setzero_si128();
+      __m128i lo = _mm_unpacklo_epi8(v, zero);
+      __m128i hi = _mm_unpackhi_epi8(v, zero);
+      _mm_storeu_si128((__m128i*)ary, _mm_unpacklo_epi16(lo, zero));
+      _mm_storeu_si128((__m128i*)(ary + 4), _mm_unpackhi_epi16(lo, zero));
+      _mm_storeu_si128((__m128i*)(ary + 8), _mm_unpacklo_epi16(hi, zero));
+      _mm_storeu_si128((__m128i*)(ary + 12), _mm_unpackhi_epi16(hi, zero));
+    }
+
+    /*!
+      @brief This method is used in order to store the offsets pos, pos + step
+      and so on, for num charcters rounded up to 4.
+     */
+    inline void storeOffsets(size_t pos, int step, int num, uint32_t* offsets)
+    {
+      __m128i v = _mm_add_epi32(_mm_set1_epi32((int)pos),
+                                _mm_setr_epi32(0, step, step * 2, step * 3));
+      __m128i inc = _mm_set1_epi32(step * 4);
+      for(int i = 0; i < num; i += 4){
+        _mm_storeu_si128((__m128i*)(offsets + i), v);
+        v = _mm_add_epi32(v, inc);
+      }
+    }
+#endif
+
+#if defined(__SSE2__)
+    /*!
+      @brief This method is used in order to widen the ASCII bytes at pos,
+      16 bytes or those in front of a byte which is not ASCII.
+      Every store stays inside ary: wi <= pos and pos + 16 <= len.
+      @return Whether any byte was decoded.
+     */
+    inline bool decodeAsciiBlock(const unsigned char* rp, size_t len, size_t* pos,
+                                 uint32_t* ary, uint32_t* offsets, size_t* wi)
+    {
+      if(*pos + 16 > len) return false;
+      __m128i v = _mm_loadu_si128((const __m128i*)(rp + *pos));
+      int stop = _mm_movemask_epi8(v) |
+        _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128()));
+      if(stop & 1) return false;
+      int num = stop ? __builtin_ctz(stop) : 16;
+      storeAscii(v, ary + *wi);
+      if(offsets) storeOffsets(*pos, 1, num, offsets + *wi);
+      *pos += num;
+      *wi += num;
+      return true;
+    }
+
+    /*!
+      @brief This method is used in order to decode five three byte
+      charcters at pos with two shuffles.
+      @return Whether the 15 bytes at pos are five three byte charcters.
+     */
+    __attribute__((target("ssse3")))
+    inline bool decodeKanaBlock(const unsigned char* rp, size_t len, size_t* pos,
+                                uint32_t* ary, uint32_t* offsets, size_t* wi)
+    {
+      if(*pos + 16 > len) return false;
+      __m128i v = _mm_loadu_si128((const __m128i*)(rp + *pos));
+      int high = _mm_movemask_epi8(v);
+      int lead = _mm_movemask_epi8(
+        _mm_cmpeq_epi8(_mm_and_si128(v, _mm_set1_epi8((char)0xf0)),
+                       _mm_set1_epi8((char)0xe0)));
+      if((high & 0x7fff) != 0x7fff || (lead & 0x1249) != 0x1249) return false;
+      // Lanes of 16 bits: the two continuation bytes, and the lead byte.
+      __m128i cont = _mm_shuffle_epi8(v, _mm_setr_epi8(2, 1, 5, 4, 8, 7, 11, 10,
+                                                       14, 13, -1, -1, -1, -1, -1, -1));
+      __m128i head = _mm_shuffle_epi8(v, _mm_setr_epi8(0, -1, 3, -1, 6, -1, 9, -1,
+                                                       12, -1, -1, -1, -1, -1, -1, -1));
+      __m128i cp = _mm_or_si128(
+        _mm_and_si128(cont, _mm_set1_epi16(0x3f)),
+        _mm_srli_epi16(_mm_and_si128(cont, _mm_set1_epi16(0x3f00)), 2));
+      cp = _mm_or_si128(cp, _mm_slli_epi16(_mm_and_si128(head, _mm_set1_epi16(0xf)), 12));
+      __m128i zero = _mm_setzero_si128();
+      _mm_storeu_si128((__m128i*)(ary + *wi), _mm_unpacklo_epi16(cp, zero));
+      _mm_storeu_si128((__m128i*)(ary + *wi + 4), _mm_unpackhi_epi16(cp, zero));
+      if(offsets) storeOffsets(*pos, 3, 5, offsets + *wi);
+      *pos += 15;
+      *wi += 5;
+      return true;
+    }
+
+    /*!
+      @brief This method is used in order to widen 32 ASCII bytes at pos.
+      @return Whether the 32 bytes at pos are ASCII with no NUL.
+     */
+    __attribute__((target("avx2")))
+    inline bool decodeAsciiBlock32(const unsigned char* rp, size_t len, size_t* pos,
+                                   uint32_t* ary, uint32_t* offsets, size_t* wi)
+    {
+      if(*pos + 32 > len) return false;
+      __m256i v = _mm256_loadu_si256((const __m256i*)(rp + *pos));
+      __m256i bad = _mm256_or_si256(v, _mm256_cmpeq_epi8(v, _mm256_setzero_si256()));
+      if(_mm256_movemask_epi8(bad) != 0) return false;
+      for(int i = 0; i < 32; i += 8){
+        __m128i b = _mm_loadl_epi64((const __m128i*)(rp + *pos + i));
+        _mm256_storeu_si256((__m256i*)(ary + *wi + i), _mm256_cvtepu8_epi32(b));
+      }
+      if(offsets) storeOffsets(*pos, 1, 32, offsets + *wi);
+      *pos += 32;
+      *wi += 32;
+      return true;
+    }
+
+    /*!
+      @brief This method is used in order to decode utf charcters with the
+      results of decodeUtf8Scalar, 16 bytes at a time where it can: a block
+      of ASCII bytes is widened as a whole, and a block of five three byte
+      charcters is decoded with two shuffles. Needs SSSE3.
+      @param str : The pointer to the utf charcters.
+      @param len : Number of bytes in str. Decoding also stops at a NUL byte.
+      @param ary : The region for storing the unicode charcters, len entries.
+      @param offsets : The region for storing len + 1 offsets, or NULL.
+      @return Number of charcters.
+     */
+    __attribute__((target("ssse3")))
+    inline size_t decodeUtf8Ssse3(const char* str, size_t len, uint32_t* ary,
+                                  uint32_t* offsets)
+    {
+      const unsigned char* rp = (const unsigned char*)str;
+      size_t pos = 0;
+      size_t wi = 0;
+      while(pos < len){
+        if(decodeAsciiBlock(rp, len, &pos, ary, offsets, &wi)) continue;
+        if(decodeKanaBlock(rp, len, &pos, ary, offsets, &wi)) continue;
+        if(rp[pos] == 0) break;
+        decodeUtf8Char(rp, len, &pos, ary, offsets, &wi);
+      }
+      if(offsets) offsets[wi] = pos;
+      return wi;
+    }
+
+    /*!
+      @brief decodeUtf8Ssse3 which widens 32 ASCII bytes at a time after a
+      full block of 16, so that Japanese text does not pay for trying them.
+      Needs AVX2.
+     */
+    __attribute__((target("avx2")))
+    inline size_t decodeUtf8Avx2(const char* str, size_t len, uint32_t* ary,
+                                 uint32_t* offsets)
+    {
+      const unsigned char* rp = (const unsigned char*)str;
+      size_t pos = 0;
+      size_t wi = 0;
+      while(pos < len){
+        if(decodeAsciiBlock(rp, len, &pos, ary, offsets, &wi)){
+          while(decodeAsciiBlock32(rp, len, &pos, ary, offsets, &wi));
+          continue;
+        }
+        if(decodeKanaBlock(rp, len, &pos, ary, offsets, &wi)) continue;
+        if(rp[pos] == 0) break;
+        decodeUtf8Char(rp, len, &pos, ary, offsets, &wi);
+      }
+      if(offsets) offsets[wi] = pos;
+      return wi;
+    }
+
+    /*! @brief Instruction sets decodeUtf8 can use. */
+    enum SimdLevel {
+      SIMD_NONE, SIMD_SSSE3, SIMD_AVX2
+    };
+
+    /*! @brief This method is used in order to get the SimdLevel of the cpu. */
+    inline SimdLevel getSimdLevel()
+    {
+      static const SimdLevel level = __builtin_cpu_supports("avx2") ? SIMD_AVX2 :
+        __builtin_cpu_supports("ssse3") ? SIMD_SSSE3 : SIMD_NONE;
+      return level;
+    }
+#endif
+
+    /*!
+      @brief This method is used in order to decode utf charcters with the
+      results of decodeUtf8Scalar, with decodeUtf8Ssse3 if the cpu supports
+      it. With SSE2 alone the scalar loop is faster, so it is used then.
+      decodeUtf8Avx2 is not picked, since segmenterxxbench measures it slower
+      than decodeUtf8Ssse3.
+      @param str : The pointer to the utf charcters.
+      @param len : Number of bytes in str. Decoding also stops at a NUL byte.
+      @param ary : The region for storing the unicode charcters, len entries.
+      @param offsets : The region for storing len + 1 offsets, or NULL.
+      @return Number of charcters.
+     */
+    inline size_t decodeUtf8(const char* str, size_t len, uint32_t* ary,
+                             uint32_t* offsets)
+    {
+#if defined(__SSE2__)
+      SimdLevel level = getSimdLevel();
+      if(level >= SIMD_SSSE3) return decodeUtf8Ssse3(str, len, ary, offsets);
+#endif
+      return decodeUtf8Scalar(str, len, ary, offsets);
+    }
+
+    /*!
+      @brief This method is used in order to tell whether the bytes str[begin]
+      to str[end] decoded to c are exactly what ucstoutf writes for c, so that
+      they can be copied instead of encoded again. They are not when bytes
+      were skipped or the charcter was malformed.
+     */
+    inline bool isExactUtf8(const char* str, uint32_t c, uint32_t begin,
+                            uint32_t end)
+    {
+      const unsigned char* rp = (const unsigned char*)str + begin;
+      if(c < 0x80) return end - begin == 1;
+      if(c < 0x800) return end - begin == 2 && rp[0] >= 0xc0 && rp[1] < 0xc0;
+      return end - begin == 3 && rp[1] < 0xc0 && rp[2] < 0xc0;
+    }
+
+    /*!
+      @brief This method is used in order to decode utf-16 charcters, 8 code
+      units at a time where none of them is a surrogate. A surrogate pair
+      gives its codepoint, and a lone surrogate is kept as it is, so every
+      code unit belongs to a charcter. Codepoints of the sentinels give the
+      codepoint before them, which is classified the same.
+      @param str : The pointer to the utf-16 charcters.
+      @param len : Number of code units in str.
+      @param ary : The region for storing the unicode charcters, len entries.
+      @param offsets : The region for storing the code unit offset of every
+      charcter and, after the last one, len. len + 1 entries, or NULL.
+      @return Number of charcters.
+     */
+    inline size_t decodeUtf16(const char16_t* str, size_t len, uint32_t* ary,
+                              uint32_t* offsets)
+    {
+      size_t pos = 0;
+      size_t wi = 0;
+      while(pos < len){
+#if defined(__SSE2__)
+        if(pos + 8 <= len){
+          __m128i v = _mm_loadu_si128((const __m128i*)(str + pos));
+          __m128i high = _mm_and_si128(v, _mm_set1_epi16((short)0xF800));
+          if(!_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_set1_epi16((short)0xD800)))){
+            __m128i zero = _mm_setzero_si128();
+            _mm_storeu_si128((__m128i*)(ary + wi), _mm_unpacklo_epi16(v, zero));
+            _mm_storeu_si128((__m128i*)(ary + wi + 4), _mm_unpackhi_epi16(v, zero));
+            if(offsets) storeOffsets(pos, 1, 8, offsets + wi);
+            pos += 8;
+            wi += 8;
+            continue;
+          }
+        }
+#endif
+        uint32_t c = str[pos];
+        if(offsets) offsets[wi] = pos;
+        if(c >= 0xD800 && c < 0xDC00 && pos + 1 < len &&
+           str[pos + 1] >= 0xDC00 && str[pos + 1] < 0xE000){
+          c = 0x10000 + ((c - 0xD800) << 10) + (str[pos + 1] - 0xDC00);
+          // model::SENTINEL_B2 and the codepoints after it are the sentinels.
+          if(c >= 0x10FFF0) c = 0x10FFEF;
+          pos++;
+        }
+        ary[wi++] = c;
+        pos++;
+      }
+      if(offsets) offsets[wi] = pos;
+      return wi;
+    }
+
+    /*! @brief The charcter of the bytes no charcter is decoded from. */
+    const uint32_t REPLACEMENT_CHAR = 0xFFFD;
+
+    /*!
+      @brief This method is used in order to get the codepoint of a JIS X
+      0208 charcter.
+      @param row : The row, from 0.
+      @param cell : The cell, from 0.
+     */
+    inline uint32_t getJisCode(unsigned int row, unsigned int cell)
+    {
+      if(row >= 94) return REPLACEMENT_CHAR;
+      uint32_t c = jis::JIS0208_CODES[row * 94 + cell];
+      return c ? c : REPLACEMENT_CHAR;
+    }
+
+    /*! @brief Full-width charcter of every half-width one, U+FF61 to U+FF9F. */
+    constexpr uint16_t HALFWIDTH_KANA_CODES[] = {
+      0x3002, 0x300C, 0x300D, 0x3001, 0x30FB, 0x30F2, 0x30A1, 0x30A3,
+      0x30A5, 0x30A7, 0x30A9, 0x30E3, 0x30E5, 0x30E7, 0x30C3, 0x30FC,
+      0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD, 0x30AF,
+      0x30B1, 0x30B3, 0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD, 0x30BF,
+      0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC, 0x30CD,
+      0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE, 0x30DF,
+      0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9, 0x30EA,
+      0x30EB, 0x30EC, 0x30ED, 0x30EF, 0x30F3, 0x309B, 0x309C
+    };
+
+    /*!
+      @brief This method is used in order to get the canonical form of a
+      charcter for the features: full-width ASCII gives ASCII, and half-width
+      katakana and punctuation give the full-width ones, the voiced sound
+      marks the spacing U+309B and U+309C. Other charcters are kept.
+      @param c : The unicode charcter.
+     */
+    constexpr uint32_t foldWidth(uint32_t c)
+    {
+      return c < 0xFF01 || c > 0xFF9F ? c :
+        c <= 0xFF5E ? c - 0xFEE0 :
+        c >= 0xFF61 ? HALFWIDTH_KANA_CODES[c - 0xFF61] : c;
+    }
+
+    /*!
+      @brief This method is used in order to decode 16 bytes at pos if all
+      of them are ASCII.
+      @return Return true if they were.
+     */
+    inline bool decodeAscii(const unsigned char* rp, size_t len, size_t* pos,
+                            uint32_t* ary, uint32_t* offsets, size_t* wi)
+    {
+#if defined(__SSE2__)
+      if(*pos + 16 <= len){
+        __m128i v = _mm_loadu_si128((const __m128i*)(rp + *pos));
+        if(!_mm_movemask_epi8(v)){
+          storeAscii(v, ary + *wi);
+          if(offsets) storeOffsets(*pos, 1, 16, offsets + *wi);
+          *pos += 16;
+          *wi += 16;
+          return true;
+        }
+      }
+#endif
+      return false;
+    }
+
+    /*!
+      @brief This method is used in order to decode Shift_JIS charcters:
+      ASCII, half width katakana and JIS X 0208. Every other byte, and a
+      lead byte without its trail byte, gives REPLACEMENT_CHAR, so every
+      byte belongs to a charcter.
+      @param str : The pointer to the Shift_JIS charcters.
+      @param len : Number of bytes in str.
+      @param ary : The region for storing the unicode charcters, len entries.
+      @param offsets : The region for storing len + 1 offsets, or NULL.
+      @return Number of charcters.
+     */
+    inline size_t decodeShiftJis(const char* str, size_t len, uint32_t* ary,
+                                 uint32_t* offsets)
+    {
+      const unsigned char* rp = (const unsigned char*)str;
+      size_t pos = 0;
+      size_t wi = 0;
+      while(pos < len){
+        if(decodeAscii(rp, len, &pos, ary, offsets, &wi)) continue;
+        unsigned int c = rp[pos];
+        unsigned int t = pos + 1 < len ? rp[pos + 1] : 0;
+        if(offsets) offsets[wi] = pos;
+        if(c < 0x80){
+          ary[wi++] = c;
+          pos++;
+        } else if(c >= 0xA1 && c <= 0xDF){
+          ary[wi++] = 0xFF61 + c - 0xA1;
+          pos++;
+        } else if(((c >= 0x81 && c <= 0x9F) || (c >= 0xE0 && c <= 0xFC)) &&
+                  t >= 0x40 && t <= 0xFC && t != 0x7F){
+          // Every lead byte covers two rows, the trail bytes from 0x9F the second.
+          unsigned int row = (c < 0xA0 ? c - 0x81 : c - 0xC1) * 2;
+          unsigned int cell = t - (t < 0x7F ? 0x40 : 0x41);
+          if(t >= 0x9F){
+            row++;
+            cell = t - 0x9F;
+          }
+          ary[wi++] = getJisCode(row, cell);
+          pos += 2;
+        } else {
+          ary[wi++] = REPLACEMENT_CHAR;
+          pos++;
+        }
+      }
+      if(offsets) offsets[wi] = pos;
+      return wi;
+    }
+
+    /*!
+      @brief This method is used in order to decode EUC-JP charcters: ASCII,
+      half width katakana and JIS X 0208. JIS X 0212 charcters give one
+      REPLACEMENT_CHAR, and so does every other byte.
+      @param str : The pointer to the EUC-JP charcters.
+      @param len : Number of bytes in str.
+      @param ary : The region for storing the unicode charcters, len entries.
+      @param offsets : The region for storing len + 1 offsets, or NULL.
+      @return Number of charcters.
+     */
+    inline size_t decodeEucJp(const char* str, size_t len, uint32_t* ary,
+                              uint32_t* offsets)
+    {
+      const unsigned char* rp = (const unsigned char*)str;
+      size_t pos = 0;
+      size_t wi = 0;
+      while(pos < len){
+        if(decodeAscii(rp, len, &pos, ary, offsets, &wi)) continue;
+        unsigned int c = rp[pos];
+        unsigned int c1 = pos + 1 < len ? rp[pos + 1] : 0;
+        unsigned int c2 = pos + 2 < len ? rp[pos + 2] : 0;
+        if(offsets) offsets[wi] = pos;
+        if(c < 0x80){
+          ary[wi++] = c;
+          pos++;
+        } else if(c == 0x8E && c1 >= 0xA1 && c1 <= 0xDF){
+          ary[wi++] = 0xFF61 + c1 - 0xA1;
+          pos += 2;
+        } else if(c == 0x8F && c1 >= 0xA1 && c1 <= 0xFE && c2 >= 0xA1 && c2 <= 0xFE){
+          ary[wi++] = REPLACEMENT_CHAR;
+          pos += 3;
+        } else if(c >= 0xA1 && c <= 0xFE && c1 >= 0xA1 && c1 <= 0xFE){
+          ary[wi++] = getJisCode(c - 0xA1, c1 - 0xA1);
+          pos += 2;
+        } else {
+          ary[wi++] = REPLACEMENT_CHAR;
+          pos++;
+        }
+      }
+      if(offsets) offsets[wi] = pos;
+      return wi;
+    }
+  }
+}
+
+#endif /* TINYSEGMENTERXX_DECODE_H */
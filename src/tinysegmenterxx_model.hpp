@@ -0,0 +1,720 @@
+/*
+ * Copyright (C) Shunya KIMURA <brmtrain@gmail.com>
+ * Use and distribution of this program is licensed under the
+ * BSD license. See the COPYING file for full text.
+ *
+ * Original version TinySegmenter was written by Taku Kudo <taku@chasen.org>
+ * The license is below.
+ *   TinySegmenter 0.1 -- Super compact Japanese tokenizer in Javascript
+ *   (c) 2008 Taku Kudo <taku@chasen.org>
+ *   TinySegmenter is freely distributable under the terms of a new BSD licence.
+ *   For details, see http://chasen.org/~taku/software/TinySegmenter/LICENCE.txt
+ *   http://www.chasen.org/~taku/software/TinySegmenter/
+ *
+ */
+
+#ifndef TINYSEGMENTERXX_MODEL_H
+#define TINYSEGMENTERXX_MODEL_H
+
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <cassert>
+#include <stdint.h>
+
+namespace tinysegmenterxx {
+
+  namespace model {
+
+    /*! @brief Feature templates, in the order getScore evaluates them. */
+    enum Template {
+      T_UP1, T_UP2, T_UP3, T_BP1, T_BP2,
+      T_UW1, T_UW2, T_UW3, T_UW4, T_UW5, T_UW6,
+      T_BW1, T_BW2, T_BW3,
+      T_TW1, T_TW2, T_TW3, T_TW4,
+      T_UC1, T_UC2, T_UC3, T_UC4, T_UC5, T_UC6,
+      T_BC1, T_BC2, T_BC3,
+      T_TC1, T_TC2, T_TC3, T_TC4,
+      T_UQ1, T_UQ2, T_UQ3,
+      T_BQ1, T_BQ2, T_BQ3, T_BQ4,
+      T_TQ1, T_TQ2, T_TQ3, T_TQ4,
+      TEMPLATE_NUM
+    };
+
+    /*!
+      @brief Name and slot kinds of a feature template.
+      kinds holds one letter per slot: 'P' p-state, 'W' word, 'C' char class.
+     */
+    struct TemplateInfo {
+      const char* name;
+      const char* kinds;
+    };
+
+    const TemplateInfo TEMPLATES[TEMPLATE_NUM] = {
+      {"UP1__", "P"},   {"UP2__", "P"},   {"UP3__", "P"},
+      {"BP1__", "PP"},  {"BP2__", "PP"},
+      {"UW1__", "W"},   {"UW2__", "W"},   {"UW3__", "W"},
+      {"UW4__", "W"},   {"UW5__", "W"},   {"UW6__", "W"},
+      {"BW1__", "WW"},  {"BW2__", "WW"},  {"BW3__", "WW"},
+      {"TW1__", "WWW"}, {"TW2__", "WWW"}, {"TW3__", "WWW"}, {"TW4__", "WWW"},
+      {"UC1__", "C"},   {"UC2__", "C"},   {"UC3__", "C"},
+      {"UC4__", "C"},   {"UC5__", "C"},   {"UC6__", "C"},
+      {"BC1__", "CC"},  {"BC2__", "CC"},  {"BC3__", "CC"},
+      {"TC1__", "CCC"}, {"TC2__", "CCC"}, {"TC3__", "CCC"}, {"TC4__", "CCC"},
+      {"UQ1__", "PC"},  {"UQ2__", "PC"},  {"UQ3__", "PC"},
+      {"BQ1__", "PCC"}, {"BQ2__", "PCC"}, {"BQ3__", "PCC"}, {"BQ4__", "PCC"},
+      {"TQ1__", "PCCC"}, {"TQ2__", "PCCC"}, {"TQ3__", "PCCC"}, {"TQ4__", "PCCC"}
+    };
+
+    const unsigned int TEMPLATE_NAME_SIZ = 5;
+
+    /*! @brief Integer codes of the character classes of util::getCharClass. */
+    enum CharClass {
+      CLASS_O, CLASS_A, CLASS_N, CLASS_I, CLASS_K, CLASS_M, CLASS_H, CLASS_NUM
+    };
+
+    /*! @brief Integer codes of the previous decisions p1, p2 and p3. */
+    enum PState {
+      PSTATE_U, PSTATE_O, PSTATE_B, PSTATE_NUM
+    };
+
+    /*! @brief Number of c1 to c4 class windows. */
+    const unsigned int CLASS_WINDOW_NUM =
+      CLASS_NUM * CLASS_NUM * CLASS_NUM * CLASS_NUM;
+
+    /*! @brief Number of p1 to p3 p-state windows. */
+    const unsigned int PSTATE_WINDOW_NUM = PSTATE_NUM * PSTATE_NUM * PSTATE_NUM;
+
+    inline int getClassWindow(int c1, int c2, int c3, int c4)
+    {
+      return ((c1 * CLASS_NUM + c2) * CLASS_NUM + c3) * CLASS_NUM + c4;
+    }
+
+    inline int getPStateWindow(int p1, int p2, int p3)
+    {
+      return (p1 * PSTATE_NUM + p2) * PSTATE_NUM + p3;
+    }
+
+    const unsigned int CHAR_PAGE_BITS = 8;
+    const unsigned int CHAR_PAGE_SIZ  = 1 << CHAR_PAGE_BITS;
+    const unsigned int CHAR_PAGE_MASK = CHAR_PAGE_SIZ - 1;
+    const unsigned int CHAR_PAGE_NUM  = 0x10000 >> CHAR_PAGE_BITS;
+
+    /*!
+      @brief Score terms of FeatureModel::getBoundedScore. TERM_TAIL and
+      TERM_CLASS are the loads from the two fused class tables.
+     */
+    enum Term {
+      TERM_UW1, TERM_UW2, TERM_UW3, TERM_UW4, TERM_UW5, TERM_UW6,
+      TERM_BW1, TERM_BW2, TERM_BW3,
+      TERM_TW1, TERM_TW2, TERM_TW3, TERM_TW4,
+      TERM_TAIL, TERM_CLASS,
+      TERM_NUM
+    };
+
+    /*!
+      @brief Reserved character IDs. IDs of the characters found in the
+      training data start at CHARID_FIRST, CHARID_UNKNOWN is shared by every
+      character the training data does not mention.
+     */
+    enum CharId {
+      CHARID_UNKNOWN, CHARID_B2, CHARID_B1, CHARID_E1, CHARID_E2, CHARID_FIRST
+    };
+
+    /*!
+      @brief Codepoints padding a decoded input: B2 and B1 before it, E1, E2
+      and E3 after it. They are private use codepoints of plane 16, which
+      util::utftoucs never decodes. E3 is only read by a window sliding out
+      of the input, never scored.
+     */
+    enum Sentinel {
+      SENTINEL_B2 = 0x10FFF0, SENTINEL_B1, SENTINEL_E1, SENTINEL_E2, SENTINEL_E3
+    };
+
+    /*! @brief Number of sentinels padding a decoded input. */
+    const unsigned int SENTINEL_NUM = 5;
+
+    /*! @brief Number of sentinels before a decoded input. */
+    const unsigned int SENTINEL_HEAD_NUM = 2;
+
+    /*!
+      @brief This method is used in order to get the ID of a sentinel.
+      @return CHARID_B2 to CHARID_E2, CHARID_UNKNOWN for other codepoints.
+     */
+    inline int getSentinelId(uint32_t c)
+    {
+      return c >= SENTINEL_B2 && c <= SENTINEL_E2 ?
+        (int)(c - SENTINEL_B2) + CHARID_B2 : CHARID_UNKNOWN;
+    }
+
+    /*!
+      @brief This method is used in order to get the code of a class name.
+      @param str : The class name, "A", "N", "I", "K", "M", "H" or "O".
+      @return The class code, or -1 if str is not a class name.
+     */
+    inline int getClassCode(const char* str)
+    {
+      switch(*str){
+      case 'O': return CLASS_O;
+      case 'A': return CLASS_A;
+      case 'N': return CLASS_N;
+      case 'I': return CLASS_I;
+      case 'K': return CLASS_K;
+      case 'M': return CLASS_M;
+      case 'H': return CLASS_H;
+      }
+      return -1;
+    }
+
+    /*!
+      @brief This method is used in order to get the code of a p-state name.
+      @param str : The p-state name, "U", "O" or "B".
+      @return The p-state code, or -1 if str is not a p-state name.
+     */
+    inline int getPStateCode(const char* str)
+    {
+      switch(*str){
+      case 'U': return PSTATE_U;
+      case 'O': return PSTATE_O;
+      case 'B': return PSTATE_B;
+      }
+      return -1;
+    }
+
+    /*!
+      @brief This method is used in order to pack a feature into an integer key.
+      The word slots a, b and c take 16 bits each, d only holds class codes.
+      @param tmpl : The feature template.
+      @return The key, never 0.
+     */
+    inline uint64_t packKey(int tmpl, uint64_t a, uint64_t b = 0,
+                            uint64_t c = 0, uint64_t d = 0)
+    {
+      return (uint64_t)(tmpl + 1) | (a << 6) | (b << 22) | (c << 38) | (d << 54);
+    }
+
+    /*! @brief This method is used in order to get the template of a key. */
+    inline int getKeyTemplate(uint64_t key)
+    {
+      return (int)(key & 0x3f) - 1;
+    }
+
+    /*!
+      @brief Stored score of a feature or of a sum of features. Every score
+      of the training data and every sum in the class tables fits in 16 bits,
+      and scores are added up as int.
+     */
+    typedef int16_t Weight;
+
+    /*!
+      @brief This method is used in order to narrow a score for storing.
+      Scores are never rounded, the model must fit.
+     */
+    inline Weight toWeight(int val)
+    {
+      assert(val >= INT16_MIN && val <= INT16_MAX);
+      return (Weight)val;
+    }
+
+    /*!
+      @brief This method is used in order to mix the bits of a key.
+      Distinct keys give distinct results.
+     */
+    inline uint64_t mixKey(uint64_t key)
+    {
+      key ^= key >> 33;
+      key *= 0xFF51AFD7ED558CCDULL;
+      key ^= key >> 33;
+      key *= 0xC4CEB9FE1A85EC53ULL;
+      key ^= key >> 33;
+      return key;
+    }
+
+    const unsigned int KEY_FILTER_HASH_NUM = 4;
+
+    /*!
+      @brief Blocked Bloom filter over packed feature keys, checked before a
+      feature table. Each key sets KEY_FILTER_HASH_NUM bits of a single
+      64-bit word, so a query is one load and one compare. With a word per
+      key false positives are rare, and most window features are misses.
+     */
+    class KeyFilter {
+
+    public:
+      /*!
+        @brief Constructor of KeyFilter object.
+        @param words : The words made by build.
+        @param num : Number of words, a power of 2.
+       */
+      constexpr KeyFilter(const uint64_t* words, size_t num) :
+        mask(num - 1), words(words){}
+
+      /*!
+        @brief This method is used in order to test a key.
+        @return Return false if the key was never put, true if it may have.
+       */
+      bool mayContain(uint64_t key) const
+      {
+        uint64_t h = mixKey(key);
+        uint64_t bits = getBits(h);
+        return (words[h & mask] & bits) == bits;
+      }
+
+      size_t getSize() const
+      {
+        return (mask + 1) * sizeof(uint64_t);
+      }
+
+      /*!
+        @brief This method is used in order to make the words of a filter.
+        @param keys : The keys to store.
+        @param words : The region for storing the words.
+       */
+      static void build(const std::vector<uint64_t>& keys, std::vector<uint64_t>* words)
+      {
+        size_t cap = 1;
+        while(cap < keys.size()) cap <<= 1;
+        words->assign(cap, 0);
+        for(size_t i = 0; i < keys.size(); ++i){
+          uint64_t h = mixKey(keys[i]);
+          (*words)[h & (cap - 1)] |= getBits(h);
+        }
+      }
+
+    private:
+      size_t mask;
+      const uint64_t* words;
+
+      /*! @brief The bits of a key, from the hash bits the word index skips. */
+      static uint64_t getBits(uint64_t h)
+      {
+        uint64_t bits = 0;
+        for(unsigned int i = 0; i < KEY_FILTER_HASH_NUM; ++i){
+          bits |= (uint64_t)1 << ((h >> (40 + i * 6)) & 63);
+        }
+        return bits;
+      }
+    };
+
+    /*! @brief Slot of PerfectHash: the check bits of a key and its score. */
+    struct PerfectHashSlot {
+      uint32_t check;
+      Weight val;
+    };
+
+    const unsigned int PERFECT_HASH_BUCKET_SIZ = 4;
+
+    /*!
+      @brief Minimal perfect hash from packed feature keys to scores, built
+      by hash and displace. A key picks a bucket with the high half of its
+      hash, and the seed of the bucket moves it to a slot of its own, so a
+      lookup reads one seed and one 8 byte slot and never probes. The low
+      half of the hash is kept in the slot to reject keys which were not
+      stored. Distinct keys never share a hash, but a missing key matches
+      the check of its slot with a chance of 2^-32.
+     */
+    class PerfectHash {
+
+    public:
+      /*!
+        @brief Constructor of PerfectHash object.
+        @param seeds : The seeds made by build.
+        @param slots : The slots made by build.
+        @param num : Number of slots.
+       */
+      constexpr PerfectHash(const uint32_t* seeds, const PerfectHashSlot* slots,
+                            uint32_t num) :
+        slotNum(num), bucketNum(getBucketNum(num)), seeds(seeds), slots(slots){}
+
+      int get(uint64_t key) const
+      {
+        uint64_t h = hash(key);
+        const PerfectHashSlot& s = slots[getSlot(h, seeds[getBucket(h, bucketNum)], slotNum)];
+        return s.check == (uint32_t)h ? s.val : 0;
+      }
+
+      /*! @brief Bytes taken by the seeds and the slots. */
+      size_t getSize() const
+      {
+        return bucketNum * sizeof(uint32_t) + slotNum * sizeof(PerfectHashSlot);
+      }
+
+      static constexpr uint32_t getBucketNum(uint32_t slotNum)
+      {
+        return (slotNum + PERFECT_HASH_BUCKET_SIZ - 1) / PERFECT_HASH_BUCKET_SIZ;
+      }
+
+      /*!
+        @brief This method is used in order to make the seeds and slots of a
+        table. There is one slot per key, and one when there are no keys.
+        @param keys : Distinct non-zero keys.
+        @param vals : The score of every key.
+        @param seeds : The region for storing the seeds.
+        @param slots : The region for storing the slots.
+       */
+      static void build(const std::vector<uint64_t>& keys, const std::vector<int>& vals,
+                        std::vector<uint32_t>* seeds, std::vector<PerfectHashSlot>* slots)
+      {
+        uint32_t slotNum = keys.size() > 0 ? keys.size() : 1;
+        uint32_t bucketNum = getBucketNum(slotNum);
+        std::vector<std::vector<uint32_t> > buckets(bucketNum);
+        for(size_t i = 0; i < keys.size(); ++i){
+          buckets[getBucket(hash(keys[i]), bucketNum)].push_back(i);
+        }
+        std::vector<uint32_t> order(bucketNum);
+        for(uint32_t i = 0; i < bucketNum; ++i) order[i] = i;
+        std::stable_sort(order.begin(), order.end(), BucketOrder(buckets));
+        PerfectHashSlot empty = {0, 0};
+        seeds->assign(bucketNum, 0);
+        slots->assign(slotNum, empty);
+        std::vector<bool> used(slotNum, false);
+        std::vector<uint32_t> taken;
+        for(uint32_t i = 0; i < bucketNum; ++i){
+          const std::vector<uint32_t>& bk = buckets[order[i]];
+          if(bk.empty()) break;
+          // Big buckets go first, while most slots are free.
+          for(uint32_t seed = 0; ; ++seed){
+            taken.clear();
+            for(size_t j = 0; j < bk.size(); ++j){
+              uint32_t s = getSlot(hash(keys[bk[j]]), seed, slotNum);
+              if(used[s] || std::find(taken.begin(), taken.end(), s) != taken.end())
+                break;
+              taken.push_back(s);
+            }
+            if(taken.size() < bk.size()) continue;
+            for(size_t j = 0; j < bk.size(); ++j){
+              used[taken[j]] = true;
+              (*slots)[taken[j]].check = (uint32_t)hash(keys[bk[j]]);
+              (*slots)[taken[j]].val = toWeight(vals[bk[j]]);
+            }
+            (*seeds)[order[i]] = seed;
+            break;
+          }
+        }
+      }
+
+    private:
+      uint32_t slotNum;
+      uint32_t bucketNum;
+      const uint32_t* seeds;
+      const PerfectHashSlot* slots;
+
+      struct BucketOrder {
+        const std::vector<std::vector<uint32_t> >& buckets;
+
+        explicit BucketOrder(const std::vector<std::vector<uint32_t> >& b) : buckets(b){}
+
+        bool operator()(uint32_t a, uint32_t b) const
+        {
+          return buckets[a].size() > buckets[b].size();
+        }
+      };
+
+      /*! @brief Salted, so that KeyFilter and PerfectHash bits are unrelated. */
+      static uint64_t hash(uint64_t key)
+      {
+        return mixKey(key ^ 0x5851F42D4C957F2DULL);
+      }
+
+      static uint32_t getBucket(uint64_t h, uint32_t bucketNum)
+      {
+        return (uint32_t)(((h >> 32) * bucketNum) >> 32);
+      }
+
+      static uint32_t getSlot(uint64_t h, uint32_t seed, uint32_t slotNum)
+      {
+        return (uint32_t)(((mixKey(h + seed) >> 32) * slotNum) >> 32);
+      }
+    };
+
+    /*!
+      @brief The tables of a FeatureModel. They are made by ModelBuilder, and
+      the ones of tools/train are compiled in, see tinysegmenterxx_tables.hpp.
+     */
+    struct ModelTables {
+      /*! @brief Number of character IDs, reserved ones included. */
+      int charNum;
+
+      /*!
+        @brief Offset in charPageIds of the page of every 256 codepoints.
+        Pages holding no character of the training data share the first
+        page, all unknown. CHAR_PAGE_NUM entries.
+       */
+      const uint32_t* charPages;
+
+      /*! @brief Character IDs, one page after another. */
+      const uint16_t* charPageIds;
+
+      uint32_t charPageIdNum;
+
+      /*! @brief Codepoint of every character ID, 0 for the markers. */
+      const uint16_t* charCodes;
+
+      /*! @brief UW1 to UW6 scores, one array of charNum IDs per template. */
+      const Weight* unigramScores;
+
+      /*!
+        @brief Sum of every feature reading only p1, p2, p3 and c1 to c4,
+        by p-state window and class window.
+       */
+      const Weight* classScores;
+
+      /*! @brief Sum of UC5, UC6, BC3, TC3 and TC4 by the c3 to c6 window. */
+      const Weight* tailScores;
+
+      /*! @brief PerfectHash of the UW, BW and TW features. */
+      const uint32_t* wordSeeds;
+      const PerfectHashSlot* wordSlots;
+      uint32_t wordSlotNum;
+
+      /*! @brief KeyFilter of the UW, BW and TW features. */
+      const uint64_t* filterWords;
+      uint32_t filterWordNum;
+
+      /*! @brief Terms in the order getBoundedScore reads them. */
+      const int* termOrder;
+
+      /*! @brief Lowest sum of the terms from termOrder[i] on. */
+      const int* termMinRest;
+
+      /*! @brief Highest sum of the terms from termOrder[i] on. */
+      const int* termMaxRest;
+    };
+
+    /*!
+      @brief The training data keyed by integer feature IDs.
+      Every string key is split into the window slots it can match, so that a
+      lookup with the IDs of a window gives exactly the score TrainHash gives
+      for the concatenated strings. It only reads its tables, which are
+      either compiled in or owned by a ModelBuilder.
+     */
+    class FeatureModel {
+
+    public:
+      constexpr explicit FeatureModel(const ModelTables& tables) :
+        charNum(tables.charNum), charPages(tables.charPages),
+        charPageIds(tables.charPageIds), charPageIdNum(tables.charPageIdNum),
+        charCodes(tables.charCodes), unigramScores(tables.unigramScores),
+        classScores(tables.classScores), tailScores(tables.tailScores),
+        words(tables.wordSeeds, tables.wordSlots, tables.wordSlotNum),
+        wordFilter(tables.filterWords, tables.filterWordNum),
+        termOrder(tables.termOrder), termMinRest(tables.termMinRest),
+        termMaxRest(tables.termMaxRest){}
+
+      /*! @brief Number of character IDs, reserved ones included. */
+      int getCharNum() const
+      {
+        return charNum;
+      }
+
+      /*! @brief Codepoint of a character ID, 0 for the markers. */
+      uint16_t getCharCode(int id) const
+      {
+        return charCodes[id];
+      }
+
+      /*! @brief The table of the UW, BW and TW features. */
+      const PerfectHash& getWordTable() const
+      {
+        return words;
+      }
+
+      /*! @brief The filter checked before getWordTable. */
+      const KeyFilter& getWordFilter() const
+      {
+        return wordFilter;
+      }
+
+      /*!
+        @brief This method is used in order to get the bytes of the tables
+        read while segmenting.
+       */
+      size_t getSize() const
+      {
+        return (charNum * 6 + PSTATE_WINDOW_NUM * CLASS_WINDOW_NUM + CLASS_WINDOW_NUM) *
+          sizeof(Weight) + words.getSize() + wordFilter.getSize() +
+          CHAR_PAGE_NUM * sizeof(uint32_t) + charPageIdNum * sizeof(uint16_t);
+      }
+
+      /*!
+        @brief This method is used in order to get the ID of a character.
+        @param c : the charcter code of unicode, or a sentinel.
+        @return The ID, CHARID_UNKNOWN if no feature uses the character.
+        In a model built with ModelBuilder::setFoldWidth, half-width and
+        full-width forms share the ID of util::foldWidth(c).
+       */
+      int getCharId(uint32_t c) const
+      {
+        if(c > 0xffff) return getSentinelId(c);
+        return charPageIds[charPages[c >> CHAR_PAGE_BITS] + (c & CHAR_PAGE_MASK)];
+      }
+
+      /*!
+        @brief This method is used in order to get score of a window.
+        @param w : IDs of the six characters of the window.
+        @param c : Class codes of the six characters of the window.
+        @return The score.
+       */
+      int getScore(const int* w, const int* c, int p1, int p2, int p3) const
+      {
+        int score = 0;
+        score += getWordScore(packKey(T_UW1, w[0]));
+        score += getWordScore(packKey(T_UW2, w[1]));
+        score += getWordScore(packKey(T_UW3, w[2]));
+        score += getWordScore(packKey(T_UW4, w[3]));
+        score += getWordScore(packKey(T_UW5, w[4]));
+        score += getWordScore(packKey(T_UW6, w[5]));
+        score += getWordScore(packKey(T_BW1, w[1], w[2]));
+        score += getWordScore(packKey(T_BW2, w[2], w[3]));
+        score += getWordScore(packKey(T_BW3, w[3], w[4]));
+        score += getWordScore(packKey(T_TW1, w[0], w[1], w[2]));
+        score += getWordScore(packKey(T_TW2, w[1], w[2], w[3]));
+        score += getWordScore(packKey(T_TW3, w[2], w[3], w[4]));
+        score += getWordScore(packKey(T_TW4, w[3], w[4], w[5]));
+        score += classScores[getPStateWindow(p1, p2, p3) * CLASS_WINDOW_NUM +
+                             getClassWindow(c[0], c[1], c[2], c[3])];
+        score += tailScores[getClassWindow(c[2], c[3], c[4], c[5])];
+        return score;
+      }
+
+      /*!
+        @brief This method is used in order to get, for every window of an
+        input, the part of the score which does not depend on earlier
+        decisions. Window d reads w[d] to w[d + 5].
+        @param w : IDs of the characters, after the B2 and B1 markers and
+        before the E1 and E2 markers.
+        @param c : Class codes of the same characters.
+        @param num : Number of windows, five less than the entries of w.
+        @param scores : The region for storing the scores of the windows.
+        @param windows : The region for storing the c1 to c4 class windows,
+        for getClassScore.
+       */
+      void getStaticScores(const int* w, const int* c, int num,
+                           int* scores, int* windows) const
+      {
+        const Weight* u = unigramScores;
+        for(int d = 0; d < num; ++d){
+          scores[d] = u[w[d]] + u[charNum + w[d + 1]] +
+            u[charNum * 2 + w[d + 2]] + u[charNum * 3 + w[d + 3]] +
+            u[charNum * 4 + w[d + 4]] + u[charNum * 5 + w[d + 5]];
+        }
+        for(int d = 0; d < num; ++d){
+          windows[d] = getClassWindow(c[d], c[d + 1], c[d + 2], c[d + 3]);
+        }
+        for(int d = 0; d < num; ++d){
+          scores[d] += tailScores[getClassWindow(c[d + 2], c[d + 3],
+                                                 c[d + 4], c[d + 5])];
+        }
+        for(int d = 0; d < num; ++d){
+          scores[d] += getNgramScore(w + d);
+        }
+      }
+
+      /*!
+        @brief This method is used in order to get the score of every feature
+        reading the previous decisions.
+        @param pwindow : The p1 to p3 window, see getPStateWindow.
+        @param cwindow : The c1 to c4 window, see getClassWindow.
+       */
+      int getClassScore(int pwindow, int cwindow) const
+      {
+        return classScores[pwindow * CLASS_WINDOW_NUM + cwindow];
+      }
+
+      /*!
+        @brief This method is used in order to get a score of a window with
+        the same sign as the full score, stopping as soon as the terms left
+        cannot change the sign. Terms are read in descending order of their
+        largest absolute score.
+        @param w : IDs of the six characters of the window.
+        @param c : Class codes of the six characters of the window.
+        @param pwindow : The p1 to p3 window, see getPStateWindow.
+        @param bias : The score before any feature.
+        @param np : The pointer for storing the number of terms read.
+        @return The score of the terms read, plus bias.
+       */
+      int getBoundedScore(const int* w, const int* c, int pwindow, int bias,
+                          int* np) const
+      {
+        int score = bias;
+        for(int i = 0; i < TERM_NUM; ++i){
+          if(score + termMinRest[i] > 0 || score + termMaxRest[i] <= 0){
+            *np = i;
+            return score;
+          }
+          score += getTermScore(termOrder[i], w, c, pwindow);
+        }
+        *np = TERM_NUM;
+        return score;
+      }
+
+    private:
+      int charNum;
+      const uint32_t* charPages;
+      const uint16_t* charPageIds;
+      uint32_t charPageIdNum;
+      const uint16_t* charCodes;
+      const Weight* unigramScores;
+      const Weight* classScores;
+      const Weight* tailScores;
+      PerfectHash words;
+      KeyFilter wordFilter;
+      const int* termOrder;
+      const int* termMinRest;
+      const int* termMaxRest;
+
+      int getTermScore(int term, const int* w, const int* c, int pwindow) const
+      {
+        if(term <= TERM_UW6){
+          return unigramScores[charNum * (term - TERM_UW1) + w[term - TERM_UW1]];
+        }
+        switch(term){
+        case TERM_BW1: return getNgramScore(T_BW1, w[1], w[2]);
+        case TERM_BW2: return getNgramScore(T_BW2, w[2], w[3]);
+        case TERM_BW3: return getNgramScore(T_BW3, w[3], w[4]);
+        case TERM_TW1: return getNgramScore(T_TW1, w[0], w[1], w[2]);
+        case TERM_TW2: return getNgramScore(T_TW2, w[1], w[2], w[3]);
+        case TERM_TW3: return getNgramScore(T_TW3, w[2], w[3], w[4]);
+        case TERM_TW4: return getNgramScore(T_TW4, w[3], w[4], w[5]);
+        case TERM_TAIL:
+          return tailScores[getClassWindow(c[2], c[3], c[4], c[5])];
+        }
+        return getClassScore(pwindow, getClassWindow(c[0], c[1], c[2], c[3]));
+      }
+
+      int getNgramScore(int tmpl, int a, int b, int c = -1) const
+      {
+        if(a == CHARID_UNKNOWN || b == CHARID_UNKNOWN || c == CHARID_UNKNOWN)
+          return 0;
+        return getWordScore(c < 0 ? packKey(tmpl, a, b) : packKey(tmpl, a, b, c));
+      }
+
+      int getWordScore(uint64_t key) const
+      {
+        return wordFilter.mayContain(key) ? words.get(key) : 0;
+      }
+
+      int getNgramScore(const int* w) const
+      {
+        int score = 0;
+        // No n-gram holds a character unknown to the training data.
+        bool k1 = w[0] != CHARID_UNKNOWN;
+        bool k2 = w[1] != CHARID_UNKNOWN;
+        bool k3 = w[2] != CHARID_UNKNOWN;
+        bool k4 = w[3] != CHARID_UNKNOWN;
+        bool k5 = w[4] != CHARID_UNKNOWN;
+        bool k6 = w[5] != CHARID_UNKNOWN;
+        if(k2 && k3) score += getWordScore(packKey(T_BW1, w[1], w[2]));
+        if(k3 && k4) score += getWordScore(packKey(T_BW2, w[2], w[3]));
+        if(k4 && k5) score += getWordScore(packKey(T_BW3, w[3], w[4]));
+        if(k1 && k2 && k3) score += getWordScore(packKey(T_TW1, w[0], w[1], w[2]));
+        if(k2 && k3 && k4) score += getWordScore(packKey(T_TW2, w[1], w[2], w[3]));
+        if(k3 && k4 && k5) score += getWordScore(packKey(T_TW3, w[2], w[3], w[4]));
+        if(k4 && k5 && k6) score += getWordScore(packKey(T_TW4, w[3], w[4], w[5]));
+        return score;
+      }
+    };
+  }
+}
+
+#endif /* TINYSEGMENTERXX_MODEL_H */
@@ -0,0 +1,7788 @@
+/*
+ * Generated by segmenterxxgen from tools/train. Do not edit,
+ * run "make model" in src instead.
+ */
+
+#ifndef TINYSEGMENTERXX_TABLES_H
+#define TINYSEGMENTERXX_TABLES_H
+
+#include "tinysegmenterxx_model.hpp"
+
+namespace tinysegmenterxx {
+
+  namespace model {
+
+    namespace tables {
+
+      constexpr int CHAR_NUM = 379;
+
+      constexpr uint32_t CHAR_PAGES[] = {
+        256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4864, 0, 5120, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1280, 5632, 15616, 6144, 6400, 2048,
+        768, 0, 9472, 11776, 12032, 2304, 0, 1024, 6656, 12288, 2816, 3328,
+        12544, 15872, 7168, 4352, 0, 3072, 8192, 3584, 12800, 13056, 7424, 3840,
+        9984, 13312, 16128, 0, 0, 8704, 13568, 16384, 10240, 10496, 4096, 6912,
+        17664, 5888, 8960, 9216, 7936, 13824, 0, 16640, 7680, 10752, 14080, 0,
+        0, 0, 0, 0, 11008, 1536, 11264, 9728, 14336, 0, 14592, 11520,
+        1792, 14848, 16896, 0, 0, 5376, 2560, 15104, 17152, 15360, 17408, 8448,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 4608
+      };
+
+      constexpr uint16_t CHAR_PAGE_IDS[] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        6, 0, 72, 0, 0, 11, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+        0, 361, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 362, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 113, 0,
+        0, 180, 0, 142, 0, 0, 0, 0, 133, 13, 0, 0,
+        0, 0, 0, 181, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 10, 0, 15, 0, 16, 0, 114, 0, 76, 20,
+        22, 34, 290, 53, 0, 115, 182, 23, 183, 24, 143, 18,
+        291, 27, 79, 46, 0, 29, 0, 25, 75, 31, 0, 14,
+        33, 0, 26, 28, 7, 37, 38, 39, 292, 293, 42, 35,
+        80, 0, 144, 294, 0, 184, 0, 0, 185, 117, 0, 186,
+        0, 0, 45, 36, 48, 32, 40, 295, 47, 0, 0, 126,
+        49, 21, 57, 17, 30, 81, 0, 82, 0, 0, 50, 19,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 145, 0, 363, 0, 0, 0, 0, 0, 0, 118,
+        0, 146, 0, 0, 187, 0, 0, 296, 0, 0, 0, 0,
+        0, 188, 0, 297, 0, 0, 0, 0, 0, 0, 0, 147,
+        0, 0, 0, 0, 189, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 190, 298, 0, 0, 0, 0, 0, 0,
+        0, 299, 300, 191, 0, 192, 0, 0, 0, 0, 0, 193,
+        0, 0, 0, 0, 0, 0, 0, 134, 301, 0, 0, 0,
+        0, 0, 0, 0, 220, 0, 0, 0, 221, 0, 0, 0,
+        8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 364, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 222, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 227, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 315, 0, 0, 0, 0, 158, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 228, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 316, 0, 0, 0, 41, 0, 43, 0, 0, 0,
+        0, 0, 0, 0, 0, 148, 86, 194, 0, 149, 0, 0,
+        0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 195, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 135, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        196, 0, 0, 151, 132, 0, 0, 0, 0, 0, 0, 0,
+        0, 302, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 197, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 198, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 199, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 376, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 173, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 339,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 83, 0, 0, 0, 0, 0,
+        0, 0, 0, 378, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 345, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 274, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 275, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 276, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 55, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 215, 154, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 136, 0, 0, 0, 0, 0,
+        0, 131, 0, 216, 0, 0, 0, 0, 137, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 217, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 218, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 219,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 225, 0,
+        0, 0, 314, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 58, 0, 155, 156, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 226, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 122,
+        0, 0, 0, 0, 0, 0, 0, 0, 92, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 348, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 349, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 279, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 280, 0, 0, 0, 0, 0, 0, 123, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 366, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 60, 95, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 321, 0, 230, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 98, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 96, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 231, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 324,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 325, 0, 0,
+        0, 0, 0, 162, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 236, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 237, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 163, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0,
+        0, 0, 0, 0, 0, 61, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 63, 0, 238, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 160,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 65, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        127, 0, 0, 0, 0, 0, 0, 77, 0, 0, 0, 232,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 165, 0, 0, 0,
+        0, 0, 0, 0, 119, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 106, 0, 240, 0, 0, 0, 0, 0, 0, 0, 0,
+        326, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 241, 0, 0, 242, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 327, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 166, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 368, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 167, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 169, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 67, 0, 0, 0, 0, 0, 256, 0, 0, 0,
+        170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 161, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 0,
+        0, 374, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 140, 71, 0, 141, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 177, 355, 178, 375, 0, 0, 0, 124, 179,
+        283, 0, 356, 0, 0, 284, 357, 0, 0, 0, 0, 0,
+        285, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 286, 358, 0, 0, 0, 0, 359, 360, 287, 0, 288,
+        0, 289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 278,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 176, 0, 0, 0, 0,
+        0, 0, 0, 97, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 78, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 87, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 200, 0,
+        0, 0, 0, 303, 0, 201, 0, 0, 0, 0, 0, 0,
+        202, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 152, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 377, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 259, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 203, 0, 0, 0, 0,
+        305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 91, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 121, 0, 0, 204, 0, 0, 0,
+        205, 206, 0, 0, 0, 207, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 306, 208, 0, 0, 0, 0, 0, 0, 209, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0,
+        0, 0, 0, 0, 0, 210, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 211, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 153, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 212, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 213, 0, 0, 0, 214, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 159,
+        0, 94, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 317,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 318, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 319, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 257, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 258, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        235, 0, 0, 0, 0, 0, 0, 0, 323, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 100, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 370, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 267, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 268, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 104,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 261, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 164, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        239, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 130, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 107, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 250, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 109, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 125, 0, 0, 260, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 335, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 110, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 111, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        308, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 309, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 112, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 340, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 246, 0, 168, 0, 0, 0, 0, 0, 128,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 247, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 329, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 332, 0, 0, 138, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 139, 0, 0, 0, 333, 0, 0, 0, 0,
+        253, 0, 0, 0, 0, 0, 0, 0, 334, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 254, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 171, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 172, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 373, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 174, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 343, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 175, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 344, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 310, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 311, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        224, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 312, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 313, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 365, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 320, 229, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 233, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 234, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 328, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 243, 0, 0, 0, 369, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 244, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 245, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 249, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 251, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 252, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 262, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 263, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 336, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 264, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 265, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 266, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 269, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 341, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 270, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 271, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 342, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 272, 0,
+        0, 273, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 346, 0, 0, 277, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 281, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 352, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 353, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 282, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 322, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 330, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 331, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 337, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 347, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 350, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 351, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 354, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 371, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0
+      };
+
+      constexpr uint16_t CHAR_CODES[] = {
+        0, 0, 0, 0, 0, 0, 44, 12392, 21516, 66, 12354, 49,
+        12289, 12301, 12387, 12356, 12358, 12427, 12375, 12435, 12363, 12425, 12364, 12371,
+        12373, 12383, 12390, 12377, 12391, 12381, 12428, 12385, 12417, 12388, 12365, 12399,
+        12415, 12393, 12394, 12395, 12418, 23550, 12398, 19968, 20013, 12414, 12379, 12420,
+        12416, 12424, 12434, 35211, 20129, 12367, 20140, 37117, 21462, 12426, 22823, 38442,
+        24179, 26041, 24341, 26085, 26412, 24403, 27598, 30446, 25351, 65314, 65297, 65379,
+        46, 8213, 8722, 12384, 12362, 24467, 38306, 12378, 12400, 12429, 12431, 36890,
+        20154, 37096, 19978, 20250, 31038, 20986, 20998, 20826, 22996, 21729, 23569, 24180,
+        24230, 38291, 24220, 30476, 25163, 27177, 26032, 32862, 31859, 26332, 26397, 39854,
+        26481, 28982, 31435, 31532, 22269, 12290, 12360, 12369, 23376, 12409, 12459, 26376,
+        35696, 20837, 22987, 24066, 65398, 31243, 12423, 24460, 27671, 21021, 26178, 21313,
+        20108, 12300, 12539, 20027, 21306, 21320, 29702, 29983, 65378, 65381, 12295, 12374,
+        12402, 12450, 12461, 12483, 19977, 19981, 19990, 20107, 20445, 21103, 21271, 22825,
+        22826, 23398, 23455, 23567, 24375, 25594, 25919, 25991, 26126, 26368, 26524, 27425,
+        27665, 30330, 30456, 33258, 34892, 35199, 35519, 36796, 38283, 65391, 65393, 65399,
+        12293, 12307, 12370, 12372, 12405, 12408, 12411, 12464, 12473, 12488, 12512, 12523,
+        12525, 12531, 19979, 20001, 20104, 20170, 20182, 20197, 20302, 20309, 20316, 20803,
+        20840, 20844, 20845, 20849, 20870, 20877, 21029, 21069, 21147, 21205, 21209, 21270,
+        21315, 21332, 21475, 21491, 21508, 21512, 21644, 22411, 22580, 22806, 22971, 23433,
+        23478, 24030, 24195, 24314, 24471, 24605, 24615, 25144, 25945, 25968, 26087, 26152,
+        26399, 26446, 26449, 26680, 26862, 26989, 27663, 27770, 27861, 28023, 28961, 29289,
+        29305, 29992, 30010, 30340, 30452, 30465, 30693, 31169, 31246, 31995, 32004, 32026,
+        32113, 32207, 32218, 32773, 33021, 33521, 36001, 36027, 36554, 36557, 36984, 37070,
+        37089, 37329, 38263, 38632, 38651, 38750, 39365, 65400, 65405, 65412, 65425, 65433,
+        65435, 65437, 12366, 12376, 12396, 12397, 12403, 12419, 12467, 12475, 12513, 12521,
+        12522, 12540, 20117, 20307, 20596, 20808, 20869, 21442, 22120, 22238, 22290, 22320,
+        22593, 22763, 22810, 23450, 23546, 23627, 23665, 23798, 24029, 24193, 24863, 25152,
+        25903, 25913, 26408, 26469, 26657, 27810, 28168, 29575, 29699, 29987, 30000, 31354,
+        32076, 32626, 33324, 35215, 35686, 35895, 36062, 36650, 36817, 36947, 37326, 37504,
+        38498, 38555, 38936, 38988, 39208, 39318, 39640, 65392, 65402, 65406, 65426, 65431,
+        65432, 69, 93, 12452, 21578, 23888, 24109, 25369, 26619, 26684, 27231, 30740,
+        34920, 35486, 65317, 65394, 20214, 31119, 36899
+      };
+
+      constexpr Weight UNIGRAM_SCORES[] = {
+        0, 0, 0, 0, 0, 0, 156, -547, 0, 0, -941, 0,
+        156, 0, 0, 0, -127, 0, 0, -137, 0, -292, -553, 505,
+        0, 0, 0, 0, -201, 0, 169, 0, 0, 0, 121, -847,
+        0, -123, 0, -789, -466, 0, -185, 0, 0, 0, 0, -470,
+        0, 182, -446, 0, 0, 0, -268, -718, 0, 208, 561, 0,
+        0, 0, 0, -141, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 729, 0, 0, 0,
+        0, 0, 0, -386, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, -460, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, -411, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, -463, -135, -402, -912, 871, 361, -408, -463, -135, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, -829, -981, 0, 0, -538, 0, -829, 3145, 0, 505, 134,
+        -694, 1529, 2095, 1454, 0, -856, 1141, 878, 188, -291, -675, -268,
+        -1011, 571, 0, 0, -949, 0, -409, 0, 1273, 1063, -1764, -1263,
+        0, 130, 0, -968, 600, 300, -402, 0, 1639, -2516, -3874, 0,
+        -412, 0, 0, 0, -579, -1769, 0, 0, 0, 0, -1815, -1650,
+        0, 0, -1584, 0, 0, 0, 3145, 0, 0, 0, 1837, -502,
+        0, 0, 0, 0, 0, 0, 0, -123, 0, 0, 978, 0,
+        0, 0, 0, 0, 0, 0, -1060, 0, -1257, 0, -1165, -1519,
+        0, -1682, 0, 509, 0, -1843, 0, -931, 0, -763, 810, 0,
+        0, 0, 0, -1519, 1261, 306, 0, 1198, 548, 0, -813, 306,
+        0, 0, 0, -1740, -3025, 0, 0, 0, -645, 0, -861, -422,
+        0, 752, 0, -645, 0, 892, 540, -1273, -587, 568, 831, -758,
+        -2150, -302, 492, 362, -1566, -3414, -865, -483, 760, 1023, -2009, 1067,
+        -1033, 1522, -1355, -1462, -630, -665, -2378, -180, 529, -242, -1353, 838,
+        -744, 1010, 3041, 1758, 831, -587, 568, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4889, 1691, 3906, 0,
+        -2696, -800, 4889, 2670, -1444, 1006, 2342, 5905, -395, -518, -1163, 727,
+        3271, -3552, -1058, 842, 6167, 584, 2318, -5228, 2773, -521, 1205, -1081,
+        0, 4555, -120, -899, -2788, 2745, 2323, 0, 4056, -1619, 653, -4384,
+        3685, -788, 0, -202, 6620, 1044, 0, 1004, 0, 0, 0, 649,
+        0, 0, -1804, 0, 0, 2099, 0, -3885, 0, 0, -3973, 0,
+        -800, 2670, 0, 0, -1723, 0, -4864, 0, -1282, 0, 0, 0,
+        -1207, -1136, 2742, 1200, 0, 0, 0, 0, 457, 3593, 0, 4513,
+        -3102, 2416, 1452, 1302, 1605, 6293, 0, 0, 1764, 0, 7767, -951,
+        0, 0, -805, 0, -960, 1201, 642, 0, 1983, 388, 0, 0,
+        0, 4125, 0, 0, 0, 3197, 0, 0, 0, 0, 0, 2475,
+        -1248, 0, 974, 0, -3794, -758, 4646, -783, 0, -273, 0, -3794,
+        5827, 0, -2171, 551, 0, -1350, 0, 0, -2087, 0, -2439, 4437,
+        -1038, 0, 0, -1356, -1008, -513, 0, 0, -2013, -1489, 0, -937,
+        0, 0, -1694, 0, 0, -2869, 0, 0, -562, -1504, -1432, -1350,
+        551, 0, -2311, -3573, 401, -3116, -1798, 1199, -5516, 1319, 874, 521,
+        1109, 1591, 2201, 278, -1759, 3815, -1193, 792, 1889, -1368, 811, 4265,
+        -361, 4858, 1574, -3030, 755, -1880, 5807, 3095, 1129, 2286, 365, -949,
+        -1872, 1327, -2309, -1006, 483, 1233, 3588, -241, -837, 1389, 1219, -241,
+        2016, -423, 1078, 1155, -1030, -2352, 1905, -1291, 1822, -488, -1479, 3222,
+        5792, -661, 360, 3094, 364, 5156, 2438, 484, 2613, -1073, 1868, -495,
+        979, 461, -3850, 914, 1215, 7313, -1835, 792, -1528, 4231, 401, 3066,
+        3663, 1384, -4229, 1163, 1255, 6457, 725, 785, -733, 1777, 1835, 1375,
+        -681, 1026, 4404, 2163, 421, 2009, -1045, 2066, 1620, 0, 874, 521,
+        1109, 1591, 2201, 278, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 3930, 4547, 0, 0, 4752, 0, 3930, 3798, -5882,
+        -3435, -640, -14896, -843, -2352, 530, -2922, 6006, 2255, 2864, 5034, 3994,
+        -731, 7410, 4091, -2613, -3654, -5046, -1659, -4482, 8578, -2082, 0, 5433,
+        6499, 4169, 0, 7396, -2069, 2210, 1051, 181, 2795, -882, 3351, 13150,
+        0, 0, -3788, 0, 1192, 0, -9726, 571, 0, 0, -856, 0,
+        1798, 0, 0, 0, 922, 0, 0, 0, 3798, 3508, -4841, 0,
+        5408, 2405, 0, 0, 1251, 1940, -4570, -1783, 0, 1036, 0, 0,
+        950, 0, 0, 0, -2006, 0, -910, 0, 374, 0, -2344, 0,
+        2997, 0, 0, 0, 0, 2937, 0, 0, 0, 0, 0, -2112,
+        788, -619, 3508, -2514, -4376, -4802, -744, 2145, -9066, -244, 0, 0,
+        2771, 2145, 0, -1544, 456, -910, 1347, 1829, 0, 0, 1895, -4371,
+        0, 4517, 0, 0, -1286, 1895, -4371, 4999, 0, 4249, 0, 0,
+        -724, 0, 0, 0, -190, 0, 3879, 0, 0, 0, -1397, 0,
+        1910, 0, 0, 2182, 522, 0, 845, 0, 0, -2716, 0, 0,
+        0, -792, 0, 0, -3370, 0, -724, 0, 0, 0, -5156, -4734,
+        1979, 1345, 6665, 1464, 0, 0, -403, 0, -856, 0, -3637, 0,
+        0, 782, 0, 0, 544, 0, 0, 530, 0, 0, 0, 0,
+        -1212, 788, 0, 0, 1623, -302, -740, -2715, 776, 0, 1013, 0,
+        0, 0, -1834, -681, 0, -1410, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 553, 0, 704, 0, 0, 0, 0, 0, 0,
+        0, 0, -1043, 5388, 0, 0, 0, 0, -735, 0, 0, 1826,
+        2586, 0, -3485, 0, 0, 0, 786, 2171, 0, -1169, 940, -994,
+        2145, -730, 0, 0, 0, -1481, 1158, 2596, -4866, 0, 0, 357,
+        0, -878, 0, 0, 0, 0, -403, 0, -856, 0, -3637, -3821,
+        -2506, 1853, 1413, -4134, -2666, 1789, 1287, -1635, -881, -541, -11870, -1768,
+        -1286, 4292, 601, 584, 1555, -851, 1500, -1200, 866, -2094, -1413, 1067,
+        -1057, -809, -1328, -1500, -2056, -2667, -4556, 916, -1566, 856, 787, -485,
+        -442, -360, -939, -543, 672, -1267, -1101, -2900, -867, 1146, 749, -852,
+        792, -1184, -1000, 730, -1433, 929, -1291, -1100, -2213, -2297, -2604, -1659,
+        -792, -1984, 1749, 2120, -11870, 1789, 1287, -1635, -881, -541, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, -32768, 0, 465, -127,
+        0, 0, 1655, -514, 465, 0, 52, 331, -503, 429, -1371, 327,
+        647, 0, -421, 0, -1537, 0, -18, -852, -850, 0, 504, 1093,
+        865, 921, 1624, -578, 502, 1682, -787, -1224, 0, 0, -635, 0,
+        -871, 0, 0, 0, 0, 0, -1264, 0, 0, 312, 722, 0,
+        0, -208, -1296, 0, 0, 0, 0, 218, 0, 0, 0, 0,
+        0, 0, -514, 0, -299, 0, 0, -1186, 527, 0, 0, 0,
+        0, 0, 419, 0, 0, 0, 0, -1153, -278, 0, 0, -654,
+        0, 2104, 0, 1763, 0, 1191, 0, -4003, 0, 0, -1682, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, -299, 1199, 0,
+        0, 1001, 0, -4353, 1219, 0, 0, -2991, 0, 0, 854, 0,
+        0, 0, 0, 0, 0, 363, 0, 0, -901, 0, 0, 0,
+        363, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, -548, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1319, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, -983, 0, 0, 0, 0, 0,
+        0, 0, 0, 451, 0, -343, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 3519, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 872, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1347, 0,
+        0, 0, 0, 0, 0, 0, -3912, -3149, 0, -1052, 0, 0,
+        0, 0, 0, 0, 1955, 0, 0, -2233, 0, 0, 0, 0,
+        0, 0, -1018, -368, 0, 0, 786, 0, 0, 0, 0, 0,
+        0, 0, 0, 451, 0, -343, 1971, 0, 0, 0, 0, 3350,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1785, 0, 0, 0, 0,
+        0, 0, 0, -814, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 240, -813, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 2368, -689, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, -2762, 241, 848, -1304, 921, 1618,
+        932, 1356, -1508, -997, 663, -1073, 0, 241, 0, 0, 0, 0,
+        0, 0, 306, 0, 0, 227, -105, 0, 0, -307, -270, 227,
+        0, 573, 0, 189, -135, 0, 0, 241, 0, -73, -200, 0,
+        -428, -1014, 383, 101, 0, 0, 0, 0, 0, 0, -236, 0,
+        0, -253, -149, -206, 0, -417, -277, 201, 0, 0, 0, 0,
+        0, 195, 0, 0, -121, 0, 0, 0, 187, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, -270, 0, 808,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 624, -507, 0, 0, 0, 798, -1212, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 808, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 887, 0, 0, 0, 535, 0, 0, 0, 0, 0,
+        0, 0, 0, 1792, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        -960, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 753, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -673, 0,
+        -496, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 302, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, -695, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, -697, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1811, 0, 0, 0, 0, 0, 0, 0, 1082, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -673, 0,
+        -496, 0, 1782, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -822, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, -800, 974, 463
+      };
+
+      constexpr Weight CLASS_SCORES[] = {
+        3867, -2502, 4017, -891, -3309, 3706, 1950, 5417, -7139, 1769, 483, -4679,
+        2336, 580, 6787, -2502, 4017, -891, -3309, 3706, 1950, 12758, -696, 4496,
+        -4393, -1109, 4185, 1245, 6787, -2502, 4017, 2940, -12050, 3706, 1950, 6787,
+        -2502, 4017, -891, 25, 3706, -1182, 9170, -3880, 6651, -3415, -4687, 617,
+        -3498, 4040, -2329, 4190, -718, -3136, 3879, 2123, 5590, -6966, 1942, 656,
+        -4506, 2509, 753, 6960, -2329, 4190, -718, -3136, 3879, 2123, 14763, 1309,
+        6501, 261, 896, 6190, 3250, 6960, -2329, 4190, 3113, -11877, 3879, 2123,
+        6960, -2329, 4190, -718, 198, 3879, -1009, 10721, -2329, 8202, -1864, -3136,
+        2168, -1947, 8996, 2627, 9146, 4238, 1820, 8835, 7079, 10546, -2010, 6898,
+        5612, 450, 7465, 5709, 11916, 2627, 9146, 4238, 1820, 8835, 7079, 19719,
+        6265, 11457, 5217, 5852, 11146, 8206, 11916, 2627, 9146, 8069, -6921, 8835,
+        7079, 11916, 2627, 9146, 4238, 5154, 8835, 3947, 15677, 2627, 13158, 3092,
+        1820, 7124, 3009, 3630, -2739, 3780, -1128, -3546, 3469, 1713, 5180, -7376,
+        1532, 246, -4916, 2099, 343, 6550, -2739, 3780, -1128, -3546, 3469, 1713,
+        16814, 3360, 8552, 2312, 2947, 8241, 5301, 6550, -2739, 3780, 2703, -12287,
+        3469, 1713, 6550, -2739, 3780, -1128, -212, 3469, -1419, 10311, -2739, 7792,
+        -4239, -3546, 1758, -2357, 3221, -3148, 3371, -1537, -3955, 3060, 1304, 4771,
+        -7785, 1123, -163, -5325, 1690, -66, 6141, -3148, 3371, -1537, -3955, 3060,
+        1304, 13944, 490, 5682, -558, 77, 5371, 2431, 6141, -3148, 3371, 2294,
+        -12696, 3060, 2007, 6141, -3148, 3371, -1537, -621, 3060, -1828, 10308, -2742,
+        7789, -2277, -3549, 1755, -2360, 7208, 839, 7358, 2450, 32, 7047, 5291,
+        8758, -3798, 5110, 3824, -1338, 5677, 3921, 10128, 839, 7358, 2450, 32,
+        7047, 5291, 17931, 4477, 9669, 3429, 4064, 9358, 6418, 10128, 839, 7358,
+        6281, -8709, 7047, 5291, 10128, 839, 7358, 2450, 3366, 7047, 2159, 13889,
+        839, 11370, 1304, 32, 5336, 1221, 4280, -2089, 4430, -478, -2896, 4119,
+        2363, 5830, -6726, 2182, 896, -4266, 2749, 993, 7200, -2089, 4430, -478,
+        -2896, 4119, 2363, 15003, 1549, 6741, -522, 1136, 6430, 3490, 7200, -2089,
+        4430, 3353, -11637, 4119, 2363, 7200, -2089, 4430, -478, 438, 2965, -769,
+        13055, -2083, 8448, -1618, -2890, 2414, -1701, 4856, -1513, 5006, 98, -2320,
+        4695, 2939, 6406, -6150, 2758, 1472, -3690, 3325, 1569, 7776, -1513, 5006,
+        98, -2320, 4695, 2939, 15579, 2125, 7317, -1572, 1712, 7006, 4066, 7776,
+        -1513, 5006, 3929, -11061, 4695, 2939, 7776, -1513, 5006, 98, 1014, 4695,
+        -193, 10159, -2891, 7640, -2426, -3698, 1606, -2509, 5029, -1340, 5179, 271,
+        -2147, 4868, 3112, 7672, -4884, 4024, 2738, -2424, 4591, 2835, 7949, -1340,
+        5179, 271, -2147, 4868, 3112, 15752, 2298, 7490, 1250, 1885, 7179, 4239,
+        7949, -1340, 5179, 4102, -10888, 4868, 3112, 7949, -1340, 5179, 271, 1187,
+        4868, -20, 11710, -1340, 9191, -875, -2147, 3157, -958, 9985, 3616, 10135,
+        5227, 2809, 9824, 8068, 11535, -1021, 7887, 6601, 1439, 8454, 6698, 12905,
+        3616, 10135, 5227, 2809, 9824, 8068, 20708, 7254, 12446, 6206, 6841, 12135,
+        9195, 12905, 3616, 10135, 9058, -5932, 9824, 8068, 12905, 3616, 10135, 5227,
+        6143, 9824, 4936, 16666, 3616, 14147, 4081, 2809, 8113, 3998, 4619, -1750,
+        4769, -139, -2557, 4458, 2702, 6169, -6387, 2521, 1235, -3927, 3088, 1332,
+        7539, -1750, 4769, -139, -2557, 4458, 2702, 17803, 4349, 9541, 3301, 3936,
+        9230, 6290, 7539, -1750, 4769, 3692, -11298, 4458, 2702, 7539, -1750, 4769,
+        -139, 777, 4458, -430, 11300, -1750, 8781, -3250, -2557, 2747, -1368, 4210,
+        -2159, 4360, -548, -2966, 4049, 2293, 5760, -6796, 2112, 826, -4336, 2679,
+        923, 7130, -2159, 4360, -548, -2966, 4049, 2293, 14933, 1479, 6671, 431,
+        1066, 6360, 3420, 7130, -2159, 4360, 3283, -11707, 4049, 2996, 7130, -2159,
+        4360, -548, 368, 4049, -839, 11297, -1753, 8778, -1288, -2560, 2744, -1371,
+        8197, 1828, 8347, 3439, 1021, 8036, 6280, 9747, -2809, 6099, 4813, -349,
+        6666, 4910, 11117, 1828, 8347, 3439, 1021, 8036, 6280, 18920, 5466, 10658,
+        4418, 5053, 10347, 7407, 11117, 1828, 8347, 7270, -7720, 8036, 6280, 11117,
+        1828, 8347, 3439, 4355, 8036, 3148, 14878, 1828, 12359, 2293, 1021, 6325,
+        2210, 5269, -1100, 5419, 511, -1907, 5108, 3352, 6819, -5737, 3171, 1885,
+        -3277, 3738, 1982, 8189, -1100, 5419, 511, -1907, 5108, 3352, 15992, 2538,
+        7730, 467, 2125, 7419, 4479, 8189, -1100, 5419, 4342, -10648, 5108, 3352,
+        8189, -1100, 5419, 511, 1427, 3954, 220, 14044, -1094, 9437, -629, -1901,
+        3403, -712, 4372, -1997, 4522, -386, -2804, 4211, 2455, 5922, -6634, 2274,
+        988, -4174, 2841, 1085, 7292, -1997, 4522, -386, -2804, 4211, 2455, 15095,
+        1641, 6833, -2056, 1228, 6522, 3582, 7292, -1997, 4522, 3445, -11545, 4211,
+        2455, 7292, -1997, 4522, -386, 530, 4211, -677, 9675, -3375, 7156, -2910,
+        -4182, 1122, -2993, 4545, -1824, 4695, -213, -2631, 4384, 2628, 6095, -6461,
+        2447, 1161, -4001, 3014, 1258, 7465, -1824, 4695, -213, -2631, 4384, 2628,
+        15268, 1814, 7006, 766, 1401, 6695, 3755, 7465, -1824, 4695, 3618, -11372,
+        4384, 2628, 7465, -1824, 4695, -213, 703, 4384, -504, 11226, -1824, 8707,
+        -1359, -2631, 2673, -1442, 9501, 3132, 9651, 4743, 2325, 9340, 7584, 11051,
+        -1505, 7403, 6117, 955, 7970, 6214, 12421, 3132, 9651, 4743, 2325, 9340,
+        7584, 20224, 6770, 11962, 5722, 6357, 11651, 8711, 12421, 3132, 9651, 8574,
+        -6416, 9340, 7584, 12421, 3132, 9651, 4743, 5659, 9340, 4452, 16182, 3132,
+        13663, 3597, 2325, 7629, 3514, 4135, -2234, 4285, -623, -3041, 3974, 2218,
+        5685, -6871, 2037, 751, -4411, 2604, 848, 7055, -2234, 4285, -623, -3041,
+        3974, 2218, 17319, 3865, 9057, 2817, 3452, 8746, 5806, 7055, -2234, 4285,
+        3208, -11782, 3974, 2218, 7055, -2234, 4285, -623, 293, 3974, -914, 10816,
+        -2234, 8297, -3734, -3041, 2263, -1852, 3726, -2643, 3876, -1032, -3450, 3565,
+        1809, 5276, -7280, 1628, 342, -4820, 2195, 439, 6646, -2643, 3876, -1032,
+        -3450, 3565, 1809, 14449, 995, 6187, -53, 582, 5876, 2936, 6646, -2643,
+        3876, 2799, -12191, 3565, 2512, 6646, -2643, 3876, -1032, -116, 3565, -1323,
+        10813, -2237, 8294, -1772, -3044, 2260, -1855, 7713, 1344, 7863, 2955, 537,
+        7552, 5796, 9263, -3293, 5615, 4329, -833, 6182, 4426, 10633, 1344, 7863,
+        2955, 537, 7552, 5796, 18436, 4982, 10174, 3934, 4569, 9863, 6923, 10633,
+        1344, 7863, 6786, -8204, 7552, 5796, 10633, 1344, 7863, 2955, 3871, 7552,
+        2664, 14394, 1344, 11875, 1809, 537, 5841, 1726, 4785, -1584, 4935, 27,
+        -2391, 4624, 2868, 6335, -6221, 2687, 1401, -3761, 3254, 1498, 7705, -1584,
+        4935, 27, -2391, 4624, 2868, 15508, 2054, 7246, -17, 1641, 6935, 3995,
+        7705, -1584, 4935, 3858, -11132, 4624, 2868, 7705, -1584, 4935, 27, 943,
+        3470, -264, 13560, -1578, 8953, -1113, -2385, 2919, -1196, 4372, -1997, 4522,
+        -386, -2804, 4211, 2455, 5922, -6634, 2274, 988, -4174, 2841, 1085, 7292,
+        -1997, 4522, -386, -2804, 4211, 2455, 14080, 626, 5818, -3071, 213, 5507,
+        2567, 7292, -1997, 4522, 3445, -11545, 4211, 2455, 7759, -1530, 4989, 81,
+        997, 4678, -210, 9533, -3517, 7014, -3052, -4324, 980, -3135, 4545, -1824,
+        4695, -213, -2631, 4384, 2628, 6095, -6461, 2447, 1161, -4001, 3014, 1258,
+        7465, -1824, 4695, -213, -2631, 4384, 2628, 15268, 1814, 7006, 766, 1401,
+        6695, 3755, 7465, -1824, 4695, 3618, -11372, 4384, 2628, 7465, -1824, 4695,
+        -213, 703, 4384, -504, 11226, -1824, 8707, -1359, -2631, 2673, -1442, 9501,
+        3132, 9651, 4743, 2325, 9340, 7584, 11051, -1505, 7403, 6117, 955, 7970,
+        6214, 12421, 3132, 9651, 4743, 2325, 9340, 7584, 20224, 6770, 11962, 5722,
+        6357, 11651, 8711, 12421, 3132, 9651, 8574, -6416, 9340, 7584, 12421, 3132,
+        9651, 4743, 5659, 9340, 4452, 16182, 3132, 13663, 3597, 2325, 7629, 3514,
+        4135, -2234, 4285, -623, -3041, 3974, 2218, 5685, -6871, 2037, 751, -4411,
+        2604, 848, 7055, -2234, 4285, -623, -3041, 3974, 2218, 17319, 3865, 9057,
+        2817, 3452, 8746, 5806, 7055, -2234, 4285, 3208, -11782, 3974, 2218, 7055,
+        -2234, 4285, -623, 293, 3974, -914, 10816, -2234, 8297, -3734, -3041, 2263,
+        -1852, 3726, -2643, 3876, -1032, -3450, 3565, 1809, 5276, -7280, 1628, 342,
+        -4820, 2195, 439, 6646, -2643, 3876, -1032, -3450, 3565, 1809, 14449, 995,
+        6187, -53, 582, 5876, 2936, 6646, -2643, 3876, 2799, -12191, 3565, 2512,
+        6646, -2643, 3876, -1032, -116, 3565, -1323, 10813, -2237, 8294, -1772, -3044,
+        2260, -1855, 7713, 1344, 7863, 2955, 537, 7552, 5796, 9263, -3293, 5615,
+        4329, -833, 6182, 4426, 10633, 1344, 7863, 2955, 537, 7552, 5796, 18436,
+        4982, 10174, 3934, 4569, 9863, 6923, 10633, 1344, 7863, 6786, -8204, 7552,
+        5796, 10633, 1344, 7863, 2955, 3871, 7552, 2664, 14394, 1344, 11875, 1809,
+        537, 5841, 1726, 4785, -1584, 4935, 27, -2391, 4624, 2868, 6335, -6221,
+        2687, 1401, -3761, 3254, 1498, 7705, -1584, 4935, 27, -2391, 4624, 2868,
+        16677, 3223, 8415, 1152, 2810, 8104, 5164, 7705, -1584, 4935, 3858, -11132,
+        4624, 2868, 7705, -1584, 4935, 27, 943, 3470, -264, 13560, -1578, 8953,
+        -1113, -2385, 2919, -1196, 4465, -1904, 4615, -293, -2711, 4304, 2548, 6015,
+        -6541, 2367, 1081, -4081, 2934, 1178, 7385, -1904, 4615, -293, -2711, 4304,
+        2548, 15188, 1734, 6926, -1963, 1321, 6615, 3675, 7385, -1904, 4615, 3538,
+        -11452, 4304, 2548, 7385, -1904, 4615, -293, 623, 4304, -584, 9768, -3282,
+        7249, -2817, -4089, 1215, -2900, 4638, -1731, 4788, -120, -2538, 4477, 2721,
+        6188, -6368, 2540, 1254, -3908, 3107, 1351, 7558, -1731, 4788, -120, -2538,
+        4477, 2721, 15361, 1907, 7099, 859, 1494, 6788, 3848, 7558, -1731, 4788,
+        3711, -11279, 4477, 2721, 7558, -1731, 4788, -120, 796, 4477, -411, 11319,
+        -1731, 8800, -1266, -2538, 2766, -1349, 9594, 3225, 9744, 4836, 2418, 9433,
+        7677, 11144, -1412, 7496, 6210, 1048, 8063, 6307, 12514, 3225, 9744, 4836,
+        2418, 9433, 7677, 20317, 6863, 12055, 5815, 6450, 11744, 8804, 12514, 3225,
+        9744, 8667, -6323, 9433, 7677, 12514, 3225, 9744, 4836, 5752, 9433, 4545,
+        16275, 3225, 13756, 3690, 2418, 7722, 3607, 4228, -2141, 4378, -530, -2948,
+        4067, 2311, 5778, -6778, 2130, 844, -4318, 2697, 941, 7148, -2141, 4378,
+        -530, -2948, 4067, 2311, 17412, 3958, 9150, 2910, 3545, 8839, 5899, 7148,
+        -2141, 4378, 3301, -11689, 4067, 2311, 7148, -2141, 4378, -530, 386, 4067,
+        -821, 10909, -2141, 8390, -3641, -2948, 2356, -1759, 3819, -2550, 3969, -939,
+        -3357, 3658, 1902, 5369, -7187, 1721, 435, -4727, 2288, 532, 6739, -2550,
+        3969, -939, -3357, 3658, 1902, 14542, 1088, 6280, 40, 675, 5969, 3029,
+        6739, -2550, 3969, 2892, -12098, 3658, 2605, 6739, -2550, 3969, -939, -23,
+        3658, -1230, 10906, -2144, 8387, -1679, -2951, 2353, -1762, 7806, 1437, 7956,
+        3048, 630, 7645, 5889, 9356, -3200, 5708, 4422, -740, 6275, 4519, 10726,
+        1437, 7956, 3048, 630, 7645, 5889, 18529, 5075, 10267, 4027, 4662, 9956,
+        7016, 10726, 1437, 7956, 6879, -8111, 7645, 5889, 10726, 1437, 7956, 3048,
+        3964, 7645, 2757, 14487, 1437, 11968, 1902, 630, 5934, 1819, 4878, -1491,
+        5028, 120, -2298, 4717, 2961, 6428, -6128, 2780, 1494, -3668, 3347, 1591,
+        7798, -1491, 5028, 120, -2298, 4717, 2961, 15601, 2147, 7339, 76, 1734,
+        7028, 4088, 7798, -1491, 5028, 3951, -11039, 4717, 2961, 7798, -1491, 5028,
+        120, 1036, 3563, -171, 13653, -1485, 9046, -1020, -2292, 3012, -1103, 5017,
+        -1352, 5167, 259, -2159, 4856, 3100, 6567, -5989, 2919, 1633, -3529, 3486,
+        1730, 7937, -1352, 5167, 259, -2159, 4856, 3100, 15740, 2286, 7478, -1411,
+        1873, 7167, 4227, 7937, -1352, 5167, 4090, -10900, 4856, 3100, 7937, -1352,
+        5167, 259, 1175, 4856, -32, 10320, -2730, 7801, -2265, -3537, 1767, -2348,
+        5190, -1179, 5340, 432, -1986, 5029, 3273, 6740, -5816, 3092, 1806, -3356,
+        3659, 1903, 8110, -1179, 5340, 432, -1986, 5029, 3273, 15913, 2459, 7651,
+        1411, 2046, 7340, 4400, 8110, -1179, 5340, 4263, -10727, 5029, 3273, 8110,
+        -1179, 5340, 432, 1348, 5029, 141, 11871, -1179, 9352, -714, -1986, 3318,
+        -797, 10146, 3777, 10296, 5388, 2970, 9985, 8229, 11696, -860, 8048, 6762,
+        1600, 8615, 6859, 13066, 3777, 10296, 5388, 2970, 9985, 8229, 20869, 7415,
+        12607, 6367, 7002, 12296, 9356, 13066, 3777, 10296, 9219, -5771, 9985, 8229,
+        13066, 3777, 10296, 5388, 6304, 9985, 5097, 16827, 3777, 14308, 4242, 2970,
+        8274, 4159, 4780, -1589, 4930, 22, -2396, 4619, 2863, 6330, -6226, 2682,
+        1396, -3766, 3249, 1493, 7700, -1589, 4930, 22, -2396, 4619, 2863, 17964,
+        4510, 9702, 3462, 4097, 9391, 6451, 7700, -1589, 4930, 3853, -11137, 4619,
+        2863, 7700, -1589, 4930, 22, 938, 4619, -269, 11461, -1589, 8942, -3089,
+        -2396, 2908, -1207, 4371, -1998, 4521, -387, -2805, 4210, 2454, 5921, -6635,
+        2273, 987, -4175, 2840, 1084, 7291, -1998, 4521, -387, -2805, 4210, 2454,
+        15094, 1640, 6832, 592, 1227, 6521, 3581, 7291, -1998, 4521, 3444, -11546,
+        4210, 3157, 7291, -1998, 4521, -387, 529, 4210, -678, 11458, -1592, 8939,
+        -1127, -2399, 2905, -1210, 8358, 1989, 8508, 3600, 1182, 8197, 6441, 9908,
+        -2648, 6260, 4974, -188, 6827, 5071, 11278, 1989, 8508, 3600, 1182, 8197,
+        6441, 19081, 5627, 10819, 4579, 5214, 10508, 7568, 11278, 1989, 8508, 7431,
+        -7559, 8197, 6441, 11278, 1989, 8508, 3600, 4516, 8197, 3309, 15226, 2176,
+        12707, 2641, 1369, 6673, 2558, 5430, -939, 5580, 672, -1746, 5269, 3513,
+        6980, -5576, 3332, 2046, -3116, 3899, 2143, 8350, -939, 5580, 672, -1746,
+        5269, 3513, 16153, 2699, 7891, 628, 2286, 7580, 4640, 8350, -939, 5580,
+        4503, -10487, 5269, 3513, 8350, -939, 5580, 672, 1588, 4115, 381, 14205,
+        -933, 9598, -468, -1740, 3564, -551, 4372, -1997, 4522, -386, -2804, 4211,
+        2455, 5922, -6634, 2274, 988, -4174, 2841, 1085, 7292, -1997, 4522, -386,
+        -2804, 4211, 2455, 15095, 1641, 6833, -2056, 1228, 6522, 3582, 7292, -1997,
+        4522, 3445, -11545, 4211, 2455, 6961, -2328, 4191, -717, 199, 3880, -1008,
+        9285, -3765, 6766, -3300, -4572, 732, -3383, 4545, -1824, 4695, -213, -2631,
+        4384, 2628, 6095, -6461, 2447, 1161, -4001, 3014, 1258, 7465, -1824, 4695,
+        -213, -2631, 4384, 2628, 15268, 1814, 7006, 766, 1401, 6695, 3755, 7465,
+        -1824, 4695, 3618, -11372, 4384, 2628, 7465, -1824, 4695, -213, 703, 4384,
+        -504, 11226, -1824, 8707, -1359, -2631, 2673, -1442, 9501, 3132, 9651, 4743,
+        2325, 9340, 7584, 11051, -1505, 7403, 6117, 955, 7970, 6214, 12421, 3132,
+        9651, 4743, 2325, 9340, 7584, 20224, 6770, 11962, 5722, 6357, 11651, 8711,
+        12421, 3132, 9651, 8574, -6416, 9340, 7584, 12421, 3132, 9651, 4743, 5659,
+        9340, 4452, 16182, 3132, 13663, 3597, 2325, 7629, 3514, 4135, -2234, 4285,
+        -623, -3041, 3974, 2218, 5685, -6871, 2037, 751, -4411, 2604, 848, 7055,
+        -2234, 4285, -623, -3041, 3974, 2218, 18317, 4863, 10055, 3815, 4450, 9744,
+        6804, 7055, -2234, 4285, 3208, -11782, 3974, 2218, 7055, -2234, 4285, -623,
+        293, 3974, -914, 10816, -2234, 8297, -3734, -3041, 2263, -1852, 3726, -2643,
+        3876, -1032, -3450, 3565, 1809, 5276, -7280, 1628, 342, -4820, 2195, 439,
+        6646, -2643, 3876, -1032, -3450, 3565, 1809, 14449, 995, 6187, -53, 582,
+        5876, 2936, 6646, -2643, 3876, 2799, -12191, 3565, 2512, 6646, -2643, 3876,
+        -1032, -116, 3565, -1323, 10813, -2237, 8294, -1772, -3044, 2260, -1855, 7713,
+        1344, 7863, 2955, 537, 7552, 5796, 9263, -3293, 5615, 4329, -833, 6182,
+        4426, 10633, 1344, 7863, 2955, 537, 7552, 5796, 18436, 4982, 10174, 3934,
+        4569, 9863, 6923, 10633, 1344, 7863, 6786, -8204, 7552, 5796, 10633, 1344,
+        7863, 2955, 3871, 7552, 2664, 14394, 1344, 11875, 1809, 537, 5841, 1726,
+        4785, -1584, 4935, 27, -2391, 4624, 2868, 6335, -6221, 2687, 1401, -3761,
+        3254, 1498, 7705, -1584, 4935, 27, -2391, 4624, 2868, 15508, 2054, 7246,
+        -17, 1641, 6935, 3995, 7705, -1584, 4935, 3858, -11132, 4624, 2868, 8285,
+        -1004, 5515, 607, 1523, 4050, 316, 14589, -549, 9982, -84, -1356, 3948,
+        -167, 15566, 9197, 15716, 10808, 8390, 15405, 13649, 5417, -7139, 1769, 483,
+        -4679, 2336, 1506, 3575, -5714, -168, -4103, -6521, 494, -1262, 11931, -1523,
+        3669, -5220, -1936, 3358, 418, 6787, -2502, 4017, 2940, -12050, 3706, 1950,
+        6787, -2502, 4017, -891, 25, 3706, -1182, 9170, -3880, 6651, -3415, -6723,
+        617, -3232, 4040, -2329, 4190, -718, -3136, 3879, 2123, 5590, -9729, 1942,
+        656, -4506, 2509, 1679, 3748, -5541, 5, -3930, -6348, 667, -1089, 13936,
+        482, 5674, -566, 69, 5363, 2423, 6960, -2329, 4190, 3113, -11697, 3879,
+        2123, 6960, -2329, 4190, -718, 198, 3879, -1009, 10721, -2329, 8202, -1864,
+        -5172, 2168, -1681, 8996, 2627, 9146, 4238, 1820, 8835, 7079, 10546, -2010,
+        6898, 5612, 450, 7465, 6635, 8704, -585, 4961, 1026, -1392, 5623, 3867,
+        18892, 5438, 10630, 4390, 5025, 10319, 7379, 11916, 2627, 9146, 8069, -6921,
+        8835, 7079, 11916, 2627, 9146, 4238, 5154, 8835, 3947, 15677, 2627, 13158,
+        3092, -216, 7124, 3275, 3630, -2739, 3780, -1128, -3546, 3469, 1713, 5180,
+        -7376, 1532, 246, -4916, 2099, 1269, 3338, -5951, -405, -4340, -6758, 257,
+        -1499, 15582, 2128, 7320, -2927, 1715, 7009, 4695, 6550, -2739, 3780, 2703,
+        -12287, 3469, 1713, 6550, -2739, 3780, -1128, -212, 3469, -1419, 10311, -2739,
+        7792, -4732, -5582, 1758, -156, 979, -5390, 1129, -3779, -6197, 818, -938,
+        4771, -7785, 1123, -163, -13481, 1690, 860, 2929, -6360, -814, -4749, -7167,
+        -152, -1908, 12324, -1130, 4062, -2178, -1543, 3751, 811, 6141, -3148, 3371,
+        2294, -12696, 3060, 2007, 6141, -3148, 3371, -1537, -621, 3060, -1828, 12106,
+        -944, 9587, -479, -3787, 3553, -296, 7208, 839, 7358, 2450, 32, 7047,
+        5291, 8758, -3798, 5110, 3824, -1338, 5677, 4847, 6916, -2373, 3173, -762,
+        -3180, 3835, 2079, 17104, 3650, 8842, 2602, 3237, 8531, 5591, 10128, 839,
+        7358, 6281, -8709, 7047, 5291, 10128, 839, 7358, 2450, 3366, 7047, 2159,
+        11487, -1563, 8968, -1098, -4406, 2934, -915, 4280, -2089, 4430, -478, -2896,
+        4119, 2363, 5830, -6726, 2182, 896, -4266, 2749, 1919, 3988, -5301, 245,
+        -3690, -6108, 907, -849, 14176, 722, 5914, -1349, 309, 5603, 1090, 7200,
+        -2089, 4430, 3353, -11637, 4119, 2363, 7639, -1650, 4869, -39, 877, 3404,
+        -330, 15819, 201, 10732, 3112, -2642, 4698, 555, 16555, 10186, 16705, 11797,
+        9379, 16394, 14638, 6406, -6150, 2758, 1472, -3690, 3325, 2495, 4564, -4725,
+        821, -3114, -5532, 1483, -273, 14752, 1298, 6490, -2399, 885, 6179, 3239,
+        7776, -1513, 5006, 3929, -11061, 4695, 2939, 7776, -1513, 5006, 98, 1014,
+        4695, -193, 10159, -2891, 7640, -2426, -5734, 1606, -2243, 5029, -1340, 5179,
+        271, -2147, 4868, 3112, 7672, -7647, 4024, 2738, -2424, 4591, 3761, 4737,
+        -4552, 994, -2941, -5359, 1656, -100, 14925, 1471, 6663, 423, 1058, 6352,
+        3412, 7949, -1340, 5179, 4102, -10708, 4868, 3112, 7949, -1340, 5179, 271,
+        1187, 4868, -20, 11710, -1340, 9191, -875, -4183, 3157, -692, 9985, 3616,
+        10135, 5227, 2809, 9824, 8068, 11535, -1021, 7887, 6601, 1439, 8454, 7624,
+        9693, 404, 5950, 2015, -403, 6612, 4856, 19881, 6427, 11619, 5379, 6014,
+        11308, 8368, 12905, 3616, 10135, 9058, -5932, 9824, 8068, 12905, 3616, 10135,
+        5227, 6143, 9824, 4936, 16666, 3616, 14147, 4081, 773, 8113, 4264, 4619,
+        -1750, 4769, -139, -2557, 4458, 2702, 6169, -6387, 2521, 1235, -3927, 3088,
+        2258, 4327, -4962, 584, -3351, -5769, 1246, -510, 17256, 3802, 8994, -1253,
+        3389, 8683, 6369, 7539, -1750, 4769, 3692, -11298, 4458, 2702, 7539, -1750,
+        4769, -139, 777, 4458, -430, 11300, -1750, 8781, -3743, -4593, 2747, 833,
+        1968, -4401, 2118, -2790, -5208, 1807, 51, 5760, -6796, 2112, 826, -12492,
+        2679, 1849, 3918, -5371, 175, -3760, -6178, 837, -919, 13313, -141, 5051,
+        -1189, -554, 4740, 1800, 7130, -2159, 4360, 3283, -11707, 4049, 2996, 7130,
+        -2159, 4360, -548, 368, 4049, -839, 13095, 45, 10576, 510, -2798, 4542,
+        693, 8197, 1828, 8347, 3439, 1021, 8036, 6280, 9747, -2809, 6099, 4813,
+        -349, 6666, 5836, 7905, -1384, 4162, 227, -2191, 4824, 3068, 18093, 4639,
+        9831, 3591, 4226, 9520, 6580, 11117, 1828, 8347, 7270, -7720, 8036, 6280,
+        11117, 1828, 8347, 3439, 4355, 8036, 3148, 12476, -574, 9957, -109, -3417,
+        3923, 74, 5269, -1100, 5419, 511, -1907, 5108, 3352, 6819, -5737, 3171,
+        1885, -3277, 3738, 2908, 4977, -4312, 1234, -2701, -5119, 1896, 140, 15165,
+        1711, 6903, -360, 1298, 6592, 2079, 8189, -1100, 5419, 4342, -10648, 5108,
+        3352, 8628, -661, 5858, 950, 1866, 4393, 659, 16698, 1080, 11611, 3991,
+        -1763, 5577, 1434, 16071, 9702, 16221, 11313, 8895, 15910, 14154, 5922, -6634,
+        2274, 988, -4174, 2841, 2011, 4080, -5209, 337, -3598, -6016, 999, -757,
+        14268, 814, 6006, -2883, 401, 5695, 2755, 7292, -1997, 4522, 3445, -11545,
+        4211, 2455, 7292, -1997, 4522, -386, 530, 4211, -677, 9675, -3375, 7156,
+        -2910, -6218, 1122, -2727, 4545, -1824, 4695, -213, -2631, 4384, 2628, 6095,
+        -9224, 2447, 1161, -4001, 3014, 2184, 4253, -5036, 510, -3425, -5843, 1172,
+        -584, 14441, 987, 6179, -61, 574, 5868, 2928, 7465, -1824, 4695, 3618,
+        -11192, 4384, 2628, 7465, -1824, 4695, -213, 703, 4384, -504, 11226, -1824,
+        8707, -1359, -4667, 2673, -1176, 9501, 3132, 9651, 4743, 2325, 9340, 7584,
+        11051, -1505, 7403, 6117, 955, 7970, 7140, 9209, -80, 5466, 1531, -887,
+        6128, 4372, 19397, 5943, 11135, 4895, 5530, 10824, 7884, 12421, 3132, 9651,
+        8574, -6416, 9340, 7584, 12421, 3132, 9651, 4743, 5659, 9340, 4452, 16182,
+        3132, 13663, 3597, 289, 7629, 3780, 4135, -2234, 4285, -623, -3041, 3974,
+        2218, 5685, -6871, 2037, 751, -4411, 2604, 1774, 3843, -5446, 100, -3835,
+        -6253, 762, -994, 16772, 3318, 8510, -1737, 2905, 8199, 5885, 7055, -2234,
+        4285, 3208, -11782, 3974, 2218, 7055, -2234, 4285, -623, 293, 3974, -914,
+        10816, -2234, 8297, -4227, -5077, 2263, 349, 1484, -4885, 1634, -3274, -5692,
+        1323, -433, 5276, -7280, 1628, 342, -12976, 2195, 1365, 3434, -5855, -309,
+        -4244, -6662, 353, -1403, 12829, -625, 4567, -1673, -1038, 4256, 1316, 6646,
+        -2643, 3876, 2799, -12191, 3565, 2512, 6646, -2643, 3876, -1032, -116, 3565,
+        -1323, 12611, -439, 10092, 26, -3282, 4058, 209, 7713, 1344, 7863, 2955,
+        537, 7552, 5796, 9263, -3293, 5615, 4329, -833, 6182, 5352, 7421, -1868,
+        3678, -257, -2675, 4340, 2584, 17609, 4155, 9347, 3107, 3742, 9036, 6096,
+        10633, 1344, 7863, 6786, -8204, 7552, 5796, 10633, 1344, 7863, 2955, 3871,
+        7552, 2664, 11992, -1058, 9473, -593, -3901, 3439, -410, 4785, -1584, 4935,
+        27, -2391, 4624, 2868, 6335, -6221, 2687, 1401, -3761, 3254, 2424, 4493,
+        -4796, 750, -3185, -5603, 1412, -344, 14681, 1227, 6419, -844, 814, 6108,
+        1595, 7705, -1584, 4935, 3858, -11132, 4624, 2868, 8144, -1145, 5374, 466,
+        1382, 3909, 175, 16214, 596, 11127, 3507, -2247, 5093, 950, 16071, 9702,
+        16221, 11313, 8895, 15910, 14154, 5922, -6634, 2274, 988, -4174, 2841, 2011,
+        4080, -5209, 337, -3598, -6016, 999, -757, 13253, -201, 4991, -3898, -614,
+        4680, 1740, 7292, -1997, 4522, 3445, -11545, 4211, 2455, 7759, -1530, 4989,
+        81, 997, 4678, -210, 9533, -3517, 7014, -3052, -6360, 980, -2869, 4545,
+        -1824, 4695, -213, -2631, 4384, 2628, 6095, -9224, 2447, 1161, -4001, 3014,
+        2184, 4253, -5036, 510, -3425, -5843, 1172, -584, 14441, 987, 6179, -61,
+        574, 5868, 2928, 7465, -1824, 4695, 3618, -11192, 4384, 2628, 7465, -1824,
+        4695, -213, 703, 4384, -504, 11226, -1824, 8707, -1359, -4667, 2673, -1176,
+        9501, 3132, 9651, 4743, 2325, 9340, 7584, 11051, -1505, 7403, 6117, 955,
+        7970, 7140, 9209, -80, 5466, 1531, -887, 6128, 4372, 19397, 5943, 11135,
+        4895, 5530, 10824, 7884, 12421, 3132, 9651, 8574, -6416, 9340, 7584, 12421,
+        3132, 9651, 4743, 5659, 9340, 4452, 16182, 3132, 13663, 3597, 289, 7629,
+        3780, 4135, -2234, 4285, -623, -3041, 3974, 2218, 5685, -6871, 2037, 751,
+        -4411, 2604, 1774, 3843, -5446, 100, -3835, -6253, 762, -994, 16772, 3318,
+        8510, -1737, 2905, 8199, 5885, 7055, -2234, 4285, 3208, -11782, 3974, 2218,
+        7055, -2234, 4285, -623, 293, 3974, -914, 12160, -890, 9641, -2883, -3733,
+        3607, 1693, 1484, -4885, 1634, -3274, -5692, 1323, -433, 5276, -7280, 1628,
+        342, -12976, 2195, 1365, 3434, -5855, -309, -4244, -6662, 353, -1403, 12829,
+        -625, 4567, -1673, -1038, 4256, 1316, 6646, -2643, 3876, 2799, -12191, 3565,
+        2512, 6646, -2643, 3876, -1032, -116, 3565, -1323, 12611, -439, 10092, 26,
+        -3282, 4058, 209, 7713, 1344, 7863, 2955, 537, 7552, 5796, 9263, -3293,
+        5615, 4329, -833, 6182, 5352, 7421, -1868, 3678, -257, -2675, 4340, 2584,
+        17609, 4155, 9347, 3107, 3742, 9036, 6096, 10633, 1344, 7863, 6786, -8204,
+        7552, 5796, 10633, 1344, 7863, 2955, 3871, 7552, 2664, 11992, -1058, 9473,
+        -593, -3901, 3439, -410, 4785, -1584, 4935, 27, -2391, 4624, 2868, 6335,
+        -6221, 2687, 1401, -3761, 3254, 2424, 4493, -4796, 750, -3185, -5603, 1412,
+        -344, 15850, 2396, 7588, 325, 1983, 7277, 2764, 7705, -1584, 4935, 3858,
+        -11132, 4624, 2868, 8144, -1145, 5374, 466, 1382, 3909, 175, 16837, 1219,
+        11750, 4130, -1624, 5716, 1573, 16164, 9795, 16314, 11406, 8988, 16003, 14247,
+        6015, -6541, 2367, 1081, -4081, 2934, 2104, 4173, -5116, 430, -3505, -5923,
+        1092, -664, 14361, 907, 6099, -2790, 494, 5788, 2848, 7385, -1904, 4615,
+        3538, -11452, 4304, 2548, 7385, -1904, 4615, -293, 623, 4304, -584, 9768,
+        -3282, 7249, -2817, -6125, 1215, -2634, 4638, -1731, 4788, -120, -2538, 4477,
+        2721, 6188, -9131, 2540, 1254, -3908, 3107, 2277, 4346, -4943, 603, -3332,
+        -5750, 1265, -491, 14534, 1080, 6272, 32, 667, 5961, 3021, 10350, 1061,
+        7580, 6503, -8307, 7269, 5513, 7558, -1731, 4788, -120, 796, 4477, -411,
+        11319, -1731, 8800, -1266, -4574, 2766, -1083, 9594, 3225, 9744, 4836, 2418,
+        9433, 7677, 11144, -1412, 7496, 6210, 1048, 8063, 7233, 9302, 13, 5559,
+        1624, -794, 6221, 4465, 19490, 6036, 11228, 4988, 5623, 10917, 7977, 12514,
+        3225, 9744, 8667, -6323, 9433, 7677, 12514, 3225, 9744, 4836, 5752, 9433,
+        4545, 16275, 3225, 13756, 3690, 382, 7722, 3873, 4228, -2141, 4378, -530,
+        -2948, 4067, 2311, 5778, -6778, 2130, 844, -4318, 2697, 1867, 3936, -5353,
+        193, -3742, -6160, 855, -901, 16865, 3411, 8603, -1644, 2998, 8292, 5978,
+        7148, -2141, 4378, 3301, -11689, 4067, 2311, 7148, -2141, 4378, -530, 386,
+        4067, -821, 10909, -2141, 8390, -4134, -4984, 2356, 442, 1577, -4792, 1727,
+        -3181, -5599, 1416, -340, 6048, -6508, 2400, 1114, -12204, 2967, 2137, 3527,
+        -5762, -216, -4151, -6569, 446, -1310, 12922, -532, 4660, -1580, -945, 4349,
+        1409, 6739, -2550, 3969, 2892, -12098, 3658, 2605, 6739, -2550, 3969, -939,
+        -23, 3658, -1230, 12704, -346, 10185, 119, -3189, 4151, 302, 7806, 1437,
+        7956, 3048, 630, 7645, 5889, 9356, -3200, 5708, 4422, -740, 6275, 5445,
+        7514, -1775, 3771, -164, -2582, 4433, 2677, 17702, 4248, 9440, 3200, 3835,
+        9129, 6189, 10726, 1437, 7956, 6879, -8111, 7645, 5889, 10726, 1437, 7956,
+        3048, 3964, 7645, 2757, 12085, -965, 9566, -500, -3808, 3532, -317, 4878,
+        -1491, 5028, 120, -2298, 4717, 2961, 6428, -6128, 2780, 1494, -3668, 3347,
+        2517, 4586, -4703, 843, -3092, -5510, 1505, -251, 14774, 1320, 6512, -751,
+        907, 6201, 1688, 7798, -1491, 5028, 3951, -11039, 4717, 2961, 8237, -1052,
+        5467, 559, 1475, 4002, 268, 16894, 1276, 11807, 4187, -1567, 5773, 1630,
+        16716, 10347, 16866, 11958, 9540, 16555, 14799, 6567, -5989, 2919, 1633, -3529,
+        3486, 2656, 4725, -4564, 982, -2953, -5371, 1644, -112, 14913, 1459, 6651,
+        -2238, 1046, 6340, 3400, 7937, -1352, 5167, 4090, -10900, 4856, 3100, 7937,
+        -1352, 5167, 259, 1175, 4856, -32, 10320, -2730, 7801, -2265, -5573, 1767,
+        -2082, 5190, -1179, 5340, 432, -1986, 5029, 3273, 6740, -8579, 3092, 1806,
+        -3356, 3659, 2829, 4898, -4391, 1155, -2780, -5198, 1817, 61, 15086, 1632,
+        6824, 584, 1219, 6513, 3573, 8110, -1179, 5340, 4263, -10547, 5029, 3273,
+        8110, -1179, 5340, 432, 1348, 5029, 141, 11871, -1179, 9352, -714, -4022,
+        3318, -531, 10146, 3777, 10296, 5388, 2970, 9985, 8229, 11696, -860, 8048,
+        6762, 1600, 8615, 7785, 9854, 565, 6111, 2176, -242, 6773, 5017, 20042,
+        6588, 11780, 5540, 6175, 11469, 8529, 13066, 3777, 10296, 9219, -5771, 9985,
+        8229, 13066, 3777, 10296, 5388, 6304, 9985, 5097, 16827, 3777, 14308, 4242,
+        934, 8274, 4425, 4780, -1589, 4930, 22, -2396, 4619, 2863, 6330, -6226,
+        2682, 1396, -3766, 3249, 2419, 4488, -4801, 745, -3190, -5608, 1407, -349,
+        17417, 3963, 9155, -1092, 3550, 8844, 6530, 7700, -1589, 4930, 3853, -11137,
+        4619, 2863, 7700, -1589, 4930, 22, 938, 4619, -269, 11461, -1589, 8942,
+        -3582, -4432, 2908, 994, 2129, -4240, 2279, -2629, -5047, 1968, 212, 5921,
+        -6635, 2273, 987, -12331, 2840, 2010, 4079, -5210, 336, -3599, -6017, 998,
+        -758, 13474, 20, 5212, -1028, -393, 4901, 1961, 7291, -1998, 4521, 3444,
+        -11546, 4210, 3157, 7291, -1998, 4521, -387, 529, 4210, -678, 13256, 206,
+        10737, 671, -2637, 4703, 854, 8358, 1989, 8508, 3600, 1182, 8197, 6441,
+        9908, -2648, 6260, 4974, -188, 6827, 5997, 8066, -1223, 4323, 388, -2030,
+        4985, 3229, 18254, 4800, 9992, 3752, 4387, 9681, 6741, 11278, 1989, 8508,
+        7431, -7559, 8197, 6441, 11278, 1989, 8508, 3600, 4516, 8197, 3309, 12824,
+        -226, 10305, 239, -3069, 4271, 422, 5430, -939, 5580, 672, -1746, 5269,
+        3513, 6980, -5576, 3332, 2046, -3116, 3899, 3069, 5138, -4151, 1395, -2540,
+        -4958, 2057, 301, 15326, 1872, 7064, -199, 1459, 6753, 2240, 8350, -939,
+        5580, 4503, -10487, 5269, 3513, 8789, -500, 6019, 1111, 2027, 4554, 820,
+        16859, 1241, 11772, 4152, -1602, 5738, 1595, 16071, 9702, 16221, 11313, 8895,
+        15910, 14154, 5922, -6634, 2274, 988, -4174, 2841, 2011, 4080, -5209, 337,
+        -3598, -6016, 999, -757, 14268, 814, 6006, -2883, 401, 5695, 2755, 7292,
+        -1997, 4522, 3445, -11545, 4211, 2455, 6961, -2328, 4191, -717, 199, 3880,
+        -1008, 9285, -3765, 6766, -3300, -6608, 732, -3117, 4545, -1824, 4695, -213,
+        -2631, 4384, 2628, 6095, -9224, 2447, 1161, -4001, 3014, 2184, 4253, -5036,
+        510, -3425, -5843, 1172, -584, 14441, 987, 6179, -61, 574, 5868, 2928,
+        7465, -1824, 4695, 3618, -11192, 4384, 2628, 7465, -1824, 4695, -213, 703,
+        4384, -504, 11226, -1824, 8707, -1359, -4667, 2673, -1176, 9501, 3132, 9651,
+        4743, 2325, 9340, 7584, 11051, -1505, 7403, 6117, 955, 7970, 7140, 9209,
+        -80, 5466, 1531, -887, 6128, 4372, 19397, 5943, 11135, 4895, 5530, 10824,
+        7884, 12421, 3132, 9651, 8574, -6416, 9340, 7584, 12421, 3132, 9651, 4743,
+        5659, 9340, 4452, 16182, 3132, 13663, 3597, 289, 7629, 3780, 4135, -2234,
+        4285, -623, -3041, 3974, 2218, 5685, -6871, 2037, 751, -4411, 2604, 1774,
+        3843, -5446, 100, -3835, -6253, 762, -994, 18767, 5313, 10505, 258, 4900,
+        10194, 7880, 7055, -2234, 4285, 3208, -11782, 3974, 2218, 7055, -2234, 4285,
+        -623, 293, 3974, -914, 10816, -2234, 8297, -4227, -5077, 2263, 349, 1484,
+        -4885, 1634, -3274, -5692, 1323, -433, 5276, -7280, 1628, 342, -12976, 2195,
+        1365, 3434, -5855, -309, -4244, -6662, 353, -1403, 12829, -625, 4567, -1673,
+        -1038, 4256, 1316, 6646, -2643, 3876, 2799, -12191, 3565, 2512, 6646, -2643,
+        3876, -1032, -116, 3565, -1323, 12611, -439, 10092, 26, -3282, 4058, 209,
+        7713, 1344, 7863, 2955, 537, 7552, 5796, 9263, -3293, 5615, 4329, -833,
+        6182, 5352, 7421, -1868, 3678, -257, -2675, 4340, 2584, 17609, 4155, 9347,
+        3107, 3742, 9036, 6096, 10633, 1344, 7863, 6786, -8204, 7552, 5796, 10633,
+        1344, 7863, 2955, 3871, 7552, 2664, 12473, -577, 9954, -112, -3420, 3920,
+        71, 4785, -1584, 4935, 27, -2391, 4624, 2868, 6335, -6221, 2687, 1401,
+        -3761, 3254, 2424, 4493, -4796, 750, -3185, -5603, 1412, -344, 16410, 2956,
+        8148, 885, 2543, 7837, 3324, 7705, -1584, 4935, 3858, -11132, 4624, 2868,
+        8724, -565, 5954, 1046, 1962, 4489, 755, 17589, 1971, 12502, 4882, -872,
+        6468, 2325, 6421, 12448, 18967, 14059, 11641, 18656, 16900, 5127, -7429, 1479,
+        193, -4969, 2046, 290, 13403, 4114, 10633, 5725, 3307, 10322, 8566, 14860,
+        1406, 6598, -6945, 2341, 6287, 7108, -222, -9511, -2992, -4069, -20865, -3303,
+        -5059, 10136, 847, 7366, -927, 3374, 7055, 2167, 10176, -2874, 7657, -2409,
+        -3681, 1623, -6387, 6594, 12621, 19140, 14232, 11814, 18829, 17073, 5300, -7256,
+        1652, 366, -4796, 2219, 463, 13576, 4287, 10806, 5898, 3480, 10495, 8739,
+        16865, 3411, 8603, -2291, 4346, 8292, 9113, -49, -9338, -2819, -3896, -20692,
+        -3130, -4886, 10309, 1020, 7539, -754, 3547, 7228, 2340, 10952, -2098, 8433,
+        -1633, -2905, 2399, -5611, 11550, 17577, 24096, 19188, 16770, 23785, 22029, 10256,
+        -2300, 6608, 5322, 160, 7175, 5419, 19530, 10241, 16760, 11852, 9434, 16449,
+        14693, 21821, 8367, 13559, 2665, 9302, 13248, 14069, 4907, -4382, 2137, 1060,
+        -15736, 1826, 70, 15265, 5976, 12495, 4202, 8503, 12184, 7296, 15908, 2858,
+        13389, 3323, 2051, 7355, -655, 6184, 12211, 18730, 13822, 11404, 18419, 16663,
+        4890, -7666, 1242, -44, -5206, 1809, 53, 13166, 3877, 10396, 5488, 3070,
+        10085, 8329, 18617, 5163, 10355, -2720, 6098, 10044, 10258, -459, -9748, -3229,
+        -4306, -21102, -3540, -5296, 9899, 610, 7129, -1164, 3137, 6818, 1930, 10542,
+        -2508, 8023, -4008, -3315, 1989, -6021, 5775, 11802, 18321, 13413, 10995, 18010,
+        16254, 4481, -8075, 833, -453, -5615, 1400, -356, 12757, 3468, 9987, 5079,
+        2661, 9676, 7920, 16465, 3011, 8203, -2691, 3946, 7892, 8713, -868, -10157,
+        -3638, -4715, -21511, -3949, -5002, 9490, 201, 6720, -1573, 2728, 6409, 1521,
+        10539, -2511, 8020, -2046, -3318, 1986, -6024, 9762, 15789, 22308, 17400, 14982,
+        21997, 20241, 8468, -4088, 4820, 3534, -1628, 5387, 3631, 16744, 7455, 13974,
+        9066, 6648, 13663, 11907, 20033, 6579, 11771, 877, 7514, 11460, 12281, 3119,
+        -6170, 349, -728, -17524, 38, -1718, 21812, 12523, 19042, 10749, 15050, 18731,
+        13843, 15677, 2627, 13158, 3092, 1820, 7124, -886, 6834, 12861, 19380, 14472,
+        12054, 19069, 17313, 5540, -7016, 1892, 606, -4556, 2459, 703, 13816, 4527,
+        11046, 6138, 3720, 10735, 8979, 19769, 6315, 11507, -1376, 7250, 11196, 12017,
+        191, -9098, -2579, -3656, -20452, -2890, -4646, 10549, 1260, 7779, -514, 3787,
+        6314, 2580, 12494, -2644, 7887, -2179, -3451, -1751, -6878, 7410, 13437, 19956,
+        15048, 12630, 19645, 17889, 6116, -6440, 2468, 1182, -3980, 3035, 1279, 14392,
+        5103, 11622, 6714, 4296, 11311, 9555, 17681, 4227, 9419, -4124, 5162, 9108,
+        9929, 767, -8522, -2003, -3080, -19876, -2314, -4070, 11125, 1836, 8355, 62,
+        4363, 8044, 3156, 11165, -1885, 8646, -1420, -2692, 2612, -5398, 7583, 13610,
+        20129, 15221, 12803, 19818, 18062, 7382, -5174, 3734, 2448, -2714, 4301, 2545,
+        14565, 5276, 11795, 6887, 4469, 11484, 9728, 17854, 4400, 9592, -1302, 5335,
+        9281, 10102, 940, -8349, -1830, -2907, -19703, -2141, -3897, 11298, 2009, 8528,
+        235, 4536, 8217, 3329, 11941, -1109, 9422, -644, -1916, 3388, -4622, 12539,
+        18566, 25085, 20177, 17759, 24774, 23018, 11245, -1311, 7597, 6311, 1149, 8164,
+        6408, 20519, 11230, 17749, 12841, 10423, 17438, 15682, 22810, 9356, 14548, 3654,
+        10291, 14237, 15058, 5896, -3393, 3126, 2049, -14747, 2815, 1059, 16254, 6965,
+        13484, 5191, 9492, 13173, 8285, 16897, 3847, 14378, 4312, 3040, 8344, 334,
+        7173, 13200, 19719, 14811, 12393, 19408, 17652, 5879, -6677, 2231, 945, -4217,
+        2798, 1042, 14155, 4866, 11385, 6477, 4059, 11074, 9318, 19606, 6152, 11344,
+        -1731, 7087, 11033, 11247, 530, -8759, -2240, -3317, -20113, -2551, -4307, 10888,
+        1599, 8118, -175, 4126, 7807, 2919, 11531, -1519, 9012, -3019, -2326, 2978,
+        -5032, 6764, 12791, 19310, 14402, 11984, 18999, 17243, 5470, -7086, 1822, 536,
+        -4626, 2389, 633, 13746, 4457, 10976, 6068, 3650, 10665, 8909, 17454, 4000,
+        9192, -1702, 4935, 8881, 9702, 121, -9168, -2649, -3726, -20522, -2960, -4013,
+        10479, 1190, 7709, -584, 3717, 7398, 2510, 11528, -1522, 9009, -1057, -2329,
+        2975, -5035, 10751, 16778, 23297, 18389, 15971, 22986, 21230, 9457, -3099, 5809,
+        4523, -639, 6376, 4620, 17733, 8444, 14963, 10055, 7637, 14652, 12896, 21022,
+        7568, 12760, 1866, 8503, 12449, 13270, 4108, -5181, 1338, 261, -16535, 1027,
+        -729, 22801, 13512, 20031, 11738, 16039, 19720, 14832, 16046, 2996, 13527, 3461,
+        2189, 7493, -517, 7823, 13850, 20369, 15461, 13043, 20058, 18302, 6529, -6027,
+        2881, 1595, -3567, 3448, 1692, 14805, 5516, 12035, 7127, 4709, 11724, 9968,
+        20758, 7304, 12496, -387, 8239, 12185, 13006, 1180, -8109, -1590, -2667, -19463,
+        -1901, -3657, 11538, 2249, 8768, 475, 4776, 7303, 3569, 13483, -1655, 8876,
+        -1190, -2462, -762, -5889, 6926, 12953, 19472, 14564, 12146, 19161, 17405, 5632,
+        -6924, 1984, 698, -4464, 2551, 795, 13908, 4619, 11138, 6230, 3812, 10827,
+        9071, 17197, 3743, 8935, -4608, 4678, 8624, 9445, 283, -9006, -2487, -3564,
+        -20360, -2798, -4554, 10641, 1352, 7871, -422, 3879, 7560, 2672, 10681, -2369,
+        8162, -1904, -3176, 2128, -5882, 7099, 13126, 19645, 14737, 12319, 19334, 17578,
+        5805, -6751, 2157, 871, -4291, 2724, 968, 14081, 4792, 11311, 6403, 3985,
+        11000, 9244, 17370, 3916, 9108, -1786, 4851, 8797, 9618, 456, -8833, -2314,
+        -3391, -20187, -2625, -4381, 10814, 1525, 8044, -249, 4052, 7733, 2845, 11457,
+        -1593, 8938, -1128, -2400, 2904, -5106, 12055, 18082, 24601, 19693, 17275, 24290,
+        22534, 10761, -1795, 7113, 5827, 665, 7680, 5924, 20035, 10746, 17265, 12357,
+        9939, 16954, 15198, 22326, 8872, 14064, 3170, 9807, 13753, 14574, 5412, -3877,
+        2642, 1565, -15231, 2331, 575, 15770, 6481, 13000, 4707, 9008, 12689, 7801,
+        16413, 3363, 13894, 3828, 2556, 7860, -150, 6689, 12716, 19235, 14327, 11909,
+        18924, 17168, 5395, -7161, 1747, 461, -4701, 2314, 558, 13671, 4382, 10901,
+        5993, 3575, 10590, 8834, 19122, 5668, 10860, -2215, 6603, 10549, 10763, 46,
+        -9243, -2724, -3801, -20597, -3035, -4791, 10404, 1115, 7634, -659, 3642, 7323,
+        2435, 11047, -2003, 8528, -3503, -2810, 2494, -5516, 6280, 12307, 18826, 13918,
+        11500, 18515, 16759, 4986, -7570, 1338, 52, -5110, 1905, 149, 13262, 3973,
+        10492, 5584, 3166, 10181, 8425, 16970, 3516, 8708, -2186, 4451, 8397, 9218,
+        -363, -9652, -3133, -4210, -21006, -3444, -4497, 9995, 706, 7225, -1068, 3233,
+        6914, 2026, 11044, -2006, 8525, -1541, -2813, 2491, -5519, 10267, 16294, 22813,
+        17905, 15487, 22502, 20746, 8973, -3583, 5325, 4039, -1123, 5892, 4136, 17249,
+        7960, 14479, 9571, 7153, 14168, 12412, 20538, 7084, 12276, 1382, 8019, 11965,
+        12786, 3624, -5665, 854, -223, -17019, 543, -1213, 22317, 13028, 19547, 11254,
+        15555, 19236, 14348, 15562, 2512, 13043, 2977, 1705, 7009, -1001, 7339, 13366,
+        19885, 14977, 12559, 19574, 17818, 6045, -6511, 2397, 1111, -4051, 2964, 1208,
+        14321, 5032, 11551, 6643, 4225, 11240, 9484, 20274, 6820, 12012, -871, 7755,
+        11701, 12522, 696, -8593, -2074, -3151, -19947, -2385, -4141, 11054, 1765, 8284,
+        -9, 4292, 6819, 3085, 12999, -2139, 8392, -1674, -2946, -1246, -6373, 6926,
+        12953, 19472, 14564, 12146, 19161, 17405, 5632, -6924, 1984, 698, -4464, 2551,
+        795, 13908, 4619, 11138, 6230, 3812, 10827, 9071, 16182, 2728, 7920, -5623,
+        3663, 7609, 8430, 283, -9006, -2487, -3564, -20360, -2798, -4554, 11108, 1819,
+        8338, 45, 4346, 8027, 3139, 10539, -2511, 8020, -2046, -3318, 1986, -6024,
+        7099, 13126, 19645, 14737, 12319, 19334, 17578, 5805, -6751, 2157, 871, -4291,
+        2724, 968, 14081, 4792, 11311, 6403, 3985, 11000, 9244, 17370, 3916, 9108,
+        -1786, 4851, 8797, 9618, 456, -8833, -2314, -3391, -20187, -2625, -4381, 10814,
+        1525, 8044, -249, 4052, 7733, 2845, 11457, -1593, 8938, -1128, -2400, 2904,
+        -5106, 12055, 18082, 24601, 19693, 17275, 24290, 22534, 10761, -1795, 7113, 5827,
+        665, 7680, 5924, 20035, 10746, 17265, 12357, 9939, 16954, 15198, 22326, 8872,
+        14064, 3170, 9807, 13753, 14574, 5412, -3877, 2642, 1565, -15231, 2331, 575,
+        15770, 6481, 13000, 4707, 9008, 12689, 7801, 16413, 3363, 13894, 3828, 2556,
+        7860, -150, 6689, 12716, 19235, 14327, 11909, 18924, 17168, 5395, -7161, 1747,
+        461, -4701, 2314, 558, 13671, 4382, 10901, 5993, 3575, 10590, 8834, 19017,
+        5563, 10755, -2320, 6498, 10444, 10658, 46, -9243, -2724, -3801, -20597, -3035,
+        -4791, 10404, 1115, 7634, -659, 3642, 7323, 2435, 10931, -2119, 8412, -3619,
+        -2926, 2378, -5632, 6280, 12307, 18826, 13918, 11500, 18515, 16759, 4986, -7570,
+        1338, 52, -5110, 1905, 149, 13262, 3973, 10492, 5584, 3166, 10181, 8425,
+        16970, 3516, 8708, -2186, 4451, 8397, 9218, -363, -9652, -3133, -4210, -21006,
+        -3444, -4497, 9995, 706, 7225, -1068, 3233, 6914, 2026, 11044, -2006, 8525,
+        -1541, -2813, 2491, -5519, 10267, 16294, 22813, 17905, 15487, 22502, 20746, 8973,
+        -3583, 5325, 4039, -1123, 5892, 4136, 17249, 7960, 14479, 9571, 7153, 14168,
+        12412, 20538, 7084, 12276, 1382, 8019, 11965, 12786, 3624, -5665, 854, -223,
+        -17019, 543, -1213, 22317, 13028, 19547, 11254, 15555, 19236, 14348, 15562, 2512,
+        13043, 2977, 1705, 7009, -1001, 7339, 13366, 19885, 14977, 12559, 19574, 17818,
+        6045, -6511, 2397, 1111, -4051, 2964, 1208, 14321, 5032, 11551, 6643, 4225,
+        11240, 9484, 21443, 7989, 13181, 298, 8924, 12870, 13691, 696, -8593, -2074,
+        -3151, -19947, -2385, -4141, 11054, 1765, 8284, -9, 4292, 6819, 3085, 12999,
+        -2139, 8392, -1674, -2946, -1246, -6373, 7019, 13046, 19565, 14657, 12239, 19254,
+        17498, 5725, -6831, 2077, 791, -4371, 2644, 888, 14001, 4712, 11231, 6323,
+        3905, 10920, 9164, 17290, 3836, 9028, -4515, 4771, 8717, 9538, 376, -8913,
+        -2394, -3471, -20267, -2705, -4461, 10734, 1445, 7964, -329, 3972, 7653, 2765,
+        10774, -2276, 8255, -1811, -3083, 2221, -5789, 7192, 13219, 19738, 14830, 12412,
+        19427, 17671, 5898, -6658, 2250, 964, -4198, 2817, 1061, 14174, 4885, 11404,
+        6496, 4078, 11093, 9337, 17463, 4009, 9201, -1693, 4944, 8890, 9711, 549,
+        -8740, -2221, -3298, -20094, -2532, -4288, 10907, 1618, 8137, -156, 4145, 7826,
+        2938, 11550, -1500, 9031, -1035, -2307, 2997, -5013, 12148, 18175, 24694, 19786,
+        17368, 24383, 22627, 10854, -1702, 7206, 5920, 758, 7773, 6017, 20128, 10839,
+        17358, 12450, 10032, 17047, 15291, 22419, 8965, 14157, 3263, 9900, 13846, 14667,
+        5505, -3784, 2735, 1658, -15138, 2424, 668, 15863, 6574, 13093, 4800, 9101,
+        12782, 7894, 16506, 3456, 13987, 3921, 2649, 7953, -57, 6782, 12809, 19328,
+        14420, 12002, 19017, 17261, 5488, -7068, 1840, 554, -4608, 2407, 651, 13764,
+        4475, 10994, 6086, 3668, 10683, 8927, 19215, 5761, 10953, -2122, 6696, 10642,
+        10856, 139, -9150, -2631, -3708, -20504, -2942, -4698, 10497, 1208, 7727, -566,
+        3735, 7416, 2528, 11140, -1910, 8621, -3410, -2717, 2587, -5423, 6373, 12400,
+        18919, 14011, 11593, 18608, 16852, 5079, -7477, 1431, 145, -5017, 1998, 242,
+        13355, 4066, 10585, 5677, 3259, 10274, 8518, 17063, 3609, 8801, -2093, 4544,
+        8490, 9311, -270, -9559, -3040, -4117, -20913, -3351, -4404, 10088, 799, 7318,
+        -975, 3326, 7007, 2119, 11137, -1913, 8618, -1448, -2720, 2584, -5426, 10360,
+        16387, 22906, 17998, 15580, 22595, 20839, 9066, -3490, 5418, 4132, -1030, 5985,
+        4229, 17342, 8053, 14572, 9664, 7246, 14261, 12505, 20631, 7177, 12369, 1475,
+        8112, 12058, 12879, 3717, -5572, 947, -130, -16926, 636, -1120, 22410, 13121,
+        19640, 11347, 15648, 19329, 14441, 15655, 2605, 13136, 3070, 1798, 7102, -908,
+        7432, 13459, 19978, 15070, 12652, 19667, 17911, 6138, -6418, 2490, 1204, -3958,
+        3057, 1301, 14414, 5125, 11644, 6736, 4318, 11333, 9577, 20367, 6913, 12105,
+        -778, 7848, 11794, 12615, 789, -8500, -1981, -3058, -19854, -2292, -4048, 11147,
+        1858, 8377, 84, 4385, 6912, 3178, 13092, -2046, 8485, -1581, -2853, -1153,
+        -6280, 7571, 13598, 20117, 15209, 12791, 19806, 18050, 6277, -6279, 2629, 1343,
+        -3819, 3196, 1440, 14553, 5264, 11783, 6875, 4457, 11472, 9716, 17842, 4388,
+        9580, -3963, 5323, 9269, 10090, 928, -8361, -1842, -2919, -19715, -2153, -3909,
+        11286, 1997, 8516, 223, 4524, 8205, 3317, 11326, -1724, 8807, -1259, -2531,
+        2773, -5237, 7744, 13771, 20290, 15382, 12964, 19979, 18223, 6450, -6106, 2802,
+        1516, -3646, 3369, 1613, 14726, 5437, 11956, 7048, 4630, 11645, 9889, 18015,
+        4561, 9753, -1141, 5496, 9442, 10263, 1101, -8188, -1669, -2746, -19542, -1980,
+        -3736, 11459, 2170, 8689, 396, 4697, 8378, 3490, 12102, -948, 9583, -483,
+        -1755, 3549, -4461, 12700, 18727, 25246, 20338, 17920, 24935, 23179, 11406, -1150,
+        7758, 6472, 1310, 8325, 6569, 20680, 11391, 17910, 13002, 10584, 17599, 15843,
+        22971, 9517, 14709, 3815, 10452, 14398, 15219, 6057, -3232, 3287, 2210, -14586,
+        2976, 1220, 16415, 7126, 13645, 5352, 9653, 13334, 8446, 17058, 4008, 14539,
+        4473, 3201, 8505, 495, 7334, 13361, 19880, 14972, 12554, 19569, 17813, 6040,
+        -6516, 2392, 1106, -4056, 2959, 1203, 14316, 5027, 11546, 6638, 4220, 11235,
+        9479, 19767, 6313, 11505, -1570, 7248, 11194, 11408, 691, -8598, -2079, -3156,
+        -19952, -2390, -4146, 11049, 1760, 8279, -14, 4287, 7968, 3080, 11692, -1358,
+        9173, -2858, -2165, 3139, -4871, 6925, 12952, 19471, 14563, 12145, 19160, 17404,
+        5631, -6925, 1983, 697, -4465, 2550, 794, 13907, 4618, 11137, 6229, 3811,
+        10826, 9070, 17615, 4161, 9353, -1541, 5096, 9042, 9863, 282, -9007, -2488,
+        -3565, -20361, -2799, -3852, 10640, 1351, 7870, -423, 3878, 7559, 2671, 11689,
+        -1361, 9170, -896, -2168, 3136, -4874, 10912, 16939, 23458, 18550, 16132, 23147,
+        21391, 9618, -2938, 5970, 4684, -478, 6537, 4781, 17894, 8605, 15124, 10216,
+        7798, 14813, 13057, 21183, 7729, 12921, 2027, 8664, 12610, 13431, 4269, -5020,
+        1499, 422, -16374, 1188, -568, 22962, 13673, 20192, 11899, 16200, 19881, 14993,
+        16394, 3344, 13875, 3809, 2537, 7841, -169, 7984, 14011, 20530, 15622, 13204,
+        20219, 18463, 6690, -5866, 3042, 1756, -3406, 3609, 1853, 14966, 5677, 12196,
+        7288, 4870, 11885, 10129, 20056, 6602, 11794, -1089, 7537, 11483, 12304, 1341,
+        -7948, -1429, -2506, -19302, -1740, -3496, 11235, 1946, 8465, 172, 4473, 7000,
+        3266, 13644, -1494, 9037, -1029, -2301, -601, -5728, 6926, 12953, 19472, 14564,
+        12146, 19161, 17405, 5632, -6924, 1984, 698, -4464, 2551, 795, 13908, 4619,
+        11138, 6230, 3812, 10827, 9071, 17197, 3743, 8935, -4608, 4678, 8624, 9445,
+        283, -9006, -2487, -3564, -20360, -2798, -4554, 10310, 1021, 7540, -753, 3548,
+        7229, 2341, 10291, -2759, 7772, -2294, -3566, 1738, -6272, 7099, 13126, 19645,
+        14737, 12319, 19334, 17578, 5805, -6751, 2157, 871, -4291, 2724, 968, 14081,
+        4792, 11311, 6403, 3985, 11000, 9244, 17370, 3916, 9108, -1786, 4851, 8797,
+        9618, 456, -8833, -2314, -3391, -20187, -2625, -4381, 10814, 1525, 8044, -249,
+        4052, 7733, 2845, 11457, -1593, 8938, -1128, -2400, 2904, -5106, 12055, 18082,
+        24601, 19693, 17275, 24290, 22534, 10761, -1795, 7113, 5827, 665, 7680, 5924,
+        20035, 10746, 17265, 12357, 9939, 16954, 15198, 22326, 8872, 14064, 3170, 9807,
+        13753, 14574, 5412, -3877, 2642, 1565, -15231, 2331, 575, 15770, 6481, 13000,
+        4707, 9008, 12689, 7801, 16413, 3363, 13894, 3828, 2556, 7860, -150, 6689,
+        12716, 19235, 14327, 11909, 18924, 17168, 5395, -7161, 1747, 461, -4701, 2314,
+        558, 13671, 4382, 10901, 5993, 3575, 10590, 8834, 19616, 6162, 11354, -1721,
+        7097, 11043, 11257, 46, -9243, -2724, -3801, -20597, -3035, -4791, 10404, 1115,
+        7634, -659, 3642, 7323, 2435, 11269, -1781, 8750, -3281, -2588, 2716, -5294,
+        6280, 12307, 18826, 13918, 11500, 18515, 16759, 4986, -7570, 1338, 52, -5110,
+        1905, 149, 13262, 3973, 10492, 5584, 3166, 10181, 8425, 16970, 3516, 8708,
+        -2186, 4451, 8397, 9218, -363, -9652, -3133, -4210, -21006, -3444, -4497, 9995,
+        706, 7225, -1068, 3233, 6914, 2026, 11044, -2006, 8525, -1541, -2813, 2491,
+        -5519, 10267, 16294, 22813, 17905, 15487, 22502, 20746, 8973, -3583, 5325, 4039,
+        -1123, 5892, 4136, 17249, 7960, 14479, 9571, 7153, 14168, 12412, 20538, 7084,
+        12276, 1382, 8019, 11965, 12786, 3624, -5665, 854, -223, -17019, 543, -1213,
+        22317, 13028, 19547, 11254, 15555, 19236, 14348, 15562, 2512, 13043, 2977, 1705,
+        7009, -1001, 7339, 13366, 19885, 14977, 12559, 19574, 17818, 6045, -6511, 2397,
+        1111, -4051, 2964, 1208, 14321, 5032, 11551, 6643, 4225, 11240, 9484, 20274,
+        6820, 12012, -871, 7755, 11701, 12522, 696, -8593, -2074, -3151, -19947, -2385,
+        -4141, 10561, 1272, 7791, -502, 3799, 6326, 2592, 14506, -632, 9899, -167,
+        -1439, 261, -4866, 7767, 1398, 7917, 3009, 591, 7606, 5850, 6352, -6204,
+        2704, 1418, -3744, 3271, 1515, 7722, -1567, 4952, 44, -2374, 4641, 2885,
+        13693, 239, 5431, -3458, -174, 5120, 2333, 7722, -1567, 4952, 3875, -11115,
+        4641, 2885, 7722, -1567, 4952, 44, 960, 4641, -247, 10105, -2945, 7586,
+        -1334, -3752, 1371, -3702, 4975, -1394, 5125, 217, -2201, 4814, 3058, 6525,
+        -6031, 2877, 1591, -3571, 3444, 1688, 7895, -1394, 5125, 217, -2201, 4814,
+        3058, 15698, 2244, 7436, 1196, 1831, 7125, 4338, 7895, -1394, 5125, 4048,
+        -10942, 4814, 3058, 7895, -1394, 5125, 217, 1133, 4814, -74, 11656, -1394,
+        9137, 217, -2201, 2922, -2151, 9931, 3562, 10081, 5173, 2755, 9770, 8014,
+        11481, -1075, 7833, 6547, 1385, 8400, 6644, 12851, 3562, 10081, 5173, 2755,
+        9770, 8014, 20654, 7200, 12392, 6152, 6787, 12081, 9294, 12851, 3562, 10081,
+        9004, -5986, 9770, 8014, 12851, 3562, 10081, 5173, 6089, 9770, 4882, 16612,
+        3562, 14093, 5173, 2755, 7878, 2805, 4565, -1804, 4715, -193, -2611, 4404,
+        2648, 6115, -6441, 2467, 1181, -3981, 3034, 1278, 7485, -1804, 4715, -193,
+        -2611, 4404, 2648, 17749, 4295, 9487, 3247, 3882, 9176, 6389, 7485, -1804,
+        4715, 3638, -11352, 4404, 2648, 7485, -1804, 4715, -193, 723, 4404, -484,
+        10950, -2100, 8431, -2454, -2907, 2216, -2857, 5915, -454, 6065, 1157, -1261,
+        5754, 3998, 9316, -3240, 5668, 4382, -780, 6235, 4479, 8835, -454, 6065,
+        1157, -1261, 5754, 3998, 16638, 3184, 8376, 2136, 2771, 8065, 5278, 9739,
+        450, 6969, 5892, -9098, 6658, 5605, 8835, -454, 6065, 1157, 2073, 5754,
+        866, 11982, -1068, 9463, 543, -1875, 3248, -1825, 8143, 1774, 8293, 3385,
+        967, 7982, 6226, 9693, -2863, 6045, 4759, -403, 6612, 4856, 11063, 1774,
+        8293, 3385, 967, 7982, 6226, 18866, 5412, 10604, 4364, 4999, 10293, 7506,
+        11063, 1774, 8293, 7216, -7774, 7982, 6226, 11063, 1774, 8293, 3385, 4301,
+        7982, 3094, 14824, 1774, 12305, 3385, 967, 6090, 1017, 5215, -1154, 5365,
+        457, -1961, 5054, 3298, 6765, -5791, 3117, 1831, -3331, 3684, 1928, 8135,
+        -1154, 5365, 457, -1961, 5054, 3298, 16389, 2935, 8127, 864, 2522, 7816,
+        5029, 8135, -1154, 5365, 4288, -10702, 5054, 3298, 8135, -1154, 5365, 457,
+        1373, 3900, 166, 13990, -1148, 9383, 463, -1955, 3168, -1905, 8756, 2387,
+        8906, 3998, 1580, 8595, 6839, 7341, -5215, 3693, 2407, -2755, 4260, 2504,
+        8711, -578, 5941, 1033, -1385, 5630, 3874, 16514, 3060, 8252, -637, 2647,
+        7941, 5154, 8711, -578, 5941, 4864, -10126, 5630, 3874, 8711, -578, 5941,
+        1033, 1949, 5630, 742, 11094, -1956, 8575, -345, -2763, 2360, -2713, 5964,
+        -405, 6114, 1206, -1212, 5803, 4047, 8607, -3949, 4959, 3673, -1489, 5526,
+        3770, 8884, -405, 6114, 1206, -1212, 5803, 4047, 16687, 3233, 8425, 2185,
+        2820, 8114, 5327, 8884, -405, 6114, 5037, -9953, 5803, 4047, 8884, -405,
+        6114, 1206, 2122, 5803, 915, 12645, -405, 10126, 1206, -1212, 3911, -1162,
+        10920, 4551, 11070, 6162, 3744, 10759, 9003, 12470, -86, 8822, 7536, 2374,
+        9389, 7633, 13840, 4551, 11070, 6162, 3744, 10759, 9003, 21643, 8189, 13381,
+        7141, 7776, 13070, 10283, 13840, 4551, 11070, 9993, -4997, 10759, 9003, 13840,
+        4551, 11070, 6162, 7078, 10759, 5871, 17601, 4551, 15082, 6162, 3744, 8867,
+        3794, 5554, -815, 5704, 796, -1622, 5393, 3637, 7104, -5452, 3456, 2170,
+        -2992, 4023, 2267, 8474, -815, 5704, 796, -1622, 5393, 3637, 18738, 5284,
+        10476, 4236, 4871, 10165, 7378, 8474, -815, 5704, 4627, -10363, 5393, 3637,
+        8474, -815, 5704, 796, 1712, 5393, 505, 11939, -1111, 9420, -1465, -1918,
+        3205, -1868, 6904, 535, 7054, 2146, -272, 6743, 4987, 10305, -2251, 6657,
+        5371, 209, 7224, 5468, 9824, 535, 7054, 2146, -272, 6743, 4987, 17627,
+        4173, 9365, 3125, 3760, 9054, 6267, 11210, 1921, 8440, 7363, -7627, 8129,
+        7076, 9824, 535, 7054, 2146, 3062, 6743, 1855, 12971, -79, 10452, 1532,
+        -886, 4237, -836, 9132, 2763, 9282, 4374, 1956, 8971, 7215, 10682, -1874,
+        7034, 5748, 586, 7601, 5845, 12052, 2763, 9282, 4374, 1956, 8971, 7215,
+        19855, 6401, 11593, 5353, 5988, 11282, 8495, 12052, 2763, 9282, 8205, -6785,
+        8971, 7215, 12052, 2763, 9282, 4374, 5290, 8971, 4083, 15813, 2763, 13294,
+        4374, 1956, 7079, 2006, 6204, -165, 6354, 1446, -972, 6043, 4287, 7754,
+        -4802, 4106, 2820, -2342, 4673, 2917, 9124, -165, 6354, 1446, -972, 6043,
+        4287, 17378, 3924, 9116, 1853, 3511, 8805, 6018, 9124, -165, 6354, 5277,
+        -9713, 6043, 4287, 9124, -165, 6354, 1446, 2362, 4889, 1155, 14979, -159,
+        10372, 1452, -966, 4157, -916, 8272, 1903, 8422, 3514, 1096, 8111, 6355,
+        6857, -5699, 3209, 1923, -3239, 3776, 2020, 8227, -1062, 5457, 549, -1869,
+        5146, 3390, 16030, 2576, 7768, -1121, 2163, 7457, 4670, 8227, -1062, 5457,
+        4380, -10610, 5146, 3390, 8227, -1062, 5457, 549, 1465, 5146, 258, 10610,
+        -2440, 8091, -829, -3247, 1876, -3197, 5480, -889, 5630, 722, -1696, 5319,
+        3563, 7030, -5526, 3382, 2096, -3066, 3949, 2193, 8400, -889, 5630, 722,
+        -1696, 5319, 3563, 16203, 2749, 7941, 1701, 2336, 7630, 4843, 8400, -889,
+        5630, 4553, -10437, 5319, 3563, 8400, -889, 5630, 722, 1638, 5319, 431,
+        12161, -889, 9642, 722, -1696, 3427, -1646, 10436, 4067, 10586, 5678, 3260,
+        10275, 8519, 11986, -570, 8338, 7052, 1890, 8905, 7149, 13356, 4067, 10586,
+        5678, 3260, 10275, 8519, 21159, 7705, 12897, 6657, 7292, 12586, 9799, 13356,
+        4067, 10586, 9509, -5481, 10275, 8519, 13356, 4067, 10586, 5678, 6594, 10275,
+        5387, 17117, 4067, 14598, 5678, 3260, 8383, 3310, 5070, -1299, 5220, 312,
+        -2106, 4909, 3153, 6620, -5936, 2972, 1686, -3476, 3539, 1783, 7990, -1299,
+        5220, 312, -2106, 4909, 3153, 18254, 4800, 9992, 3752, 4387, 9681, 6894,
+        7990, -1299, 5220, 4143, -10847, 4909, 3153, 7990, -1299, 5220, 312, 1228,
+        4909, 21, 11455, -1595, 8936, -1949, -2402, 2721, -2352, 6420, 51, 6570,
+        1662, -756, 6259, 4503, 9821, -2735, 6173, 4887, -275, 6740, 4984, 9340,
+        51, 6570, 1662, -756, 6259, 4503, 17143, 3689, 8881, 2641, 3276, 8570,
+        5783, 10244, 955, 7474, 6397, -8593, 7163, 6110, 9340, 51, 6570, 1662,
+        2578, 6259, 1371, 12487, -563, 9968, 1048, -1370, 3753, -1320, 8648, 2279,
+        8798, 3890, 1472, 8487, 6731, 10198, -2358, 6550, 5264, 102, 7117, 5361,
+        11568, 2279, 8798, 3890, 1472, 8487, 6731, 19371, 5917, 11109, 4869, 5504,
+        10798, 8011, 11568, 2279, 8798, 7721, -7269, 8487, 6731, 11568, 2279, 8798,
+        3890, 4806, 8487, 3599, 15329, 2279, 12810, 3890, 1472, 6595, 1522, 5720,
+        -649, 5870, 962, -1456, 5559, 3803, 7270, -5286, 3622, 2336, -2826, 4189,
+        2433, 8640, -649, 5870, 962, -1456, 5559, 3803, 16894, 3440, 8632, 1369,
+        3027, 8321, 5534, 8640, -649, 5870, 4793, -10197, 5559, 3803, 8640, -649,
+        5870, 962, 1878, 4405, 671, 14495, -643, 9888, 968, -1450, 3673, -1400,
+        8272, 1903, 8422, 3514, 1096, 8111, 6355, 6857, -5699, 3209, 1923, -3239,
+        3776, 2020, 8227, -1062, 5457, 549, -1869, 5146, 3390, 15015, 1561, 6753,
+        -2136, 1148, 6442, 3655, 8227, -1062, 5457, 4380, -10610, 5146, 3390, 8694,
+        -595, 5924, 1016, 1932, 5613, 725, 10468, -2582, 7949, -971, -3389, 1734,
+        -3339, 5480, -889, 5630, 722, -1696, 5319, 3563, 7030, -5526, 3382, 2096,
+        -3066, 3949, 2193, 8400, -889, 5630, 722, -1696, 5319, 3563, 16203, 2749,
+        7941, 1701, 2336, 7630, 4843, 8400, -889, 5630, 4553, -10437, 5319, 3563,
+        8400, -889, 5630, 722, 1638, 5319, 431, 12161, -889, 9642, 722, -1696,
+        3427, -1646, 10436, 4067, 10586, 5678, 3260, 10275, 8519, 11986, -570, 8338,
+        7052, 1890, 8905, 7149, 13356, 4067, 10586, 5678, 3260, 10275, 8519, 21159,
+        7705, 12897, 6657, 7292, 12586, 9799, 13356, 4067, 10586, 9509, -5481, 10275,
+        8519, 13356, 4067, 10586, 5678, 6594, 10275, 5387, 17117, 4067, 14598, 5678,
+        3260, 8383, 3310, 5070, -1299, 5220, 312, -2106, 4909, 3153, 6620, -5936,
+        2972, 1686, -3476, 3539, 1783, 7990, -1299, 5220, 312, -2106, 4909, 3153,
+        18254, 4800, 9992, 3752, 4387, 9681, 6894, 7990, -1299, 5220, 4143, -10847,
+        4909, 3153, 7990, -1299, 5220, 312, 1228, 4909, 21, 11387, -1663, 8868,
+        -2017, -2470, 2653, -2420, 6420, 51, 6570, 1662, -756, 6259, 4503, 9821,
+        -2735, 6173, 4887, -275, 6740, 4984, 9340, 51, 6570, 1662, -756, 6259,
+        4503, 17143, 3689, 8881, 2641, 3276, 8570, 5783, 10244, 955, 7474, 6397,
+        -8593, 7163, 6110, 9340, 51, 6570, 1662, 2578, 6259, 1371, 12487, -563,
+        9968, 1048, -1370, 3753, -1320, 8648, 2279, 8798, 3890, 1472, 8487, 6731,
+        10198, -2358, 6550, 5264, 102, 7117, 5361, 11568, 2279, 8798, 3890, 1472,
+        8487, 6731, 19371, 5917, 11109, 4869, 5504, 10798, 8011, 11568, 2279, 8798,
+        7721, -7269, 8487, 6731, 11568, 2279, 8798, 3890, 4806, 8487, 3599, 15329,
+        2279, 12810, 3890, 1472, 6595, 1522, 5720, -649, 5870, 962, -1456, 5559,
+        3803, 7270, -5286, 3622, 2336, -2826, 4189, 2433, 8640, -649, 5870, 962,
+        -1456, 5559, 3803, 18263, 4809, 10001, 2738, 4396, 9690, 6903, 8640, -649,
+        5870, 4793, -10197, 5559, 3803, 8640, -649, 5870, 962, 1878, 4405, 671,
+        14495, -643, 9888, 968, -1450, 3673, -1400, 8365, 1996, 8515, 3607, 1189,
+        8204, 6448, 6950, -5606, 3302, 2016, -3146, 3869, 2113, 8320, -969, 5550,
+        642, -1776, 5239, 3483, 16123, 2669, 7861, -1028, 2256, 7550, 4763, 8320,
+        -969, 5550, 4473, -10517, 5239, 3483, 8320, -969, 5550, 642, 1558, 5239,
+        351, 10703, -2347, 8184, -736, -3154, 1969, -3104, 5573, -796, 5723, 815,
+        -1603, 5412, 3656, 7123, -5433, 3475, 2189, -2973, 4042, 2286, 8493, -796,
+        5723, 815, -1603, 5412, 3656, 16296, 2842, 8034, 1794, 2429, 7723, 4936,
+        8493, -796, 5723, 4646, -10344, 5412, 3656, 8493, -796, 5723, 815, 1731,
+        5412, 524, 12254, -796, 9735, 815, -1603, 3520, -1553, 10529, 4160, 10679,
+        5771, 3353, 10368, 8612, 12079, -477, 8431, 7145, 1983, 8998, 7242, 13449,
+        4160, 10679, 5771, 3353, 10368, 8612, 21252, 7798, 12990, 6750, 7385, 12679,
+        9892, 13449, 4160, 10679, 9602, -5388, 10368, 8612, 13449, 4160, 10679, 5771,
+        6687, 10368, 5480, 17210, 4160, 14691, 5771, 3353, 8476, 3403, 5163, -1206,
+        5313, 405, -2013, 5002, 3246, 6713, -5843, 3065, 1779, -3383, 3632, 1876,
+        8083, -1206, 5313, 405, -2013, 5002, 3246, 18347, 4893, 10085, 3845, 4480,
+        9774, 6987, 8083, -1206, 5313, 4236, -10754, 5002, 3246, 8083, -1206, 5313,
+        405, 1321, 5002, 114, 11548, -1502, 9029, -1856, -2309, 2814, -2259, 6513,
+        144, 6663, 1755, -663, 6352, 4596, 9914, -2642, 6266, 4980, -182, 6833,
+        5077, 9433, 144, 6663, 1755, -663, 6352, 4596, 17236, 3782, 8974, 2734,
+        3369, 8663, 5876, 10337, 1048, 7567, 6490, -8500, 7256, 6203, 9433, 144,
+        6663, 1755, 2671, 6352, 1464, 12580, -470, 10061, 1141, -1277, 3846, -1227,
+        8741, 2372, 8891, 3983, 1565, 8580, 6824, 10291, -2265, 6643, 5357, 195,
+        7210, 5454, 11661, 2372, 8891, 3983, 1565, 8580, 6824, 19464, 6010, 11202,
+        4962, 5597, 10891, 8104, 11661, 2372, 8891, 7814, -7176, 8580, 6824, 11661,
+        2372, 8891, 3983, 4899, 8580, 3692, 15422, 2372, 12903, 3983, 1565, 6688,
+        1615, 5813, -556, 5963, 1055, -1363, 5652, 3896, 7363, -5193, 3715, 2429,
+        -2733, 4282, 2526, 8733, -556, 5963, 1055, -1363, 5652, 3896, 16987, 3533,
+        8725, 1462, 3120, 8414, 5627, 8733, -556, 5963, 4886, -10104, 5652, 3896,
+        8733, -556, 5963, 1055, 1971, 4498, 764, 14588, -550, 9981, 1061, -1357,
+        3766, -1307, 8917, 2548, 9067, 4159, 1741, 8756, 7000, 7502, -5054, 3854,
+        2568, -2594, 4421, 2665, 8872, -417, 6102, 1194, -1224, 5791, 4035, 16675,
+        3221, 8413, -476, 2808, 8102, 5315, 8872, -417, 6102, 5025, -9965, 5791,
+        4035, 8872, -417, 6102, 1194, 2110, 5791, 903, 11255, -1795, 8736, -184,
+        -2602, 2521, -2552, 6125, -244, 6275, 1367, -1051, 5964, 4208, 7675, -4881,
+        4027, 2741, -2421, 4594, 2838, 9045, -244, 6275, 1367, -1051, 5964, 4208,
+        16848, 3394, 8586, 2346, 2981, 8275, 5488, 9045, -244, 6275, 5198, -9792,
+        5964, 4208, 9045, -244, 6275, 1367, 2283, 5964, 1076, 12806, -244, 10287,
+        1367, -1051, 4072, -1001, 11081, 4712, 11231, 6323, 3905, 10920, 9164, 12631,
+        75, 8983, 7697, 2535, 9550, 7794, 14001, 4712, 11231, 6323, 3905, 10920,
+        9164, 21804, 8350, 13542, 7302, 7937, 13231, 10444, 14001, 4712, 11231, 10154,
+        -4836, 10920, 9164, 14001, 4712, 11231, 6323, 7239, 10920, 6032, 17762, 4712,
+        15243, 6323, 3905, 9028, 3955, 5715, -654, 5865, 957, -1461, 5554, 3798,
+        7265, -5291, 3617, 2331, -2831, 4184, 2428, 8635, -654, 5865, 957, -1461,
+        5554, 3798, 18899, 5445, 10637, 4397, 5032, 10326, 7539, 8635, -654, 5865,
+        4788, -10202, 5554, 3798, 8635, -654, 5865, 957, 1873, 5554, 666, 12100,
+        -950, 9581, -1304, -1757, 3366, -1707, 7065, 696, 7215, 2307, -111, 6904,
+        5148, 10466, -2090, 6818, 5532, 370, 7385, 5629, 9985, 696, 7215, 2307,
+        -111, 6904, 5148, 17788, 4334, 9526, 3286, 3921, 9215, 6428, 10889, 1600,
+        8119, 7042, -7948, 7808, 6755, 9985, 696, 7215, 2307, 3223, 6904, 2016,
+        13132, 82, 10613, 1693, -725, 4398, -675, 9293, 2924, 9443, 4535, 2117,
+        9132, 7376, 10843, -1713, 7195, 5909, 747, 7762, 6006, 12213, 2924, 9443,
+        4535, 2117, 9132, 7376, 20016, 6562, 11754, 5514, 6149, 11443, 8656, 12213,
+        2924, 9443, 8366, -6624, 9132, 7376, 12213, 2924, 9443, 4535, 5451, 9132,
+        4244, 16161, 3111, 13642, 4722, 2304, 7427, 2354, 6365, -4, 6515, 1607,
+        -811, 6204, 4448, 7915, -4641, 4267, 2981, -2181, 4834, 3078, 9285, -4,
+        6515, 1607, -811, 6204, 4448, 17539, 4085, 9277, 2014, 3672, 8966, 6179,
+        9285, -4, 6515, 5438, -9552, 6204, 4448, 9285, -4, 6515, 1607, 2523,
+        5050, 1316, 15140, 2, 10533, 1613, -805, 4318, -755, 8272, 1903, 8422,
+        3514, 1096, 8111, 6355, 6857, -5699, 3209, 1923, -3239, 3776, 2020, 8227,
+        -1062, 5457, 549, -1869, 5146, 3390, 16030, 2576, 7768, -1121, 2163, 7457,
+        4670, 8227, -1062, 5457, 4380, -10610, 5146, 3390, 7896, -1393, 5126, 218,
+        1134, 4815, -73, 10220, -2830, 7701, -1219, -3637, 1486, -3587, 5480, -889,
+        5630, 722, -1696, 5319, 3563, 7030, -5526, 3382, 2096, -3066, 3949, 2193,
+        8400, -889, 5630, 722, -1696, 5319, 3563, 16203, 2749, 7941, 1701, 2336,
+        7630, 4843, 8400, -889, 5630, 4553, -10437, 5319, 3563, 8400, -889, 5630,
+        722, 1638, 5319, 431, 12161, -889, 9642, 722, -1696, 3427, -1646, 10436,
+        4067, 10586, 5678, 3260, 10275, 8519, 11986, -570, 8338, 7052, 1890, 8905,
+        7149, 13356, 4067, 10586, 5678, 3260, 10275, 8519, 21159, 7705, 12897, 6657,
+        7292, 12586, 9799, 13356, 4067, 10586, 9509, -5481, 10275, 8519, 13356, 4067,
+        10586, 5678, 6594, 10275, 5387, 17117, 4067, 14598, 5678, 3260, 8383, 3310,
+        5070, -1299, 5220, 312, -2106, 4909, 3153, 6620, -5936, 2972, 1686, -3476,
+        3539, 1783, 7990, -1299, 5220, 312, -2106, 4909, 3153, 19252, 5798, 10990,
+        4750, 5385, 10679, 7892, 7990, -1299, 5220, 4143, -10847, 4909, 3153, 7990,
+        -1299, 5220, 312, 1228, 4909, 21, 11704, -1346, 9185, -1700, -2153, 2970,
+        -2103, 6420, 51, 6570, 1662, -756, 6259, 4503, 9821, -2735, 6173, 4887,
+        -275, 6740, 4984, 9340, 51, 6570, 1662, -756, 6259, 4503, 17143, 3689,
+        8881, 2641, 3276, 8570, 5783, 10244, 955, 7474, 6397, -8593, 7163, 6110,
+        9340, 51, 6570, 1662, 2578, 6259, 1371, 12487, -563, 9968, 1048, -1370,
+        3753, -1320, 8648, 2279, 8798, 3890, 1472, 8487, 6731, 10198, -2358, 6550,
+        5264, 102, 7117, 5361, 11568, 2279, 8798, 3890, 1472, 8487, 6731, 19371,
+        5917, 11109, 4869, 5504, 10798, 8011, 11568, 2279, 8798, 7721, -7269, 8487,
+        6731, 11568, 2279, 8798, 3890, 4806, 8487, 3599, 15329, 2279, 12810, 3890,
+        1472, 6595, 1522, 5720, -649, 5870, 962, -1456, 5559, 3803, 7270, -5286,
+        3622, 2336, -2826, 4189, 2433, 8640, -649, 5870, 962, -1456, 5559, 3803,
+        16894, 3440, 8632, 1369, 3027, 8321, 5534, 8640, -649, 5870, 4793, -10197,
+        5559, 3803, 9220, -69, 6450, 1542, 2458, 4985, 1251, 15805, 667, 11198,
+        2278, -140, 4983, -90, 17704, 11335, 17854, 12946, 10528, 17543, 15787, 4590,
+        -7966, 942, -344, -5506, 1509, 679, 2748, -6541, -995, -4930, -7348, -333,
+        -2089, 11104, -2350, 2842, -6047, -2763, 2531, -256, 5960, -3329, 3190, 2113,
+        -12877, 2879, 1123, 5960, -3329, 3190, -1718, -802, 2879, -2009, 8343, -4707,
+        5824, -3096, -7550, -391, -5198, 3213, -3156, 3363, -1545, -3963, 3052, 1296,
+        4763, -10556, 1115, -171, -5333, 1682, 852, 2921, -6368, -822, -4757, -7175,
+        -160, -1916, 13109, -345, 4847, -1393, -758, 4536, 1749, 6133, -3156, 3363,
+        2286, -12524, 3052, 1296, 6133, -3156, 3363, -1545, -629, 3052, -1836, 9894,
+        -3156, 7375, -1545, -5999, 1160, -3647, 8169, 1800, 8319, 3411, 993, 8008,
+        6252, 9719, -2837, 6071, 4785, -377, 6638, 5808, 7877, -1412, 4134, 199,
+        -2219, 4796, 3040, 18065, 4611, 9803, 3563, 4198, 9492, 6705, 11089, 1800,
+        8319, 7242, -7748, 8008, 6252, 11089, 1800, 8319, 3411, 4327, 8008, 3120,
+        14850, 1800, 12331, 3411, -1043, 6116, 1309, 2803, -3566, 2953, -1955, -4373,
+        2642, 886, 4353, -8203, 705, -581, -5743, 1272, 442, 2511, -6778, -1232,
+        -5167, -7585, -570, -2326, 14755, 1301, 6493, -3754, 888, 6182, 4021, 5723,
+        -3566, 2953, 1876, -13114, 2642, 886, 5723, -3566, 2953, -1955, -1039, 2642,
+        -2246, 9188, -3862, 6669, -4709, -6705, 454, -2418, 1911, -4458, 2061, -2847,
+        -5265, 1750, -6, 7554, -5002, 3906, 2620, -10698, 4473, 3643, 3861, -5428,
+        118, -3817, -6235, 780, -976, 13256, -198, 4994, -1246, -611, 4683, 1896,
+        7977, -1312, 5207, 4130, -10860, 4896, 3843, 7073, -2216, 4303, -605, 311,
+        3992, -896, 12018, -1032, 9499, 579, -3875, 3284, -1523, 6381, 12, 6531,
+        1623, -795, 6220, 4464, 7931, -4625, 4283, 2997, -2165, 4850, 4020, 6089,
+        -3200, 2346, -1589, -4007, 3008, 1252, 16277, 2823, 8015, 1775, 2410, 7704,
+        4917, 9301, 12, 6531, 5454, -9536, 6220, 4464, 9301, 12, 6531, 1623,
+        2539, 6220, 1332, 10660, -2390, 8141, -779, -5233, 1926, -2881, 3453, -2916,
+        3603, -1305, -3723, 3292, 1536, 5003, -7553, 1355, 69, -5093, 1922, 1092,
+        3161, -6128, -582, -4517, -6935, 80, -1676, 13800, 346, 5538, -1725, -67,
+        5227, 867, 6373, -2916, 3603, 2526, -12464, 3292, 1536, 6812, -2477, 4042,
+        -866, 50, 2577, -1157, 14992, -626, 9905, 3431, -3469, 3690, -1411, 18693,
+        12324, 18843, 13935, 11517, 18532, 16776, 5579, -6977, 1931, 645, -4517, 2498,
+        1668, 3737, -5552, -6, -3941, -6359, 656, -1100, 13925, 471, 5663, -3226,
+        58, 5352, 2565, 6949, -2340, 4179, 3102, -11888, 3868, 2112, 6949, -2340,
+        4179, -729, 187, 3868, -1020, 9332, -3718, 6813, -2107, -6561, 598, -4209,
+        4202, -2167, 4352, -556, -2974, 4041, 2285, 6845, -8474, 3197, 1911, -3251,
+        3764, 2934, 3910, -5379, 167, -3768, -6186, 829, -927, 14098, 644, 5836,
+        -404, 231, 5525, 2738, 7122, -2167, 4352, 3275, -11535, 4041, 2285, 7122,
+        -2167, 4352, -556, 360, 4041, -847, 10883, -2167, 8364, -556, -5010, 2149,
+        -2658, 9158, 2789, 9308, 4400, 1982, 8997, 7241, 10708, -1848, 7060, 5774,
+        612, 7627, 6797, 8866, -423, 5123, 1188, -1230, 5785, 4029, 19054, 5600,
+        10792, 4552, 5187, 10481, 7694, 12078, 2789, 9308, 8231, -6759, 8997, 7241,
+        12078, 2789, 9308, 4400, 5316, 8997, 4109, 15839, 2789, 13320, 4400, -54,
+        7105, 2298, 3792, -2577, 3942, -966, -3384, 3631, 1875, 5342, -7214, 1694,
+        408, -4754, 2261, 1431, 3500, -5789, -243, -4178, -6596, 419, -1337, 16429,
+        2975, 8167, -2080, 2562, 7856, 5695, 6712, -2577, 3942, 2865, -12125, 3631,
+        1875, 6712, -2577, 3942, -966, -50, 3631, -1257, 10177, -2873, 7658, -3720,
+        -5716, 1443, -1429, 2900, -3469, 3050, -1858, -4276, 2739, 983, 8543, -4013,
+        4895, 3609, -9709, 5462, 4632, 4850, -4439, 1107, -2828, -5246, 1769, 13,
+        14245, 791, 5983, -257, 378, 5672, 2885, 9448, 159, 6678, 5601, -9389,
+        6367, 5314, 8062, -1227, 5292, 384, 1300, 4981, 93, 13007, -43, 10488,
+        1568, -2886, 4273, -534, 7370, 1001, 7520, 2612, 194, 7209, 5453, 8920,
+        -3636, 5272, 3986, -1176, 5839, 5009, 7078, -2211, 3335, -600, -3018, 3997,
+        2241, 17266, 3812, 9004, 2764, 3399, 8693, 5906, 10290, 1001, 7520, 6443,
+        -8547, 7209, 5453, 10290, 1001, 7520, 2612, 3528, 7209, 2321, 11649, -1401,
+        9130, 210, -4244, 2915, -1892, 4442, -1927, 4592, -316, -2734, 4281, 2525,
+        5992, -6564, 2344, 1058, -4104, 2911, 2081, 4150, -5139, 407, -3528, -5946,
+        1069, -687, 14789, 1335, 6527, -736, 922, 6216, 1856, 7362, -1927, 4592,
+        3515, -11475, 4281, 2525, 7801, -1488, 5031, 123, 1039, 3566, -168, 15871,
+        253, 10784, 4310, -2590, 4569, -532, 18209, 11840, 18359, 13451, 11033, 18048,
+        16292, 5095, -7461, 1447, 161, -5001, 2014, 1184, 3253, -6036, -490, -4425,
+        -6843, 172, -1584, 13441, -13, 5179, -3710, -426, 4868, 2081, 6465, -2824,
+        3695, 2618, -12372, 3384, 1628, 6465, -2824, 3695, -1213, -297, 3384, -1504,
+        8848, -4202, 6329, -2591, -7045, 114, -4693, 3718, -2651, 3868, -1040, -3458,
+        3557, 1801, 5268, -10051, 1620, 334, -4828, 2187, 1357, 3426, -5863, -317,
+        -4252, -6670, 345, -1411, 13614, 160, 5352, -888, -253, 5041, 2254, 6638,
+        -2651, 3868, 2791, -12019, 3557, 1801, 6638, -2651, 3868, -1040, -124, 3557,
+        -1331, 10399, -2651, 7880, -1040, -5494, 1665, -3142, 8674, 2305, 8824, 3916,
+        1498, 8513, 6757, 10224, -2332, 6576, 5290, 128, 7143, 6313, 8382, -907,
+        4639, 704, -1714, 5301, 3545, 18570, 5116, 10308, 4068, 4703, 9997, 7210,
+        11594, 2305, 8824, 7747, -7243, 8513, 6757, 11594, 2305, 8824, 3916, 4832,
+        8513, 3625, 15355, 2305, 12836, 3916, -538, 6621, 1814, 3308, -3061, 3458,
+        -1450, -3868, 3147, 1391, 4858, -7698, 1210, -76, -5238, 1777, 947, 3016,
+        -6273, -727, -4662, -7080, -65, -1821, 15945, 2491, 7683, -2564, 2078, 7372,
+        5211, 6228, -3061, 3458, 2381, -12609, 3147, 1391, 6228, -3061, 3458, -1450,
+        -534, 3147, -1741, 9693, -3357, 7174, -4204, -6200, 959, -1913, 2416, -3953,
+        2566, -2342, -4760, 2255, 499, 8059, -4497, 4411, 3125, -10193, 4978, 4148,
+        4366, -4923, 623, -3312, -5730, 1285, -471, 13761, 307, 5499, -741, -106,
+        5188, 2401, 8482, -807, 5712, 4635, -10355, 5401, 4348, 7578, -1711, 4808,
+        -100, 816, 4497, -391, 12523, -527, 10004, 1084, -3370, 3789, -1018, 6886,
+        517, 7036, 2128, -290, 6725, 4969, 8436, -4120, 4788, 3502, -1660, 5355,
+        4525, 6594, -2695, 2851, -1084, -3502, 3513, 1757, 16782, 3328, 8520, 2280,
+        2915, 8209, 5422, 9806, 517, 7036, 5959, -9031, 6725, 4969, 9806, 517,
+        7036, 2128, 3044, 6725, 1837, 11165, -1885, 8646, -274, -4728, 2431, -2376,
+        3958, -2411, 4108, -800, -3218, 3797, 2041, 5508, -7048, 1860, 574, -4588,
+        2427, 1597, 3666, -5623, -77, -4012, -6430, 585, -1171, 14305, 851, 6043,
+        -1220, 438, 5732, 1372, 6878, -2411, 4108, 3031, -11959, 3797, 2041, 7317,
+        -1972, 4547, -361, 555, 3082, -652, 15387, -231, 10300, 3826, -3074, 4085,
+        -1016, 18209, 11840, 18359, 13451, 11033, 18048, 16292, 5095, -7461, 1447, 161,
+        -5001, 2014, 1184, 3253, -6036, -490, -4425, -6843, 172, -1584, 12426, -1028,
+        4164, -4725, -1441, 3853, 1066, 6465, -2824, 3695, 2618, -12372, 3384, 1628,
+        6932, -2357, 4162, -746, 170, 3851, -1037, 8706, -4344, 6187, -2733, -7187,
+        -28, -4835, 3718, -2651, 3868, -1040, -3458, 3557, 1801, 5268, -10051, 1620,
+        334, -4828, 2187, 1357, 3426, -5863, -317, -4252, -6670, 345, -1411, 13614,
+        160, 5352, -888, -253, 5041, 2254, 6638, -2651, 3868, 2791, -12019, 3557,
+        1801, 6638, -2651, 3868, -1040, -124, 3557, -1331, 10399, -2651, 7880, -1040,
+        -5494, 1665, -3142, 8674, 2305, 8824, 3916, 1498, 8513, 6757, 10224, -2332,
+        6576, 5290, 128, 7143, 6313, 8382, -907, 4639, 704, -1714, 5301, 3545,
+        18570, 5116, 10308, 4068, 4703, 9997, 7210, 11594, 2305, 8824, 7747, -7243,
+        8513, 6757, 11594, 2305, 8824, 3916, 4832, 8513, 3625, 15355, 2305, 12836,
+        3916, -538, 6621, 1814, 3308, -3061, 3458, -1450, -3868, 3147, 1391, 4858,
+        -7698, 1210, -76, -5238, 1777, 947, 3016, -6273, -727, -4662, -7080, -65,
+        -1821, 15945, 2491, 7683, -2564, 2078, 7372, 5211, 6228, -3061, 3458, 2381,
+        -12609, 3147, 1391, 6228, -3061, 3458, -1450, -534, 3147, -1741, 10969, -2081,
+        8450, -2928, -4924, 2235, -637, 2416, -3953, 2566, -2342, -4760, 2255, 499,
+        8059, -4497, 4411, 3125, -10193, 4978, 4148, 4366, -4923, 623, -3312, -5730,
+        1285, -471, 13761, 307, 5499, -741, -106, 5188, 2401, 8482, -807, 5712,
+        4635, -10355, 5401, 4348, 7578, -1711, 4808, -100, 816, 4497, -391, 12523,
+        -527, 10004, 1084, -3370, 3789, -1018, 6886, 517, 7036, 2128, -290, 6725,
+        4969, 8436, -4120, 4788, 3502, -1660, 5355, 4525, 6594, -2695, 2851, -1084,
+        -3502, 3513, 1757, 16782, 3328, 8520, 2280, 2915, 8209, 5422, 9806, 517,
+        7036, 5959, -9031, 6725, 4969, 9806, 517, 7036, 2128, 3044, 6725, 1837,
+        11165, -1885, 8646, -274, -4728, 2431, -2376, 3958, -2411, 4108, -800, -3218,
+        3797, 2041, 5508, -7048, 1860, 574, -4588, 2427, 1597, 3666, -5623, -77,
+        -4012, -6430, 585, -1171, 15674, 2220, 7412, 149, 1807, 7101, 2741, 6878,
+        -2411, 4108, 3031, -11959, 3797, 2041, 7317, -1972, 4547, -361, 555, 3082,
+        -652, 16010, 392, 10923, 4449, -2451, 4708, -393, 18302, 11933, 18452, 13544,
+        11126, 18141, 16385, 5188, -7368, 1540, 254, -4908, 2107, 1277, 3346, -5943,
+        -397, -4332, -6750, 265, -1491, 13534, 80, 5272, -3617, -333, 4961, 2174,
+        6558, -2731, 3788, 2711, -12279, 3477, 1721, 6558, -2731, 3788, -1120, -204,
+        3477, -1411, 8941, -4109, 6422, -2498, -6952, 207, -4600, 3811, -2558, 3961,
+        -947, -3365, 3650, 1894, 5361, -9958, 1713, 427, -4735, 2280, 1450, 3519,
+        -5770, -224, -4159, -6577, 438, -1318, 13707, 253, 5445, -795, -160, 5134,
+        2347, 9523, 234, 6753, 5676, -9134, 6442, 4686, 6731, -2558, 3961, -947,
+        -31, 3650, -1238, 10492, -2558, 7973, -947, -5401, 1758, -3049, 8767, 2398,
+        8917, 4009, 1591, 8606, 6850, 10317, -2239, 6669, 5383, 221, 7236, 6406,
+        8475, -814, 4732, 797, -1621, 5394, 3638, 18663, 5209, 10401, 4161, 4796,
+        10090, 7303, 11687, 2398, 8917, 7840, -7150, 8606, 6850, 11687, 2398, 8917,
+        4009, 4925, 8606, 3718, 15448, 2398, 12929, 4009, -445, 6714, 1907, 3401,
+        -2968, 3551, -1357, -3775, 3240, 1484, 4951, -7605, 1303, 17, -5145, 1870,
+        1040, 3109, -6180, -634, -4569, -6987, 28, -1728, 16038, 2584, 7776, -2471,
+        2171, 7465, 5304, 6321, -2968, 3551, 2474, -12516, 3240, 1484, 6321, -2968,
+        3551, -1357, -441, 3240, -1648, 9786, -3264, 7267, -4111, -6107, 1052, -1820,
+        2509, -3860, 2659, -2249, -4667, 2348, 592, 8831, -3725, 5183, 3897, -9421,
+        5750, 4920, 4459, -4830, 716, -3219, -5637, 1378, -378, 13854, 400, 5592,
+        -648, -13, 5281, 2494, 8575, -714, 5805, 4728, -10262, 5494, 4441, 7671,
+        -1618, 4901, -7, 909, 4590, -298, 12616, -434, 10097, 1177, -3277, 3882,
+        -925, 6979, 610, 7129, 2221, -197, 6818, 5062, 8529, -4027, 4881, 3595,
+        -1567, 5448, 4618, 6687, -2602, 2944, -991, -3409, 3606, 1850, 16875, 3421,
+        8613, 2373, 3008, 8302, 5515, 9899, 610, 7129, 6052, -8938, 6818, 5062,
+        9899, 610, 7129, 2221, 3137, 6818, 1930, 11258, -1792, 8739, -181, -4635,
+        2524, -2283, 4051, -2318, 4201, -707, -3125, 3890, 2134, 5601, -6955, 1953,
+        667, -4495, 2520, 1690, 3759, -5530, 16, -3919, -6337, 678, -1078, 14398,
+        944, 6136, -1127, 531, 5825, 1465, 6971, -2318, 4201, 3124, -11866, 3890,
+        2134, 7410, -1879, 4640, -268, 648, 3175, -559, 16067, 449, 10980, 4506,
+        -2394, 4765, -336, 18854, 12485, 19004, 14096, 11678, 18693, 16937, 5740, -6816,
+        2092, 806, -4356, 2659, 1829, 3898, -5391, 155, -3780, -6198, 817, -939,
+        14086, 632, 5824, -3065, 219, 5513, 2726, 7110, -2179, 4340, 3263, -11727,
+        4029, 2273, 7110, -2179, 4340, -568, 348, 4029, -859, 9493, -3557, 6974,
+        -1946, -6400, 759, -4048, 4363, -2006, 4513, -395, -2813, 4202, 2446, 5913,
+        -9406, 2265, 979, -4183, 2832, 2002, 4071, -5218, 328, -3607, -6025, 990,
+        -766, 14259, 805, 5997, -243, 392, 5686, 2899, 7283, -2006, 4513, 3436,
+        -11374, 4202, 2446, 7283, -2006, 4513, -395, 521, 4202, -686, 11044, -2006,
+        8525, -395, -4849, 2310, -2497, 9319, 2950, 9469, 4561, 2143, 9158, 7402,
+        10869, -1687, 7221, 5935, 773, 7788, 6958, 9027, -262, 5284, 1349, -1069,
+        5946, 4190, 19215, 5761, 10953, 4713, 5348, 10642, 7855, 12239, 2950, 9469,
+        8392, -6598, 9158, 7402, 12239, 2950, 9469, 4561, 5477, 9158, 4270, 16000,
+        2950, 13481, 4561, 107, 7266, 2459, 3953, -2416, 4103, -805, -3223, 3792,
+        2036, 5503, -7053, 1855, 569, -4593, 2422, 1592, 3661, -5628, -82, -4017,
+        -6435, 580, -1176, 16590, 3136, 8328, -1919, 2723, 8017, 5856, 6873, -2416,
+        4103, 3026, -11964, 3792, 2036, 6873, -2416, 4103, -805, 111, 3792, -1096,
+        10338, -2712, 7819, -3559, -5555, 1604, -1268, 3061, -3308, 3211, -1697, -4115,
+        2900, 1144, 8704, -3852, 5056, 3770, -9548, 5623, 4793, 5011, -4278, 1268,
+        -2667, -5085, 1930, 174, 14406, 952, 6144, -96, 539, 5833, 3046, 9127,
+        -162, 6357, 5280, -9710, 6046, 4993, 8223, -1066, 5453, 545, 1461, 5142,
+        254, 13168, 118, 10649, 1729, -2725, 4434, -373, 7531, 1162, 7681, 2773,
+        355, 7370, 5614, 9081, -3475, 5433, 4147, -1015, 6000, 5170, 7239, -2050,
+        3496, -439, -2857, 4158, 2402, 17427, 3973, 9165, 2925, 3560, 8854, 6067,
+        10451, 1162, 7681, 6604, -8386, 7370, 5614, 10451, 1162, 7681, 2773, 3689,
+        7370, 2482, 11997, -1053, 9478, 558, -3896, 3263, -1544, 4603, -1766, 4753,
+        -155, -2573, 4442, 2686, 6153, -6403, 2505, 1219, -3943, 3072, 2242, 4311,
+        -4978, 568, -3367, -5785, 1230, -526, 14950, 1496, 6688, -575, 1083, 6377,
+        2017, 7523, -1766, 4753, 3676, -11314, 4442, 2686, 7962, -1327, 5192, 284,
+        1200, 3727, -7, 16032, 414, 10945, 4471, -2429, 4730, -371, 18209, 11840,
+        18359, 13451, 11033, 18048, 16292, 5095, -7461, 1447, 161, -5001, 2014, 1184,
+        3253, -6036, -490, -4425, -6843, 172, -1584, 13441, -13, 5179, -3710, -426,
+        4868, 2081, 6465, -2824, 3695, 2618, -12372, 3384, 1628, 6134, -3155, 3364,
+        -1544, -628, 3053, -1835, 8458, -4592, 5939, -2981, -7435, -276, -5083, 3718,
+        -2651, 3868, -1040, -3458, 3557, 1801, 5268, -10051, 1620, 334, -4828, 2187,
+        1357, 3426, -5863, -317, -4252, -6670, 345, -1411, 13614, 160, 5352, -888,
+        -253, 5041, 2254, 6638, -2651, 3868, 2791, -12019, 3557, 1801, 6638, -2651,
+        3868, -1040, -124, 3557, -1331, 10399, -2651, 7880, -1040, -5494, 1665, -3142,
+        8674, 2305, 8824, 3916, 1498, 8513, 6757, 10224, -2332, 6576, 5290, 128,
+        7143, 6313, 8382, -907, 4639, 704, -1714, 5301, 3545, 18570, 5116, 10308,
+        4068, 4703, 9997, 7210, 11594, 2305, 8824, 7747, -7243, 8513, 6757, 11594,
+        2305, 8824, 3916, 4832, 8513, 3625, 15355, 2305, 12836, 3916, -538, 6621,
+        1814, 3308, -3061, 3458, -1450, -3868, 3147, 1391, 4858, -7698, 1210, -76,
+        -5238, 1777, 947, 3016, -6273, -727, -4662, -7080, -65, -1821, 17940, 4486,
+        9678, -569, 4073, 9367, 7206, 6228, -3061, 3458, 2381, -12609, 3147, 1391,
+        6228, -3061, 3458, -1450, -534, 3147, -1741, 9942, -3108, 7423, -3955, -5951,
+        1208, -1664, 2416, -3953, 2566, -2342, -4760, 2255, 499, 8059, -4497, 4411,
+        3125, -10193, 4978, 4148, 4366, -4923, 623, -3312, -5730, 1285, -471, 13761,
+        307, 5499, -741, -106, 5188, 2401, 8482, -807, 5712, 4635, -10355, 5401,
+        4348, 7578, -1711, 4808, -100, 816, 4497, -391, 12523, -527, 10004, 1084,
+        -3370, 3789, -1018, 6886, 517, 7036, 2128, -290, 6725, 4969, 8436, -4120,
+        4788, 3502, -1660, 5355, 4525, 6594, -2695, 2851, -1084, -3502, 3513, 1757,
+        16782, 3328, 8520, 2280, 2915, 8209, 5422, 9806, 517, 7036, 5959, -9031,
+        6725, 4969, 9806, 517, 7036, 2128, 3044, 6725, 1837, 11646, -1404, 9127,
+        207, -4247, 2912, -1895, 3958, -2411, 4108, -800, -3218, 3797, 2041, 5508,
+        -7048, 1860, 574, -4588, 2427, 1597, 3666, -5623, -77, -4012, -6430, 585,
+        -1171, 16034, 2580, 7772, 509, 2167, 7461, 3101, 6878, -2411, 4108, 3031,
+        -11959, 3797, 2041, 7897, -1392, 5127, 219, 1135, 3662, -72, 17043, 1425,
+        11956, 5482, -1418, 5741, 640, 10321, 16348, 22867, 17959, 15541, 22556, 20800,
+        6062, -6494, 2414, 1128, -4034, 2981, 1225, 14338, 5049, 11568, 6660, 4242,
+        11257, 9501, 15795, 2341, 7533, -6010, 3276, 7222, 8196, 713, -8576, -2057,
+        -3134, -19930, -2368, -4124, 11071, 1782, 8301, 8, 4309, 7990, 3102, 11111,
+        -1939, 8592, -328, -2746, 2377, -6591, 7529, 13556, 20075, 15167, 12749, 19764,
+        18008, 6235, -6321, 2587, 1301, -3861, 3154, 1398, 14511, 5222, 11741, 6833,
+        4415, 11430, 9674, 17800, 4346, 9538, -1356, 5281, 9227, 10201, 886, -8403,
+        -1884, -2961, -19757, -2195, -3951, 11244, 1955, 8474, 181, 4482, 8163, 3275,
+        11887, -1163, 9368, 448, -1970, 3153, -5815, 12485, 18512, 25031, 20123, 17705,
+        24720, 22964, 11191, -1365, 7543, 6257, 1095, 8110, 6354, 20465, 11176, 17695,
+        12787, 10369, 17384, 15628, 22756, 9302, 14494, 3600, 10237, 14183, 15157, 5842,
+        -3447, 3072, 1995, -14801, 2761, 1005, 16200, 6911, 13430, 5137, 9438, 13119,
+        8231, 16843, 3793, 14324, 5404, 2986, 8109, -859, 7119, 13146, 19665, 14757,
+        12339, 19354, 17598, 5825, -6731, 2177, 891, -4271, 2744, 988, 14101, 4812,
+        11331, 6423, 4005, 11020, 9264, 19552, 6098, 11290, -1785, 7033, 10979, 11346,
+        476, -8813, -2294, -3371, -20167, -2605, -4361, 10834, 1545, 8064, -229, 4072,
+        7753, 2865, 11181, -1869, 8662, -2223, -2676, 2447, -6521, 8469, 14496, 21015,
+        16107, 13689, 20704, 18948, 9026, -3530, 5378, 4092, -1070, 5945, 4189, 15451,
+        6162, 12681, 7773, 5355, 12370, 10614, 19159, 5705, 10897, 3, 6640, 10586,
+        11560, 2730, -6559, -40, -1117, -17913, -351, -1404, 12184, 2895, 9414, 1121,
+        5422, 9103, 4215, 12213, -837, 9694, 774, -1644, 3479, -5489, 10697, 16724,
+        23243, 18335, 15917, 22932, 21176, 9403, -3153, 5755, 4469, -693, 6322, 4566,
+        17679, 8390, 14909, 10001, 7583, 14598, 12842, 20968, 7514, 12706, 1812, 8449,
+        12395, 13369, 4054, -5235, 1284, 207, -16589, 973, -783, 22747, 13458, 19977,
+        11684, 15985, 19666, 14778, 16612, 3562, 14093, 5173, 2755, 7878, -1090, 7769,
+        13796, 20315, 15407, 12989, 20004, 18248, 6475, -6081, 2827, 1541, -3621, 3394,
+        1638, 14751, 5462, 11981, 7073, 4655, 11670, 9914, 21155, 7701, 12893, 10,
+        8636, 12582, 13556, 1126, -8163, -1644, -2721, -19517, -1955, -3711, 11484, 2195,
+        8714, 421, 4722, 7249, 3515, 13429, -1709, 8822, -98, -2516, -997, -7082,
+        11310, 17337, 23856, 18948, 16530, 23545, 21789, 7051, -5505, 3403, 2117, -3045,
+        3970, 2214, 15327, 6038, 12557, 7649, 5231, 12246, 10490, 18616, 5162, 10354,
+        -3189, 6097, 10043, 11017, 1702, -7587, -1068, -2145, -18941, -1379, -3135, 12060,
+        2771, 9290, 997, 5298, 8979, 4091, 12100, -950, 9581, 661, -1757, 3366,
+        -5602, 8518, 14545, 21064, 16156, 13738, 20753, 18997, 8317, -4239, 4669, 3383,
+        -1779, 5236, 3480, 15500, 6211, 12730, 7822, 5404, 12419, 10663, 18789, 5335,
+        10527, -367, 6270, 10216, 11190, 1875, -7414, -895, -1972, -18768, -1206, -2962,
+        12233, 2944, 9463, 1170, 5471, 9152, 4264, 12876, -174, 10357, 1437, -981,
+        4142, -4826, 13474, 19501, 26020, 21112, 18694, 25709, 23953, 12180, -376, 8532,
+        7246, 2084, 9099, 7343, 21454, 12165, 18684, 13776, 11358, 18373, 16617, 23745,
+        10291, 15483, 4589, 11226, 15172, 16146, 6831, -2458, 4061, 2984, -13812, 3750,
+        1994, 17189, 7900, 14419, 6126, 10427, 14108, 9220, 17832, 4782, 15313, 6393,
+        3975, 9098, 130, 8108, 14135, 20654, 15746, 13328, 20343, 18587, 6814, -5742,
+        3166, 1880, -3282, 3733, 1977, 15090, 5801, 12320, 7412, 4994, 12009, 10253,
+        20541, 7087, 12279, -796, 8022, 11968, 12335, 1465, -7824, -1305, -2382, -19178,
+        -1616, -3372, 11823, 2534, 9053, 760, 5061, 8742, 3854, 12170, -880, 9651,
+        -1234, -1687, 3436, -5532, 9458, 15485, 22004, 17096, 14678, 21693, 19937, 10015,
+        -2541, 6367, 5081, -81, 6934, 5178, 16440, 7151, 13670, 8762, 6344, 13359,
+        11603, 20148, 6694, 11886, 992, 7629, 11575, 12549, 4201, -5088, 1431, 354,
+        -16442, 1120, 67, 13173, 3884, 10403, 2110, 6411, 10092, 5204, 13202, 152,
+        10683, 1763, -655, 4468, -4500, 11686, 17713, 24232, 19324, 16906, 23921, 22165,
+        10392, -2164, 6744, 5458, 296, 7311, 5555, 18668, 9379, 15898, 10990, 8572,
+        15587, 13831, 21957, 8503, 13695, 2801, 9438, 13384, 14358, 5043, -4246, 2273,
+        1196, -15600, 1962, 206, 23736, 14447, 20966, 12673, 16974, 20655, 15767, 16981,
+        3931, 14462, 5542, 3124, 8247, -721, 8758, 14785, 21304, 16396, 13978, 20993,
+        19237, 7464, -5092, 3816, 2530, -2632, 4383, 2627, 15740, 6451, 12970, 8062,
+        5644, 12659, 10903, 22144, 8690, 13882, 999, 9625, 13571, 14545, 2115, -7174,
+        -655, -1732, -18528, -966, -2722, 12473, 3184, 9703, 1410, 5711, 8238, 4504,
+        14418, -720, 9811, 891, -1527, -8, -6093, 10826, 16853, 23372, 18464, 16046,
+        23061, 21305, 6567, -5989, 2919, 1633, -3529, 3486, 1730, 14843, 5554, 12073,
+        7165, 4747, 11762, 10006, 18132, 4678, 9870, -3673, 5613, 9559, 10533, 1218,
+        -8071, -1552, -2629, -19425, -1863, -3619, 11576, 2287, 8806, 513, 4814, 8495,
+        3607, 11616, -1434, 9097, 177, -2241, 2882, -6086, 8034, 14061, 20580, 15672,
+        13254, 20269, 18513, 6740, -5816, 3092, 1806, -3356, 3659, 1903, 15016, 5727,
+        12246, 7338, 4920, 11935, 10179, 18305, 4851, 10043, -851, 5786, 9732, 10706,
+        1391, -7898, -1379, -2456, -19252, -1690, -3446, 11749, 2460, 8979, 686, 4987,
+        8668, 3780, 12392, -658, 9873, 953, -1465, 3658, -5310, 12990, 19017, 25536,
+        20628, 18210, 25225, 23469, 11696, -860, 8048, 6762, 1600, 8615, 6859, 20970,
+        11681, 18200, 13292, 10874, 17889, 16133, 23261, 9807, 14999, 4105, 10742, 14688,
+        15662, 6347, -2942, 3577, 2500, -14296, 3266, 1510, 16705, 7416, 13935, 5642,
+        9943, 13624, 8736, 17348, 4298, 14829, 5909, 3491, 8614, -354, 7624, 13651,
+        20170, 15262, 12844, 19859, 18103, 6330, -6226, 2682, 1396, -3766, 3249, 1493,
+        14606, 5317, 11836, 6928, 4510, 11525, 9769, 20057, 6603, 11795, -1280, 7538,
+        11484, 11851, 981, -8308, -1789, -2866, -19662, -2100, -3856, 11339, 2050, 8569,
+        276, 4577, 8258, 3370, 11686, -1364, 9167, -1718, -2171, 2952, -6016, 8974,
+        15001, 21520, 16612, 14194, 21209, 19453, 9531, -3025, 5883, 4597, -565, 6450,
+        4694, 15956, 6667, 13186, 8278, 5860, 12875, 11119, 19664, 6210, 11402, 508,
+        7145, 11091, 12065, 3235, -6054, 465, -612, -17408, 154, -899, 12689, 3400,
+        9919, 1626, 5927, 9608, 4720, 12718, -332, 10199, 1279, -1139, 3984, -4984,
+        11202, 17229, 23748, 18840, 16422, 23437, 21681, 9908, -2648, 6260, 4974, -188,
+        6827, 5071, 18184, 8895, 15414, 10506, 8088, 15103, 13347, 21473, 8019, 13211,
+        2317, 8954, 12900, 13874, 4559, -4730, 1789, 712, -16084, 1478, -278, 23252,
+        13963, 20482, 12189, 16490, 20171, 15283, 16497, 3447, 13978, 5058, 2640, 7763,
+        -1205, 8274, 14301, 20820, 15912, 13494, 20509, 18753, 6980, -5576, 3332, 2046,
+        -3116, 3899, 2143, 15256, 5967, 12486, 7578, 5160, 12175, 10419, 21660, 8206,
+        13398, 515, 9141, 13087, 14061, 1631, -7658, -1139, -2216, -19012, -1450, -3206,
+        11989, 2700, 9219, 926, 5227, 7754, 4020, 13934, -1204, 9327, 407, -2011,
+        -492, -6577, 10826, 16853, 23372, 18464, 16046, 23061, 21305, 6567, -5989, 2919,
+        1633, -3529, 3486, 1730, 14843, 5554, 12073, 7165, 4747, 11762, 10006, 17117,
+        3663, 8855, -4688, 4598, 8544, 9518, 1218, -8071, -1552, -2629, -19425, -1863,
+        -3619, 12043, 2754, 9273, 980, 5281, 8962, 4074, 11474, -1576, 8955, 35,
+        -2383, 2740, -6228, 8034, 14061, 20580, 15672, 13254, 20269, 18513, 6740, -5816,
+        3092, 1806, -3356, 3659, 1903, 15016, 5727, 12246, 7338, 4920, 11935, 10179,
+        18305, 4851, 10043, -851, 5786, 9732, 10706, 1391, -7898, -1379, -2456, -19252,
+        -1690, -3446, 11749, 2460, 8979, 686, 4987, 8668, 3780, 12392, -658, 9873,
+        953, -1465, 3658, -5310, 12990, 19017, 25536, 20628, 18210, 25225, 23469, 11696,
+        -860, 8048, 6762, 1600, 8615, 6859, 20970, 11681, 18200, 13292, 10874, 17889,
+        16133, 23261, 9807, 14999, 4105, 10742, 14688, 15662, 6347, -2942, 3577, 2500,
+        -14296, 3266, 1510, 16705, 7416, 13935, 5642, 9943, 13624, 8736, 17348, 4298,
+        14829, 5909, 3491, 8614, -354, 7624, 13651, 20170, 15262, 12844, 19859, 18103,
+        6330, -6226, 2682, 1396, -3766, 3249, 1493, 14606, 5317, 11836, 6928, 4510,
+        11525, 9769, 19952, 6498, 11690, -1385, 7433, 11379, 11746, 981, -8308, -1789,
+        -2866, -19662, -2100, -3856, 11339, 2050, 8569, 276, 4577, 8258, 3370, 11502,
+        -1548, 8983, -1902, -2355, 2768, -6200, 8974, 15001, 21520, 16612, 14194, 21209,
+        19453, 9531, -3025, 5883, 4597, -565, 6450, 4694, 15956, 6667, 13186, 8278,
+        5860, 12875, 11119, 19664, 6210, 11402, 508, 7145, 11091, 12065, 3235, -6054,
+        465, -612, -17408, 154, -899, 12689, 3400, 9919, 1626, 5927, 9608, 4720,
+        12718, -332, 10199, 1279, -1139, 3984, -4984, 11202, 17229, 23748, 18840, 16422,
+        23437, 21681, 9908, -2648, 6260, 4974, -188, 6827, 5071, 18184, 8895, 15414,
+        10506, 8088, 15103, 13347, 21473, 8019, 13211, 2317, 8954, 12900, 13874, 4559,
+        -4730, 1789, 712, -16084, 1478, -278, 23252, 13963, 20482, 12189, 16490, 20171,
+        15283, 16497, 3447, 13978, 5058, 2640, 7763, -1205, 8274, 14301, 20820, 15912,
+        13494, 20509, 18753, 6980, -5576, 3332, 2046, -3116, 3899, 2143, 15256, 5967,
+        12486, 7578, 5160, 12175, 10419, 23029, 9575, 14767, 1884, 10510, 14456, 15430,
+        1631, -7658, -1139, -2216, -19012, -1450, -3206, 11989, 2700, 9219, 926, 5227,
+        7754, 4020, 13934, -1204, 9327, 407, -2011, -492, -6577, 10919, 16946, 23465,
+        18557, 16139, 23154, 21398, 6660, -5896, 3012, 1726, -3436, 3579, 1823, 14936,
+        5647, 12166, 7258, 4840, 11855, 10099, 18225, 4771, 9963, -3580, 5706, 9652,
+        10626, 1311, -7978, -1459, -2536, -19332, -1770, -3526, 11669, 2380, 8899, 606,
+        4907, 8588, 3700, 11709, -1341, 9190, 270, -2148, 2975, -5993, 8127, 14154,
+        20673, 15765, 13347, 20362, 18606, 6833, -5723, 3185, 1899, -3263, 3752, 1996,
+        15109, 5820, 12339, 7431, 5013, 12028, 10272, 18398, 4944, 10136, -758, 5879,
+        9825, 10799, 1484, -7805, -1286, -2363, -19159, -1597, -3353, 11842, 2553, 9072,
+        779, 5080, 8761, 3873, 12485, -565, 9966, 1046, -1372, 3751, -5217, 13083,
+        19110, 25629, 20721, 18303, 25318, 23562, 11789, -767, 8141, 6855, 1693, 8708,
+        6952, 21063, 11774, 18293, 13385, 10967, 17982, 16226, 23354, 9900, 15092, 4198,
+        10835, 14781, 15755, 6440, -2849, 3670, 2593, -14203, 3359, 1603, 16798, 7509,
+        14028, 5735, 10036, 13717, 8829, 17441, 4391, 14922, 6002, 3584, 8707, -261,
+        7717, 13744, 20263, 15355, 12937, 19952, 18196, 6423, -6133, 2775, 1489, -3673,
+        3342, 1586, 14699, 5410, 11929, 7021, 4603, 11618, 9862, 20150, 6696, 11888,
+        -1187, 7631, 11577, 11944, 1074, -8215, -1696, -2773, -19569, -2007, -3763, 11432,
+        2143, 8662, 369, 4670, 8351, 3463, 11779, -1271, 9260, -1625, -2078, 3045,
+        -5923, 9067, 15094, 21613, 16705, 14287, 21302, 19546, 9624, -2932, 5976, 4690,
+        -472, 6543, 4787, 16049, 6760, 13279, 8371, 5953, 12968, 11212, 19757, 6303,
+        11495, 601, 7238, 11184, 12158, 3328, -5961, 558, -519, -17315, 247, -806,
+        12782, 3493, 10012, 1719, 6020, 9701, 4813, 12811, -239, 10292, 1372, -1046,
+        4077, -4891, 11295, 17322, 23841, 18933, 16515, 23530, 21774, 10001, -2555, 6353,
+        5067, -95, 6920, 5164, 18277, 8988, 15507, 10599, 8181, 15196, 13440, 21566,
+        8112, 13304, 2410, 9047, 12993, 13967, 4652, -4637, 1882, 805, -15991, 1571,
+        -185, 23345, 14056, 20575, 12282, 16583, 20264, 15376, 16590, 3540, 14071, 5151,
+        2733, 7856, -1112, 8367, 14394, 20913, 16005, 13587, 20602, 18846, 7073, -5483,
+        3425, 2139, -3023, 3992, 2236, 15349, 6060, 12579, 7671, 5253, 12268, 10512,
+        21753, 8299, 13491, 608, 9234, 13180, 14154, 1724, -7565, -1046, -2123, -18919,
+        -1357, -3113, 12082, 2793, 9312, 1019, 5320, 7847, 4113, 14027, -1111, 9420,
+        500, -1918, -399, -6484, 11471, 17498, 24017, 19109, 16691, 23706, 21950, 7212,
+        -5344, 3564, 2278, -2884, 4131, 2375, 15488, 6199, 12718, 7810, 5392, 12407,
+        10651, 18777, 5323, 10515, -3028, 6258, 10204, 11178, 1863, -7426, -907, -1984,
+        -18780, -1218, -2974, 12221, 2932, 9451, 1158, 5459, 9140, 4252, 12261, -789,
+        9742, 822, -1596, 3527, -5441, 8679, 14706, 21225, 16317, 13899, 20914, 19158,
+        7385, -5171, 3737, 2451, -2711, 4304, 2548, 15661, 6372, 12891, 7983, 5565,
+        12580, 10824, 18950, 5496, 10688, -206, 6431, 10377, 11351, 2036, -7253, -734,
+        -1811, -18607, -1045, -2801, 12394, 3105, 9624, 1331, 5632, 9313, 4425, 13037,
+        -13, 10518, 1598, -820, 4303, -4665, 13635, 19662, 26181, 21273, 18855, 25870,
+        24114, 12341, -215, 8693, 7407, 2245, 9260, 7504, 21615, 12326, 18845, 13937,
+        11519, 18534, 16778, 23906, 10452, 15644, 4750, 11387, 15333, 16307, 6992, -2297,
+        4222, 3145, -13651, 3911, 2155, 17350, 8061, 14580, 6287, 10588, 14269, 9381,
+        17993, 4943, 15474, 6554, 4136, 9259, 291, 8269, 14296, 20815, 15907, 13489,
+        20504, 18748, 6975, -5581, 3327, 2041, -3121, 3894, 2138, 15251, 5962, 12481,
+        7573, 5155, 12170, 10414, 20702, 7248, 12440, -635, 8183, 12129, 12496, 1626,
+        -7663, -1144, -2221, -19017, -1455, -3211, 11984, 2695, 9214, 921, 5222, 8903,
+        4015, 12331, -719, 9812, -1073, -1526, 3597, -5371, 9619, 15646, 22165, 17257,
+        14839, 21854, 20098, 10176, -2380, 6528, 5242, 80, 7095, 5339, 16601, 7312,
+        13831, 8923, 6505, 13520, 11764, 20309, 6855, 12047, 1153, 7790, 11736, 12710,
+        3880, -5409, 1110, 33, -16763, 799, -254, 13334, 4045, 10564, 2271, 6572,
+        10253, 5365, 13363, 313, 10844, 1924, -494, 4629, -4339, 11847, 17874, 24393,
+        19485, 17067, 24082, 22326, 10553, -2003, 6905, 5619, 457, 7472, 5716, 18829,
+        9540, 16059, 11151, 8733, 15748, 13992, 22118, 8664, 13856, 2962, 9599, 13545,
+        14519, 5204, -4085, 2434, 1357, -15439, 2123, 367, 23897, 14608, 21127, 12834,
+        17135, 20816, 15928, 17329, 4279, 14810, 5890, 3472, 8595, -373, 8919, 14946,
+        21465, 16557, 14139, 21154, 19398, 7625, -4931, 3977, 2691, -2471, 4544, 2788,
+        15901, 6612, 13131, 8223, 5805, 12820, 11064, 21442, 7988, 13180, 297, 8923,
+        12869, 13843, 2276, -7013, -494, -1571, -18367, -805, -2561, 12170, 2881, 9400,
+        1107, 5408, 7935, 4201, 14579, -559, 9972, 1052, -1366, 153, -5932, 10826,
+        16853, 23372, 18464, 16046, 23061, 21305, 6567, -5989, 2919, 1633, -3529, 3486,
+        1730, 14843, 5554, 12073, 7165, 4747, 11762, 10006, 18132, 4678, 9870, -3673,
+        5613, 9559, 10533, 1218, -8071, -1552, -2629, -19425, -1863, -3619, 11245, 1956,
+        8475, 182, 4483, 8164, 3276, 11226, -1824, 8707, -213, -2631, 2492, -6476,
+        8034, 14061, 20580, 15672, 13254, 20269, 18513, 6740, -5816, 3092, 1806, -3356,
+        3659, 1903, 15016, 5727, 12246, 7338, 4920, 11935, 10179, 18305, 4851, 10043,
+        -851, 5786, 9732, 10706, 1391, -7898, -1379, -2456, -19252, -1690, -3446, 11749,
+        2460, 8979, 686, 4987, 8668, 3780, 12392, -658, 9873, 953, -1465, 3658,
+        -5310, 12990, 19017, 25536, 20628, 18210, 25225, 23469, 11696, -860, 8048, 6762,
+        1600, 8615, 6859, 20970, 11681, 18200, 13292, 10874, 17889, 16133, 23261, 9807,
+        14999, 4105, 10742, 14688, 15662, 6347, -2942, 3577, 2500, -14296, 3266, 1510,
+        16705, 7416, 13935, 5642, 9943, 13624, 8736, 17348, 4298, 14829, 5909, 3491,
+        8614, -354, 7624, 13651, 20170, 15262, 12844, 19859, 18103, 6330, -6226, 2682,
+        1396, -3766, 3249, 1493, 14606, 5317, 11836, 6928, 4510, 11525, 9769, 20551,
+        7097, 12289, -786, 8032, 11978, 12345, 981, -8308, -1789, -2866, -19662, -2100,
+        -3856, 11339, 2050, 8569, 276, 4577, 8258, 3370, 12157, -893, 9638, -1247,
+        -1700, 3423, -5545, 8974, 15001, 21520, 16612, 14194, 21209, 19453, 9531, -3025,
+        5883, 4597, -565, 6450, 4694, 15956, 6667, 13186, 8278, 5860, 12875, 11119,
+        19664, 6210, 11402, 508, 7145, 11091, 12065, 3235, -6054, 465, -612, -17408,
+        154, -899, 12689, 3400, 9919, 1626, 5927, 9608, 4720, 12718, -332, 10199,
+        1279, -1139, 3984, -4984, 11202, 17229, 23748, 18840, 16422, 23437, 21681, 9908,
+        -2648, 6260, 4974, -188, 6827, 5071, 18184, 8895, 15414, 10506, 8088, 15103,
+        13347, 21473, 8019, 13211, 2317, 8954, 12900, 13874, 4559, -4730, 1789, 712,
+        -16084, 1478, -278, 23252, 13963, 20482, 12189, 16490, 20171, 15283, 16497, 3447,
+        13978, 5058, 2640, 7763, -1205, 8274, 14301, 20820, 15912, 13494, 20509, 18753,
+        6980, -5576, 3332, 2046, -3116, 3899, 2143, 15256, 5967, 12486, 7578, 5160,
+        12175, 10419, 21660, 8206, 13398, 515, 9141, 13087, 14061, 1631, -7658, -1139,
+        -2216, -19012, -1450, -3206, 11496, 2207, 8726, 433, 4734, 7261, 3527, 15722,
+        584, 11115, 2195, -223, 1296, -4789, -4808, -5586, 933, -3975, -6393, 622,
+        -1134, 5838, -6718, 2190, 904, -4258, 2757, 1001, 7208, -2081, 4438, -470,
+        -2888, 4127, 2371, 13179, -275, 4917, -3972, -688, 4606, 747, 8072, -2081,
+        4438, 3361, -13349, 4127, 2371, 7208, -2081, 4438, -470, 446, 4127, -761,
+        9500, -3550, 6981, -3098, -4357, 1413, -3050, 4461, -1908, 4611, -297, -2715,
+        4300, 2544, 6011, -6545, 2363, 1077, -4085, 2930, 1174, 7381, -1908, 4611,
+        -297, -2715, 4300, 2544, 15184, 1730, 6922, 682, 1317, 6611, 2752, 8245,
+        -1908, 4611, 3534, -13176, 4300, 2544, 7381, -1908, 4611, -297, 619, 4300,
+        -588, 11142, -1908, 8623, -1456, -2715, 3055, -1408, 9417, 3048, 9567, 4659,
+        2241, 9256, 7500, 10967, -1589, 7319, 6033, 871, 7886, 6130, 12337, 3048,
+        9567, 4659, 2241, 9256, 7500, 20140, 6686, 11878, 5638, 6273, 11567, 7708,
+        13201, 3048, 9567, 8490, -8220, 9256, 7500, 12337, 3048, 9567, 4659, 5575,
+        9256, 4368, 16547, 3497, 14028, 3949, 2690, 8460, 3997, 4164, -2205, 4314,
+        -594, -3012, 4003, 2247, 5714, -6842, 2066, 780, -4382, 2633, 877, 7084,
+        -2205, 4314, -594, -3012, 4003, 2247, 16190, 2736, 7928, 655, 2323, 7617,
+        3758, 7948, -2205, 4314, 3237, -13473, 4003, 2247, 7970, -1319, 5200, 292,
+        1208, 4889, 1, 10845, -2205, 8326, -3718, -3012, 2758, -3106, 3642, -2727,
+        3792, -1116, -3534, 3481, 1725, 5192, -7364, 1544, 258, -5447, 2111, 355,
+        6562, -2727, 3792, -1116, -3534, 3481, 1725, 14365, 911, 6103, -137, 498,
+        5792, 1933, 7426, -2727, 3792, 2715, -13995, 3481, 2428, 6562, -2727, 3792,
+        -1116, -200, 3481, -1407, 10729, -2321, 8210, -1869, -3128, 2642, -1821, 7629,
+        1260, 7779, 2871, 453, 7468, 5712, 9179, -3377, 5531, 4245, -917, 6098,
+        4342, 10549, 1260, 7779, 2871, 453, 7468, 5712, 18352, 4898, 10090, 3850,
+        4485, 9779, 5920, 11413, 1260, 7779, 6702, -10008, 7468, 5712, 10549, 1260,
+        7779, 2871, 3787, 7468, 2580, 15518, 2468, 12999, 2920, 1661, 7431, 2968,
+        4917, -1452, 5067, 159, -2259, 4756, 3000, 6467, -6089, 2819, 1533, -3629,
+        3386, 1630, 7837, -1452, 5067, 159, -2259, 4756, 3000, 15640, 2186, 7378,
+        115, 1773, 7067, 3208, 8701, -1452, 5067, 3990, -12720, 4756, 3000, 9358,
+        69, 6588, 1680, 2596, 5123, 1389, 15067, -71, 10460, 381, -878, 4892,
+        429, -2911, -3689, 2830, -2078, -4496, 2519, 763, 6827, -5729, 3179, 1893,
+        -3269, 3746, 1990, 8197, -1092, 5427, 519, -1899, 5116, 3360, 16000, 2546,
+        7738, -1151, 2133, 7427, 3568, 9061, -1092, 5427, 4350, -12360, 5116, 3360,
+        8197, -1092, 5427, 519, 1435, 5116, 228, 10489, -2561, 7970, -2109, -3368,
+        2402, -2061, 5450, -919, 5600, 692, -1726, 5289, 3533, 8093, -4463, 4445,
+        3159, -2003, 5012, 3256, 8370, -919, 5600, 692, -1726, 5289, 3533, 16173,
+        2719, 7911, 1671, 2306, 7600, 3741, 9234, -919, 5600, 4523, -12187, 5289,
+        3533, 8370, -919, 5600, 692, 1608, 5289, 401, 12131, -919, 9612, -467,
+        -1726, 4044, -419, 10406, 4037, 10556, 5648, 3230, 10245, 8489, 11956, -600,
+        8308, 7022, 1860, 8875, 7119, 13326, 4037, 10556, 5648, 3230, 10245, 8489,
+        21129, 7675, 12867, 6627, 7262, 12556, 8697, 14190, 4037, 10556, 9479, -7231,
+        10245, 8489, 13326, 4037, 10556, 5648, 6564, 10245, 5357, 17536, 4486, 15017,
+        4938, 3679, 9449, 4986, 5153, -1216, 5303, 395, -2023, 4992, 3236, 6703,
+        -5853, 3055, 1769, -3393, 3622, 1866, 8073, -1216, 5303, 395, -2023, 4992,
+        3236, 17179, 3725, 8917, 1644, 3312, 8606, 4747, 8937, -1216, 5303, 4226,
+        -12484, 4992, 3236, 8959, -330, 6189, 1281, 2197, 5878, 990, 11834, -1216,
+        9315, -2729, -2023, 3747, -2117, 4631, -1738, 4781, -127, -2545, 4470, 2714,
+        6181, -6375, 2533, 1247, -4458, 3100, 1344, 7551, -1738, 4781, -127, -2545,
+        4470, 2714, 15354, 1900, 7092, 852, 1487, 6781, 2922, 8415, -1738, 4781,
+        3704, -13006, 4470, 3417, 7551, -1738, 4781, -127, 789, 4470, -418, 11718,
+        -1332, 9199, -880, -2139, 3631, -832, 8618, 2249, 8768, 3860, 1442, 8457,
+        6701, 10168, -2388, 6520, 5234, 72, 7087, 5331, 11538, 2249, 8768, 3860,
+        1442, 8457, 6701, 19341, 5887, 11079, 4839, 5474, 10768, 6909, 12402, 2249,
+        8768, 7691, -9019, 8457, 6701, 11538, 2249, 8768, 3860, 4776, 8457, 3569,
+        16507, 3457, 13988, 3909, 2650, 8420, 3957, 5906, -463, 6056, 1148, -1270,
+        5745, 3989, 7456, -5100, 3808, 2522, -2640, 4375, 2619, 8826, -463, 6056,
+        1148, -1270, 5745, 3989, 16629, 3175, 8367, 1104, 2762, 8056, 4197, 9690,
+        -463, 6056, 4979, -11731, 5745, 3989, 10347, 1058, 7577, 2669, 3585, 6112,
+        2378, 15831, 693, 11224, 1145, -114, 5656, 1193, -3395, -4173, 2346, -2562,
+        -4980, 2035, 279, 6343, -6213, 2695, 1409, -3753, 3262, 1506, 7713, -1576,
+        4943, 35, -2383, 4632, 2876, 15516, 2062, 7254, -1635, 1649, 6943, 3084,
+        8577, -1576, 4943, 3866, -12844, 4632, 2876, 7713, -1576, 4943, 35, 951,
+        4632, -256, 10005, -3045, 7486, -2593, -3852, 1918, -2545, 4966, -1403, 5116,
+        208, -2210, 4805, 3049, 6516, -6040, 2868, 1582, -3580, 3435, 1679, 7886,
+        -1403, 5116, 208, -2210, 4805, 3049, 15689, 2235, 7427, 1187, 1822, 7116,
+        3257, 8750, -1403, 5116, 4039, -12671, 4805, 3049, 7886, -1403, 5116, 208,
+        1124, 4805, -83, 11647, -1403, 9128, -951, -2210, 3560, -903, 9922, 3553,
+        10072, 5164, 2746, 9761, 8005, 11472, -1084, 7824, 6538, 1376, 8391, 6635,
+        12842, 3553, 10072, 5164, 2746, 9761, 8005, 20645, 7191, 12383, 6143, 6778,
+        12072, 8213, 13706, 3553, 10072, 8995, -7715, 9761, 8005, 12842, 3553, 10072,
+        5164, 6080, 9761, 4873, 17052, 4002, 14533, 4454, 3195, 8965, 4502, 4669,
+        -1700, 4819, -89, -2507, 4508, 2752, 6219, -6337, 2571, 1285, -3877, 3138,
+        1382, 7589, -1700, 4819, -89, -2507, 4508, 2752, 16695, 3241, 8433, 1160,
+        2828, 8122, 4263, 8453, -1700, 4819, 3742, -12968, 4508, 2752, 8475, -814,
+        5705, 797, 1713, 5394, 506, 11350, -1700, 8831, -3213, -2507, 3263, -2601,
+        4147, -2222, 4297, -611, -3029, 3986, 2230, 5697, -6859, 2049, 763, -4942,
+        2616, 860, 7067, -2222, 4297, -611, -3029, 3986, 2230, 14870, 1416, 6608,
+        368, 1003, 6297, 2438, 7931, -2222, 4297, 3220, -13490, 3986, 2933, 7067,
+        -2222, 4297, -611, 305, 3986, -902, 11234, -1816, 8715, -1364, -2623, 3147,
+        -1316, 8134, 1765, 8284, 3376, 958, 7973, 6217, 9684, -2872, 6036, 4750,
+        -412, 6603, 4847, 11054, 1765, 8284, 3376, 958, 7973, 6217, 18857, 5403,
+        10595, 4355, 4990, 10284, 6425, 11918, 1765, 8284, 7207, -9503, 7973, 6217,
+        11054, 1765, 8284, 3376, 4292, 7973, 3085, 16023, 2973, 13504, 3425, 2166,
+        7936, 3473, 5422, -947, 5572, 664, -1754, 5261, 3505, 6972, -5584, 3324,
+        2038, -3124, 3891, 2135, 8342, -947, 5572, 664, -1754, 5261, 3505, 16145,
+        2691, 7883, 620, 2278, 7572, 3713, 9206, -947, 5572, 4495, -12215, 5261,
+        3505, 9863, 574, 7093, 2185, 3101, 5628, 1894, 14603, -535, 9996, -83,
+        -1342, 4428, -35, -3395, -4173, 2346, -2562, -4980, 2035, 279, 6343, -6213,
+        2695, 1409, -3753, 3262, 1506, 7713, -1576, 4943, 35, -2383, 4632, 2876,
+        14501, 1047, 6239, -2650, 634, 5928, 2069, 8577, -1576, 4943, 3866, -12844,
+        4632, 2876, 8180, -1109, 5410, 502, 1418, 5099, 211, 9863, -3187, 7344,
+        -2735, -3994, 1776, -2687, 4966, -1403, 5116, 208, -2210, 4805, 3049, 6516,
+        -6040, 2868, 1582, -3580, 3435, 1679, 7886, -1403, 5116, 208, -2210, 4805,
+        3049, 15689, 2235, 7427, 1187, 1822, 7116, 3257, 8750, -1403, 5116, 4039,
+        -12671, 4805, 3049, 7886, -1403, 5116, 208, 1124, 4805, -83, 11647, -1403,
+        9128, -951, -2210, 3560, -903, 9922, 3553, 10072, 5164, 2746, 9761, 8005,
+        11472, -1084, 7824, 6538, 1376, 8391, 6635, 12842, 3553, 10072, 5164, 2746,
+        9761, 8005, 20645, 7191, 12383, 6143, 6778, 12072, 8213, 13706, 3553, 10072,
+        8995, -7715, 9761, 8005, 12842, 3553, 10072, 5164, 6080, 9761, 4873, 17052,
+        4002, 14533, 4454, 3195, 8965, 4502, 4669, -1700, 4819, -89, -2507, 4508,
+        2752, 6219, -6337, 2571, 1285, -3877, 3138, 1382, 7589, -1700, 4819, -89,
+        -2507, 4508, 2752, 18290, 4836, 10028, 2755, 4423, 9717, 5858, 8453, -1700,
+        4819, 3742, -12968, 4508, 2752, 8475, -814, 5705, 797, 1713, 5394, 506,
+        11350, -1700, 8831, -3213, -2507, 3263, -2601, 4147, -2222, 4297, -611, -3029,
+        3986, 2230, 5697, -6859, 2049, 763, -4942, 2616, 860, 7067, -2222, 4297,
+        -611, -3029, 3986, 2230, 14870, 1416, 6608, 368, 1003, 6297, 2438, 7931,
+        -2222, 4297, 3220, -13490, 3986, 2933, 7067, -2222, 4297, -611, 305, 3986,
+        -902, 11234, -1816, 8715, -1364, -2623, 3147, -1316, 8134, 1765, 8284, 3376,
+        958, 7973, 6217, 9684, -2872, 6036, 4750, -412, 6603, 4847, 11054, 1765,
+        8284, 3376, 958, 7973, 6217, 18857, 5403, 10595, 4355, 4990, 10284, 6425,
+        11918, 1765, 8284, 7207, -9503, 7973, 6217, 11054, 1765, 8284, 3376, 4292,
+        7973, 3085, 16023, 2973, 13504, 3425, 2166, 7936, 3473, 5422, -947, 5572,
+        664, -1754, 5261, 3505, 6972, -5584, 3324, 2038, -3124, 3891, 2135, 8342,
+        -947, 5572, 664, -1754, 5261, 3505, 17314, 3860, 9052, 1789, 3447, 8741,
+        4882, 9206, -947, 5572, 4495, -12215, 5261, 3505, 9863, 574, 7093, 2185,
+        3101, 5628, 1894, 15407, 269, 10800, 721, -538, 5232, 769, -3302, -4080,
+        2439, -2469, -4887, 2128, 372, 6436, -6120, 2788, 1502, -3660, 3355, 1599,
+        7806, -1483, 5036, 128, -2290, 4725, 2969, 15609, 2155, 7347, -1542, 1742,
+        7036, 3177, 8670, -1483, 5036, 3959, -12751, 4725, 2969, 7806, -1483, 5036,
+        128, 1044, 4725, -163, 10098, -2952, 7579, -2500, -3759, 2011, -2452, 5059,
+        -1310, 5209, 301, -2117, 4898, 3142, 6609, -5947, 2961, 1675, -3487, 3528,
+        1772, 7979, -1310, 5209, 301, -2117, 4898, 3142, 15782, 2328, 7520, 1280,
+        1915, 7209, 3350, 8843, -1310, 5209, 4132, -12578, 4898, 3142, 7979, -1310,
+        5209, 301, 1217, 4898, 10, 11740, -1310, 9221, -858, -2117, 3653, -810,
+        10015, 3646, 10165, 5257, 2839, 9854, 8098, 11565, -991, 7917, 6631, 1469,
+        8484, 6728, 12935, 3646, 10165, 5257, 2839, 9854, 8098, 20738, 7284, 12476,
+        6236, 6871, 12165, 8306, 13799, 3646, 10165, 9088, -7622, 9854, 8098, 12935,
+        3646, 10165, 5257, 6173, 9854, 4966, 17145, 4095, 14626, 4547, 3288, 9058,
+        4595, 4762, -1607, 4912, 4, -2414, 4601, 2845, 6312, -6244, 2664, 1378,
+        -3784, 3231, 1475, 7682, -1607, 4912, 4, -2414, 4601, 2845, 16788, 3334,
+        8526, 1253, 2921, 8215, 4356, 8546, -1607, 4912, 3835, -12875, 4601, 2845,
+        8568, -721, 5798, 890, 1806, 5487, 599, 11443, -1607, 8924, -3120, -2414,
+        3356, -2508, 4240, -2129, 4390, -518, -2936, 4079, 2323, 5790, -6766, 2142,
+        856, -4849, 2709, 953, 7160, -2129, 4390, -518, -2936, 4079, 2323, 14963,
+        1509, 6701, 461, 1096, 6390, 2531, 8024, -2129, 4390, 3313, -13397, 4079,
+        3026, 7160, -2129, 4390, -518, 398, 4079, -809, 11327, -1723, 8808, -1271,
+        -2530, 3240, -1223, 8227, 1858, 8377, 3469, 1051, 8066, 6310, 9777, -2779,
+        6129, 4843, -319, 6696, 4940, 11147, 1858, 8377, 3469, 1051, 8066, 6310,
+        18950, 5496, 10688, 4448, 5083, 10377, 6518, 12011, 1858, 8377, 7300, -9410,
+        8066, 6310, 11147, 1858, 8377, 3469, 4385, 8066, 3178, 16116, 3066, 13597,
+        3518, 2259, 8029, 3566, 5515, -854, 5665, 757, -1661, 5354, 3598, 7065,
+        -5491, 3417, 2131, -3031, 3984, 2228, 8435, -854, 5665, 757, -1661, 5354,
+        3598, 16238, 2784, 7976, 713, 2371, 7665, 3806, 9299, -854, 5665, 4588,
+        -12122, 5354, 3598, 9956, 667, 7186, 2278, 3194, 5721, 1987, 15440, 302,
+        10833, 754, -505, 5265, 802, -2750, -3528, 2991, -1917, -4335, 2680, 924,
+        6988, -5568, 3340, 2054, -3108, 3907, 2151, 8358, -931, 5588, 680, -1738,
+        5277, 3521, 16161, 2707, 7899, -990, 2294, 7588, 3729, 9222, -931, 5588,
+        4511, -12199, 5277, 3521, 8358, -931, 5588, 680, 1596, 5277, 389, 10650,
+        -2400, 8131, -1948, -3207, 2563, -1900, 5611, -758, 5761, 853, -1565, 5450,
+        3694, 7161, -5395, 3513, 2227, -2935, 4080, 2324, 8531, -758, 5761, 853,
+        -1565, 5450, 3694, 16334, 2880, 8072, 1832, 2467, 7761, 3902, 9395, -758,
+        5761, 4684, -12026, 5450, 3694, 8531, -758, 5761, 853, 1769, 5450, 562,
+        12292, -758, 9773, -306, -1565, 4205, -258, 10567, 4198, 10717, 5809, 3391,
+        10406, 8650, 12117, -439, 8469, 7183, 2021, 9036, 7280, 13487, 4198, 10717,
+        5809, 3391, 10406, 8650, 21290, 7836, 13028, 6788, 7423, 12717, 8858, 14351,
+        4198, 10717, 9640, -7070, 10406, 8650, 13487, 4198, 10717, 5809, 6725, 10406,
+        5518, 17697, 4647, 15178, 5099, 3840, 9610, 5147, 5314, -1055, 5464, 556,
+        -1862, 5153, 3397, 6864, -5692, 3216, 1930, -3232, 3783, 2027, 8234, -1055,
+        5464, 556, -1862, 5153, 3397, 17340, 3886, 9078, 1805, 3473, 8767, 4908,
+        9098, -1055, 5464, 4387, -12323, 5153, 3397, 9120, -169, 6350, 1442, 2358,
+        6039, 1151, 11995, -1055, 9476, -2568, -1862, 3908, -1956, 4792, -1577, 4942,
+        34, -2384, 4631, 2875, 6342, -6214, 2694, 1408, -4297, 3261, 1505, 7712,
+        -1577, 4942, 34, -2384, 4631, 2875, 15515, 2061, 7253, 1013, 1648, 6942,
+        3083, 8576, -1577, 4942, 3865, -12845, 4631, 3578, 7712, -1577, 4942, 34,
+        950, 4631, -257, 11879, -1171, 9360, -719, -1978, 3792, -671, 8779, 2410,
+        8929, 4021, 1603, 8618, 6862, 10329, -2227, 6681, 5395, 233, 7248, 5492,
+        11699, 2410, 8929, 4021, 1603, 8618, 6862, 19502, 6048, 11240, 5000, 5635,
+        10929, 7070, 12563, 2410, 8929, 7852, -8858, 8618, 6862, 11699, 2410, 8929,
+        4021, 4937, 8618, 3730, 16855, 3805, 14336, 4257, 2998, 8768, 4305, 6067,
+        -302, 6217, 1309, -1109, 5906, 4150, 7617, -4939, 3969, 2683, -2479, 4536,
+        2780, 8987, -302, 6217, 1309, -1109, 5906, 4150, 16790, 3336, 8528, 1265,
+        2923, 8217, 4358, 9851, -302, 6217, 5140, -11570, 5906, 4150, 10508, 1219,
+        7738, 2830, 3746, 6273, 2539, 15992, 854, 11385, 1306, 47, 5817, 1354,
+        -3395, -4173, 2346, -2562, -4980, 2035, 279, 6343, -6213, 2695, 1409, -3753,
+        3262, 1506, 7713, -1576, 4943, 35, -2383, 4632, 2876, 15516, 2062, 7254,
+        -1635, 1649, 6943, 3084, 8577, -1576, 4943, 3866, -12844, 4632, 2876, 7382,
+        -1907, 4612, -296, 620, 4301, -587, 9615, -3435, 7096, -2983, -4242, 1528,
+        -2935, 4966, -1403, 5116, 208, -2210, 4805, 3049, 6516, -6040, 2868, 1582,
+        -3580, 3435, 1679, 7886, -1403, 5116, 208, -2210, 4805, 3049, 15689, 2235,
+        7427, 1187, 1822, 7116, 3257, 8750, -1403, 5116, 4039, -12671, 4805, 3049,
+        7886, -1403, 5116, 208, 1124, 4805, -83, 11647, -1403, 9128, -951, -2210,
+        3560, -903, 9922, 3553, 10072, 5164, 2746, 9761, 8005, 11472, -1084, 7824,
+        6538, 1376, 8391, 6635, 12842, 3553, 10072, 5164, 2746, 9761, 8005, 20645,
+        7191, 12383, 6143, 6778, 12072, 8213, 13706, 3553, 10072, 8995, -7715, 9761,
+        8005, 12842, 3553, 10072, 5164, 6080, 9761, 4873, 17052, 4002, 14533, 4454,
+        3195, 8965, 4502, 4669, -1700, 4819, -89, -2507, 4508, 2752, 6219, -6337,
+        2571, 1285, -3877, 3138, 1382, 7589, -1700, 4819, -89, -2507, 4508, 2752,
+        17693, 4239, 9431, 2158, 3826, 9120, 5261, 8453, -1700, 4819, 3742, -12968,
+        4508, 2752, 8475, -814, 5705, 797, 1713, 5394, 506, 11218, -1832, 8699,
+        -3345, -2639, 3131, -2733, 4147, -2222, 4297, -611, -3029, 3986, 2230, 5697,
+        -6859, 2049, 763, -4942, 2616, 860, 7067, -2222, 4297, -611, -3029, 3986,
+        2230, 14870, 1416, 6608, 368, 1003, 6297, 2438, 7931, -2222, 4297, 3220,
+        -13490, 3986, 2933, 7067, -2222, 4297, -611, 305, 3986, -902, 11234, -1816,
+        8715, -1364, -2623, 3147, -1316, 8134, 1765, 8284, 3376, 958, 7973, 6217,
+        9684, -2872, 6036, 4750, -412, 6603, 4847, 11054, 1765, 8284, 3376, 958,
+        7973, 6217, 18857, 5403, 10595, 4355, 4990, 10284, 6425, 11918, 1765, 8284,
+        7207, -9503, 7973, 6217, 11054, 1765, 8284, 3376, 4292, 7973, 3085, 16023,
+        2973, 13504, 3425, 2166, 7936, 3473, 5422, -947, 5572, 664, -1754, 5261,
+        3505, 6972, -5584, 3324, 2038, -3124, 3891, 2135, 8342, -947, 5572, 664,
+        -1754, 5261, 3505, 16461, 3007, 8199, 936, 2594, 7888, 4029, 9206, -947,
+        5572, 4495, -12215, 5261, 3505, 10443, 1154, 7673, 2765, 3681, 6208, 2474,
+        16149, 1011, 11542, 1463, 204, 5974, 1511, 6951, 6173, 12692, 7784, 5366,
+        12381, 10625, 5898, -6658, 2250, 964, -4198, 2817, 1987, 4056, -5233, 313,
+        -3622, -6040, 975, -781, 12412, -1042, 4150, -4739, -1455, 3839, -20, 8132,
+        -2021, 4498, 3421, -13289, 4187, 2431, 7268, -2021, 4498, -410, 506, 4187,
+        -701, 9560, -3490, 7041, -3038, -6333, 1473, -2724, 4521, -1848, 4671, -237,
+        -2655, 4360, 2604, 6071, -9248, 2423, 1137, -4025, 2990, 2160, 4229, -5060,
+        486, -3449, -5867, 1148, -608, 14417, 963, 6155, -85, 550, 5844, 1985,
+        8305, -1848, 4671, 3594, -12936, 4360, 2604, 7441, -1848, 4671, -237, 679,
+        4360, -528, 11202, -1848, 8683, -1396, -4691, 3115, -1082, 9477, 3108, 9627,
+        4719, 2301, 9316, 7560, 11027, -1529, 7379, 6093, 931, 7946, 7116, 9185,
+        -104, 5442, 1507, -911, 6104, 4348, 19373, 5919, 11111, 4871, 5506, 10800,
+        6941, 13261, 3108, 9627, 8550, -8160, 9316, 7560, 12397, 3108, 9627, 4719,
+        5635, 9316, 4428, 16607, 3557, 14088, 4009, 714, 8520, 4323, 4224, -2145,
+        4374, -534, -2952, 4063, 2307, 5774, -6782, 2126, 840, -4322, 2693, 1863,
+        3932, -5357, 189, -3746, -6164, 851, -905, 15018, 1564, 6756, -4524, 1151,
+        6445, 3212, 8008, -2145, 4374, 3297, -13413, 4063, 2307, 8030, -1259, 5260,
+        352, 1268, 4949, 61, 10905, -2145, 8386, -4151, -4988, 2818, -845, 1460,
+        -4909, 1610, -3298, -5716, 1299, -457, 5252, -7304, 1604, 318, -13543, 2171,
+        1341, 3410, -5879, -333, -4268, -6686, 329, -1427, 12805, -649, 4543, -1697,
+        -1062, 4232, 373, 7486, -2667, 3852, 2775, -13935, 3541, 2488, 6622, -2667,
+        3852, -1056, -140, 3541, -1347, 12587, -463, 10068, -11, -3306, 4500, 303,
+        7689, 1320, 7839, 2931, 513, 7528, 5772, 9239, -3317, 5591, 4305, -857,
+        6158, 5328, 7397, -1892, 3654, -281, -2699, 4316, 2560, 17585, 4131, 9323,
+        3083, 3718, 9012, 5153, 11473, 1320, 7839, 6762, -9948, 7528, 5772, 10609,
+        1320, 7839, 2931, 3847, 7528, 2640, 13176, 126, 10657, 578, -2717, 5089,
+        892, 4977, -1392, 5127, 219, -2199, 4816, 3060, 6527, -6029, 2879, 1593,
+        -3569, 3446, 2616, 4685, -4604, 942, -2993, -5411, 1604, -152, 14873, 1419,
+        6611, -652, 1006, 6300, 868, 8761, -1392, 5127, 4050, -12660, 4816, 3060,
+        9857, 568, 7087, 2179, 3095, 5622, 1888, 17891, 2273, 12804, 5171, -570,
+        7236, 2745, 8848, 8070, 14589, 9681, 7263, 14278, 12522, 6887, -5669, 3239,
+        1953, -3209, 3806, 2976, 5045, -4244, 1302, -2633, -5051, 1964, 208, 15233,
+        1779, 6971, -1918, 1366, 6660, 2801, 9121, -1032, 5487, 4410, -12300, 5176,
+        3420, 8257, -1032, 5487, 579, 1495, 5176, 288, 10549, -2501, 8030, -2049,
+        -5344, 2462, -1735, 5510, -859, 5660, 752, -1666, 5349, 3593, 8153, -7166,
+        4505, 3219, -1943, 5072, 4242, 5218, -4071, 1475, -2460, -4878, 2137, 381,
+        15406, 1952, 7144, 904, 1539, 6833, 2974, 9294, -859, 5660, 4583, -11947,
+        5349, 3593, 8430, -859, 5660, 752, 1668, 5349, 461, 12191, -859, 9672,
+        -407, -3702, 4104, -93, 10466, 4097, 10616, 5708, 3290, 10305, 8549, 12016,
+        -540, 8368, 7082, 1920, 8935, 8105, 10174, 885, 6431, 2496, 78, 7093,
+        5337, 20362, 6908, 12100, 5860, 6495, 11789, 7930, 14250, 4097, 10616, 9539,
+        -7171, 10305, 8549, 13386, 4097, 10616, 5708, 6624, 10305, 5417, 17596, 4546,
+        15077, 4998, 1703, 9509, 5312, 5213, -1156, 5363, 455, -1963, 5052, 3296,
+        6763, -5793, 3115, 1829, -3333, 3682, 2852, 4921, -4368, 1178, -2757, -5175,
+        1840, 84, 16692, 3238, 8430, -2850, 2825, 8119, 4886, 8997, -1156, 5363,
+        4286, -12424, 5052, 3296, 9019, -270, 6249, 1341, 2257, 5938, 1050, 11894,
+        -1156, 9375, -3162, -3999, 3807, 144, 2449, -3920, 2599, -2309, -4727, 2288,
+        532, 6241, -6315, 2593, 1307, -12554, 3160, 2330, 4399, -4890, 656, -3279,
+        -5697, 1318, -438, 13794, 340, 5532, -708, -73, 5221, 1362, 8475, -1678,
+        4841, 3764, -12946, 4530, 3477, 7611, -1678, 4841, -67, 849, 4530, -358,
+        13576, 526, 11057, 978, -2317, 5489, 1292, 8678, 2309, 8828, 3920, 1502,
+        8517, 6761, 10228, -2328, 6580, 5294, 132, 7147, 6317, 8386, -903, 4643,
+        708, -1710, 5305, 3549, 18574, 5120, 10312, 4072, 4707, 10001, 6142, 12462,
+        2309, 8828, 7751, -8959, 8517, 6761, 11598, 2309, 8828, 3920, 4836, 8517,
+        3629, 14165, 1115, 11646, 1567, -1728, 6078, 1881, 5966, -403, 6116, 1208,
+        -1210, 5805, 4049, 7516, -5040, 3868, 2582, -2580, 4435, 3605, 5674, -3615,
+        1931, -2004, -4422, 2593, 837, 15862, 2408, 7600, 337, 1995, 7289, 1857,
+        9750, -403, 6116, 5039, -11671, 5805, 4049, 10846, 1557, 8076, 3168, 4084,
+        6611, 2877, 18545, 2927, 13458, 5825, 84, 7890, 3399, 8364, 7586, 14105,
+        9197, 6779, 13794, 12038, 6403, -6153, 2755, 1469, -3693, 3322, 2492, 4561,
+        -4728, 818, -3117, -5535, 1480, -276, 14749, 1295, 6487, -2402, 882, 6176,
+        2317, 8637, -1516, 5003, 3926, -12784, 4692, 2936, 7773, -1516, 5003, 95,
+        1011, 4692, -196, 10065, -2985, 7546, -2533, -5828, 1978, -2219, 5026, -1343,
+        5176, 268, -2150, 4865, 3109, 6576, -8743, 2928, 1642, -3520, 3495, 2665,
+        4734, -4555, 991, -2944, -5362, 1653, -103, 14922, 1468, 6660, 420, 1055,
+        6349, 2490, 8810, -1343, 5176, 4099, -12431, 4865, 3109, 7946, -1343, 5176,
+        268, 1184, 4865, -23, 11707, -1343, 9188, -891, -4186, 3620, -577, 9982,
+        3613, 10132, 5224, 2806, 9821, 8065, 11532, -1024, 7884, 6598, 1436, 8451,
+        7621, 9690, 401, 5947, 2012, -406, 6609, 4853, 19878, 6424, 11616, 5376,
+        6011, 11305, 7446, 13766, 3613, 10132, 9055, -7655, 9821, 8065, 12902, 3613,
+        10132, 5224, 6140, 9821, 4933, 17112, 4062, 14593, 4514, 1219, 9025, 4828,
+        4729, -1640, 4879, -29, -2447, 4568, 2812, 6279, -6277, 2631, 1345, -3817,
+        3198, 2368, 4437, -4852, 694, -3241, -5659, 1356, -400, 16208, 2754, 7946,
+        -3334, 2341, 7635, 4402, 8513, -1640, 4879, 3802, -12908, 4568, 2812, 8535,
+        -754, 5765, 857, 1773, 5454, 566, 11410, -1640, 8891, -3646, -4483, 3323,
+        -340, 1965, -4404, 2115, -2793, -5211, 1804, 48, 5757, -6799, 2109, 823,
+        -13038, 2676, 1846, 3915, -5374, 172, -3763, -6181, 834, -922, 13310, -144,
+        5048, -1192, -557, 4737, 878, 7991, -2162, 4357, 3280, -13430, 4046, 2993,
+        7127, -2162, 4357, -551, 365, 4046, -842, 13092, 42, 10573, 494, -2801,
+        5005, 808, 8194, 1825, 8344, 3436, 1018, 8033, 6277, 9744, -2812, 6096,
+        4810, -352, 6663, 5833, 7902, -1387, 4159, 224, -2194, 4821, 3065, 18090,
+        4636, 9828, 3588, 4223, 9517, 5658, 11978, 1825, 8344, 7267, -9443, 8033,
+        6277, 11114, 1825, 8344, 3436, 4352, 8033, 3145, 13681, 631, 11162, 1083,
+        -2212, 5594, 1397, 5482, -887, 5632, 724, -1694, 5321, 3565, 7032, -5524,
+        3384, 2098, -3064, 3951, 3121, 5190, -4099, 1447, -2488, -4906, 2109, 353,
+        15378, 1924, 7116, -147, 1511, 6805, 1373, 9266, -887, 5632, 4555, -12155,
+        5321, 3565, 10362, 1073, 7592, 2684, 3600, 6127, 2393, 17317, 1699, 12230,
+        4597, -1144, 6662, 2171, 8364, 7586, 14105, 9197, 6779, 13794, 12038, 6403,
+        -6153, 2755, 1469, -3693, 3322, 2492, 4561, -4728, 818, -3117, -5535, 1480,
+        -276, 13734, 280, 5472, -3417, -133, 5161, 1302, 8637, -1516, 5003, 3926,
+        -12784, 4692, 2936, 8240, -1049, 5470, 562, 1478, 5159, 271, 9923, -3127,
+        7404, -2675, -5970, 1836, -2361, 5026, -1343, 5176, 268, -2150, 4865, 3109,
+        6576, -8743, 2928, 1642, -3520, 3495, 2665, 4734, -4555, 991, -2944, -5362,
+        1653, -103, 14922, 1468, 6660, 420, 1055, 6349, 2490, 8810, -1343, 5176,
+        4099, -12431, 4865, 3109, 7946, -1343, 5176, 268, 1184, 4865, -23, 11707,
+        -1343, 9188, -891, -4186, 3620, -577, 9982, 3613, 10132, 5224, 2806, 9821,
+        8065, 11532, -1024, 7884, 6598, 1436, 8451, 7621, 9690, 401, 5947, 2012,
+        -406, 6609, 4853, 19878, 6424, 11616, 5376, 6011, 11305, 7446, 13766, 3613,
+        10132, 9055, -7655, 9821, 8065, 12902, 3613, 10132, 5224, 6140, 9821, 4933,
+        17112, 4062, 14593, 4514, 1219, 9025, 4828, 4729, -1640, 4879, -29, -2447,
+        4568, 2812, 6279, -6277, 2631, 1345, -3817, 3198, 2368, 4437, -4852, 694,
+        -3241, -5659, 1356, -400, 17803, 4349, 9541, -1739, 3936, 9230, 5997, 8513,
+        -1640, 4879, 3802, -12908, 4568, 2812, 8535, -754, 5765, 857, 1773, 5454,
+        566, 12754, -296, 10235, -2302, -3139, 4667, 1004, 1965, -4404, 2115, -2793,
+        -5211, 1804, 48, 5757, -6799, 2109, 823, -13038, 2676, 1846, 3915, -5374,
+        172, -3763, -6181, 834, -922, 13310, -144, 5048, -1192, -557, 4737, 878,
+        7991, -2162, 4357, 3280, -13430, 4046, 2993, 7127, -2162, 4357, -551, 365,
+        4046, -842, 13092, 42, 10573, 494, -2801, 5005, 808, 8194, 1825, 8344,
+        3436, 1018, 8033, 6277, 9744, -2812, 6096, 4810, -352, 6663, 5833, 7902,
+        -1387, 4159, 224, -2194, 4821, 3065, 18090, 4636, 9828, 3588, 4223, 9517,
+        5658, 11978, 1825, 8344, 7267, -9443, 8033, 6277, 11114, 1825, 8344, 3436,
+        4352, 8033, 3145, 13681, 631, 11162, 1083, -2212, 5594, 1397, 5482, -887,
+        5632, 724, -1694, 5321, 3565, 7032, -5524, 3384, 2098, -3064, 3951, 3121,
+        5190, -4099, 1447, -2488, -4906, 2109, 353, 16547, 3093, 8285, 1022, 2680,
+        7974, 2542, 9266, -887, 5632, 4555, -12155, 5321, 3565, 10362, 1073, 7592,
+        2684, 3600, 6127, 2393, 18744, 3126, 13657, 6024, 283, 8089, 3598, 8457,
+        7679, 14198, 9290, 6872, 13887, 12131, 6496, -6060, 2848, 1562, -3600, 3415,
+        2585, 4654, -4635, 911, -3024, -5442, 1573, -183, 14842, 1388, 6580, -2309,
+        975, 6269, 2410, 8730, -1423, 5096, 4019, -12691, 4785, 3029, 7866, -1423,
+        5096, 188, 1104, 4785, -103, 10158, -2892, 7639, -2440, -5735, 2071, -2126,
+        5119, -1250, 5269, 361, -2057, 4958, 3202, 6669, -8650, 3021, 1735, -3427,
+        3588, 2758, 4827, -4462, 1084, -2851, -5269, 1746, -10, 15015, 1561, 6753,
+        513, 1148, 6442, 2583, 11695, 1542, 8061, 6984, -9546, 7750, 5994, 8039,
+        -1250, 5269, 361, 1277, 4958, 70, 11800, -1250, 9281, -798, -4093, 3713,
+        -484, 10075, 3706, 10225, 5317, 2899, 9914, 8158, 11625, -931, 7977, 6691,
+        1529, 8544, 7714, 9783, 494, 6040, 2105, -313, 6702, 4946, 19971, 6517,
+        11709, 5469, 6104, 11398, 7539, 13859, 3706, 10225, 9148, -7562, 9914, 8158,
+        12995, 3706, 10225, 5317, 6233, 9914, 5026, 17205, 4155, 14686, 4607, 1312,
+        9118, 4921, 4822, -1547, 4972, 64, -2354, 4661, 2905, 6372, -6184, 2724,
+        1438, -3724, 3291, 2461, 4530, -4759, 787, -3148, -5566, 1449, -307, 16301,
+        2847, 8039, -3241, 2434, 7728, 4495, 8606, -1547, 4972, 3895, -12815, 4661,
+        2905, 8628, -661, 5858, 950, 1866, 5547, 659, 11503, -1547, 8984, -3553,
+        -4390, 3416, -247, 2058, -4311, 2208, -2700, -5118, 1897, 141, 6529, -6027,
+        2881, 1595, -12266, 3448, 2618, 4008, -5281, 265, -3670, -6088, 927, -829,
+        13403, -51, 5141, -1099, -464, 4830, 971, 8084, -2069, 4450, 3373, -13337,
+        4139, 3086, 7220, -2069, 4450, -458, 458, 4139, -749, 13185, 135, 10666,
+        587, -2708, 5098, 901, 8287, 1918, 8437, 3529, 1111, 8126, 6370, 9837,
+        -2719, 6189, 4903, -259, 6756, 5926, 7995, -1294, 4252, 317, -2101, 4914,
+        3158, 18183, 4729, 9921, 3681, 4316, 9610, 5751, 12071, 1918, 8437, 7360,
+        -9350, 8126, 6370, 11207, 1918, 8437, 3529, 4445, 8126, 3238, 13774, 724,
+        11255, 1176, -2119, 5687, 1490, 5575, -794, 5725, 817, -1601, 5414, 3658,
+        7125, -5431, 3477, 2191, -2971, 4044, 3214, 5283, -4006, 1540, -2395, -4813,
+        2202, 446, 15471, 2017, 7209, -54, 1604, 6898, 1466, 9359, -794, 5725,
+        4648, -12062, 5414, 3658, 10455, 1166, 7685, 2777, 3693, 6220, 2486, 18741,
+        3123, 13654, 6021, 280, 8086, 3595, 9009, 8231, 14750, 9842, 7424, 14439,
+        12683, 7048, -5508, 3400, 2114, -3048, 3967, 3137, 5206, -4083, 1463, -2472,
+        -4890, 2125, 369, 15394, 1940, 7132, -1757, 1527, 6821, 2962, 9282, -871,
+        5648, 4571, -12139, 5337, 3581, 8418, -871, 5648, 740, 1656, 5337, 449,
+        10710, -2340, 8191, -1888, -5183, 2623, -1574, 5671, -698, 5821, 913, -1505,
+        5510, 3754, 7221, -8098, 3573, 2287, -2875, 4140, 3310, 5379, -3910, 1636,
+        -2299, -4717, 2298, 542, 15567, 2113, 7305, 1065, 1700, 6994, 3135, 9455,
+        -698, 5821, 4744, -11786, 5510, 3754, 8591, -698, 5821, 913, 1829, 5510,
+        622, 12352, -698, 9833, -246, -3541, 4265, 68, 10627, 4258, 10777, 5869,
+        3451, 10466, 8710, 12177, -379, 8529, 7243, 2081, 9096, 8266, 10335, 1046,
+        6592, 2657, 239, 7254, 5498, 20523, 7069, 12261, 6021, 6656, 11950, 8091,
+        14411, 4258, 10777, 9700, -7010, 10466, 8710, 13547, 4258, 10777, 5869, 6785,
+        10466, 5578, 17757, 4707, 15238, 5159, 1864, 9670, 5473, 5374, -995, 5524,
+        616, -1802, 5213, 3457, 6924, -5632, 3276, 1990, -3172, 3843, 3013, 5082,
+        -4207, 1339, -2596, -5014, 2001, 245, 16853, 3399, 8591, -2689, 2986, 8280,
+        5047, 9158, -995, 5524, 4447, -12263, 5213, 3457, 9180, -109, 6410, 1502,
+        2418, 6099, 1211, 12055, -995, 9536, -3001, -3838, 3968, 305, 2610, -3759,
+        2760, -2148, -4566, 2449, 693, 6402, -6154, 2754, 1468, -12393, 3321, 2491,
+        4560, -4729, 817, -3118, -5536, 1479, -277, 13955, 501, 5693, -547, 88,
+        5382, 1523, 8636, -1517, 5002, 3925, -12785, 4691, 3638, 7772, -1517, 5002,
+        94, 1010, 4691, -197, 13737, 687, 11218, 1139, -2156, 5650, 1453, 8839,
+        2470, 8989, 4081, 1663, 8678, 6922, 10389, -2167, 6741, 5455, 293, 7308,
+        6478, 8547, -742, 4804, 869, -1549, 5466, 3710, 18735, 5281, 10473, 4233,
+        4868, 10162, 6303, 12623, 2470, 8989, 7912, -8798, 8678, 6922, 11759, 2470,
+        8989, 4081, 4997, 8678, 3790, 14513, 1463, 11994, 1915, -1380, 6426, 2229,
+        6127, -242, 6277, 1369, -1049, 5966, 4210, 7677, -4879, 4029, 2743, -2419,
+        4596, 3766, 5835, -3454, 2092, -1843, -4261, 2754, 998, 16023, 2569, 7761,
+        498, 2156, 7450, 2018, 9911, -242, 6277, 5200, -11510, 5966, 4210, 11007,
+        1718, 8237, 3329, 4245, 6772, 3038, 18706, 3088, 13619, 5986, 245, 8051,
+        3560, 8364, 7586, 14105, 9197, 6779, 13794, 12038, 6403, -6153, 2755, 1469,
+        -3693, 3322, 2492, 4561, -4728, 818, -3117, -5535, 1480, -276, 14749, 1295,
+        6487, -2402, 882, 6176, 2317, 8637, -1516, 5003, 3926, -12784, 4692, 2936,
+        7442, -1847, 4672, -236, 680, 4361, -527, 9675, -3375, 7156, -2923, -6218,
+        1588, -2609, 5026, -1343, 5176, 268, -2150, 4865, 3109, 6576, -8743, 2928,
+        1642, -3520, 3495, 2665, 4734, -4555, 991, -2944, -5362, 1653, -103, 14922,
+        1468, 6660, 420, 1055, 6349, 2490, 8810, -1343, 5176, 4099, -12431, 4865,
+        3109, 7946, -1343, 5176, 268, 1184, 4865, -23, 11707, -1343, 9188, -891,
+        -4186, 3620, -577, 9982, 3613, 10132, 5224, 2806, 9821, 8065, 11532, -1024,
+        7884, 6598, 1436, 8451, 7621, 9690, 401, 5947, 2012, -406, 6609, 4853,
+        19878, 6424, 11616, 5376, 6011, 11305, 7446, 13766, 3613, 10132, 9055, -7655,
+        9821, 8065, 12902, 3613, 10132, 5224, 6140, 9821, 4933, 17112, 4062, 14593,
+        4514, 1219, 9025, 4828, 4729, -1640, 4879, -29, -2447, 4568, 2812, 6279,
+        -6277, 2631, 1345, -3817, 3198, 2368, 4437, -4852, 694, -3241, -5659, 1356,
+        -400, 18203, 4749, 9941, -1339, 4336, 9630, 6397, 8513, -1640, 4879, 3802,
+        -12908, 4568, 2812, 8535, -754, 5765, 857, 1773, 5454, 566, 11278, -1772,
+        8759, -3778, -4615, 3191, -472, 1965, -4404, 2115, -2793, -5211, 1804, 48,
+        5757, -6799, 2109, 823, -13038, 2676, 1846, 3915, -5374, 172, -3763, -6181,
+        834, -922, 13310, -144, 5048, -1192, -557, 4737, 878, 7991, -2162, 4357,
+        3280, -13430, 4046, 2993, 7127, -2162, 4357, -551, 365, 4046, -842, 13092,
+        42, 10573, 494, -2801, 5005, 808, 8194, 1825, 8344, 3436, 1018, 8033,
+        6277, 9744, -2812, 6096, 4810, -352, 6663, 5833, 7902, -1387, 4159, 224,
+        -2194, 4821, 3065, 18090, 4636, 9828, 3588, 4223, 9517, 5658, 11978, 1825,
+        8344, 7267, -9443, 8033, 6277, 11114, 1825, 8344, 3436, 4352, 8033, 3145,
+        14162, 1112, 11643, 1564, -1731, 6075, 1878, 5482, -887, 5632, 724, -1694,
+        5321, 3565, 7032, -5524, 3384, 2098, -3064, 3951, 3121, 5190, -4099, 1447,
+        -2488, -4906, 2109, 353, 17423, 3969, 9161, 1898, 3556, 8850, 3418, 9266,
+        -887, 5632, 4555, -12155, 5321, 3565, 10942, 1653, 8172, 3264, 4180, 6707,
+        2973, 19209, 3591, 14122, 6489, 748, 8554, 4063, -2254, 9364, 15883, 10975,
+        8557, 15572, 13816, 5548, -7008, 1900, 614, -4548, 2467, 711, 13824, 4535,
+        11054, 6146, 3728, 10743, 8987, 15281, 1827, 7019, -6524, 2762, 6708, 6610,
+        1063, -9090, -2571, -3648, -22164, -2882, -4638, 10557, 1268, 7787, -506, 3795,
+        7476, 2588, 10506, -2544, 7987, -2092, -3351, 2419, -5939, 7015, 13042, 19561,
+        14653, 12235, 19250, 17494, 5721, -6835, 2073, 787, -4375, 2640, 884, 13997,
+        4708, 11227, 6319, 3901, 10916, 9160, 17286, 3832, 9024, -1870, 4767, 8713,
+        8615, 1236, -8917, -2398, -3475, -21991, -2709, -4465, 10730, 1441, 7960, -333,
+        3968, 7649, 2761, 11373, -1677, 8854, -1225, -2484, 3286, -5072, 11971, 17998,
+        24517, 19609, 17191, 24206, 22450, 10677, -1879, 7029, 5743, 581, 7596, 5840,
+        19951, 10662, 17181, 12273, 9855, 16870, 15114, 22242, 8788, 13980, 3086, 9723,
+        13669, 13571, 6192, -3961, 2558, 1481, -17035, 2247, 491, 15686, 6397, 12916,
+        4623, 8924, 12605, 7717, 16778, 3728, 14259, 4180, 2921, 8691, 333, 6718,
+        12745, 19264, 14356, 11938, 18953, 17197, 5424, -7132, 1776, 490, -4672, 2343,
+        587, 13700, 4411, 10930, 6022, 3604, 10619, 8863, 17993, 4539, 9731, -4377,
+        5474, 9420, 8715, 939, -9214, -2695, -3772, -22288, -3006, -4762, 11319, 2030,
+        8549, 256, 4557, 8238, 3350, 11076, -1974, 8557, -3487, -2781, 2989, -6770,
+        6196, 12223, 18742, 13834, 11416, 18431, 16675, 4902, -7654, 1254, -32, -5737,
+        1821, 65, 13178, 3889, 10408, 5500, 3082, 10097, 8341, 16886, 3432, 8624,
+        -2270, 4367, 8313, 8215, 417, -9736, -3217, -4294, -22810, -3528, -4581, 9911,
+        622, 7141, -1152, 3149, 6830, 1942, 10960, -2090, 8441, -1638, -2897, 2873,
+        -5485, 10183, 16210, 22729, 17821, 15403, 22418, 20662, 8889, -3667, 5241, 3955,
+        -1207, 5808, 4052, 17165, 7876, 14395, 9487, 7069, 14084, 12328, 20454, 7000,
+        12192, 1298, 7935, 11881, 11783, 4404, -5749, 770, -307, -18823, 459, -1297,
+        22233, 12944, 19463, 11170, 15471, 19152, 14264, 17306, 4256, 14787, 4708, 3449,
+        9219, 861, 7471, 13498, 20017, 15109, 12691, 19706, 17950, 6177, -6379, 2529,
+        1243, -3919, 3096, 1340, 14453, 5164, 11683, 6775, 4357, 11372, 9616, 20406,
+        6952, 12144, -739, 7887, 11833, 11735, 1692, -8461, -1942, -3019, -21535, -2253,
+        -4009, 12707, 3418, 9937, 1644, 5945, 8472, 4738, 14506, -632, 9899, -180,
+        -1439, 727, -4748, -357, 11261, 17780, 12872, 10454, 17469, 15713, 6537, -6019,
+        2889, 1603, -3559, 3456, 1700, 14813, 5524, 12043, 7135, 4717, 11732, 9976,
+        18102, 4648, 9840, -3703, 5583, 9529, 9431, 2052, -8101, -1582, -2659, -21175,
+        -1893, -3649, 11546, 2257, 8776, 483, 4784, 8465, 3577, 11495, -1555, 8976,
+        -1103, -2362, 3408, -4950, 8004, 14031, 20550, 15642, 13224, 20239, 18483, 7803,
+        -4753, 4155, 2869, -2293, 4722, 2966, 14986, 5697, 12216, 7308, 4890, 11905,
+        10149, 18275, 4821, 10013, -881, 5756, 9702, 9604, 2225, -7928, -1409, -2486,
+        -21002, -1720, -3476, 11719, 2430, 8949, 656, 4957, 8638, 3750, 12362, -688,
+        9843, -236, -1495, 4275, -4083, 12960, 18987, 25506, 20598, 18180, 25195, 23439,
+        11666, -890, 8018, 6732, 1570, 8585, 6829, 20940, 11651, 18170, 13262, 10844,
+        17859, 16103, 23231, 9777, 14969, 4075, 10712, 14658, 14560, 7181, -2972, 3547,
+        2470, -16046, 3236, 1480, 16675, 7386, 13905, 5612, 9913, 13594, 8706, 17767,
+        4717, 15248, 5169, 3910, 9680, 1322, 7707, 13734, 20253, 15345, 12927, 19942,
+        18186, 6413, -6143, 2765, 1479, -3683, 3332, 1576, 14689, 5400, 11919, 7011,
+        4593, 11608, 9852, 18982, 5528, 10720, -3388, 6463, 10409, 9704, 1928, -8225,
+        -1706, -2783, -21299, -2017, -3773, 12308, 3019, 9538, 1245, 5546, 9227, 4339,
+        12065, -985, 9546, -2498, -1792, 3978, -5781, 7185, 13212, 19731, 14823, 12405,
+        19420, 17664, 5891, -6665, 2243, 957, -4748, 2810, 1054, 14167, 4878, 11397,
+        6489, 4071, 11086, 9330, 17875, 4421, 9613, -1281, 5356, 9302, 9204, 1406,
+        -8747, -2228, -3305, -21821, -2539, -3592, 10900, 1611, 8130, -163, 4138, 7819,
+        2931, 11949, -1101, 9430, -649, -1908, 3862, -4496, 11172, 17199, 23718, 18810,
+        16392, 23407, 21651, 9878, -2678, 6230, 4944, -218, 6797, 5041, 18154, 8865,
+        15384, 10476, 8058, 15073, 13317, 21443, 7989, 13181, 2287, 8924, 12870, 12772,
+        5393, -4760, 1759, 682, -17834, 1448, -308, 23222, 13933, 20452, 12159, 16460,
+        20141, 15253, 17675, 4625, 15156, 5077, 3818, 9588, 1230, 8460, 14487, 21006,
+        16098, 13680, 20695, 18939, 7166, -5390, 3518, 2232, -2930, 4085, 2329, 15442,
+        6153, 12672, 7764, 5346, 12361, 10605, 21395, 7941, 13133, 250, 8876, 12822,
+        12724, 2681, -7472, -953, -2030, -20546, -1264, -3020, 13696, 4407, 10926, 2633,
+        6934, 9461, 5727, 15270, 132, 10663, 584, -675, 1491, -3984, -841, 10777,
+        17296, 12388, 9970, 16985, 15229, 6053, -6503, 2405, 1119, -4043, 2972, 1216,
+        14329, 5040, 11559, 6651, 4233, 11248, 9492, 17618, 4164, 9356, -4187, 5099,
+        9045, 8947, 1568, -8585, -2066, -3143, -21659, -2377, -4133, 11062, 1773, 8292,
+        -1, 4300, 7981, 3093, 11011, -2039, 8492, -1587, -2846, 2924, -5434, 7520,
+        13547, 20066, 15158, 12740, 19755, 17999, 6226, -6330, 2578, 1292, -3870, 3145,
+        1389, 14502, 5213, 11732, 6824, 4406, 11421, 9665, 17791, 4337, 9529, -1365,
+        5272, 9218, 9120, 1741, -8412, -1893, -2970, -21486, -2204, -3960, 11235, 1946,
+        8465, 172, 4473, 8154, 3266, 11878, -1172, 9359, -720, -1979, 3791, -4567,
+        12476, 18503, 25022, 20114, 17696, 24711, 22955, 11182, -1374, 7534, 6248, 1086,
+        8101, 6345, 20456, 11167, 17686, 12778, 10360, 17375, 15619, 22747, 9293, 14485,
+        3591, 10228, 14174, 14076, 6697, -3456, 3063, 1986, -16530, 2752, 996, 16191,
+        6902, 13421, 5128, 9429, 13110, 8222, 17283, 4233, 14764, 4685, 3426, 9196,
+        838, 7223, 13250, 19769, 14861, 12443, 19458, 17702, 5929, -6627, 2281, 995,
+        -4167, 2848, 1092, 14205, 4916, 11435, 6527, 4109, 11124, 9368, 18498, 5044,
+        10236, -3872, 5979, 9925, 9220, 1444, -8709, -2190, -3267, -21783, -2501, -4257,
+        11824, 2535, 9054, 761, 5062, 8743, 3855, 11581, -1469, 9062, -2982, -2276,
+        3494, -6265, 6701, 12728, 19247, 14339, 11921, 18936, 17180, 5407, -7149, 1759,
+        473, -5232, 2326, 570, 13683, 4394, 10913, 6005, 3587, 10602, 8846, 17391,
+        3937, 9129, -1765, 4872, 8818, 8720, 922, -9231, -2712, -3789, -22305, -3023,
+        -4076, 10416, 1127, 7646, -647, 3654, 7335, 2447, 11465, -1585, 8946, -1133,
+        -2392, 3378, -4980, 10688, 16715, 23234, 18326, 15908, 22923, 21167, 9394, -3162,
+        5746, 4460, -702, 6313, 4557, 17670, 8381, 14900, 9992, 7574, 14589, 12833,
+        20959, 7505, 12697, 1803, 8440, 12386, 12288, 4909, -5244, 1275, 198, -18318,
+        964, -792, 22738, 13449, 19968, 11675, 15976, 19657, 14769, 17191, 4141, 14672,
+        4593, 3334, 9104, 746, 7976, 14003, 20522, 15614, 13196, 20211, 18455, 6682,
+        -5874, 3034, 1748, -3414, 3601, 1845, 14958, 5669, 12188, 7280, 4862, 11877,
+        10121, 20911, 7457, 12649, -234, 8392, 12338, 12240, 2197, -7956, -1437, -2514,
+        -21030, -1748, -3504, 13212, 3923, 10442, 2149, 6450, 8977, 5243, 14042, -1096,
+        9435, -644, -1903, 263, -5212, -841, 10777, 17296, 12388, 9970, 16985, 15229,
+        6053, -6503, 2405, 1119, -4043, 2972, 1216, 14329, 5040, 11559, 6651, 4233,
+        11248, 9492, 16603, 3149, 8341, -5202, 4084, 8030, 7932, 1568, -8585, -2066,
+        -3143, -21659, -2377, -4133, 11529, 2240, 8759, 466, 4767, 8448, 3560, 10869,
+        -2181, 8350, -1729, -2988, 2782, -5576, 7520, 13547, 20066, 15158, 12740, 19755,
+        17999, 6226, -6330, 2578, 1292, -3870, 3145, 1389, 14502, 5213, 11732, 6824,
+        4406, 11421, 9665, 17791, 4337, 9529, -1365, 5272, 9218, 9120, 1741, -8412,
+        -1893, -2970, -21486, -2204, -3960, 11235, 1946, 8465, 172, 4473, 8154, 3266,
+        11878, -1172, 9359, -720, -1979, 3791, -4567, 12476, 18503, 25022, 20114, 17696,
+        24711, 22955, 11182, -1374, 7534, 6248, 1086, 8101, 6345, 20456, 11167, 17686,
+        12778, 10360, 17375, 15619, 22747, 9293, 14485, 3591, 10228, 14174, 14076, 6697,
+        -3456, 3063, 1986, -16530, 2752, 996, 16191, 6902, 13421, 5128, 9429, 13110,
+        8222, 17283, 4233, 14764, 4685, 3426, 9196, 838, 7223, 13250, 19769, 14861,
+        12443, 19458, 17702, 5929, -6627, 2281, 995, -4167, 2848, 1092, 14205, 4916,
+        11435, 6527, 4109, 11124, 9368, 19988, 6534, 11726, -2382, 7469, 11415, 10710,
+        1444, -8709, -2190, -3267, -21783, -2501, -4257, 11824, 2535, 9054, 761, 5062,
+        8743, 3855, 11465, -1585, 8946, -3098, -2392, 3378, -6381, 6701, 12728, 19247,
+        14339, 11921, 18936, 17180, 5407, -7149, 1759, 473, -5232, 2326, 570, 13683,
+        4394, 10913, 6005, 3587, 10602, 8846, 17391, 3937, 9129, -1765, 4872, 8818,
+        8720, 922, -9231, -2712, -3789, -22305, -3023, -4076, 10416, 1127, 7646, -647,
+        3654, 7335, 2447, 11465, -1585, 8946, -1133, -2392, 3378, -4980, 10688, 16715,
+        23234, 18326, 15908, 22923, 21167, 9394, -3162, 5746, 4460, -702, 6313, 4557,
+        17670, 8381, 14900, 9992, 7574, 14589, 12833, 20959, 7505, 12697, 1803, 8440,
+        12386, 12288, 4909, -5244, 1275, 198, -18318, 964, -792, 22738, 13449, 19968,
+        11675, 15976, 19657, 14769, 17191, 4141, 14672, 4593, 3334, 9104, 746, 7976,
+        14003, 20522, 15614, 13196, 20211, 18455, 6682, -5874, 3034, 1748, -3414, 3601,
+        1845, 14958, 5669, 12188, 7280, 4862, 11877, 10121, 22080, 8626, 13818, 935,
+        9561, 13507, 13409, 2197, -7956, -1437, -2514, -21030, -1748, -3504, 13212, 3923,
+        10442, 2149, 6450, 8977, 5243, 14846, -292, 10239, 160, -1099, 1067, -4408,
+        -748, 10870, 17389, 12481, 10063, 17078, 15322, 6146, -6410, 2498, 1212, -3950,
+        3065, 1309, 14422, 5133, 11652, 6744, 4326, 11341, 9585, 17711, 4257, 9449,
+        -4094, 5192, 9138, 9040, 1661, -8492, -1973, -3050, -21566, -2284, -4040, 11155,
+        1866, 8385, 92, 4393, 8074, 3186, 11104, -1946, 8585, -1494, -2753, 3017,
+        -5341, 7613, 13640, 20159, 15251, 12833, 19848, 18092, 6319, -6237, 2671, 1385,
+        -3777, 3238, 1482, 14595, 5306, 11825, 6917, 4499, 11514, 9758, 17884, 4430,
+        9622, -1272, 5365, 9311, 9213, 1834, -8319, -1800, -2877, -21393, -2111, -3867,
+        11328, 2039, 8558, 265, 4566, 8247, 3359, 11971, -1079, 9452, -627, -1886,
+        3884, -4474, 12569, 18596, 25115, 20207, 17789, 24804, 23048, 11275, -1281, 7627,
+        6341, 1179, 8194, 6438, 20549, 11260, 17779, 12871, 10453, 17468, 15712, 22840,
+        9386, 14578, 3684, 10321, 14267, 14169, 6790, -3363, 3156, 2079, -16437, 2845,
+        1089, 16284, 6995, 13514, 5221, 9522, 13203, 8315, 17376, 4326, 14857, 4778,
+        3519, 9289, 931, 7316, 13343, 19862, 14954, 12536, 19551, 17795, 6022, -6534,
+        2374, 1088, -4074, 2941, 1185, 14298, 5009, 11528, 6620, 4202, 11217, 9461,
+        18591, 5137, 10329, -3779, 6072, 10018, 9313, 1537, -8616, -2097, -3174, -21690,
+        -2408, -4164, 11917, 2628, 9147, 854, 5155, 8836, 3948, 11674, -1376, 9155,
+        -2889, -2183, 3587, -6172, 6794, 12821, 19340, 14432, 12014, 19029, 17273, 5500,
+        -7056, 1852, 566, -5139, 2419, 663, 13776, 4487, 11006, 6098, 3680, 10695,
+        8939, 17484, 4030, 9222, -1672, 4965, 8911, 8813, 1015, -9138, -2619, -3696,
+        -22212, -2930, -3983, 10509, 1220, 7739, -554, 3747, 7428, 2540, 11558, -1492,
+        9039, -1040, -2299, 3471, -4887, 10781, 16808, 23327, 18419, 16001, 23016, 21260,
+        9487, -3069, 5839, 4553, -609, 6406, 4650, 17763, 8474, 14993, 10085, 7667,
+        14682, 12926, 21052, 7598, 12790, 1896, 8533, 12479, 12381, 5002, -5151, 1368,
+        291, -18225, 1057, -699, 22831, 13542, 20061, 11768, 16069, 19750, 14862, 17284,
+        4234, 14765, 4686, 3427, 9197, 839, 8069, 14096, 20615, 15707, 13289, 20304,
+        18548, 6775, -5781, 3127, 1841, -3321, 3694, 1938, 15051, 5762, 12281, 7373,
+        4955, 11970, 10214, 21004, 7550, 12742, -141, 8485, 12431, 12333, 2290, -7863,
+        -1344, -2421, -20937, -1655, -3411, 13305, 4016, 10535, 2242, 6543, 9070, 5336,
+        14879, -259, 10272, 193, -1066, 1100, -4375, -196, 11422, 17941, 13033, 10615,
+        17630, 15874, 6698, -5858, 3050, 1764, -3398, 3617, 1861, 14974, 5685, 12204,
+        7296, 4878, 11893, 10137, 18263, 4809, 10001, -3542, 5744, 9690, 9592, 2213,
+        -7940, -1421, -2498, -21014, -1732, -3488, 11707, 2418, 8937, 644, 4945, 8626,
+        3738, 11656, -1394, 9137, -942, -2201, 3569, -4789, 8165, 14192, 20711, 15803,
+        13385, 20400, 18644, 6871, -5685, 3223, 1937, -3225, 3790, 2034, 15147, 5858,
+        12377, 7469, 5051, 12066, 10310, 18436, 4982, 10174, -720, 5917, 9863, 9765,
+        2386, -7767, -1248, -2325, -20841, -1559, -3315, 11880, 2591, 9110, 817, 5118,
+        8799, 3911, 12523, -527, 10004, -75, -1334, 4436, -3922, 13121, 19148, 25667,
+        20759, 18341, 25356, 23600, 11827, -729, 8179, 6893, 1731, 8746, 6990, 21101,
+        11812, 18331, 13423, 11005, 18020, 16264, 23392, 9938, 15130, 4236, 10873, 14819,
+        14721, 7342, -2811, 3708, 2631, -15885, 3397, 1641, 16836, 7547, 14066, 5773,
+        10074, 13755, 8867, 17928, 4878, 15409, 5330, 4071, 9841, 1483, 7868, 13895,
+        20414, 15506, 13088, 20103, 18347, 6574, -5982, 2926, 1640, -3522, 3493, 1737,
+        14850, 5561, 12080, 7172, 4754, 11769, 10013, 19143, 5689, 10881, -3227, 6624,
+        10570, 9865, 2089, -8064, -1545, -2622, -21138, -1856, -3612, 12469, 3180, 9699,
+        1406, 5707, 9388, 4500, 12226, -824, 9707, -2337, -1631, 4139, -5620, 7346,
+        13373, 19892, 14984, 12566, 19581, 17825, 6052, -6504, 2404, 1118, -4587, 2971,
+        1215, 14328, 5039, 11558, 6650, 4232, 11247, 9491, 18036, 4582, 9774, -1120,
+        5517, 9463, 9365, 1567, -8586, -2067, -3144, -21660, -2378, -3431, 11061, 1772,
+        8291, -2, 4299, 7980, 3092, 12110, -940, 9591, -488, -1747, 4023, -4335,
+        11333, 17360, 23879, 18971, 16553, 23568, 21812, 10039, -2517, 6391, 5105, -57,
+        6958, 5202, 18315, 9026, 15545, 10637, 8219, 15234, 13478, 21604, 8150, 13342,
+        2448, 9085, 13031, 12933, 5554, -4599, 1920, 843, -17673, 1609, -147, 23383,
+        14094, 20613, 12320, 16621, 20302, 15414, 18023, 4973, 15504, 5425, 4166, 9936,
+        1578, 8621, 14648, 21167, 16259, 13841, 20856, 19100, 7327, -5229, 3679, 2393,
+        -2769, 4246, 2490, 15603, 6314, 12833, 7925, 5507, 12522, 10766, 20693, 7239,
+        12431, -452, 8174, 12120, 12022, 2842, -7311, -792, -1869, -20385, -1103, -2859,
+        13393, 4104, 10623, 2330, 6631, 9158, 5424, 15431, 293, 10824, 745, -514,
+        1652, -3823, -841, 10777, 17296, 12388, 9970, 16985, 15229, 6053, -6503, 2405,
+        1119, -4043, 2972, 1216, 14329, 5040, 11559, 6651, 4233, 11248, 9492, 17618,
+        4164, 9356, -4187, 5099, 9045, 8947, 1568, -8585, -2066, -3143, -21659, -2377,
+        -4133, 10731, 1442, 7961, -332, 3969, 7650, 2762, 10621, -2429, 8102, -1977,
+        -3236, 2534, -5824, 7520, 13547, 20066, 15158, 12740, 19755, 17999, 6226, -6330,
+        2578, 1292, -3870, 3145, 1389, 14502, 5213, 11732, 6824, 4406, 11421, 9665,
+        17791, 4337, 9529, -1365, 5272, 9218, 9120, 1741, -8412, -1893, -2970, -21486,
+        -2204, -3960, 11235, 1946, 8465, 172, 4473, 8154, 3266, 11878, -1172, 9359,
+        -720, -1979, 3791, -4567, 12476, 18503, 25022, 20114, 17696, 24711, 22955, 11182,
+        -1374, 7534, 6248, 1086, 8101, 6345, 20456, 11167, 17686, 12778, 10360, 17375,
+        15619, 22747, 9293, 14485, 3591, 10228, 14174, 14076, 6697, -3456, 3063, 1986,
+        -16530, 2752, 996, 16191, 6902, 13421, 5128, 9429, 13110, 8222, 17283, 4233,
+        14764, 4685, 3426, 9196, 838, 7223, 13250, 19769, 14861, 12443, 19458, 17702,
+        5929, -6627, 2281, 995, -4167, 2848, 1092, 14205, 4916, 11435, 6527, 4109,
+        11124, 9368, 18992, 5538, 10730, -3378, 6473, 10419, 9714, 1444, -8709, -2190,
+        -3267, -21783, -2501, -4257, 11824, 2535, 9054, 761, 5062, 8743, 3855, 11671,
+        -1379, 9152, -2892, -2186, 3584, -6175, 6701, 12728, 19247, 14339, 11921, 18936,
+        17180, 5407, -7149, 1759, 473, -5232, 2326, 570, 13683, 4394, 10913, 6005,
+        3587, 10602, 8846, 17391, 3937, 9129, -1765, 4872, 8818, 8720, 922, -9231,
+        -2712, -3789, -22305, -3023, -4076, 10416, 1127, 7646, -647, 3654, 7335, 2447,
+        11465, -1585, 8946, -1133, -2392, 3378, -4980, 10688, 16715, 23234, 18326, 15908,
+        22923, 21167, 9394, -3162, 5746, 4460, -702, 6313, 4557, 17670, 8381, 14900,
+        9992, 7574, 14589, 12833, 20959, 7505, 12697, 1803, 8440, 12386, 12288, 4909,
+        -5244, 1275, 198, -18318, 964, -792, 22738, 13449, 19968, 11675, 15976, 19657,
+        14769, 17191, 4141, 14672, 4593, 3334, 9104, 746, 7976, 14003, 20522, 15614,
+        13196, 20211, 18455, 6682, -5874, 3034, 1748, -3414, 3601, 1845, 14958, 5669,
+        12188, 7280, 4862, 11877, 10121, 21227, 7773, 12965, 82, 8708, 12654, 12556,
+        2197, -7956, -1437, -2514, -21030, -1748, -3504, 12719, 3430, 9949, 1656, 5957,
+        8484, 4750, 16066, 928, 11459, 1380, 121, 2287, -3188, 1231, -5138, 1381,
+        -3527, -5945, 1070, -686, 2781, -9775, -867, -2153, -7315, -300, -2056, 4151,
+        -5138, 1381, -3527, -5945, 1070, -686, 10122, -3332, 1860, -7029, -3745, 1549,
+        -1391, 4151, -5138, 1381, 304, -14686, 1070, -686, 4151, -5138, 1381, -3527,
+        -2611, 1070, -3818, 6534, -6516, 4015, -6051, -7323, -2019, -6134, 1404, -4965,
+        1554, -3354, -5772, 1243, -513, 2954, -9602, -694, -1980, -7142, -127, -1883,
+        4324, -4965, 1554, -3354, -5772, 1243, -513, 12127, -1327, 3865, -2375, -1740,
+        3554, 614, 4324, -4965, 1554, 477, -14513, 1243, -513, 4324, -4965, 1554,
+        -3354, -2438, 1243, -3645, 8085, -4965, 5566, -4500, -5772, -468, -4583, 6360,
+        -9, 6510, 1602, -816, 6199, 4443, 7910, -4646, 4262, 2976, -2186, 4829,
+        3073, 9280, -9, 6510, 1602, -816, 6199, 4443, 17083, 3629, 8821, 2581,
+        3216, 8510, 5570, 9280, -9, 6510, 5433, -9557, 6199, 4443, 9280, -9,
+        6510, 1602, 2518, 6199, 1311, 13041, -9, 10522, 456, -816, 4488, 373,
+        994, -5375, 1144, -3764, -6182, 833, -923, 2544, -10012, -1104, -2390, -7552,
+        -537, -2293, 3914, -5375, 1144, -3764, -6182, 833, -923, 14178, 724, 5916,
+        -324, 311, 5605, 2665, 3914, -5375, 1144, 67, -14923, 833, -923, 3914,
+        -5375, 1144, -3764, -2848, 833, -4055, 7675, -5375, 5156, -6875, -6182, -878,
+        -4993, 585, -5784, 735, -4173, -6591, 424, -1332, 2135, -10421, -1513, -2799,
+        -7961, -946, -2702, 3505, -5784, 735, -4173, -6591, 424, -1332, 11308, -2146,
+        3046, -3194, -2559, 2735, -205, 3505, -5784, 735, -342, -15332, 424, -629,
+        3505, -5784, 735, -4173, -3257, 424, -4464, 7672, -5378, 5153, -4913, -6185,
+        -881, -4996, 4572, -1797, 4722, -186, -2604, 4411, 2655, 6122, -6434, 2474,
+        1188, -3974, 3041, 1285, 7492, -1797, 4722, -186, -2604, 4411, 2655, 15295,
+        1841, 7033, 793, 1428, 6722, 3782, 7492, -1797, 4722, 3645, -11345, 4411,
+        2655, 7492, -1797, 4722, -186, 730, 4411, -477, 11253, -1797, 8734, -1332,
+        -2604, 2700, -1415, 1644, -4725, 1794, -3114, -5532, 1483, -273, 3194, -9362,
+        -454, -1740, -6902, 113, -1643, 4564, -4725, 1794, -3114, -5532, 1483, -273,
+        12367, -1087, 4105, -3158, -1500, 3794, 854, 4564, -4725, 1794, 717, -14273,
+        1483, -273, 4564, -4725, 1794, -3114, -2198, 329, -3405, 10419, -4719, 5812,
+        -4254, -5526, -222, -4337, 4642, -1727, 4792, -116, -2534, 4481, 2725, 6192,
+        -6364, 2544, 1258, -3904, 3111, 1355, 7562, -1727, 4792, -116, -2534, 4481,
+        2725, 15365, 1911, 7103, -1786, 1498, 6792, 3852, 7562, -1727, 4792, 3715,
+        -11275, 4481, 2725, 7562, -1727, 4792, -116, 800, 4481, -407, 9945, -3105,
+        7426, -2640, -3912, 1392, -2723, 4815, -1554, 4965, 57, -2361, 4654, 2898,
+        7458, -5098, 3810, 2524, -2638, 4377, 2621, 7735, -1554, 4965, 57, -2361,
+        4654, 2898, 15538, 2084, 7276, 1036, 1671, 6965, 4025, 7735, -1554, 4965,
+        3888, -11102, 4654, 2898, 7735, -1554, 4965, 57, 973, 4654, -234, 11496,
+        -1554, 8977, -1089, -2361, 2943, -1172, 9771, 3402, 9921, 5013, 2595, 9610,
+        7854, 11321, -1235, 7673, 6387, 1225, 8240, 6484, 12691, 3402, 9921, 5013,
+        2595, 9610, 7854, 20494, 7040, 12232, 5992, 6627, 11921, 8981, 12691, 3402,
+        9921, 8844, -6146, 9610, 7854, 12691, 3402, 9921, 5013, 5929, 9610, 4722,
+        16452, 3402, 13933, 3867, 2595, 7899, 3784, 4405, -1964, 4555, -353, -2771,
+        4244, 2488, 5955, -6601, 2307, 1021, -4141, 2874, 1118, 7325, -1964, 4555,
+        -353, -2771, 4244, 2488, 17589, 4135, 9327, 3087, 3722, 9016, 6076, 7325,
+        -1964, 4555, 3478, -11512, 4244, 2488, 7325, -1964, 4555, -353, 563, 4244,
+        -644, 11086, -1964, 8567, -3464, -2771, 2533, -1582, 3996, -2373, 4146, -762,
+        -3180, 3835, 2079, 5546, -7010, 1898, 612, -4550, 2465, 709, 6916, -2373,
+        4146, -762, -3180, 3835, 2079, 14719, 1265, 6457, 217, 852, 6146, 3206,
+        6916, -2373, 4146, 3069, -11921, 3835, 2782, 6916, -2373, 4146, -762, 154,
+        3835, -1053, 11083, -1967, 8564, -1502, -2774, 2530, -1585, 7983, 1614, 8133,
+        3225, 807, 7822, 6066, 9533, -3023, 5885, 4599, -563, 6452, 4696, 10903,
+        1614, 8133, 3225, 807, 7822, 6066, 18706, 5252, 10444, 4204, 4839, 10133,
+        7193, 10903, 1614, 8133, 7056, -7934, 7822, 6066, 10903, 1614, 8133, 3225,
+        4141, 7822, 2934, 14664, 1614, 12145, 2079, 807, 6111, 1996, 5055, -1314,
+        5205, 297, -2121, 4894, 3138, 6605, -5951, 2957, 1671, -3491, 3524, 1768,
+        7975, -1314, 5205, 297, -2121, 4894, 3138, 15778, 2324, 7516, 253, 1911,
+        7205, 4265, 7975, -1314, 5205, 4128, -10862, 4894, 3138, 7975, -1314, 5205,
+        297, 1213, 3740, 6, 13830, -1308, 9223, -843, -2115, 3189, -926, 4158,
+        -2211, 4308, -600, -3018, 3997, 2241, 5708, -6848, 2060, 774, -4388, 2627,
+        871, 7078, -2211, 4308, -600, -3018, 3997, 2241, 14881, 1427, 6619, -2270,
+        1014, 6308, 3368, 7078, -2211, 4308, 3231, -11759, 3997, 2241, 7078, -2211,
+        4308, -600, 316, 3997, -891, 9461, -3589, 6942, -3124, -4396, 908, -3207,
+        4331, -2038, 4481, -427, -2845, 4170, 2414, 5881, -6675, 2233, 947, -4215,
+        2800, 1044, 7251, -2038, 4481, -427, -2845, 4170, 2414, 15054, 1600, 6792,
+        552, 1187, 6481, 3541, 7251, -2038, 4481, 3404, -11586, 4170, 2414, 7251,
+        -2038, 4481, -427, 489, 4170, -718, 11012, -2038, 8493, -1573, -2845, 2459,
+        -1656, 9287, 2918, 9437, 4529, 2111, 9126, 7370, 10837, -1719, 7189, 5903,
+        741, 7756, 6000, 12207, 2918, 9437, 4529, 2111, 9126, 7370, 20010, 6556,
+        11748, 5508, 6143, 11437, 8497, 12207, 2918, 9437, 8360, -6630, 9126, 7370,
+        12207, 2918, 9437, 4529, 5445, 9126, 4238, 15968, 2918, 13449, 3383, 2111,
+        7415, 3300, 3921, -2448, 4071, -837, -3255, 3760, 2004, 5471, -7085, 1823,
+        537, -4625, 2390, 634, 6841, -2448, 4071, -837, -3255, 3760, 2004, 17105,
+        3651, 8843, 2603, 3238, 8532, 5592, 6841, -2448, 4071, 2994, -11996, 3760,
+        2004, 6841, -2448, 4071, -837, 79, 3760, -1128, 10602, -2448, 8083, -3948,
+        -3255, 2049, -2066, 3512, -2857, 3662, -1246, -3664, 3351, 1595, 5062, -7494,
+        1414, 128, -5034, 1981, 225, 6432, -2857, 3662, -1246, -3664, 3351, 1595,
+        14235, 781, 5973, -267, 368, 5662, 2722, 6432, -2857, 3662, 2585, -12405,
+        3351, 2298, 6432, -2857, 3662, -1246, -330, 3351, -1537, 10599, -2451, 8080,
+        -1986, -3258, 2046, -2069, 7499, 1130, 7649, 2741, 323, 7338, 5582, 9049,
+        -3507, 5401, 4115, -1047, 5968, 4212, 10419, 1130, 7649, 2741, 323, 7338,
+        5582, 18222, 4768, 9960, 3720, 4355, 9649, 6709, 10419, 1130, 7649, 6572,
+        -8418, 7338, 5582, 10419, 1130, 7649, 2741, 3657, 7338, 2450, 14180, 1130,
+        11661, 1595, 323, 5627, 1512, 4571, -1798, 4721, -187, -2605, 4410, 2654,
+        6121, -6435, 2473, 1187, -3975, 3040, 1284, 7491, -1798, 4721, -187, -2605,
+        4410, 2654, 15294, 1840, 7032, -231, 1427, 6721, 3781, 7491, -1798, 4721,
+        3644, -11346, 4410, 2654, 7491, -1798, 4721, -187, 729, 3256, -478, 13346,
+        -1792, 8739, -1327, -2599, 2705, -1410, 4635, -1734, 4785, -123, -2541, 4474,
+        2718, 6185, -6371, 2537, 1251, -3911, 3104, 1348, 7555, -1734, 4785, -123,
+        -2541, 4474, 2718, 14343, 889, 6081, -2808, 476, 5770, 2830, 7555, -1734,
+        4785, 3708, -11282, 4474, 2718, 8022, -1267, 5252, 344, 1260, 4941, 53,
+        9796, -3254, 7277, -2789, -4061, 1243, -2872, 4808, -1561, 4958, 50, -2368,
+        4647, 2891, 6358, -6198, 2710, 1424, -3738, 3277, 1521, 7728, -1561, 4958,
+        50, -2368, 4647, 2891, 15531, 2077, 7269, 1029, 1664, 6958, 4018, 7728,
+        -1561, 4958, 3881, -11109, 4647, 2891, 7728, -1561, 4958, 50, 966, 4647,
+        -241, 11489, -1561, 8970, -1096, -2368, 2936, -1179, 9764, 3395, 9914, 5006,
+        2588, 9603, 7847, 11314, -1242, 7666, 6380, 1218, 8233, 6477, 12684, 3395,
+        9914, 5006, 2588, 9603, 7847, 20487, 7033, 12225, 5985, 6620, 11914, 8974,
+        12684, 3395, 9914, 8837, -6153, 9603, 7847, 12684, 3395, 9914, 5006, 5922,
+        9603, 4715, 16445, 3395, 13926, 3860, 2588, 7892, 3777, 4398, -1971, 4548,
+        -360, -2778, 4237, 2481, 5948, -6608, 2300, 1014, -4148, 2867, 1111, 7318,
+        -1971, 4548, -360, -2778, 4237, 2481, 17582, 4128, 9320, 3080, 3715, 9009,
+        6069, 7318, -1971, 4548, 3471, -11519, 4237, 2481, 7318, -1971, 4548, -360,
+        556, 4237, -651, 11079, -1971, 8560, -3471, -2778, 2526, -1589, 3989, -2380,
+        4139, -769, -3187, 3828, 2072, 5539, -7017, 1891, 605, -4557, 2458, 702,
+        6909, -2380, 4139, -769, -3187, 3828, 2072, 14712, 1258, 6450, 210, 845,
+        6139, 3199, 6909, -2380, 4139, 3062, -11928, 3828, 2775, 6909, -2380, 4139,
+        -769, 147, 3828, -1060, 11076, -1974, 8557, -1509, -2781, 2523, -1592, 7976,
+        1607, 8126, 3218, 800, 7815, 6059, 9526, -3030, 5878, 4592, -570, 6445,
+        4689, 10896, 1607, 8126, 3218, 800, 7815, 6059, 18699, 5245, 10437, 4197,
+        4832, 10126, 7186, 10896, 1607, 8126, 7049, -7941, 7815, 6059, 10896, 1607,
+        8126, 3218, 4134, 7815, 2927, 14657, 1607, 12138, 2072, 800, 6104, 1989,
+        5048, -1321, 5198, 290, -2128, 4887, 3131, 6598, -5958, 2950, 1664, -3498,
+        3517, 1761, 7968, -1321, 5198, 290, -2128, 4887, 3131, 16940, 3486, 8678,
+        1415, 3073, 8367, 5427, 7968, -1321, 5198, 4121, -10869, 4887, 3131, 7968,
+        -1321, 5198, 290, 1206, 3733, -1, 13823, -1315, 9216, -850, -2122, 3182,
+        -933, 4661, -1708, 4811, -97, -2515, 4500, 2744, 6211, -6345, 2563, 1277,
+        -3885, 3130, 1374, 7581, -1708, 4811, -97, -2515, 4500, 2744, 15384, 1930,
+        7122, -1767, 1517, 6811, 3871, 7581, -1708, 4811, 3734, -11256, 4500, 2744,
+        7581, -1708, 4811, -97, 819, 4500, -388, 9964, -3086, 7445, -2621, -3893,
+        1411, -2704, 4834, -1535, 4984, 76, -2342, 4673, 2917, 6384, -6172, 2736,
+        1450, -3712, 3303, 1547, 7754, -1535, 4984, 76, -2342, 4673, 2917, 15557,
+        2103, 7295, 1055, 1690, 6984, 4044, 7754, -1535, 4984, 3907, -11083, 4673,
+        2917, 7754, -1535, 4984, 76, 992, 4673, -215, 11515, -1535, 8996, -1070,
+        -2342, 2962, -1153, 9790, 3421, 9940, 5032, 2614, 9629, 7873, 11340, -1216,
+        7692, 6406, 1244, 8259, 6503, 12710, 3421, 9940, 5032, 2614, 9629, 7873,
+        20513, 7059, 12251, 6011, 6646, 11940, 9000, 12710, 3421, 9940, 8863, -6127,
+        9629, 7873, 12710, 3421, 9940, 5032, 5948, 9629, 4741, 16471, 3421, 13952,
+        3886, 2614, 7918, 3803, 4424, -1945, 4574, -334, -2752, 4263, 2507, 5974,
+        -6582, 2326, 1040, -4122, 2893, 1137, 7344, -1945, 4574, -334, -2752, 4263,
+        2507, 17608, 4154, 9346, 3106, 3741, 9035, 6095, 7344, -1945, 4574, 3497,
+        -11493, 4263, 2507, 7344, -1945, 4574, -334, 582, 4263, -625, 11105, -1945,
+        8586, -3445, -2752, 2552, -1563, 4015, -2354, 4165, -743, -3161, 3854, 2098,
+        5565, -6991, 1917, 631, -4531, 2484, 728, 6935, -2354, 4165, -743, -3161,
+        3854, 2098, 14738, 1284, 6476, 236, 871, 6165, 3225, 6935, -2354, 4165,
+        3088, -11902, 3854, 2801, 6935, -2354, 4165, -743, 173, 3854, -1034, 11102,
+        -1948, 8583, -1483, -2755, 2549, -1566, 8002, 1633, 8152, 3244, 826, 7841,
+        6085, 9552, -3004, 5904, 4618, -544, 6471, 4715, 10922, 1633, 8152, 3244,
+        826, 7841, 6085, 18725, 5271, 10463, 4223, 4858, 10152, 7212, 10922, 1633,
+        8152, 7075, -7915, 7841, 6085, 10922, 1633, 8152, 3244, 4160, 7841, 2953,
+        14683, 1633, 12164, 2098, 826, 6130, 2015, 5074, -1295, 5224, 316, -2102,
+        4913, 3157, 6624, -5932, 2976, 1690, -3472, 3543, 1787, 7994, -1295, 5224,
+        316, -2102, 4913, 3157, 15797, 2343, 7535, 272, 1930, 7224, 4284, 7994,
+        -1295, 5224, 4147, -10843, 4913, 3157, 7994, -1295, 5224, 316, 1232, 3759,
+        25, 13849, -1289, 9242, -824, -2096, 3208, -907, 4803, -1566, 4953, 45,
+        -2373, 4642, 2886, 6353, -6203, 2705, 1419, -3743, 3272, 1516, 7723, -1566,
+        4953, 45, -2373, 4642, 2886, 15526, 2072, 7264, -1625, 1659, 6953, 4013,
+        7723, -1566, 4953, 3876, -11114, 4642, 2886, 7723, -1566, 4953, 45, 961,
+        4642, -246, 10106, -2944, 7587, -2479, -3751, 1553, -2562, 4976, -1393, 5126,
+        218, -2200, 4815, 3059, 6526, -6030, 2878, 1592, -3570, 3445, 1689, 7896,
+        -1393, 5126, 218, -2200, 4815, 3059, 15699, 2245, 7437, 1197, 1832, 7126,
+        4186, 7896, -1393, 5126, 4049, -10941, 4815, 3059, 7896, -1393, 5126, 218,
+        1134, 4815, -73, 11657, -1393, 9138, -928, -2200, 3104, -1011, 9932, 3563,
+        10082, 5174, 2756, 9771, 8015, 11482, -1074, 7834, 6548, 1386, 8401, 6645,
+        12852, 3563, 10082, 5174, 2756, 9771, 8015, 20655, 7201, 12393, 6153, 6788,
+        12082, 9142, 12852, 3563, 10082, 9005, -5985, 9771, 8015, 12852, 3563, 10082,
+        5174, 6090, 9771, 4883, 16613, 3563, 14094, 4028, 2756, 8060, 3945, 4566,
+        -1803, 4716, -192, -2610, 4405, 2649, 6116, -6440, 2468, 1182, -3980, 3035,
+        1279, 7486, -1803, 4716, -192, -2610, 4405, 2649, 17750, 4296, 9488, 3248,
+        3883, 9177, 6237, 7486, -1803, 4716, 3639, -11351, 4405, 2649, 7486, -1803,
+        4716, -192, 724, 4405, -483, 11247, -1803, 8728, -3303, -2610, 2694, -1421,
+        4157, -2212, 4307, -601, -3019, 3996, 2240, 5707, -6849, 2059, 773, -4389,
+        2626, 870, 7077, -2212, 4307, -601, -3019, 3996, 2240, 14880, 1426, 6618,
+        378, 1013, 6307, 3367, 7077, -2212, 4307, 3230, -11760, 3996, 2943, 7077,
+        -2212, 4307, -601, 315, 3996, -892, 11244, -1806, 8725, -1341, -2613, 2691,
+        -1424, 8144, 1775, 8294, 3386, 968, 7983, 6227, 9694, -2862, 6046, 4760,
+        -402, 6613, 4857, 11064, 1775, 8294, 3386, 968, 7983, 6227, 18867, 5413,
+        10605, 4365, 5000, 10294, 7354, 11064, 1775, 8294, 7217, -7773, 7983, 6227,
+        11064, 1775, 8294, 3386, 4302, 7983, 3095, 15012, 1962, 12493, 2427, 1155,
+        6459, 2344, 5216, -1153, 5366, 458, -1960, 5055, 3299, 6766, -5790, 3118,
+        1832, -3330, 3685, 1929, 8136, -1153, 5366, 458, -1960, 5055, 3299, 15939,
+        2485, 7677, 414, 2072, 7366, 4426, 8136, -1153, 5366, 4289, -10701, 5055,
+        3299, 8136, -1153, 5366, 458, 1374, 3901, 167, 13991, -1147, 9384, -682,
+        -1954, 3350, -765, 4063, -2306, 4213, -695, -3113, 3902, 2146, 5613, -6943,
+        1965, 679, -4483, 2532, 776, 6983, -2306, 4213, -695, -3113, 3902, 2146,
+        14786, 1332, 6524, -2365, 919, 6213, 3273, 6983, -2306, 4213, 3136, -11854,
+        3902, 2146, 6652, -2637, 3882, -1026, -110, 3571, -1317, 8976, -4074, 6457,
+        -3609, -4881, 423, -3692, 4236, -2133, 4386, -522, -2940, 4075, 2319, 5786,
+        -6770, 2138, 852, -4310, 2705, 949, 7156, -2133, 4386, -522, -2940, 4075,
+        2319, 14959, 1505, 6697, 457, 1092, 6386, 3446, 7156, -2133, 4386, 3309,
+        -11681, 4075, 2319, 7156, -2133, 4386, -522, 394, 4075, -813, 10917, -2133,
+        8398, -1668, -2940, 2364, -1751, 9192, 2823, 9342, 4434, 2016, 9031, 7275,
+        10742, -1814, 7094, 5808, 646, 7661, 5905, 12112, 2823, 9342, 4434, 2016,
+        9031, 7275, 19915, 6461, 11653, 5413, 6048, 11342, 8402, 12112, 2823, 9342,
+        8265, -6725, 9031, 7275, 12112, 2823, 9342, 4434, 5350, 9031, 4143, 15873,
+        2823, 13354, 3288, 2016, 7320, 3205, 3826, -2543, 3976, -932, -3350, 3665,
+        1909, 5376, -7180, 1728, 442, -4720, 2295, 539, 6746, -2543, 3976, -932,
+        -3350, 3665, 1909, 18008, 4554, 9746, 3506, 4141, 9435, 6495, 6746, -2543,
+        3976, 2899, -12091, 3665, 1909, 6746, -2543, 3976, -932, -16, 3665, -1223,
+        10507, -2543, 7988, -4043, -3350, 1954, -2161, 3417, -2952, 3567, -1341, -3759,
+        3256, 1500, 4967, -7589, 1319, 33, -5129, 1886, 130, 6337, -2952, 3567,
+        -1341, -3759, 3256, 1500, 14140, 686, 5878, -362, 273, 5567, 2627, 6337,
+        -2952, 3567, 2490, -12500, 3256, 2203, 6337, -2952, 3567, -1341, -425, 3256,
+        -1632, 10504, -2546, 7985, -2081, -3353, 1951, -2164, 7404, 1035, 7554, 2646,
+        228, 7243, 5487, 8954, -3602, 5306, 4020, -1142, 5873, 4117, 10324, 1035,
+        7554, 2646, 228, 7243, 5487, 18127, 4673, 9865, 3625, 4260, 9554, 6614,
+        10324, 1035, 7554, 6477, -8513, 7243, 5487, 10324, 1035, 7554, 2646, 3562,
+        7243, 2355, 14085, 1035, 11566, 1500, 228, 5532, 1417, 4476, -1893, 4626,
+        -282, -2700, 4315, 2559, 6026, -6530, 2378, 1092, -4070, 2945, 1189, 7396,
+        -1893, 4626, -282, -2700, 4315, 2559, 15199, 1745, 6937, -326, 1332, 6626,
+        3686, 7396, -1893, 4626, 3549, -11441, 4315, 2559, 7976, -1313, 5206, 298,
+        1214, 3741, 7, 14280, -858, 9673, -393, -1665, 3639, -476, 12930, 6561,
+        13080, 8172, 5754, 12769, 11013, 2781, -9775, -867, -2153, -7315, -300, -1130,
+        939, -8350, -2804, -6739, -9157, -2142, -3898, 9295, -4159, 1033, -7856, -4572,
+        722, -2218, 4151, -5138, 1381, 304, -14686, 1070, -686, 4151, -5138, 1381,
+        -3527, -2611, 1070, -3818, 6534, -6516, 4015, -6051, -9359, -2019, -5868, 1404,
+        -4965, 1554, -3354, -5772, 1243, -513, 2954, -12365, -694, -1980, -7142, -127,
+        -957, 1112, -8177, -2631, -6566, -8984, -1969, -3725, 11300, -2154, 3038, -3202,
+        -2567, 2727, -213, 4324, -4965, 1554, 477, -14333, 1243, -513, 4324, -4965,
+        1554, -3354, -2438, 1243, -3645, 8085, -4965, 5566, -4500, -7808, -468, -4317,
+        6360, -9, 6510, 1602, -816, 6199, 4443, 7910, -4646, 4262, 2976, -2186,
+        4829, 3999, 6068, -3221, 2325, -1610, -4028, 2987, 1231, 16256, 2802, 7994,
+        1754, 2389, 7683, 4743, 9280, -9, 6510, 5433, -9557, 6199, 4443, 9280,
+        -9, 6510, 1602, 2518, 6199, 1311, 13041, -9, 10522, 456, -2852, 4488,
+        639, 994, -5375, 1144, -3764, -6182, 833, -923, 2544, -10012, -1104, -2390,
+        -7552, -537, -1367, 702, -8587, -3041, -6976, -9394, -2379, -4135, 12946, -508,
+        4684, -5563, -921, 4373, 2059, 3914, -5375, 1144, 67, -14923, 833, -923,
+        3914, -5375, 1144, -3764, -2848, 833, -4055, 7675, -5375, 5156, -7368, -8218,
+        -878, -2792, -1657, -8026, -1507, -6415, -8833, -1818, -3574, 2135, -10421, -1513,
+        -2799, -16117, -946, -1776, 293, -8996, -3450, -7385, -9803, -2788, -4544, 9688,
+        -3766, 1426, -4814, -4179, 1115, -1825, 3505, -5784, 735, -342, -15332, 424,
+        -629, 3505, -5784, 735, -4173, -3257, 424, -4464, 9470, -3580, 6951, -3115,
+        -6423, 917, -2932, 4572, -1797, 4722, -186, -2604, 4411, 2655, 6122, -6434,
+        2474, 1188, -3974, 3041, 2211, 4280, -5009, 537, -3398, -5816, 1199, -557,
+        14468, 1014, 6206, -34, 601, 5895, 2955, 7492, -1797, 4722, 3645, -11345,
+        4411, 2655, 7492, -1797, 4722, -186, 730, 4411, -477, 8851, -4199, 6332,
+        -3734, -7042, 298, -3551, 1644, -4725, 1794, -3114, -5532, 1483, -273, 3194,
+        -9362, -454, -1740, -6902, 113, -717, 1352, -7937, -2391, -6326, -8744, -1729,
+        -3485, 11540, -1914, 3278, -3985, -2327, 2967, -1546, 4564, -4725, 1794, 717,
+        -14273, 1483, -273, 5003, -4286, 2233, -2675, -1759, 768, -2966, 13183, -2435,
+        8096, 476, -5278, 2062, -2081, 16341, 9972, 16491, 11583, 9165, 16180, 14424,
+        6192, -6364, 2544, 1258, -3904, 3111, 2281, 4350, -4939, 607, -3328, -5746,
+        1269, -487, 14538, 1084, 6276, -2613, 671, 5965, 3025, 7562, -1727, 4792,
+        3715, -11275, 4481, 2725, 7562, -1727, 4792, -116, 800, 4481, -407, 9945,
+        -3105, 7426, -2640, -5948, 1392, -2457, 4815, -1554, 4965, 57, -2361, 4654,
+        2898, 7458, -7861, 3810, 2524, -2638, 4377, 3547, 4523, -4766, 780, -3155,
+        -5573, 1442, -314, 14711, 1257, 6449, 209, 844, 6138, 3198, 7735, -1554,
+        4965, 3888, -10922, 4654, 2898, 7735, -1554, 4965, 57, 973, 4654, -234,
+        11496, -1554, 8977, -1089, -4397, 2943, -906, 9771, 3402, 9921, 5013, 2595,
+        9610, 7854, 11321, -1235, 7673, 6387, 1225, 8240, 7410, 9479, 190, 5736,
+        1801, -617, 6398, 4642, 19667, 6213, 11405, 5165, 5800, 11094, 8154, 12691,
+        3402, 9921, 8844, -6146, 9610, 7854, 12691, 3402, 9921, 5013, 5929, 9610,
+        4722, 16452, 3402, 13933, 3867, 559, 7899, 4050, 4405, -1964, 4555, -353,
+        -2771, 4244, 2488, 5955, -6601, 2307, 1021, -4141, 2874, 2044, 4113, -5176,
+        370, -3565, -5983, 1032, -724, 17042, 3588, 8780, -1467, 3175, 8469, 6155,
+        7325, -1964, 4555, 3478, -11512, 4244, 2488, 7325, -1964, 4555, -353, 563,
+        4244, -644, 11086, -1964, 8567, -3957, -4807, 2533, 619, 1754, -4615, 1904,
+        -3004, -5422, 1593, -163, 5546, -7010, 1898, 612, -12706, 2465, 1635, 3704,
+        -5585, -39, -3974, -6392, 623, -1133, 13099, -355, 4837, -1403, -768, 4526,
+        1586, 6916, -2373, 4146, 3069, -11921, 3835, 2782, 6916, -2373, 4146, -762,
+        154, 3835, -1053, 12881, -169, 10362, 296, -3012, 4328, 479, 7983, 1614,
+        8133, 3225, 807, 7822, 6066, 9533, -3023, 5885, 4599, -563, 6452, 5622,
+        7691, -1598, 3948, 13, -2405, 4610, 2854, 17879, 4425, 9617, 3377, 4012,
+        9306, 6366, 10903, 1614, 8133, 7056, -7934, 7822, 6066, 10903, 1614, 8133,
+        3225, 4141, 7822, 2934, 12262, -788, 9743, -323, -3631, 3709, -140, 5055,
+        -1314, 5205, 297, -2121, 4894, 3138, 6605, -5951, 2957, 1671, -3491, 3524,
+        2694, 4763, -4526, 1020, -2915, -5333, 1682, -74, 14951, 1497, 6689, -574,
+        1084, 6378, 1865, 7975, -1314, 5205, 4128, -10862, 4894, 3138, 8414, -875,
+        5644, 736, 1652, 4179, 445, 16484, 866, 11397, 3777, -1977, 5363, 1220,
+        15857, 9488, 16007, 11099, 8681, 15696, 13940, 5708, -6848, 2060, 774, -4388,
+        2627, 1797, 3866, -5423, 123, -3812, -6230, 785, -971, 14054, 600, 5792,
+        -3097, 187, 5481, 2541, 7078, -2211, 4308, 3231, -11759, 3997, 2241, 7078,
+        -2211, 4308, -600, 316, 3997, -891, 9461, -3589, 6942, -3124, -6432, 908,
+        -2941, 4331, -2038, 4481, -427, -2845, 4170, 2414, 5881, -9438, 2233, 947,
+        -4215, 2800, 1970, 4039, -5250, 296, -3639, -6057, 958, -798, 14227, 773,
+        5965, -275, 360, 5654, 2714, 7251, -2038, 4481, 3404, -11406, 4170, 2414,
+        7251, -2038, 4481, -427, 489, 4170, -718, 11012, -2038, 8493, -1573, -4881,
+        2459, -1390, 9287, 2918, 9437, 4529, 2111, 9126, 7370, 10837, -1719, 7189,
+        5903, 741, 7756, 6926, 8995, -294, 5252, 1317, -1101, 5914, 4158, 19183,
+        5729, 10921, 4681, 5316, 10610, 7670, 12207, 2918, 9437, 8360, -6630, 9126,
+        7370, 12207, 2918, 9437, 4529, 5445, 9126, 4238, 15968, 2918, 13449, 3383,
+        75, 7415, 3566, 3921, -2448, 4071, -837, -3255, 3760, 2004, 5471, -7085,
+        1823, 537, -4625, 2390, 1560, 3629, -5660, -114, -4049, -6467, 548, -1208,
+        16558, 3104, 8296, -1951, 2691, 7985, 5671, 6841, -2448, 4071, 2994, -11996,
+        3760, 2004, 6841, -2448, 4071, -837, 79, 3760, -1128, 10602, -2448, 8083,
+        -4441, -5291, 2049, 135, 1270, -5099, 1420, -3488, -5906, 1109, -647, 5062,
+        -7494, 1414, 128, -13190, 1981, 1151, 3220, -6069, -523, -4458, -6876, 139,
+        -1617, 12615, -839, 4353, -1887, -1252, 4042, 1102, 6432, -2857, 3662, 2585,
+        -12405, 3351, 2298, 6432, -2857, 3662, -1246, -330, 3351, -1537, 12397, -653,
+        9878, -188, -3496, 3844, -5, 7499, 1130, 7649, 2741, 323, 7338, 5582,
+        9049, -3507, 5401, 4115, -1047, 5968, 5138, 7207, -2082, 3464, -471, -2889,
+        4126, 2370, 17395, 3941, 9133, 2893, 3528, 8822, 5882, 10419, 1130, 7649,
+        6572, -8418, 7338, 5582, 10419, 1130, 7649, 2741, 3657, 7338, 2450, 11778,
+        -1272, 9259, -807, -4115, 3225, -624, 4571, -1798, 4721, -187, -2605, 4410,
+        2654, 6121, -6435, 2473, 1187, -3975, 3040, 2210, 4279, -5010, 536, -3399,
+        -5817, 1198, -558, 14467, 1013, 6205, -1058, 600, 5894, 1381, 7491, -1798,
+        4721, 3644, -11346, 4410, 2654, 7930, -1359, 5160, 252, 1168, 3695, -39,
+        16000, 382, 10913, 3293, -2461, 4879, 736, 16334, 9965, 16484, 11576, 9158,
+        16173, 14417, 6185, -6371, 2537, 1251, -3911, 3104, 2274, 4343, -4946, 600,
+        -3335, -5753, 1262, -494, 13516, 62, 5254, -3635, -351, 4943, 2003, 7555,
+        -1734, 4785, 3708, -11282, 4474, 2718, 8022, -1267, 5252, 344, 1260, 4941,
+        53, 9796, -3254, 7277, -2789, -6097, 1243, -2606, 4808, -1561, 4958, 50,
+        -2368, 4647, 2891, 6358, -8961, 2710, 1424, -3738, 3277, 2447, 4516, -4773,
+        773, -3162, -5580, 1435, -321, 14704, 1250, 6442, 202, 837, 6131, 3191,
+        7728, -1561, 4958, 3881, -10929, 4647, 2891, 7728, -1561, 4958, 50, 966,
+        4647, -241, 11489, -1561, 8970, -1096, -4404, 2936, -913, 9764, 3395, 9914,
+        5006, 2588, 9603, 7847, 11314, -1242, 7666, 6380, 1218, 8233, 7403, 9472,
+        183, 5729, 1794, -624, 6391, 4635, 19660, 6206, 11398, 5158, 5793, 11087,
+        8147, 12684, 3395, 9914, 8837, -6153, 9603, 7847, 12684, 3395, 9914, 5006,
+        5922, 9603, 4715, 16445, 3395, 13926, 3860, 552, 7892, 4043, 4398, -1971,
+        4548, -360, -2778, 4237, 2481, 5948, -6608, 2300, 1014, -4148, 2867, 2037,
+        4106, -5183, 363, -3572, -5990, 1025, -731, 17035, 3581, 8773, -1474, 3168,
+        8462, 6148, 7318, -1971, 4548, 3471, -11519, 4237, 2481, 7318, -1971, 4548,
+        -360, 556, 4237, -651, 12423, -627, 9904, -2620, -3470, 3870, 1956, 1747,
+        -4622, 1897, -3011, -5429, 1586, -170, 5539, -7017, 1891, 605, -12713, 2458,
+        1628, 3697, -5592, -46, -3981, -6399, 616, -1140, 13092, -362, 4830, -1410,
+        -775, 4519, 1579, 6909, -2380, 4139, 3062, -11928, 3828, 2775, 6909, -2380,
+        4139, -769, 147, 3828, -1060, 12874, -176, 10355, 289, -3019, 4321, 472,
+        7976, 1607, 8126, 3218, 800, 7815, 6059, 9526, -3030, 5878, 4592, -570,
+        6445, 5615, 7684, -1605, 3941, 6, -2412, 4603, 2847, 17872, 4418, 9610,
+        3370, 4005, 9299, 6359, 10896, 1607, 8126, 7049, -7941, 7815, 6059, 10896,
+        1607, 8126, 3218, 4134, 7815, 2927, 12255, -795, 9736, -330, -3638, 3702,
+        -147, 5048, -1321, 5198, 290, -2128, 4887, 3131, 6598, -5958, 2950, 1664,
+        -3498, 3517, 2687, 4756, -4533, 1013, -2922, -5340, 1675, -81, 16113, 2659,
+        7851, 588, 2246, 7540, 3027, 7968, -1321, 5198, 4121, -10869, 4887, 3131,
+        8407, -882, 5637, 729, 1645, 4172, 438, 17100, 1482, 12013, 4393, -1361,
+        5979, 1836, 16360, 9991, 16510, 11602, 9184, 16199, 14443, 6211, -6345, 2563,
+        1277, -3885, 3130, 2300, 4369, -4920, 626, -3309, -5727, 1288, -468, 14557,
+        1103, 6295, -2594, 690, 5984, 3044, 7581, -1708, 4811, 3734, -11256, 4500,
+        2744, 7581, -1708, 4811, -97, 819, 4500, -388, 9964, -3086, 7445, -2621,
+        -5929, 1411, -2438, 4834, -1535, 4984, 76, -2342, 4673, 2917, 6384, -8935,
+        2736, 1450, -3712, 3303, 2473, 4542, -4747, 799, -3136, -5554, 1461, -295,
+        14730, 1276, 6468, 228, 863, 6157, 3217, 10546, 1257, 7776, 6699, -8111,
+        7465, 5709, 7754, -1535, 4984, 76, 992, 4673, -215, 11515, -1535, 8996,
+        -1070, -4378, 2962, -887, 9790, 3421, 9940, 5032, 2614, 9629, 7873, 11340,
+        -1216, 7692, 6406, 1244, 8259, 7429, 9498, 209, 5755, 1820, -598, 6417,
+        4661, 19686, 6232, 11424, 5184, 5819, 11113, 8173, 12710, 3421, 9940, 8863,
+        -6127, 9629, 7873, 12710, 3421, 9940, 5032, 5948, 9629, 4741, 16471, 3421,
+        13952, 3886, 578, 7918, 4069, 4424, -1945, 4574, -334, -2752, 4263, 2507,
+        5974, -6582, 2326, 1040, -4122, 2893, 2063, 4132, -5157, 389, -3546, -5964,
+        1051, -705, 17061, 3607, 8799, -1448, 3194, 8488, 6174, 7344, -1945, 4574,
+        3497, -11493, 4263, 2507, 7344, -1945, 4574, -334, 582, 4263, -625, 11105,
+        -1945, 8586, -3938, -4788, 2552, 638, 1773, -4596, 1923, -2985, -5403, 1612,
+        -144, 6244, -6312, 2596, 1310, -12008, 3163, 2333, 3723, -5566, -20, -3955,
+        -6373, 642, -1114, 13118, -336, 4856, -1384, -749, 4545, 1605, 6935, -2354,
+        4165, 3088, -11902, 3854, 2801, 6935, -2354, 4165, -743, 173, 3854, -1034,
+        12900, -150, 10381, 315, -2993, 4347, 498, 8002, 1633, 8152, 3244, 826,
+        7841, 6085, 9552, -3004, 5904, 4618, -544, 6471, 5641, 7710, -1579, 3967,
+        32, -2386, 4629, 2873, 17898, 4444, 9636, 3396, 4031, 9325, 6385, 10922,
+        1633, 8152, 7075, -7915, 7841, 6085, 10922, 1633, 8152, 3244, 4160, 7841,
+        2953, 12281, -769, 9762, -304, -3612, 3728, -121, 5074, -1295, 5224, 316,
+        -2102, 4913, 3157, 6624, -5932, 2976, 1690, -3472, 3543, 2713, 4782, -4507,
+        1039, -2896, -5314, 1701, -55, 14970, 1516, 6708, -555, 1103, 6397, 1884,
+        7994, -1295, 5224, 4147, -10843, 4913, 3157, 8433, -856, 5663, 755, 1671,
+        4198, 464, 17090, 1472, 12003, 4383, -1371, 5969, 1826, 16502, 10133, 16652,
+        11744, 9326, 16341, 14585, 6353, -6203, 2705, 1419, -3743, 3272, 2442, 4511,
+        -4778, 768, -3167, -5585, 1430, -326, 14699, 1245, 6437, -2452, 832, 6126,
+        3186, 7723, -1566, 4953, 3876, -11114, 4642, 2886, 7723, -1566, 4953, 45,
+        961, 4642, -246, 10106, -2944, 7587, -2479, -5787, 1553, -2296, 4976, -1393,
+        5126, 218, -2200, 4815, 3059, 6526, -8793, 2878, 1592, -3570, 3445, 2615,
+        4684, -4605, 941, -2994, -5412, 1603, -153, 14872, 1418, 6610, 370, 1005,
+        6299, 3359, 7896, -1393, 5126, 4049, -10761, 4815, 3059, 7896, -1393, 5126,
+        218, 1134, 4815, -73, 11657, -1393, 9138, -928, -4236, 3104, -745, 9932,
+        3563, 10082, 5174, 2756, 9771, 8015, 11482, -1074, 7834, 6548, 1386, 8401,
+        7571, 9640, 351, 5897, 1962, -456, 6559, 4803, 19828, 6374, 11566, 5326,
+        5961, 11255, 8315, 12852, 3563, 10082, 9005, -5985, 9771, 8015, 12852, 3563,
+        10082, 5174, 6090, 9771, 4883, 16613, 3563, 14094, 4028, 720, 8060, 4211,
+        4566, -1803, 4716, -192, -2610, 4405, 2649, 6116, -6440, 2468, 1182, -3980,
+        3035, 2205, 4274, -5015, 531, -3404, -5822, 1193, -563, 17203, 3749, 8941,
+        -1306, 3336, 8630, 6316, 7486, -1803, 4716, 3639, -11351, 4405, 2649, 7486,
+        -1803, 4716, -192, 724, 4405, -483, 11247, -1803, 8728, -3796, -4646, 2694,
+        780, 1915, -4454, 2065, -2843, -5261, 1754, -2, 5707, -6849, 2059, 773,
+        -12545, 2626, 1796, 3865, -5424, 122, -3813, -6231, 784, -972, 13260, -194,
+        4998, -1242, -607, 4687, 1747, 7077, -2212, 4307, 3230, -11760, 3996, 2943,
+        7077, -2212, 4307, -601, 315, 3996, -892, 13042, -8, 10523, 457, -2851,
+        4489, 640, 8144, 1775, 8294, 3386, 968, 7983, 6227, 9694, -2862, 6046,
+        4760, -402, 6613, 5783, 7852, -1437, 4109, 174, -2244, 4771, 3015, 18040,
+        4586, 9778, 3538, 4173, 9467, 6527, 11064, 1775, 8294, 7217, -7773, 7983,
+        6227, 11064, 1775, 8294, 3386, 4302, 7983, 3095, 12610, -440, 10091, 25,
+        -3283, 4057, 208, 5216, -1153, 5366, 458, -1960, 5055, 3299, 6766, -5790,
+        3118, 1832, -3330, 3685, 2855, 4924, -4365, 1181, -2754, -5172, 1843, 87,
+        15112, 1658, 6850, -413, 1245, 6539, 2026, 8136, -1153, 5366, 4289, -10701,
+        5055, 3299, 8575, -714, 5805, 897, 1813, 4340, 606, 16645, 1027, 11558,
+        3938, -1816, 5524, 1381, 15762, 9393, 15912, 11004, 8586, 15601, 13845, 5613,
+        -6943, 1965, 679, -4483, 2532, 1702, 3771, -5518, 28, -3907, -6325, 690,
+        -1066, 13959, 505, 5697, -3192, 92, 5386, 2446, 6983, -2306, 4213, 3136,
+        -11854, 3902, 2146, 6652, -2637, 3882, -1026, -110, 3571, -1317, 8976, -4074,
+        6457, -3609, -6917, 423, -3426, 4236, -2133, 4386, -522, -2940, 4075, 2319,
+        5786, -9533, 2138, 852, -4310, 2705, 1875, 3944, -5345, 201, -3734, -6152,
+        863, -893, 14132, 678, 5870, -370, 265, 5559, 2619, 7156, -2133, 4386,
+        3309, -11501, 4075, 2319, 7156, -2133, 4386, -522, 394, 4075, -813, 10917,
+        -2133, 8398, -1668, -4976, 2364, -1485, 9192, 2823, 9342, 4434, 2016, 9031,
+        7275, 10742, -1814, 7094, 5808, 646, 7661, 6831, 8900, -389, 5157, 1222,
+        -1196, 5819, 4063, 19088, 5634, 10826, 4586, 5221, 10515, 7575, 12112, 2823,
+        9342, 8265, -6725, 9031, 7275, 12112, 2823, 9342, 4434, 5350, 9031, 4143,
+        15873, 2823, 13354, 3288, -20, 7320, 3471, 3826, -2543, 3976, -932, -3350,
+        3665, 1909, 5376, -7180, 1728, 442, -4720, 2295, 1465, 3534, -5755, -209,
+        -4144, -6562, 453, -1303, 18458, 5004, 10196, -51, 4591, 9885, 7571, 6746,
+        -2543, 3976, 2899, -12091, 3665, 1909, 6746, -2543, 3976, -932, -16, 3665,
+        -1223, 10507, -2543, 7988, -4536, -5386, 1954, 40, 1175, -5194, 1325, -3583,
+        -6001, 1014, -742, 4967, -7589, 1319, 33, -13285, 1886, 1056, 3125, -6164,
+        -618, -4553, -6971, 44, -1712, 12520, -934, 4258, -1982, -1347, 3947, 1007,
+        6337, -2952, 3567, 2490, -12500, 3256, 2203, 6337, -2952, 3567, -1341, -425,
+        3256, -1632, 12302, -748, 9783, -283, -3591, 3749, -100, 7404, 1035, 7554,
+        2646, 228, 7243, 5487, 8954, -3602, 5306, 4020, -1142, 5873, 5043, 7112,
+        -2177, 3369, -566, -2984, 4031, 2275, 17300, 3846, 9038, 2798, 3433, 8727,
+        5787, 10324, 1035, 7554, 6477, -8513, 7243, 5487, 10324, 1035, 7554, 2646,
+        3562, 7243, 2355, 12164, -886, 9645, -421, -3729, 3611, -238, 4476, -1893,
+        4626, -282, -2700, 4315, 2559, 6026, -6530, 2378, 1092, -4070, 2945, 2115,
+        4184, -5105, 441, -3494, -5912, 1103, -653, 16101, 2647, 7839, 576, 2234,
+        7528, 3015, 7396, -1893, 4626, 3549, -11441, 4315, 2559, 8415, -874, 5645,
+        737, 1653, 4180, 446, 17280, 1662, 12193, 4573, -1181, 6159, 2016, 3785,
+        9812, 16331, 11423, 9005, 16020, 14264, 2491, -10065, -1157, -2443, -7605, -590,
+        -2346, 10767, 1478, 7997, 3089, 671, 7686, 5930, 12224, -1230, 3962, -9581,
+        -295, 3651, 4472, -2858, -12147, -5628, -6705, -23501, -5939, -7695, 7500, -1789,
+        4730, -3563, 738, 4419, -469, 7540, -5510, 5021, -5045, -6317, -1013, -9023,
+        3958, 9985, 16504, 11596, 9178, 16193, 14437, 2664, -9892, -984, -2270, -7432,
+        -417, -2173, 10940, 1651, 8170, 3262, 844, 7859, 6103, 14229, 775, 5967,
+        -4927, 1710, 5656, 6477, -2685, -11974, -5455, -6532, -23328, -5766, -7522, 7673,
+        -1616, 4903, -3390, 911, 4592, -296, 8316, -4734, 5797, -4269, -5541, -237,
+        -8247, 8914, 14941, 21460, 16552, 14134, 21149, 19393, 7620, -4936, 3972, 2686,
+        -2476, 4539, 2783, 16894, 7605, 14124, 9216, 6798, 13813, 12057, 19185, 5731,
+        10923, 29, 6666, 10612, 11433, 2271, -7018, -499, -1576, -18372, -810, -2566,
+        12629, 3340, 9859, 1566, 5867, 9548, 4660, 13272, 222, 10753, 687, -585,
+        4719, -3291, 3548, 9575, 16094, 11186, 8768, 15783, 14027, 2254, -10302, -1394,
+        -2680, -7842, -827, -2583, 10530, 1241, 7760, 2852, 434, 7449, 5693, 15981,
+        2527, 7719, -5356, 3462, 7408, 7622, -3095, -12384, -5865, -6942, -23738, -6176,
+        -7932, 7263, -2026, 4493, -3800, 501, 4182, -706, 7906, -5144, 5387, -6644,
+        -5951, -647, -8657, 3139, 9166, 15685, 10777, 8359, 15374, 13618, 1845, -10711,
+        -1803, -3089, -8251, -1236, -2992, 10121, 832, 7351, 2443, 25, 7040, 5284,
+        13829, 375, 5567, -5327, 1310, 5256, 6077, -3504, -12793, -6274, -7351, -24147,
+        -6585, -7638, 6854, -2435, 4084, -4209, 92, 3773, -1115, 7903, -5147, 5384,
+        -4682, -5954, -650, -8660, 7126, 13153, 19672, 14764, 12346, 19361, 17605, 5832,
+        -6724, 2184, 898, -4264, 2751, 995, 14108, 4819, 11338, 6430, 4012, 11027,
+        9271, 17397, 3943, 9135, -1759, 4878, 8824, 9645, 483, -8806, -2287, -3364,
+        -20160, -2598, -4354, 19176, 9887, 16406, 8113, 12414, 16095, 11207, 13041, -9,
+        10522, 456, -816, 4488, -3522, 4198, 10225, 16744, 11836, 9418, 16433, 14677,
+        2904, -9652, -744, -2030, -7192, -177, -1933, 11180, 1891, 8410, 3502, 1084,
+        8099, 6343, 17133, 3679, 8871, -4012, 4614, 8560, 9381, -2445, -11734, -5215,
+        -6292, -23088, -5526, -7282, 7913, -1376, 5143, -3150, 1151, 3678, -56, 9858,
+        -5280, 5251, -4815, -6087, -4387, -9514, 7196, 13223, 19742, 14834, 12416, 19431,
+        17675, 5902, -6654, 2254, 968, -4194, 2821, 1065, 14178, 4889, 11408, 6500,
+        4082, 11097, 9341, 17467, 4013, 9205, -4338, 4948, 8894, 9715, 553, -8736,
+        -2217, -3294, -20090, -2528, -4284, 10911, 1622, 8141, -152, 4149, 7830, 2942,
+        10951, -2099, 8432, -1634, -2906, 2398, -5612, 7369, 13396, 19915, 15007, 12589,
+        19604, 17848, 7168, -5388, 3520, 2234, -2928, 4087, 2331, 14351, 5062, 11581,
+        6673, 4255, 11270, 9514, 17640, 4186, 9378, -1516, 5121, 9067, 9888, 726,
+        -8563, -2044, -3121, -19917, -2355, -4111, 11084, 1795, 8314, 21, 4322, 8003,
+        3115, 11727, -1323, 9208, -858, -2130, 3174, -4836, 12325, 18352, 24871, 19963,
+        17545, 24560, 22804, 11031, -1525, 7383, 6097, 935, 7950, 6194, 20305, 11016,
+        17535, 12627, 10209, 17224, 15468, 22596, 9142, 14334, 3440, 10077, 14023, 14844,
+        5682, -3607, 2912, 1835, -14961, 2601, 845, 16040, 6751, 13270, 4977, 9278,
+        12959, 8071, 16683, 3633, 14164, 4098, 2826, 8130, 120, 6959, 12986, 19505,
+        14597, 12179, 19194, 17438, 5665, -6891, 2017, 731, -4431, 2584, 828, 13941,
+        4652, 11171, 6263, 3845, 10860, 9104, 19392, 5938, 11130, -1945, 6873, 10819,
+        11033, 316, -8973, -2454, -3531, -20327, -2765, -4521, 10674, 1385, 7904, -389,
+        3912, 7593, 2705, 11317, -1733, 8798, -3233, -2540, 2764, -5246, 6550, 12577,
+        19096, 14188, 11770, 18785, 17029, 5256, -7300, 1608, 322, -4840, 2175, 419,
+        13532, 4243, 10762, 5854, 3436, 10451, 8695, 17240, 3786, 8978, -1916, 4721,
+        8667, 9488, -93, -9382, -2863, -3940, -20736, -3174, -4227, 10265, 976, 7495,
+        -798, 3503, 7184, 2296, 11314, -1736, 8795, -1271, -2543, 2761, -5249, 10537,
+        16564, 23083, 18175, 15757, 22772, 21016, 9243, -3313, 5595, 4309, -853, 6162,
+        4406, 17519, 8230, 14749, 9841, 7423, 14438, 12682, 20808, 7354, 12546, 1652,
+        8289, 12235, 13056, 3894, -5395, 1124, 47, -16749, 813, -943, 22587, 13298,
+        19817, 11524, 15825, 19506, 14618, 15832, 2782, 13313, 3247, 1975, 7279, -731,
+        7609, 13636, 20155, 15247, 12829, 19844, 18088, 6315, -6241, 2667, 1381, -3781,
+        3234, 1478, 14591, 5302, 11821, 6913, 4495, 11510, 9754, 20544, 7090, 12282,
+        -601, 8025, 11971, 12792, 966, -8323, -1804, -2881, -19677, -2115, -3871, 11324,
+        2035, 8554, 261, 4562, 7089, 3355, 13269, -1869, 8662, -1404, -2676, -976,
+        -6103, 6712, 12739, 19258, 14350, 11932, 18947, 17191, 5418, -7138, 1770, 484,
+        -4678, 2337, 581, 13694, 4405, 10924, 6016, 3598, 10613, 8857, 16983, 3529,
+        8721, -4822, 4464, 8410, 9231, 69, -9220, -2701, -3778, -20574, -3012, -4768,
+        10427, 1138, 7657, -636, 3665, 7346, 2458, 10467, -2583, 7948, -2118, -3390,
+        1914, -6096, 6885, 12912, 19431, 14523, 12105, 19120, 17364, 5591, -6965, 1943,
+        657, -4505, 2510, 754, 13867, 4578, 11097, 6189, 3771, 10786, 9030, 17156,
+        3702, 8894, -2000, 4637, 8583, 9404, 242, -9047, -2528, -3605, -20401, -2839,
+        -4595, 10600, 1311, 7830, -463, 3838, 7519, 2631, 11243, -1807, 8724, -1342,
+        -2614, 2690, -5320, 11841, 17868, 24387, 19479, 17061, 24076, 22320, 10547, -2009,
+        6899, 5613, 451, 7466, 5710, 19821, 10532, 17051, 12143, 9725, 16740, 14984,
+        22112, 8658, 13850, 2956, 9593, 13539, 14360, 5198, -4091, 2428, 1351, -15445,
+        2117, 361, 15556, 6267, 12786, 4493, 8794, 12475, 7587, 16199, 3149, 13680,
+        3614, 2342, 7646, -364, 6475, 12502, 19021, 14113, 11695, 18710, 16954, 5181,
+        -7375, 1533, 247, -4915, 2100, 344, 13457, 4168, 10687, 5779, 3361, 10376,
+        8620, 18908, 5454, 10646, -2429, 6389, 10335, 10549, -168, -9457, -2938, -4015,
+        -20811, -3249, -5005, 10190, 901, 7420, -873, 3428, 7109, 2221, 10833, -2217,
+        8314, -3717, -3024, 2280, -5730, 6066, 12093, 18612, 13704, 11286, 18301, 16545,
+        4772, -7784, 1124, -162, -5324, 1691, -65, 13048, 3759, 10278, 5370, 2952,
+        9967, 8211, 16756, 3302, 8494, -2400, 4237, 8183, 9004, -577, -9866, -3347,
+        -4424, -21220, -3658, -4711, 9781, 492, 7011, -1282, 3019, 6700, 1812, 10830,
+        -2220, 8311, -1755, -3027, 2277, -5733, 10053, 16080, 22599, 17691, 15273, 22288,
+        20532, 8759, -3797, 5111, 3825, -1337, 5678, 3922, 17035, 7746, 14265, 9357,
+        6939, 13954, 12198, 20324, 6870, 12062, 1168, 7805, 11751, 12572, 3410, -5879,
+        640, -437, -17233, 329, -1427, 22103, 12814, 19333, 11040, 15341, 19022, 14134,
+        15348, 2298, 12829, 2763, 1491, 6795, -1215, 7125, 13152, 19671, 14763, 12345,
+        19360, 17604, 5831, -6725, 2183, 897, -4265, 2750, 994, 14107, 4818, 11337,
+        6429, 4011, 11026, 9270, 20060, 6606, 11798, -1085, 7541, 11487, 12308, 482,
+        -8807, -2288, -3365, -20161, -2599, -4355, 10840, 1551, 8070, -223, 4078, 6605,
+        2871, 12785, -2353, 8178, -1888, -3160, -1460, -6587, 7189, 13216, 19735, 14827,
+        12409, 19424, 17668, 5895, -6661, 2247, 961, -4201, 2814, 1058, 14171, 4882,
+        11401, 6493, 4075, 11090, 9334, 16445, 2991, 8183, -5360, 3926, 7872, 8693,
+        546, -8743, -2224, -3301, -20097, -2535, -4291, 11371, 2082, 8601, 308, 4609,
+        8290, 3402, 10802, -2248, 8283, -1783, -3055, 2249, -5761, 7362, 13389, 19908,
+        15000, 12582, 19597, 17841, 6068, -6488, 2420, 1134, -4028, 2987, 1231, 14344,
+        5055, 11574, 6666, 4248, 11263, 9507, 17633, 4179, 9371, -1523, 5114, 9060,
+        9881, 719, -8570, -2051, -3128, -19924, -2362, -4118, 11077, 1788, 8307, 14,
+        4315, 7996, 3108, 11720, -1330, 9201, -865, -2137, 3167, -4843, 12318, 18345,
+        24864, 19956, 17538, 24553, 22797, 11024, -1532, 7376, 6090, 928, 7943, 6187,
+        20298, 11009, 17528, 12620, 10202, 17217, 15461, 22589, 9135, 14327, 3433, 10070,
+        14016, 14837, 5675, -3614, 2905, 1828, -14968, 2594, 838, 16033, 6744, 13263,
+        4970, 9271, 12952, 8064, 16676, 3626, 14157, 4091, 2819, 8123, 113, 6952,
+        12979, 19498, 14590, 12172, 19187, 17431, 5658, -6898, 2010, 724, -4438, 2577,
+        821, 13934, 4645, 11164, 6256, 3838, 10853, 9097, 19280, 5826, 11018, -2057,
+        6761, 10707, 10921, 309, -8980, -2461, -3538, -20334, -2772, -4528, 10667, 1378,
+        7897, -396, 3905, 7586, 2698, 11194, -1856, 8675, -3356, -2663, 2641, -5369,
+        6543, 12570, 19089, 14181, 11763, 18778, 17022, 5249, -7307, 1601, 315, -4847,
+        2168, 412, 13525, 4236, 10755, 5847, 3429, 10444, 8688, 17233, 3779, 8971,
+        -1923, 4714, 8660, 9481, -100, -9389, -2870, -3947, -20743, -3181, -4234, 10258,
+        969, 7488, -805, 3496, 7177, 2289, 11307, -1743, 8788, -1278, -2550, 2754,
+        -5256, 10530, 16557, 23076, 18168, 15750, 22765, 21009, 9236, -3320, 5588, 4302,
+        -860, 6155, 4399, 17512, 8223, 14742, 9834, 7416, 14431, 12675, 20801, 7347,
+        12539, 1645, 8282, 12228, 13049, 3887, -5402, 1117, 40, -16756, 806, -950,
+        22580, 13291, 19810, 11517, 15818, 19499, 14611, 15825, 2775, 13306, 3240, 1968,
+        7272, -738, 7602, 13629, 20148, 15240, 12822, 19837, 18081, 6308, -6248, 2660,
+        1374, -3788, 3227, 1471, 14584, 5295, 11814, 6906, 4488, 11503, 9747, 21706,
+        8252, 13444, 561, 9187, 13133, 13954, 959, -8330, -1811, -2888, -19684, -2122,
+        -3878, 11317, 2028, 8547, 254, 4555, 7082, 3348, 13262, -1876, 8655, -1411,
+        -2683, -983, -6110, 7215, 13242, 19761, 14853, 12435, 19450, 17694, 5921, -6635,
+        2273, 987, -4175, 2840, 1084, 14197, 4908, 11427, 6519, 4101, 11116, 9360,
+        17486, 4032, 9224, -4319, 4967, 8913, 9734, 572, -8717, -2198, -3275, -20071,
+        -2509, -4265, 10930, 1641, 8160, -133, 4168, 7849, 2961, 10970, -2080, 8451,
+        -1615, -2887, 2417, -5593, 7388, 13415, 19934, 15026, 12608, 19623, 17867, 6094,
+        -6462, 2446, 1160, -4002, 3013, 1257, 14370, 5081, 11600, 6692, 4274, 11289,
+        9533, 17659, 4205, 9397, -1497, 5140, 9086, 9907, 745, -8544, -2025, -3102,
+        -19898, -2336, -4092, 11103, 1814, 8333, 40, 4341, 8022, 3134, 11746, -1304,
+        9227, -839, -2111, 3193, -4817, 12344, 18371, 24890, 19982, 17564, 24579, 22823,
+        11050, -1506, 7402, 6116, 954, 7969, 6213, 20324, 11035, 17554, 12646, 10228,
+        17243, 15487, 22615, 9161, 14353, 3459, 10096, 14042, 14863, 5701, -3588, 2931,
+        1854, -14942, 2620, 864, 16059, 6770, 13289, 4996, 9297, 12978, 8090, 16702,
+        3652, 14183, 4117, 2845, 8149, 139, 6978, 13005, 19524, 14616, 12198, 19213,
+        17457, 5684, -6872, 2036, 750, -4412, 2603, 847, 13960, 4671, 11190, 6282,
+        3864, 10879, 9123, 19411, 5957, 11149, -1926, 6892, 10838, 11052, 335, -8954,
+        -2435, -3512, -20308, -2746, -4502, 10693, 1404, 7923, -370, 3931, 7612, 2724,
+        11336, -1714, 8817, -3214, -2521, 2783, -5227, 6569, 12596, 19115, 14207, 11789,
+        18804, 17048, 5275, -7281, 1627, 341, -4821, 2194, 438, 13551, 4262, 10781,
+        5873, 3455, 10470, 8714, 17259, 3805, 8997, -1897, 4740, 8686, 9507, -74,
+        -9363, -2844, -3921, -20717, -3155, -4208, 10284, 995, 7514, -779, 3522, 7203,
+        2315, 11333, -1717, 8814, -1252, -2524, 2780, -5230, 10556, 16583, 23102, 18194,
+        15776, 22791, 21035, 9262, -3294, 5614, 4328, -834, 6181, 4425, 17538, 8249,
+        14768, 9860, 7442, 14457, 12701, 20827, 7373, 12565, 1671, 8308, 12254, 13075,
+        3913, -5376, 1143, 66, -16730, 832, -924, 22606, 13317, 19836, 11543, 15844,
+        19525, 14637, 15851, 2801, 13332, 3266, 1994, 7298, -712, 7628, 13655, 20174,
+        15266, 12848, 19863, 18107, 6334, -6222, 2686, 1400, -3762, 3253, 1497, 14610,
+        5321, 11840, 6932, 4514, 11529, 9773, 20563, 7109, 12301, -582, 8044, 11990,
+        12811, 985, -8304, -1785, -2862, -19658, -2096, -3852, 11343, 2054, 8573, 280,
+        4581, 7108, 3374, 13288, -1850, 8681, -1385, -2657, -957, -6084, 7357, 13384,
+        19903, 14995, 12577, 19592, 17836, 6063, -6493, 2415, 1129, -4033, 2982, 1226,
+        14339, 5050, 11569, 6661, 4243, 11258, 9502, 17628, 4174, 9366, -4177, 5109,
+        9055, 9876, 714, -8575, -2056, -3133, -19929, -2367, -4123, 11072, 1783, 8302,
+        9, 4310, 7991, 3103, 11112, -1938, 8593, -1473, -2745, 2559, -5451, 7530,
+        13557, 20076, 15168, 12750, 19765, 18009, 6236, -6320, 2588, 1302, -3860, 3155,
+        1399, 14512, 5223, 11742, 6834, 4416, 11431, 9675, 17801, 4347, 9539, -1355,
+        5282, 9228, 10049, 887, -8402, -1883, -2960, -19756, -2194, -3950, 11245, 1956,
+        8475, 182, 4483, 8164, 3276, 11888, -1162, 9369, -697, -1969, 3335, -4675,
+        12486, 18513, 25032, 20124, 17706, 24721, 22965, 11192, -1364, 7544, 6258, 1096,
+        8111, 6355, 20466, 11177, 17696, 12788, 10370, 17385, 15629, 22757, 9303, 14495,
+        3601, 10238, 14184, 15005, 5843, -3446, 3073, 1996, -14800, 2762, 1006, 16201,
+        6912, 13431, 5138, 9439, 13120, 8232, 16844, 3794, 14325, 4259, 2987, 8291,
+        281, 7120, 13147, 19666, 14758, 12340, 19355, 17599, 5826, -6730, 2178, 892,
+        -4270, 2745, 989, 14102, 4813, 11332, 6424, 4006, 11021, 9265, 19553, 6099,
+        11291, -1784, 7034, 10980, 11194, 477, -8812, -2293, -3370, -20166, -2604, -4360,
+        10835, 1546, 8065, -228, 4073, 7754, 2866, 11478, -1572, 8959, -3072, -2379,
+        2925, -5085, 6711, 12738, 19257, 14349, 11931, 18946, 17190, 5417, -7139, 1769,
+        483, -4679, 2336, 580, 13693, 4404, 10923, 6015, 3597, 10612, 8856, 17401,
+        3947, 9139, -1755, 4882, 8828, 9649, 68, -9221, -2702, -3779, -20575, -3013,
+        -4066, 10426, 1137, 7656, -637, 3664, 7345, 2457, 11475, -1575, 8956, -1110,
+        -2382, 2922, -5088, 10698, 16725, 23244, 18336, 15918, 22933, 21177, 9404, -3152,
+        5756, 4470, -692, 6323, 4567, 17680, 8391, 14910, 10002, 7584, 14599, 12843,
+        20969, 7515, 12707, 1813, 8450, 12396, 13217, 4055, -5234, 1285, 208, -16588,
+        974, -782, 22748, 13459, 19978, 11685, 15986, 19667, 14779, 16180, 3130, 13661,
+        3595, 2323, 7627, -383, 7770, 13797, 20316, 15408, 12990, 20005, 18249, 6476,
+        -6080, 2828, 1542, -3620, 3395, 1639, 14752, 5463, 11982, 7074, 4656, 11671,
+        9915, 19842, 6388, 11580, -1303, 7323, 11269, 12090, 1127, -8162, -1643, -2720,
+        -19516, -1954, -3710, 11021, 1732, 8251, -42, 4259, 6786, 3052, 13430, -1708,
+        8823, -1243, -2515, -815, -5942, 6617, 12644, 19163, 14255, 11837, 18852, 17096,
+        5323, -7233, 1675, 389, -4773, 2242, 486, 13599, 4310, 10829, 5921, 3503,
+        10518, 8762, 16888, 3434, 8626, -4917, 4369, 8315, 9136, -26, -9315, -2796,
+        -3873, -20669, -3107, -4863, 10001, 712, 7231, -1062, 3239, 6920, 2032, 9982,
+        -3068, 7463, -2603, -3875, 1429, -6581, 6790, 12817, 19336, 14428, 12010, 19025,
+        17269, 5496, -7060, 1848, 562, -4600, 2415, 659, 13772, 4483, 11002, 6094,
+        3676, 10691, 8935, 17061, 3607, 8799, -2095, 4542, 8488, 9309, 147, -9142,
+        -2623, -3700, -20496, -2934, -4690, 10505, 1216, 7735, -558, 3743, 7424, 2536,
+        11148, -1902, 8629, -1437, -2709, 2595, -5415, 11746, 17773, 24292, 19384, 16966,
+        23981, 22225, 10452, -2104, 6804, 5518, 356, 7371, 5615, 19726, 10437, 16956,
+        12048, 9630, 16645, 14889, 22017, 8563, 13755, 2861, 9498, 13444, 14265, 5103,
+        -4186, 2333, 1256, -15540, 2022, 266, 15461, 6172, 12691, 4398, 8699, 12380,
+        7492, 16104, 3054, 13585, 3519, 2247, 7551, -459, 6380, 12407, 18926, 14018,
+        11600, 18615, 16859, 5086, -7470, 1438, 152, -5010, 2005, 249, 13362, 4073,
+        10592, 5684, 3266, 10281, 8525, 19307, 5853, 11045, -2030, 6788, 10734, 10948,
+        -263, -9552, -3033, -4110, -20906, -3344, -5100, 10095, 806, 7325, -968, 3333,
+        7014, 2126, 10960, -2090, 8441, -3590, -2897, 2407, -5603, 5971, 11998, 18517,
+        13609, 11191, 18206, 16450, 4677, -7879, 1029, -257, -5419, 1596, -160, 12953,
+        3664, 10183, 5275, 2857, 9872, 8116, 16661, 3207, 8399, -2495, 4142, 8088,
+        8909, -672, -9961, -3442, -4519, -21315, -3753, -4806, 9686, 397, 6916, -1377,
+        2924, 6605, 1717, 10735, -2315, 8216, -1850, -3122, 2182, -5828, 9958, 15985,
+        22504, 17596, 15178, 22193, 20437, 8664, -3892, 5016, 3730, -1432, 5583, 3827,
+        16940, 7651, 14170, 9262, 6844, 13859, 12103, 20229, 6775, 11967, 1073, 7710,
+        11656, 12477, 3315, -5974, 545, -532, -17328, 234, -1522, 22008, 12719, 19238,
+        10945, 15246, 18927, 14039, 15253, 2203, 12734, 2668, 1396, 6700, -1310, 7030,
+        13057, 19576, 14668, 12250, 19265, 17509, 5736, -6820, 2088, 802, -4360, 2655,
+        899, 14012, 4723, 11242, 6334, 3916, 10931, 9175, 19965, 6511, 11703, -1180,
+        7446, 11392, 12213, 387, -8902, -2383, -3460, -20256, -2694, -4450, 10252, 963,
+        7482, -811, 3490, 6017, 2283, 14197, -941, 9590, -476, -1748, -48, -5175,
+        5006, -1363, 5156, 248, -2170, 4845, 3089, 3591, -8965, -57, -1343, -6505,
+        510, -1246, 4961, -4328, 2191, -2717, -5135, 1880, 124, 10932, -2522, 2670,
+        -6219, -2935, 2359, -428, 4961, -4328, 2191, 1114, -13876, 1880, 124, 4961,
+        -4328, 2191, -2717, -1801, 1880, -3008, 7344, -5706, 4825, -4095, -6513, -1390,
+        -6463, 2214, -4155, 2364, -2544, -4962, 2053, 297, 3764, -8792, 116, -1170,
+        -6332, 683, -1073, 5134, -4155, 2364, -2544, -4962, 2053, 297, 12937, -517,
+        4675, -1565, -930, 4364, 1577, 5134, -4155, 2364, 1287, -13703, 2053, 297,
+        5134, -4155, 2364, -2544, -1628, 2053, -2835, 8895, -4155, 6376, -2544, -4962,
+        161, -4912, 7170, 801, 7320, 2412, -6, 7009, 5253, 8720, -3836, 5072,
+        3786, -1376, 5639, 3883, 10090, 801, 7320, 2412, -6, 7009, 5253, 17893,
+        4439, 9631, 3391, 4026, 9320, 6533, 10090, 801, 7320, 6243, -8747, 7009,
+        5253, 10090, 801, 7320, 2412, 3328, 7009, 2121, 13851, 801, 11332, 2412,
+        -6, 5117, 44, 1804, -4565, 1954, -2954, -5372, 1643, -113, 3354, -9202,
+        -294, -1580, -6742, 273, -1483, 4724, -4565, 1954, -2954, -5372, 1643, -113,
+        14988, 1534, 6726, 486, 1121, 6415, 3628, 4724, -4565, 1954, 877, -14113,
+        1643, -113, 4724, -4565, 1954, -2954, -2038, 1643, -3245, 8189, -4861, 5670,
+        -5215, -5668, -545, -5618, 3154, -3215, 3304, -1604, -4022, 2993, 1237, 6555,
+        -6001, 2907, 1621, -3541, 3474, 1718, 6074, -3215, 3304, -1604, -4022, 2993,
+        1237, 13877, 423, 5615, -625, 10, 5304, 2517, 6978, -2311, 4208, 3131,
+        -11859, 3897, 2844, 6074, -3215, 3304, -1604, -688, 2993, -1895, 9221, -3829,
+        6702, -2218, -4636, 487, -4586, 5382, -987, 5532, 624, -1794, 5221, 3465,
+        6932, -5624, 3284, 1998, -3164, 3851, 2095, 8302, -987, 5532, 624, -1794,
+        5221, 3465, 16105, 2651, 7843, 1603, 2238, 7532, 4745, 8302, -987, 5532,
+        4455, -10535, 5221, 3465, 8302, -987, 5532, 624, 1540, 5221, 333, 12063,
+        -987, 9544, 624, -1794, 3329, -1744, 2454, -3915, 2604, -2304, -4722, 2293,
+        537, 4004, -8552, 356, -930, -6092, 923, -833, 5374, -3915, 2604, -2304,
+        -4722, 2293, 537, 13628, 174, 5366, -1897, -239, 5055, 2268, 5374, -3915,
+        2604, 1527, -13463, 2293, 537, 5374, -3915, 2604, -2304, -1388, 1139, -2595,
+        11229, -3909, 6622, -2298, -4716, 407, -4666, 8417, 2048, 8567, 3659, 1241,
+        8256, 6500, 7002, -5554, 3354, 2068, -3094, 3921, 2165, 8372, -917, 5602,
+        694, -1724, 5291, 3535, 16175, 2721, 7913, -976, 2308, 7602, 4815, 8372,
+        -917, 5602, 4525, -10465, 5291, 3535, 8372, -917, 5602, 694, 1610, 5291,
+        403, 10755, -2295, 8236, -684, -3102, 2021, -3052, 5625, -744, 5775, 867,
+        -1551, 5464, 3708, 8268, -4288, 4620, 3334, -1828, 5187, 3431, 8545, -744,
+        5775, 867, -1551, 5464, 3708, 16348, 2894, 8086, 1846, 2481, 7775, 4988,
+        8545, -744, 5775, 4698, -10292, 5464, 3708, 8545, -744, 5775, 867, 1783,
+        5464, 576, 12306, -744, 9787, 867, -1551, 3572, -1501, 10581, 4212, 10731,
+        5823, 3405, 10420, 8664, 12131, -425, 8483, 7197, 2035, 9050, 7294, 13501,
+        4212, 10731, 5823, 3405, 10420, 8664, 21304, 7850, 13042, 6802, 7437, 12731,
+        9944, 13501, 4212, 10731, 9654, -5336, 10420, 8664, 13501, 4212, 10731, 5823,
+        6739, 10420, 5532, 17262, 4212, 14743, 5823, 3405, 8528, 3455, 5215, -1154,
+        5365, 457, -1961, 5054, 3298, 6765, -5791, 3117, 1831, -3331, 3684, 1928,
+        8135, -1154, 5365, 457, -1961, 5054, 3298, 18399, 4945, 10137, 3897, 4532,
+        9826, 7039, 8135, -1154, 5365, 4288, -10702, 5054, 3298, 8135, -1154, 5365,
+        457, 1373, 5054, 166, 11600, -1450, 9081, -1804, -2257, 2866, -2207, 6565,
+        196, 6715, 1807, -611, 6404, 4648, 9966, -2590, 6318, 5032, -130, 6885,
+        5129, 9485, 196, 6715, 1807, -611, 6404, 4648, 17288, 3834, 9026, 2786,
+        3421, 8715, 5928, 10871, 1582, 8101, 7024, -7966, 7790, 6737, 9485, 196,
+        6715, 1807, 2723, 6404, 1516, 12632, -418, 10113, 1193, -1225, 3898, -1175,
+        8793, 2424, 8943, 4035, 1617, 8632, 6876, 10343, -2213, 6695, 5409, 247,
+        7262, 5506, 11713, 2424, 8943, 4035, 1617, 8632, 6876, 19516, 6062, 11254,
+        5014, 5649, 10943, 8156, 11713, 2424, 8943, 7866, -7124, 8632, 6876, 11713,
+        2424, 8943, 4035, 4951, 8632, 3744, 15474, 2424, 12955, 4035, 1617, 6740,
+        1667, 5865, -504, 6015, 1107, -1311, 5704, 3948, 7415, -5141, 3767, 2481,
+        -2681, 4334, 2578, 8785, -504, 6015, 1107, -1311, 5704, 3948, 17039, 3585,
+        8777, 1514, 3172, 8466, 5679, 8785, -504, 6015, 4938, -10052, 5704, 3948,
+        8785, -504, 6015, 1107, 2023, 4550, 816, 14640, -498, 10033, 1113, -1305,
+        3818, -1255, 7933, 1564, 8083, 3175, 757, 7772, 6016, 6518, -6038, 2870,
+        1584, -3578, 3437, 1681, 7888, -1401, 5118, 210, -2208, 4807, 3051, 15691,
+        2237, 7429, -1460, 1824, 7118, 4331, 7888, -1401, 5118, 4041, -10949, 4807,
+        3051, 7888, -1401, 5118, 210, 1126, 4807, -81, 10271, -2779, 7752, -1168,
+        -3586, 1537, -3536, 5141, -1228, 5291, 383, -2035, 4980, 3224, 6691, -5865,
+        3043, 1757, -3405, 3610, 1854, 8061, -1228, 5291, 383, -2035, 4980, 3224,
+        15864, 2410, 7602, 1362, 1997, 7291, 4504, 8061, -1228, 5291, 4214, -10776,
+        4980, 3224, 8061, -1228, 5291, 383, 1299, 4980, 92, 11822, -1228, 9303,
+        383, -2035, 3088, -1985, 10097, 3728, 10247, 5339, 2921, 9936, 8180, 11647,
+        -909, 7999, 6713, 1551, 8566, 6810, 13017, 3728, 10247, 5339, 2921, 9936,
+        8180, 20820, 7366, 12558, 6318, 6953, 12247, 9460, 13017, 3728, 10247, 9170,
+        -5820, 9936, 8180, 13017, 3728, 10247, 5339, 6255, 9936, 5048, 16778, 3728,
+        14259, 5339, 2921, 8044, 2971, 4731, -1638, 4881, -27, -2445, 4570, 2814,
+        6281, -6275, 2633, 1347, -3815, 3200, 1444, 7651, -1638, 4881, -27, -2445,
+        4570, 2814, 17915, 4461, 9653, 3413, 4048, 9342, 6555, 7651, -1638, 4881,
+        3804, -11186, 4570, 2814, 7651, -1638, 4881, -27, 889, 4570, -318, 11116,
+        -1934, 8597, -2288, -2741, 2382, -2691, 6081, -288, 6231, 1323, -1095, 5920,
+        4164, 9482, -3074, 5834, 4548, -614, 6401, 4645, 9001, -288, 6231, 1323,
+        -1095, 5920, 4164, 16804, 3350, 8542, 2302, 2937, 8231, 5444, 9905, 616,
+        7135, 6058, -8932, 6824, 5771, 9001, -288, 6231, 1323, 2239, 5920, 1032,
+        12148, -902, 9629, 709, -1709, 3414, -1659, 8309, 1940, 8459, 3551, 1133,
+        8148, 6392, 9859, -2697, 6211, 4925, -237, 6778, 5022, 11229, 1940, 8459,
+        3551, 1133, 8148, 6392, 19032, 5578, 10770, 4530, 5165, 10459, 7672, 11229,
+        1940, 8459, 7382, -7608, 8148, 6392, 11229, 1940, 8459, 3551, 4467, 8148,
+        3260, 14990, 1940, 12471, 3551, 1133, 6256, 1183, 5381, -988, 5531, 623,
+        -1795, 5220, 3464, 6931, -5625, 3283, 1997, -3165, 3850, 2094, 8301, -988,
+        5531, 623, -1795, 5220, 3464, 16555, 3101, 8293, 1030, 2688, 7982, 5195,
+        8301, -988, 5531, 4454, -10536, 5220, 3464, 8301, -988, 5531, 623, 1539,
+        4066, 332, 14156, -982, 9549, 629, -1789, 3334, -1739, 8410, 2041, 8560,
+        3652, 1234, 8249, 6493, 6995, -5561, 3347, 2061, -3101, 3914, 2158, 8365,
+        -924, 5595, 687, -1731, 5284, 3528, 15153, 1699, 6891, -1998, 1286, 6580,
+        3793, 8365, -924, 5595, 4518, -10472, 5284, 3528, 8832, -457, 6062, 1154,
+        2070, 5751, 863, 10606, -2444, 8087, -833, -3251, 1872, -3201, 5618, -751,
+        5768, 860, -1558, 5457, 3701, 7168, -5388, 3520, 2234, -2928, 4087, 2331,
+        8538, -751, 5768, 860, -1558, 5457, 3701, 16341, 2887, 8079, 1839, 2474,
+        7768, 4981, 8538, -751, 5768, 4691, -10299, 5457, 3701, 8538, -751, 5768,
+        860, 1776, 5457, 569, 12299, -751, 9780, 860, -1558, 3565, -1508, 10574,
+        4205, 10724, 5816, 3398, 10413, 8657, 12124, -432, 8476, 7190, 2028, 9043,
+        7287, 13494, 4205, 10724, 5816, 3398, 10413, 8657, 21297, 7843, 13035, 6795,
+        7430, 12724, 9937, 13494, 4205, 10724, 9647, -5343, 10413, 8657, 13494, 4205,
+        10724, 5816, 6732, 10413, 5525, 17255, 4205, 14736, 5816, 3398, 8521, 3448,
+        5208, -1161, 5358, 450, -1968, 5047, 3291, 6758, -5798, 3110, 1824, -3338,
+        3677, 1921, 8128, -1161, 5358, 450, -1968, 5047, 3291, 18392, 4938, 10130,
+        3890, 4525, 9819, 7032, 8128, -1161, 5358, 4281, -10709, 5047, 3291, 8128,
+        -1161, 5358, 450, 1366, 5047, 159, 11525, -1525, 9006, -1879, -2332, 2791,
+        -2282, 6558, 189, 6708, 1800, -618, 6397, 4641, 9959, -2597, 6311, 5025,
+        -137, 6878, 5122, 9478, 189, 6708, 1800, -618, 6397, 4641, 17281, 3827,
+        9019, 2779, 3414, 8708, 5921, 10382, 1093, 7612, 6535, -8455, 7301, 6248,
+        9478, 189, 6708, 1800, 2716, 6397, 1509, 12625, -425, 10106, 1186, -1232,
+        3891, -1182, 8786, 2417, 8936, 4028, 1610, 8625, 6869, 10336, -2220, 6688,
+        5402, 240, 7255, 5499, 11706, 2417, 8936, 4028, 1610, 8625, 6869, 19509,
+        6055, 11247, 5007, 5642, 10936, 8149, 11706, 2417, 8936, 7859, -7131, 8625,
+        6869, 11706, 2417, 8936, 4028, 4944, 8625, 3737, 15467, 2417, 12948, 4028,
+        1610, 6733, 1660, 5858, -511, 6008, 1100, -1318, 5697, 3941, 7408, -5148,
+        3760, 2474, -2688, 4327, 2571, 8778, -511, 6008, 1100, -1318, 5697, 3941,
+        18401, 4947, 10139, 2876, 4534, 9828, 7041, 8778, -511, 6008, 4931, -10059,
+        5697, 3941, 8778, -511, 6008, 1100, 2016, 4543, 809, 14633, -505, 10026,
+        1106, -1312, 3811, -1262, 8436, 2067, 8586, 3678, 1260, 8275, 6519, 7021,
+        -5535, 3373, 2087, -3075, 3940, 2184, 8391, -898, 5621, 713, -1705, 5310,
+        3554, 16194, 2740, 7932, -957, 2327, 7621, 4834, 8391, -898, 5621, 4544,
+        -10446, 5310, 3554, 8391, -898, 5621, 713, 1629, 5310, 422, 10774, -2276,
+        8255, -665, -3083, 2040, -3033, 5644, -725, 5794, 886, -1532, 5483, 3727,
+        7194, -5362, 3546, 2260, -2902, 4113, 2357, 8564, -725, 5794, 886, -1532,
+        5483, 3727, 16367, 2913, 8105, 1865, 2500, 7794, 5007, 8564, -725, 5794,
+        4717, -10273, 5483, 3727, 8564, -725, 5794, 886, 1802, 5483, 595, 12325,
+        -725, 9806, 886, -1532, 3591, -1482, 10600, 4231, 10750, 5842, 3424, 10439,
+        8683, 12150, -406, 8502, 7216, 2054, 9069, 7313, 13520, 4231, 10750, 5842,
+        3424, 10439, 8683, 21323, 7869, 13061, 6821, 7456, 12750, 9963, 13520, 4231,
+        10750, 9673, -5317, 10439, 8683, 13520, 4231, 10750, 5842, 6758, 10439, 5551,
+        17281, 4231, 14762, 5842, 3424, 8547, 3474, 5234, -1135, 5384, 476, -1942,
+        5073, 3317, 6784, -5772, 3136, 1850, -3312, 3703, 1947, 8154, -1135, 5384,
+        476, -1942, 5073, 3317, 18418, 4964, 10156, 3916, 4551, 9845, 7058, 8154,
+        -1135, 5384, 4307, -10683, 5073, 3317, 8154, -1135, 5384, 476, 1392, 5073,
+        185, 11619, -1431, 9100, -1785, -2238, 2885, -2188, 6584, 215, 6734, 1826,
+        -592, 6423, 4667, 9985, -2571, 6337, 5051, -111, 6904, 5148, 9504, 215,
+        6734, 1826, -592, 6423, 4667, 17307, 3853, 9045, 2805, 3440, 8734, 5947,
+        10408, 1119, 7638, 6561, -8429, 7327, 6274, 9504, 215, 6734, 1826, 2742,
+        6423, 1535, 12651, -399, 10132, 1212, -1206, 3917, -1156, 8812, 2443, 8962,
+        4054, 1636, 8651, 6895, 10362, -2194, 6714, 5428, 266, 7281, 5525, 11732,
+        2443, 8962, 4054, 1636, 8651, 6895, 19535, 6081, 11273, 5033, 5668, 10962,
+        8175, 11732, 2443, 8962, 7885, -7105, 8651, 6895, 11732, 2443, 8962, 4054,
+        4970, 8651, 3763, 15493, 2443, 12974, 4054, 1636, 6759, 1686, 5884, -485,
+        6034, 1126, -1292, 5723, 3967, 7434, -5122, 3786, 2500, -2662, 4353, 2597,
+        8804, -485, 6034, 1126, -1292, 5723, 3967, 17058, 3604, 8796, 1533, 3191,
+        8485, 5698, 8804, -485, 6034, 4957, -10033, 5723, 3967, 8804, -485, 6034,
+        1126, 2042, 4569, 835, 14659, -479, 10052, 1132, -1286, 3837, -1236, 8578,
+        2209, 8728, 3820, 1402, 8417, 6661, 7163, -5393, 3515, 2229, -2933, 4082,
+        2326, 8533, -756, 5763, 855, -1563, 5452, 3696, 16336, 2882, 8074, -815,
+        2469, 7763, 4976, 8533, -756, 5763, 4686, -10304, 5452, 3696, 8533, -756,
+        5763, 855, 1771, 5452, 564, 10916, -2134, 8397, -523, -2941, 2182, -2891,
+        5786, -583, 5936, 1028, -1390, 5625, 3869, 7336, -5220, 3688, 2402, -2760,
+        4255, 2499, 8706, -583, 5936, 1028, -1390, 5625, 3869, 16509, 3055, 8247,
+        2007, 2642, 7936, 5149, 8706, -583, 5936, 4859, -10131, 5625, 3869, 8706,
+        -583, 5936, 1028, 1944, 5625, 737, 12467, -583, 9948, 1028, -1390, 3733,
+        -1340, 10742, 4373, 10892, 5984, 3566, 10581, 8825, 12292, -264, 8644, 7358,
+        2196, 9211, 7455, 13662, 4373, 10892, 5984, 3566, 10581, 8825, 21465, 8011,
+        13203, 6963, 7598, 12892, 10105, 13662, 4373, 10892, 9815, -5175, 10581, 8825,
+        13662, 4373, 10892, 5984, 6900, 10581, 5693, 17423, 4373, 14904, 5984, 3566,
+        8689, 3616, 5376, -993, 5526, 618, -1800, 5215, 3459, 6926, -5630, 3278,
+        1992, -3170, 3845, 2089, 8296, -993, 5526, 618, -1800, 5215, 3459, 18560,
+        5106, 10298, 4058, 4693, 9987, 7200, 8296, -993, 5526, 4449, -10541, 5215,
+        3459, 8296, -993, 5526, 618, 1534, 5215, 327, 11761, -1289, 9242, -1643,
+        -2096, 3027, -2046, 6726, 357, 6876, 1968, -450, 6565, 4809, 10127, -2429,
+        6479, 5193, 31, 7046, 5290, 9646, 357, 6876, 1968, -450, 6565, 4809,
+        17449, 3995, 9187, 2947, 3582, 8876, 6089, 10550, 1261, 7780, 6703, -8287,
+        7469, 6416, 9646, 357, 6876, 1968, 2884, 6565, 1677, 12793, -257, 10274,
+        1354, -1064, 4059, -1014, 8954, 2585, 9104, 4196, 1778, 8793, 7037, 10504,
+        -2052, 6856, 5570, 408, 7423, 5667, 11874, 2585, 9104, 4196, 1778, 8793,
+        7037, 19677, 6223, 11415, 5175, 5810, 11104, 8317, 11874, 2585, 9104, 8027,
+        -6963, 8793, 7037, 11874, 2585, 9104, 4196, 5112, 8793, 3905, 15822, 2772,
+        13303, 4383, 1965, 7088, 2015, 6026, -343, 6176, 1268, -1150, 5865, 4109,
+        7576, -4980, 3928, 2642, -2520, 4495, 2739, 8946, -343, 6176, 1268, -1150,
+        5865, 4109, 17200, 3746, 8938, 1675, 3333, 8627, 5840, 8946, -343, 6176,
+        5099, -9891, 5865, 4109, 8946, -343, 6176, 1268, 2184, 4711, 977, 14801,
+        -337, 10194, 1274, -1144, 3979, -1094, 7838, 1469, 7988, 3080, 662, 7677,
+        5921, 6423, -6133, 2775, 1489, -3673, 3342, 1586, 7793, -1496, 5023, 115,
+        -2303, 4712, 2956, 15596, 2142, 7334, -1555, 1729, 7023, 4236, 7793, -1496,
+        5023, 3946, -11044, 4712, 2956, 7462, -1827, 4692, -216, 700, 4381, -507,
+        9786, -3264, 7267, -1653, -4071, 1052, -4021, 5046, -1323, 5196, 288, -2130,
+        4885, 3129, 6596, -5960, 2948, 1662, -3500, 3515, 1759, 7966, -1323, 5196,
+        288, -2130, 4885, 3129, 15769, 2315, 7507, 1267, 1902, 7196, 4409, 7966,
+        -1323, 5196, 4119, -10871, 4885, 3129, 7966, -1323, 5196, 288, 1204, 4885,
+        -3, 11727, -1323, 9208, 288, -2130, 2993, -2080, 10002, 3633, 10152, 5244,
+        2826, 9841, 8085, 11552, -1004, 7904, 6618, 1456, 8471, 6715, 12922, 3633,
+        10152, 5244, 2826, 9841, 8085, 20725, 7271, 12463, 6223, 6858, 12152, 9365,
+        12922, 3633, 10152, 9075, -5915, 9841, 8085, 12922, 3633, 10152, 5244, 6160,
+        9841, 4953, 16683, 3633, 14164, 5244, 2826, 7949, 2876, 4636, -1733, 4786,
+        -122, -2540, 4475, 2719, 6186, -6370, 2538, 1252, -3910, 3105, 1349, 7556,
+        -1733, 4786, -122, -2540, 4475, 2719, 18818, 5364, 10556, 4316, 4951, 10245,
+        7458, 7556, -1733, 4786, 3709, -11281, 4475, 2719, 7556, -1733, 4786, -122,
+        794, 4475, -413, 11270, -1780, 8751, -2134, -2587, 2536, -2537, 5986, -383,
+        6136, 1228, -1190, 5825, 4069, 9387, -3169, 5739, 4453, -709, 6306, 4550,
+        8906, -383, 6136, 1228, -1190, 5825, 4069, 16709, 3255, 8447, 2207, 2842,
+        8136, 5349, 9810, 521, 7040, 5963, -9027, 6729, 5676, 8906, -383, 6136,
+        1228, 2144, 5825, 937, 12053, -997, 9534, 614, -1804, 3319, -1754, 8214,
+        1845, 8364, 3456, 1038, 8053, 6297, 9764, -2792, 6116, 4830, -332, 6683,
+        4927, 11134, 1845, 8364, 3456, 1038, 8053, 6297, 18937, 5483, 10675, 4435,
+        5070, 10364, 7577, 11134, 1845, 8364, 7287, -7703, 8053, 6297, 11134, 1845,
+        8364, 3456, 4372, 8053, 3165, 14895, 1845, 12376, 3456, 1038, 6161, 1088,
+        5286, -1083, 5436, 528, -1890, 5125, 3369, 6836, -5720, 3188, 1902, -3260,
+        3755, 1999, 8206, -1083, 5436, 528, -1890, 5125, 3369, 16460, 3006, 8198,
+        935, 2593, 7887, 5100, 8206, -1083, 5436, 4359, -10631, 5125, 3369, 8786,
+        -503, 6016, 1108, 2024, 4551, 817, 15371, 233, 10764, 1844, -574, 4549,
+        -524, 14943, 8574, 15093, 10185, 7767, 14782, 13026, 1829, -10727, -1819, -3105,
+        -8267, -1252, -2082, -13, -9302, -3756, -7691, -10109, -3094, -4850, 8343, -5111,
+        81, -8808, -5524, -230, -3017, 3199, -6090, 429, -648, -15638, 118, -1638,
+        3199, -6090, 429, -4479, -3563, 118, -4770, 5582, -7468, 3063, -5857, -10311,
+        -3152, -7959, 452, -5917, 602, -4306, -6724, 291, -1465, 2002, -13317, -1646,
+        -2932, -8094, -1079, -1909, 160, -9129, -3583, -7518, -9936, -2921, -4677, 10348,
+        -3106, 2086, -4154, -3519, 1775, -1012, 3372, -5917, 602, -475, -15285, 291,
+        -1465, 3372, -5917, 602, -4306, -3390, 291, -4597, 7133, -5917, 4614, -4306,
+        -8760, -1601, -6408, 5408, -961, 5558, 650, -1768, 5247, 3491, 6958, -5598,
+        3310, 2024, -3138, 3877, 3047, 5116, -4173, 1373, -2562, -4980, 2035, 279,
+        15304, 1850, 7042, 802, 1437, 6731, 3944, 8328, -961, 5558, 4481, -10509,
+        5247, 3491, 8328, -961, 5558, 650, 1566, 5247, 359, 12089, -961, 9570,
+        650, -3804, 3355, -1452, 42, -6327, 192, -4716, -7134, -119, -1875, 1592,
+        -10964, -2056, -3342, -8504, -1489, -2319, -250, -9539, -3993, -7928, -10346, -3331,
+        -5087, 11994, -1460, 3732, -6515, -1873, 3421, 1260, 2962, -6327, 192, -885,
+        -15875, -119, -1875, 2962, -6327, 192, -4716, -3800, -119, -5007, 6427, -6623,
+        3908, -7470, -9466, -2307, -5179, -850, -7219, -700, -5608, -8026, -1011, -2767,
+        4793, -7763, 1145, -141, -13459, 1712, 882, 1100, -8189, -2643, -6578, -8996,
+        -1981, -3737, 10495, -2959, 2233, -4007, -3372, 1922, -865, 5216, -4073, 2446,
+        1369, -13621, 2135, 1082, 4312, -4977, 1542, -3366, -2450, 1231, -3657, 9257,
+        -3793, 6738, -2182, -6636, 523, -4284, 3620, -2749, 3770, -1138, -3556, 3459,
+        1703, 5170, -7386, 1522, 236, -4926, 2089, 1259, 3328, -5961, -415, -4350,
+        -6768, 247, -1509, 13516, 62, 5254, -986, -351, 4943, 2156, 6540, -2749,
+        3770, 2693, -12297, 3459, 1703, 6540, -2749, 3770, -1138, -222, 3459, -1429,
+        7899, -5151, 5380, -3540, -7994, -835, -5642, 692, -5677, 842, -4066, -6484,
+        531, -1225, 2242, -10314, -1406, -2692, -7854, -839, -1669, 400, -8889, -3343,
+        -7278, -9696, -2681, -4437, 11039, -2415, 2777, -4486, -2828, 2466, -1894, 3612,
+        -5677, 842, -235, -15225, 531, -1225, 4051, -5238, 1281, -3627, -2711, -184,
+        -3918, 12231, -3387, 7144, 670, -6230, 929, -4172, 18354, 11985, 18504, 13596,
+        11178, 18193, 16437, 5240, -7316, 1592, 306, -4856, 2159, 1329, 3398, -5891,
+        -345, -4280, -6698, 317, -1439, 13586, 132, 5324, -3565, -281, 5013, 2226,
+        6610, -2679, 3840, 2763, -12227, 3529, 1773, 6610, -2679, 3840, -1068, -152,
+        3529, -1359, 8993, -4057, 6474, -2446, -6900, 259, -4548, 3863, -2506, 4013,
+        -895, -3313, 3702, 1946, 6506, -8813, 2858, 1572, -3590, 3425, 2595, 3571,
+        -5718, -172, -4107, -6525, 490, -1266, 13759, 305, 5497, -743, -108, 5186,
+        2399, 6783, -2506, 4013, 2936, -11874, 3702, 1946, 6783, -2506, 4013, -895,
+        21, 3702, -1186, 10544, -2506, 8025, -895, -5349, 1810, -2997, 8819, 2450,
+        8969, 4061, 1643, 8658, 6902, 10369, -2187, 6721, 5435, 273, 7288, 6458,
+        8527, -762, 4784, 849, -1569, 5446, 3690, 18715, 5261, 10453, 4213, 4848,
+        10142, 7355, 11739, 2450, 8969, 7892, -7098, 8658, 6902, 11739, 2450, 8969,
+        4061, 4977, 8658, 3770, 15500, 2450, 12981, 4061, -393, 6766, 1959, 3453,
+        -2916, 3603, -1305, -3723, 3292, 1536, 5003, -7553, 1355, 69, -5093, 1922,
+        1092, 3161, -6128, -582, -4517, -6935, 80, -1676, 16090, 2636, 7828, -2419,
+        2223, 7517, 5356, 6373, -2916, 3603, 2526, -12464, 3292, 1536, 6373, -2916,
+        3603, -1305, -389, 3292, -1596, 9838, -3212, 7319, -4059, -6055, 1104, -1768,
+        2561, -3808, 2711, -2197, -4615, 2400, 644, 8204, -4352, 4556, 3270, -10048,
+        5123, 4293, 4511, -4778, 768, -3167, -5585, 1430, -326, 13906, 452, 5644,
+        -596, 39, 5333, 2546, 9109, -180, 6339, 5262, -9728, 6028, 4975, 7723,
+        -1566, 4953, 45, 961, 4642, -246, 12668, -382, 10149, 1229, -3225, 3934,
+        -873, 7031, 662, 7181, 2273, -145, 6870, 5114, 8581, -3975, 4933, 3647,
+        -1515, 5500, 4670, 6739, -2550, 2996, -939, -3357, 3658, 1902, 16927, 3473,
+        8665, 2425, 3060, 8354, 5567, 9951, 662, 7181, 6104, -8886, 6870, 5114,
+        9951, 662, 7181, 2273, 3189, 6870, 1982, 11310, -1740, 8791, -129, -4583,
+        2576, -2231, 4103, -2266, 4253, -655, -3073, 3942, 2186, 5653, -6903, 2005,
+        719, -4443, 2572, 1742, 3811, -5478, 68, -3867, -6285, 730, -1026, 14450,
+        996, 6188, -1075, 583, 5877, 1517, 7023, -2266, 4253, 3176, -11814, 3942,
+        2186, 7462, -1827, 4692, -216, 700, 3227, -507, 15532, -86, 10445, 3971,
+        -2929, 4230, -871, 17870, 11501, 18020, 13112, 10694, 17709, 15953, 4756, -7800,
+        1108, -178, -5340, 1675, 845, 2914, -6375, -829, -4764, -7182, -167, -1923,
+        13102, -352, 4840, -4049, -765, 4529, 1742, 6126, -3163, 3356, 2279, -12711,
+        3045, 1289, 6126, -3163, 3356, -1552, -636, 3045, -1843, 8509, -4541, 5990,
+        -2930, -7384, -225, -5032, 3379, -2990, 3529, -1379, -3797, 3218, 1462, 4929,
+        -10390, 1281, -5, -5167, 1848, 1018, 3087, -6202, -656, -4591, -7009, 6,
+        -1750, 13275, -179, 5013, -1227, -592, 4702, 1915, 6299, -2990, 3529, 2452,
+        -12358, 3218, 1462, 6299, -2990, 3529, -1379, -463, 3218, -1670, 10060, -2990,
+        7541, -1379, -5833, 1326, -3481, 8335, 1966, 8485, 3577, 1159, 8174, 6418,
+        9885, -2671, 6237, 4951, -211, 6804, 5974, 8043, -1246, 4300, 365, -2053,
+        4962, 3206, 18231, 4777, 9969, 3729, 4364, 9658, 6871, 11255, 1966, 8485,
+        7408, -7582, 8174, 6418, 11255, 1966, 8485, 3577, 4493, 8174, 3286, 15016,
+        1966, 12497, 3577, -877, 6282, 1475, 2969, -3400, 3119, -1789, -4207, 2808,
+        1052, 4519, -8037, 871, -415, -5577, 1438, 608, 2677, -6612, -1066, -5001,
+        -7419, -404, -2160, 15606, 2152, 7344, -2903, 1739, 7033, 4872, 5889, -3400,
+        3119, 2042, -12948, 2808, 1052, 5889, -3400, 3119, -1789, -873, 2808, -2080,
+        9354, -3696, 6835, -4543, -6539, 620, -2252, 2077, -4292, 2227, -2681, -5099,
+        1916, 160, 7720, -4836, 4072, 2786, -10532, 4639, 3809, 4027, -5262, 284,
+        -3651, -6069, 946, -810, 13422, -32, 5160, -1080, -445, 4849, 2062, 8143,
+        -1146, 5373, 4296, -10694, 5062, 4009, 7239, -2050, 4469, -439, 477, 4158,
+        -730, 12184, -866, 9665, 745, -3709, 3450, -1357, 6547, 178, 6697, 1789,
+        -629, 6386, 4630, 8097, -4459, 4449, 3163, -1999, 5016, 4186, 6255, -3034,
+        2512, -1423, -3841, 3174, 1418, 16443, 2989, 8181, 1941, 2576, 7870, 5083,
+        9467, 178, 6697, 5620, -9370, 6386, 4630, 9467, 178, 6697, 1789, 2705,
+        6386, 1498, 10826, -2224, 8307, -613, -5067, 2092, -2715, 3619, -2750, 3769,
+        -1139, -3557, 3458, 1702, 5169, -7387, 1521, 235, -4927, 2088, 1258, 3327,
+        -5962, -416, -4351, -6769, 246, -1510, 13966, 512, 5704, -1559, 99, 5393,
+        1033, 6539, -2750, 3769, 2692, -12298, 3458, 1702, 6978, -2311, 4208, -700,
+        216, 2743, -991, 15048, -570, 9961, 3487, -3413, 3746, -1355, 18347, 11978,
+        18497, 13589, 11171, 18186, 16430, 5233, -7323, 1585, 299, -4863, 2152, 1322,
+        3391, -5898, -352, -4287, -6705, 310, -1446, 12564, -890, 4302, -4587, -1303,
+        3991, 1204, 6603, -2686, 3833, 2756, -12234, 3522, 1766, 7070, -2219, 4300,
+        -608, 308, 3989, -899, 8844, -4206, 6325, -2595, -7049, 110, -4697, 3856,
+        -2513, 4006, -902, -3320, 3695, 1939, 5406, -9913, 1758, 472, -4690, 2325,
+        1495, 3564, -5725, -179, -4114, -6532, 483, -1273, 13752, 298, 5490, -750,
+        -115, 5179, 2392, 6776, -2513, 4006, 2929, -11881, 3695, 1939, 6776, -2513,
+        4006, -902, 14, 3695, -1193, 10537, -2513, 8018, -902, -5356, 1803, -3004,
+        8812, 2443, 8962, 4054, 1636, 8651, 6895, 10362, -2194, 6714, 5428, 266,
+        7281, 6451, 8520, -769, 4777, 842, -1576, 5439, 3683, 18708, 5254, 10446,
+        4206, 4841, 10135, 7348, 11732, 2443, 8962, 7885, -7105, 8651, 6895, 11732,
+        2443, 8962, 4054, 4970, 8651, 3763, 15493, 2443, 12974, 4054, -400, 6759,
+        1952, 3446, -2923, 3596, -1312, -3730, 3285, 1529, 4996, -7560, 1348, 62,
+        -5100, 1915, 1085, 3154, -6135, -589, -4524, -6942, 73, -1683, 16083, 2629,
+        7821, -2426, 2216, 7510, 5349, 6366, -2923, 3596, 2519, -12471, 3285, 1529,
+        6366, -2923, 3596, -1312, -396, 3285, -1603, 11107, -1943, 8588, -2790, -4786,
+        2373, -499, 2554, -3815, 2704, -2204, -4622, 2393, 637, 8197, -4359, 4549,
+        3263, -10055, 5116, 4286, 4504, -4785, 761, -3174, -5592, 1423, -333, 13899,
+        445, 5637, -603, 32, 5326, 2539, 8620, -669, 5850, 4773, -10217, 5539,
+        4486, 7716, -1573, 4946, 38, 954, 4635, -253, 12661, -389, 10142, 1222,
+        -3232, 3927, -880, 7024, 655, 7174, 2266, -152, 6863, 5107, 8574, -3982,
+        4926, 3640, -1522, 5493, 4663, 6732, -2557, 2989, -946, -3364, 3651, 1895,
+        16920, 3466, 8658, 2418, 3053, 8347, 5560, 9944, 655, 7174, 6097, -8893,
+        6863, 5107, 9944, 655, 7174, 2266, 3182, 6863, 1975, 11303, -1747, 8784,
+        -136, -4590, 2569, -2238, 4096, -2273, 4246, -662, -3080, 3935, 2179, 5646,
+        -6910, 1998, 712, -4450, 2565, 1735, 3804, -5485, 61, -3874, -6292, 723,
+        -1033, 15812, 2358, 7550, 287, 1945, 7239, 2879, 7016, -2273, 4246, 3169,
+        -11821, 3935, 2179, 7455, -1834, 4685, -223, 693, 3220, -514, 16148, 530,
+        11061, 4587, -2313, 4846, -255, 18373, 12004, 18523, 13615, 11197, 18212, 16456,
+        5259, -7297, 1611, 325, -4837, 2178, 1348, 3417, -5872, -326, -4261, -6679,
+        336, -1420, 13605, 151, 5343, -3546, -262, 5032, 2245, 6629, -2660, 3859,
+        2782, -12208, 3548, 1792, 6629, -2660, 3859, -1049, -133, 3548, -1340, 9012,
+        -4038, 6493, -2427, -6881, 278, -4529, 3882, -2487, 4032, -876, -3294, 3721,
+        1965, 5432, -9887, 1784, 498, -4664, 2351, 1521, 3590, -5699, -153, -4088,
+        -6506, 509, -1247, 13778, 324, 5516, -724, -89, 5205, 2418, 9594, 305,
+        6824, 5747, -9063, 6513, 4757, 6802, -2487, 4032, -876, 40, 3721, -1167,
+        10563, -2487, 8044, -876, -5330, 1829, -2978, 8838, 2469, 8988, 4080, 1662,
+        8677, 6921, 10388, -2168, 6740, 5454, 292, 7307, 6477, 8546, -743, 4803,
+        868, -1550, 5465, 3709, 18734, 5280, 10472, 4232, 4867, 10161, 7374, 11758,
+        2469, 8988, 7911, -7079, 8677, 6921, 11758, 2469, 8988, 4080, 4996, 8677,
+        3789, 15519, 2469, 13000, 4080, -374, 6785, 1978, 3472, -2897, 3622, -1286,
+        -3704, 3311, 1555, 5022, -7534, 1374, 88, -5074, 1941, 1111, 3180, -6109,
+        -563, -4498, -6916, 99, -1657, 16109, 2655, 7847, -2400, 2242, 7536, 5375,
+        6392, -2897, 3622, 2545, -12445, 3311, 1555, 6392, -2897, 3622, -1286, -370,
+        3311, -1577, 9857, -3193, 7338, -4040, -6036, 1123, -1749, 2580, -3789, 2730,
+        -2178, -4596, 2419, 663, 8902, -3654, 5254, 3968, -9350, 5821, 4991, 4530,
+        -4759, 787, -3148, -5566, 1449, -307, 13925, 471, 5663, -577, 58, 5352,
+        2565, 8646, -643, 5876, 4799, -10191, 5565, 4512, 7742, -1547, 4972, 64,
+        980, 4661, -227, 12687, -363, 10168, 1248, -3206, 3953, -854, 7050, 681,
+        7200, 2292, -126, 6889, 5133, 8600, -3956, 4952, 3666, -1496, 5519, 4689,
+        6758, -2531, 3015, -920, -3338, 3677, 1921, 16946, 3492, 8684, 2444, 3079,
+        8373, 5586, 9970, 681, 7200, 6123, -8867, 6889, 5133, 9970, 681, 7200,
+        2292, 3208, 6889, 2001, 11329, -1721, 8810, -110, -4564, 2595, -2212, 4122,
+        -2247, 4272, -636, -3054, 3961, 2205, 5672, -6884, 2024, 738, -4424, 2591,
+        1761, 3830, -5459, 87, -3848, -6266, 749, -1007, 14469, 1015, 6207, -1056,
+        602, 5896, 1536, 7042, -2247, 4272, 3195, -11795, 3961, 2205, 7481, -1808,
+        4711, -197, 719, 3246, -488, 16138, 520, 11051, 4577, -2323, 4836, -265,
+        18515, 12146, 18665, 13757, 11339, 18354, 16598, 5401, -7155, 1753, 467, -4695,
+        2320, 1490, 3559, -5730, -184, -4119, -6537, 478, -1278, 13747, 293, 5485,
+        -3404, -120, 5174, 2387, 6771, -2518, 4001, 2924, -12066, 3690, 1934, 6771,
+        -2518, 4001, -907, 9, 3690, -1198, 9154, -3896, 6635, -2285, -6739, 420,
+        -4387, 4024, -2345, 4174, -734, -3152, 3863, 2107, 5574, -9745, 1926, 640,
+        -4522, 2493, 1663, 3732, -5557, -11, -3946, -6364, 651, -1105, 13920, 466,
+        5658, -582, 53, 5347, 2560, 6944, -2345, 4174, 3097, -11713, 3863, 2107,
+        6944, -2345, 4174, -734, 182, 3863, -1025, 10705, -2345, 8186, -734, -5188,
+        1971, -2836, 8980, 2611, 9130, 4222, 1804, 8819, 7063, 10530, -2026, 6882,
+        5596, 434, 7449, 6619, 8688, -601, 4945, 1010, -1408, 5607, 3851, 18876,
+        5422, 10614, 4374, 5009, 10303, 7516, 11900, 2611, 9130, 8053, -6937, 8819,
+        7063, 11900, 2611, 9130, 4222, 5138, 8819, 3931, 15661, 2611, 13142, 4222,
+        -232, 6927, 2120, 3614, -2755, 3764, -1144, -3562, 3453, 1697, 5164, -7392,
+        1516, 230, -4932, 2083, 1253, 3322, -5967, -421, -4356, -6774, 241, -1515,
+        16251, 2797, 7989, -2258, 2384, 7678, 5517, 6534, -2755, 3764, 2687, -12303,
+        3453, 1697, 6534, -2755, 3764, -1144, -228, 3453, -1435, 9999, -3051, 7480,
+        -3898, -5894, 1265, -1607, 2722, -3647, 2872, -2036, -4454, 2561, 805, 8365,
+        -4191, 4717, 3431, -9887, 5284, 4454, 4672, -4617, 929, -3006, -5424, 1591,
+        -165, 14067, 613, 5805, -435, 200, 5494, 2707, 8788, -501, 6018, 4941,
+        -10049, 5707, 4654, 7884, -1405, 5114, 206, 1122, 4803, -85, 12829, -221,
+        10310, 1390, -3064, 4095, -712, 7192, 823, 7342, 2434, 16, 7031, 5275,
+        8742, -3814, 5094, 3808, -1354, 5661, 4831, 6900, -2389, 3157, -778, -3196,
+        3819, 2063, 17088, 3634, 8826, 2586, 3221, 8515, 5728, 10112, 823, 7342,
+        6265, -8725, 7031, 5275, 10112, 823, 7342, 2434, 3350, 7031, 2143, 11658,
+        -1392, 9139, 219, -4235, 2924, -1883, 4264, -2105, 4414, -494, -2912, 4103,
+        2347, 5814, -6742, 2166, 880, -4282, 2733, 1903, 3972, -5317, 229, -3706,
+        -6124, 891, -865, 14611, 1157, 6349, -914, 744, 6038, 1678, 7184, -2105,
+        4414, 3337, -11653, 4103, 2347, 7623, -1666, 4853, -55, 861, 3388, -346,
+        15693, 75, 10606, 4132, -2768, 4391, -710, 17775, 11406, 17925, 13017, 10599,
+        17614, 15858, 4661, -7895, 1013, -273, -5435, 1580, 750, 2819, -6470, -924,
+        -4859, -7277, -262, -2018, 13007, -447, 4745, -4144, -860, 4434, 1647, 6031,
+        -3258, 3261, 2184, -12806, 2950, 1194, 5700, -3589, 2930, -1978, -1062, 2619,
+        -2269, 8024, -5026, 5505, -3415, -7869, -710, -5517, 3284, -3085, 3434, -1474,
+        -3892, 3123, 1367, 4834, -10485, 1186, -100, -5262, 1753, 923, 2992, -6297,
+        -751, -4686, -7104, -89, -1845, 13180, -274, 4918, -1322, -687, 4607, 1820,
+        6204, -3085, 3434, 2357, -12453, 3123, 1367, 6204, -3085, 3434, -1474, -558,
+        3123, -1765, 9965, -3085, 7446, -1474, -5928, 1231, -3576, 8240, 1871, 8390,
+        3482, 1064, 8079, 6323, 9790, -2766, 6142, 4856, -306, 6709, 5879, 7948,
+        -1341, 4205, 270, -2148, 4867, 3111, 18136, 4682, 9874, 3634, 4269, 9563,
+        6776, 11160, 1871, 8390, 7313, -7677, 8079, 6323, 11160, 1871, 8390, 3482,
+        4398, 8079, 3191, 14921, 1871, 12402, 3482, -972, 6187, 1380, 2874, -3495,
+        3024, -1884, -4302, 2713, 957, 4424, -8132, 776, -510, -5672, 1343, 513,
+        2582, -6707, -1161, -5096, -7514, -499, -2255, 17506, 4052, 9244, -1003, 3639,
+        8933, 6772, 5794, -3495, 3024, 1947, -13043, 2713, 957, 5794, -3495, 3024,
+        -1884, -968, 2713, -2175, 9508, -3542, 6989, -4389, -6385, 774, -2098, 1982,
+        -4387, 2132, -2776, -5194, 1821, 65, 7625, -4931, 3977, 2691, -10627, 4544,
+        3714, 3932, -5357, 189, -3746, -6164, 851, -905, 13327, -127, 5065, -1175,
+        -540, 4754, 1967, 8048, -1241, 5278, 4201, -10789, 4967, 3914, 7144, -2145,
+        4374, -534, 382, 4063, -825, 12089, -961, 9570, 650, -3804, 3355, -1452,
+        6452, 83, 6602, 1694, -724, 6291, 4535, 8002, -4554, 4354, 3068, -2094,
+        4921, 4091, 6160, -3129, 2417, -1518, -3936, 3079, 1323, 16348, 2894, 8086,
+        1846, 2481, 7775, 4988, 9372, 83, 6602, 5525, -9465, 6291, 4535, 9372,
+        83, 6602, 1694, 2610, 6291, 1403, 11212, -1838, 8693, -227, -4681, 2478,
+        -2329, 3524, -2845, 3674, -1234, -3652, 3363, 1607, 5074, -7482, 1426, 140,
+        -5022, 1993, 1163, 3232, -6057, -511, -4446, -6864, 151, -1605, 15600, 2146,
+        7338, 75, 1733, 7027, 2667, 6444, -2845, 3674, 2597, -12393, 3363, 1607,
+        7463, -1826, 4693, -215, 701, 3228, -506, 16609, 991, 11522, 5048, -1852,
+        5307, 206, 7560, 13587, 20106, 15198, 12780, 19795, 18039, 3301, -9255, -347,
+        -1633, -6795, 220, -1536, 11577, 2288, 8807, 3899, 1481, 8496, 6740, 13034,
+        -420, 4772, -8771, 515, 4461, 5435, -2048, -11337, -4818, -5895, -22691, -5129,
+        -6885, 8310, -979, 5540, -2753, 1548, 5229, 341, 8350, -4700, 5831, -3089,
+        -5507, -384, -9352, 4768, 10795, 17314, 12406, 9988, 17003, 15247, 3474, -9082,
+        -174, -1460, -6622, 393, -1363, 11750, 2461, 8980, 4072, 1654, 8669, 6913,
+        15039, 1585, 6777, -4117, 2520, 6466, 7440, -1875, -11164, -4645, -5722, -22518,
+        -4956, -6712, 8483, -806, 5713, -2580, 1721, 5402, 514, 9126, -3924, 6607,
+        -2313, -4731, 392, -8576, 9724, 15751, 22270, 17362, 14944, 21959, 20203, 8430,
+        -4126, 4782, 3496, -1666, 5349, 3593, 17704, 8415, 14934, 10026, 7608, 14623,
+        12867, 19995, 6541, 11733, 839, 7476, 11422, 12396, 3081, -6208, 311, -766,
+        -17562, 0, -1756, 13439, 4150, 10669, 2376, 6677, 10358, 5470, 14082, 1032,
+        11563, 2643, 225, 5348, -3620, 4358, 10385, 16904, 11996, 9578, 16593, 14837,
+        3064, -9492, -584, -1870, -7032, -17, -1773, 11340, 2051, 8570, 3662, 1244,
+        8259, 6503, 16791, 3337, 8529, -4546, 4272, 8218, 8585, -2285, -11574, -5055,
+        -6132, -22928, -5366, -7122, 8073, -1216, 5303, -2990, 1311, 4992, 104, 8420,
+        -4630, 5901, -4984, -5437, -314, -9282, 5708, 11735, 18254, 13346, 10928, 17943,
+        16187, 6265, -6291, 2617, 1331, -3831, 3184, 1428, 12690, 3401, 9920, 5012,
+        2594, 9609, 7853, 16398, 2944, 8136, -2758, 3879, 7825, 8799, -31, -9320,
+        -2801, -3878, -20674, -3112, -4165, 9423, 134, 6653, -1640, 2661, 6342, 1454,
+        9452, -3598, 6933, -1987, -4405, 718, -8250, 7936, 13963, 20482, 15574, 13156,
+        20171, 18415, 6642, -5914, 2994, 1708, -3454, 3561, 1805, 14918, 5629, 12148,
+        7240, 4822, 11837, 10081, 18207, 4753, 9945, -949, 5688, 9634, 10608, 1293,
+        -7996, -1477, -2554, -19350, -1788, -3544, 19986, 10697, 17216, 8923, 13224, 16905,
+        12017, 13851, 801, 11332, 2412, -6, 5117, -3851, 5008, 11035, 17554, 12646,
+        10228, 17243, 15487, 3714, -8842, 66, -1220, -6382, 633, -1123, 11990, 2701,
+        9220, 4312, 1894, 8909, 7153, 18394, 4940, 10132, -2751, 5875, 9821, 10795,
+        -1635, -10924, -4405, -5482, -22278, -4716, -6472, 8723, -566, 5953, -2340, 1961,
+        4488, 754, 10668, -4470, 6061, -2859, -5277, -3758, -9843, 10971, 16998, 23517,
+        18609, 16191, 23206, 21450, 6712, -5844, 3064, 1778, -3384, 3631, 1875, 14988,
+        5699, 12218, 7310, 4892, 11907, 10151, 18277, 4823, 10015, -3528, 5758, 9704,
+        10678, 1363, -7926, -1407, -2484, -19280, -1718, -3474, 11721, 2432, 8951, 658,
+        4959, 8640, 3752, 11761, -1289, 9242, 322, -2096, 3027, -5941, 8179, 14206,
+        20725, 15817, 13399, 20414, 18658, 7978, -4578, 4330, 3044, -2118, 4897, 3141,
+        15161, 5872, 12391, 7483, 5065, 12080, 10324, 18450, 4996, 10188, -706, 5931,
+        9877, 10851, 1536, -7753, -1234, -2311, -19107, -1545, -3301, 11894, 2605, 9124,
+        831, 5132, 8813, 3925, 12537, -513, 10018, 1098, -1320, 3803, -5165, 13135,
+        19162, 25681, 20773, 18355, 25370, 23614, 11841, -715, 8193, 6907, 1745, 8760,
+        7004, 21115, 11826, 18345, 13437, 11019, 18034, 16278, 23406, 9952, 15144, 4250,
+        10887, 14833, 15807, 6492, -2797, 3722, 2645, -14151, 3411, 1655, 16850, 7561,
+        14080, 5787, 10088, 13769, 8881, 17493, 4443, 14974, 6054, 3636, 8759, -209,
+        7769, 13796, 20315, 15407, 12989, 20004, 18248, 6475, -6081, 2827, 1541, -3621,
+        3394, 1638, 14751, 5462, 11981, 7073, 4655, 11670, 9914, 20202, 6748, 11940,
+        -1135, 7683, 11629, 11996, 1126, -8163, -1644, -2721, -19517, -1955, -3711, 11484,
+        2195, 8714, 421, 4722, 8403, 3515, 11831, -1219, 9312, -1573, -2026, 3097,
+        -5871, 9119, 15146, 21665, 16757, 14339, 21354, 19598, 9676, -2880, 6028, 4742,
+        -420, 6595, 4839, 16101, 6812, 13331, 8423, 6005, 13020, 11264, 19809, 6355,
+        11547, 653, 7290, 11236, 12210, 3862, -5427, 1092, 15, -16781, 781, -272,
+        12834, 3545, 10064, 1771, 6072, 9753, 4865, 12863, -187, 10344, 1424, -994,
+        4129, -4839, 11347, 17374, 23893, 18985, 16567, 23582, 21826, 10053, -2503, 6405,
+        5119, -43, 6972, 5216, 18329, 9040, 15559, 10651, 8233, 15248, 13492, 21618,
+        8164, 13356, 2462, 9099, 13045, 14019, 4704, -4585, 1934, 857, -15939, 1623,
+        -133, 23397, 14108, 20627, 12334, 16635, 20316, 15428, 16642, 3592, 14123, 5203,
+        2785, 7908, -1060, 8419, 14446, 20965, 16057, 13639, 20654, 18898, 7125, -5431,
+        3477, 2191, -2971, 4044, 2288, 15401, 6112, 12631, 7723, 5305, 12320, 10564,
+        21805, 8351, 13543, 660, 9286, 13232, 14206, 1776, -7513, -994, -2071, -18867,
+        -1305, -3061, 12134, 2845, 9364, 1071, 5372, 7899, 4165, 14079, -1059, 9472,
+        552, -1866, -347, -6432, 10487, 16514, 23033, 18125, 15707, 22722, 20966, 6228,
+        -6328, 2580, 1294, -3868, 3147, 1391, 14504, 5215, 11734, 6826, 4408, 11423,
+        9667, 17793, 4339, 9531, -4012, 5274, 9220, 10194, 879, -8410, -1891, -2968,
+        -19764, -2202, -3958, 11237, 1948, 8467, 174, 4475, 8156, 3268, 11277, -1773,
+        8758, -162, -2580, 2543, -6425, 7695, 13722, 20241, 15333, 12915, 19930, 18174,
+        6401, -6155, 2753, 1467, -3695, 3320, 1564, 14677, 5388, 11907, 6999, 4581,
+        11596, 9840, 17966, 4512, 9704, -1190, 5447, 9393, 10367, 1052, -8237, -1718,
+        -2795, -19591, -2029, -3785, 11410, 2121, 8640, 347, 4648, 8329, 3441, 12053,
+        -997, 9534, 614, -1804, 3319, -5649, 12651, 18678, 25197, 20289, 17871, 24886,
+        23130, 11357, -1199, 7709, 6423, 1261, 8276, 6520, 20631, 11342, 17861, 12953,
+        10535, 17550, 15794, 22922, 9468, 14660, 3766, 10403, 14349, 15323, 6008, -3281,
+        3238, 2161, -14635, 2927, 1171, 16366, 7077, 13596, 5303, 9604, 13285, 8397,
+        17009, 3959, 14490, 5570, 3152, 8275, -693, 7285, 13312, 19831, 14923, 12505,
+        19520, 17764, 5991, -6565, 2343, 1057, -4105, 2910, 1154, 14267, 4978, 11497,
+        6589, 4171, 11186, 9430, 19718, 6264, 11456, -1619, 7199, 11145, 11512, 642,
+        -8647, -2128, -3205, -20001, -2439, -4195, 11000, 1711, 8230, -63, 4238, 7919,
+        3031, 11347, -1703, 8828, -2057, -2510, 2613, -6355, 8635, 14662, 21181, 16273,
+        13855, 20870, 19114, 9192, -3364, 5544, 4258, -904, 6111, 4355, 15617, 6328,
+        12847, 7939, 5521, 12536, 10780, 19325, 5871, 11063, 169, 6806, 10752, 11726,
+        2896, -6393, 126, -951, -17747, -185, -1238, 12350, 3061, 9580, 1287, 5588,
+        9269, 4381, 12379, -671, 9860, 940, -1478, 3645, -5323, 10863, 16890, 23409,
+        18501, 16083, 23098, 21342, 9569, -2987, 5921, 4635, -527, 6488, 4732, 17845,
+        8556, 15075, 10167, 7749, 14764, 13008, 21134, 7680, 12872, 1978, 8615, 12561,
+        13535, 4220, -5069, 1450, 373, -16423, 1139, -617, 22913, 13624, 20143, 11850,
+        16151, 19832, 14944, 16158, 3108, 13639, 4719, 2301, 7424, -1544, 7935, 13962,
+        20481, 15573, 13155, 20170, 18414, 6641, -5915, 2993, 1707, -3455, 3560, 1804,
+        14917, 5628, 12147, 7239, 4821, 11836, 10080, 21321, 7867, 13059, 176, 8802,
+        12748, 13722, 1292, -7997, -1478, -2555, -19351, -1789, -3545, 11650, 2361, 8880,
+        587, 4888, 7415, 3681, 13595, -1543, 8988, 68, -2350, -831, -6916, 10964,
+        16991, 23510, 18602, 16184, 23199, 21443, 6705, -5851, 3057, 1771, -3391, 3624,
+        1868, 14981, 5692, 12211, 7303, 4885, 11900, 10144, 17255, 3801, 8993, -4550,
+        4736, 8682, 9656, 1356, -7933, -1414, -2491, -19287, -1725, -3481, 12181, 2892,
+        9411, 1118, 5419, 9100, 4212, 11612, -1438, 9093, 173, -2245, 2878, -6090,
+        8172, 14199, 20718, 15810, 13392, 20407, 18651, 6878, -5678, 3230, 1944, -3218,
+        3797, 2041, 15154, 5865, 12384, 7476, 5058, 12073, 10317, 18443, 4989, 10181,
+        -713, 5924, 9870, 10844, 1529, -7760, -1241, -2318, -19114, -1552, -3308, 11887,
+        2598, 9117, 824, 5125, 8806, 3918, 12530, -520, 10011, 1091, -1327, 3796,
+        -5172, 13128, 19155, 25674, 20766, 18348, 25363, 23607, 11834, -722, 8186, 6900,
+        1738, 8753, 6997, 21108, 11819, 18338, 13430, 11012, 18027, 16271, 23399, 9945,
+        15137, 4243, 10880, 14826, 15800, 6485, -2804, 3715, 2638, -14158, 3404, 1648,
+        16843, 7554, 14073, 5780, 10081, 13762, 8874, 17486, 4436, 14967, 6047, 3629,
+        8752, -216, 7762, 13789, 20308, 15400, 12982, 19997, 18241, 6468, -6088, 2820,
+        1534, -3628, 3387, 1631, 14744, 5455, 11974, 7066, 4648, 11663, 9907, 20090,
+        6636, 11828, -1247, 7571, 11517, 11884, 1119, -8170, -1651, -2728, -19524, -1962,
+        -3718, 11477, 2188, 8707, 414, 4715, 8396, 3508, 11640, -1410, 9121, -1764,
+        -2217, 2906, -6062, 9112, 15139, 21658, 16750, 14332, 21347, 19591, 9669, -2887,
+        6021, 4735, -427, 6588, 4832, 16094, 6805, 13324, 8416, 5998, 13013, 11257,
+        19802, 6348, 11540, 646, 7283, 11229, 12203, 3373, -5916, 603, -474, -17270,
+        292, -761, 12827, 3538, 10057, 1764, 6065, 9746, 4858, 12856, -194, 10337,
+        1417, -1001, 4122, -4846, 11340, 17367, 23886, 18978, 16560, 23575, 21819, 10046,
+        -2510, 6398, 5112, -50, 6965, 5209, 18322, 9033, 15552, 10644, 8226, 15241,
+        13485, 21611, 8157, 13349, 2455, 9092, 13038, 14012, 4697, -4592, 1927, 850,
+        -15946, 1616, -140, 23390, 14101, 20620, 12327, 16628, 20309, 15421, 16635, 3585,
+        14116, 5196, 2778, 7901, -1067, 8412, 14439, 20958, 16050, 13632, 20647, 18891,
+        7118, -5438, 3470, 2184, -2978, 4037, 2281, 15394, 6105, 12624, 7716, 5298,
+        12313, 10557, 23167, 9713, 14905, 2022, 10648, 14594, 15568, 1769, -7520, -1001,
+        -2078, -18874, -1312, -3068, 12127, 2838, 9357, 1064, 5365, 7892, 4158, 14072,
+        -1066, 9465, 545, -1873, -354, -6439, 10990, 17017, 23536, 18628, 16210, 23225,
+        21469, 6731, -5825, 3083, 1797, -3365, 3650, 1894, 15007, 5718, 12237, 7329,
+        4911, 11926, 10170, 18296, 4842, 10034, -3509, 5777, 9723, 10697, 1382, -7907,
+        -1388, -2465, -19261, -1699, -3455, 11740, 2451, 8970, 677, 4978, 8659, 3771,
+        11780, -1270, 9261, 341, -2077, 3046, -5922, 8198, 14225, 20744, 15836, 13418,
+        20433, 18677, 6904, -5652, 3256, 1970, -3192, 3823, 2067, 15180, 5891, 12410,
+        7502, 5084, 12099, 10343, 18469, 5015, 10207, -687, 5950, 9896, 10870, 1555,
+        -7734, -1215, -2292, -19088, -1526, -3282, 11913, 2624, 9143, 850, 5151, 8832,
+        3944, 12556, -494, 10037, 1117, -1301, 3822, -5146, 13154, 19181, 25700, 20792,
+        18374, 25389, 23633, 11860, -696, 8212, 6926, 1764, 8779, 7023, 21134, 11845,
+        18364, 13456, 11038, 18053, 16297, 23425, 9971, 15163, 4269, 10906, 14852, 15826,
+        6511, -2778, 3741, 2664, -14132, 3430, 1674, 16869, 7580, 14099, 5806, 10107,
+        13788, 8900, 17512, 4462, 14993, 6073, 3655, 8778, -190, 7788, 13815, 20334,
+        15426, 13008, 20023, 18267, 6494, -6062, 2846, 1560, -3602, 3413, 1657, 14770,
+        5481, 12000, 7092, 4674, 11689, 9933, 20221, 6767, 11959, -1116, 7702, 11648,
+        12015, 1145, -8144, -1625, -2702, -19498, -1936, -3692, 11503, 2214, 8733, 440,
+        4741, 8422, 3534, 11850, -1200, 9331, -1554, -2007, 3116, -5852, 9138, 15165,
+        21684, 16776, 14358, 21373, 19617, 9695, -2861, 6047, 4761, -401, 6614, 4858,
+        16120, 6831, 13350, 8442, 6024, 13039, 11283, 19828, 6374, 11566, 672, 7309,
+        11255, 12229, 3399, -5890, 629, -448, -17244, 318, -735, 12853, 3564, 10083,
+        1790, 6091, 9772, 4884, 12882, -168, 10363, 1443, -975, 4148, -4820, 11366,
+        17393, 23912, 19004, 16586, 23601, 21845, 10072, -2484, 6424, 5138, -24, 6991,
+        5235, 18348, 9059, 15578, 10670, 8252, 15267, 13511, 21637, 8183, 13375, 2481,
+        9118, 13064, 14038, 4723, -4566, 1953, 876, -15920, 1642, -114, 23416, 14127,
+        20646, 12353, 16654, 20335, 15447, 16661, 3611, 14142, 5222, 2804, 7927, -1041,
+        8438, 14465, 20984, 16076, 13658, 20673, 18917, 7144, -5412, 3496, 2210, -2952,
+        4063, 2307, 15420, 6131, 12650, 7742, 5324, 12339, 10583, 21824, 8370, 13562,
+        679, 9305, 13251, 14225, 1795, -7494, -975, -2052, -18848, -1286, -3042, 12153,
+        2864, 9383, 1090, 5391, 7918, 4184, 14098, -1040, 9491, 571, -1847, -328,
+        -6413, 11132, 17159, 23678, 18770, 16352, 23367, 21611, 6873, -5683, 3225, 1939,
+        -3223, 3792, 2036, 15149, 5860, 12379, 7471, 5053, 12068, 10312, 18438, 4984,
+        10176, -3367, 5919, 9865, 10839, 1524, -7765, -1246, -2323, -19119, -1557, -3313,
+        11882, 2593, 9112, 819, 5120, 8801, 3913, 11922, -1128, 9403, 483, -1935,
+        3188, -5780, 8340, 14367, 20886, 15978, 13560, 20575, 18819, 7046, -5510, 3398,
+        2112, -3050, 3965, 2209, 15322, 6033, 12552, 7644, 5226, 12241, 10485, 18611,
+        5157, 10349, -545, 6092, 10038, 11012, 1697, -7592, -1073, -2150, -18946, -1384,
+        -3140, 12055, 2766, 9285, 992, 5293, 8974, 4086, 12698, -352, 10179, 1259,
+        -1159, 3964, -5004, 13296, 19323, 25842, 20934, 18516, 25531, 23775, 12002, -554,
+        8354, 7068, 1906, 8921, 7165, 21276, 11987, 18506, 13598, 11180, 18195, 16439,
+        23567, 10113, 15305, 4411, 11048, 14994, 15968, 6653, -2636, 3883, 2806, -13990,
+        3572, 1816, 17011, 7722, 14241, 5948, 10249, 13930, 9042, 17654, 4604, 15135,
+        6215, 3797, 8920, -48, 7930, 13957, 20476, 15568, 13150, 20165, 18409, 6636,
+        -5920, 2988, 1702, -3460, 3555, 1799, 14912, 5623, 12142, 7234, 4816, 11831,
+        10075, 20363, 6909, 12101, -974, 7844, 11790, 12157, 1287, -8002, -1483, -2560,
+        -19356, -1794, -3550, 11645, 2356, 8875, 582, 4883, 8564, 3676, 11992, -1058,
+        9473, -1412, -1865, 3258, -5710, 9280, 15307, 21826, 16918, 14500, 21515, 19759,
+        9837, -2719, 6189, 4903, -259, 6756, 5000, 16262, 6973, 13492, 8584, 6166,
+        13181, 11425, 19970, 6516, 11708, 814, 7451, 11397, 12371, 3541, -5748, 771,
+        -306, -17102, 460, -593, 12995, 3706, 10225, 1932, 6233, 9914, 5026, 13024,
+        -26, 10505, 1585, -833, 4290, -4678, 11508, 17535, 24054, 19146, 16728, 23743,
+        21987, 10214, -2342, 6566, 5280, 118, 7133, 5377, 18490, 9201, 15720, 10812,
+        8394, 15409, 13653, 21779, 8325, 13517, 2623, 9260, 13206, 14180, 4865, -4424,
+        2095, 1018, -15778, 1784, 28, 23558, 14269, 20788, 12495, 16796, 20477, 15589,
+        16990, 3940, 14471, 5551, 3133, 8256, -712, 8580, 14607, 21126, 16218, 13800,
+        20815, 19059, 7286, -5270, 3638, 2352, -2810, 4205, 2449, 15562, 6273, 12792,
+        7884, 5466, 12481, 10725, 21103, 7649, 12841, -42, 8584, 12530, 13504, 1937,
+        -7352, -833, -1910, -18706, -1144, -2900, 11831, 2542, 9061, 768, 5069, 7596,
+        3862, 14240, -898, 9633, 713, -1705, -186, -6271, 10392, 16419, 22938, 18030,
+        15612, 22627, 20871, 6133, -6423, 2485, 1199, -3963, 3052, 1296, 14409, 5120,
+        11639, 6731, 4313, 11328, 9572, 17698, 4244, 9436, -4107, 5179, 9125, 10099,
+        784, -8505, -1986, -3063, -19859, -2297, -4053, 10811, 1522, 8041, -252, 4049,
+        7730, 2842, 10792, -2258, 8273, -647, -3065, 2058, -6910, 7600, 13627, 20146,
+        15238, 12820, 19835, 18079, 6306, -6250, 2658, 1372, -3790, 3225, 1469, 14582,
+        5293, 11812, 6904, 4486, 11501, 9745, 17871, 4417, 9609, -1285, 5352, 9298,
+        10272, 957, -8332, -1813, -2890, -19686, -2124, -3880, 11315, 2026, 8545, 252,
+        4553, 8234, 3346, 11958, -1092, 9439, 519, -1899, 3224, -5744, 12556, 18583,
+        25102, 20194, 17776, 24791, 23035, 11262, -1294, 7614, 6328, 1166, 8181, 6425,
+        20536, 11247, 17766, 12858, 10440, 17455, 15699, 22827, 9373, 14565, 3671, 10308,
+        14254, 15228, 5913, -3376, 3143, 2066, -14730, 2832, 1076, 16271, 6982, 13501,
+        5208, 9509, 13190, 8302, 16914, 3864, 14395, 5475, 3057, 8180, -788, 7190,
+        13217, 19736, 14828, 12410, 19425, 17669, 5896, -6660, 2248, 962, -4200, 2815,
+        1059, 14172, 4883, 11402, 6494, 4076, 11091, 9335, 20117, 6663, 11855, -1220,
+        7598, 11544, 11911, 547, -8742, -2223, -3300, -20096, -2534, -4290, 10905, 1616,
+        8135, -158, 4143, 7824, 2936, 11723, -1327, 9204, -1681, -2134, 2989, -5979,
+        8540, 14567, 21086, 16178, 13760, 20775, 19019, 9097, -3459, 5449, 4163, -999,
+        6016, 4260, 15522, 6233, 12752, 7844, 5426, 12441, 10685, 19230, 5776, 10968,
+        74, 6711, 10657, 11631, 2801, -6488, 31, -1046, -17842, -280, -1333, 12255,
+        2966, 9485, 1192, 5493, 9174, 4286, 12284, -766, 9765, 845, -1573, 3550,
+        -5418, 10768, 16795, 23314, 18406, 15988, 23003, 21247, 9474, -3082, 5826, 4540,
+        -622, 6393, 4637, 17750, 8461, 14980, 10072, 7654, 14669, 12913, 21039, 7585,
+        12777, 1883, 8520, 12466, 13440, 4125, -5164, 1355, 278, -16518, 1044, -712,
+        22818, 13529, 20048, 11755, 16056, 19737, 14849, 16063, 3013, 13544, 4624, 2206,
+        7329, -1639, 7840, 13867, 20386, 15478, 13060, 20075, 18319, 6546, -6010, 2898,
+        1612, -3550, 3465, 1709, 14822, 5533, 12052, 7144, 4726, 11741, 9985, 21226,
+        7772, 12964, 81, 8707, 12653, 13627, 1197, -8092, -1573, -2650, -19446, -1884,
+        -3640, 11062, 1773, 8292, -1, 4300, 6827, 3093, 15288, 150, 10681, 1761,
+        -657, 862, -5223, -7492, -8270, -1751, -6659, -9077, -2062, -3818, 3154, -9402,
+        -494, -1780, -6942, 73, -1683, 4524, -4765, 1754, -3154, -5572, 1443, -313,
+        10495, -2959, 2233, -6656, -3372, 1922, -1937, 5388, -4765, 1754, 677, -16033,
+        1443, -313, 4524, -4765, 1754, -3154, -2238, 1443, -3445, 6816, -6234, 4297,
+        -5782, -7041, -1271, -5734, 1777, -4592, 1927, -2981, -5399, 1616, -140, 3327,
+        -9229, -321, -1607, -6769, 246, -1510, 4697, -4592, 1927, -2981, -5399, 1616,
+        -140, 12500, -954, 4238, -2002, -1367, 3927, 68, 5561, -4592, 1927, 850,
+        -15860, 1616, -140, 4697, -4592, 1927, -2981, -2065, 1616, -3272, 8458, -4592,
+        5939, -4140, -5399, 371, -4092, 6733, 364, 6883, 1975, -443, 6572, 4816,
+        8283, -4273, 4635, 3349, -1813, 5202, 3446, 9653, 364, 6883, 1975, -443,
+        6572, 4816, 17456, 4002, 9194, 2954, 3589, 8883, 5024, 10517, 364, 6883,
+        5806, -10904, 6572, 4816, 9653, 364, 6883, 1975, 2891, 6572, 1684, 13863,
+        813, 11344, 1265, 6, 5776, 1313, 1480, -4889, 1630, -3278, -5696, 1319,
+        -437, 3030, -9526, -618, -1904, -7066, -51, -1807, 4400, -4889, 1630, -3278,
+        -5696, 1319, -437, 13506, 52, 5244, -2029, -361, 4933, 1074, 5264, -4889,
+        1630, 553, -16157, 1319, -437, 5286, -4003, 2516, -2392, -1476, 2205, -2683,
+        8161, -4889, 5642, -6402, -5696, 74, -5790, 958, -5411, 1108, -3800, -6218,
+        797, -959, 2508, -10048, -1140, -2426, -8131, -573, -2329, 3878, -5411, 1108,
+        -3800, -6218, 797, -959, 11681, -1773, 3419, -2821, -2186, 3108, -751, 4742,
+        -5411, 1108, 31, -16679, 797, -256, 3878, -5411, 1108, -3800, -2884, 797,
+        -4091, 8045, -5005, 5526, -4553, -5812, -42, -4505, 4945, -1424, 5095, 187,
+        -2231, 4784, 3028, 6495, -6061, 2847, 1561, -3601, 3414, 1658, 7865, -1424,
+        5095, 187, -2231, 4784, 3028, 15668, 2214, 7406, 1166, 1801, 7095, 3236,
+        8729, -1424, 5095, 4018, -12692, 4784, 3028, 7865, -1424, 5095, 187, 1103,
+        4784, -104, 12834, -216, 10315, 236, -1023, 4747, 284, 2233, -4136, 2383,
+        -2525, -4943, 2072, 316, 3783, -8773, 135, -1151, -6313, 702, -1054, 5153,
+        -4136, 2383, -2525, -4943, 2072, 316, 12956, -498, 4694, -2569, -911, 4383,
+        524, 6017, -4136, 2383, 1306, -15404, 2072, 316, 6674, -2615, 3904, -1004,
+        -88, 2439, -1295, 12383, -2755, 7776, -2303, -3562, 2208, -2255, -3173, -3951,
+        2568, -2340, -4758, 2257, 501, 6565, -5991, 2917, 1631, -3531, 3484, 1728,
+        7935, -1354, 5165, 257, -2161, 4854, 3098, 15738, 2284, 7476, -1413, 1871,
+        7165, 3306, 8799, -1354, 5165, 4088, -12622, 4854, 3098, 7935, -1354, 5165,
+        257, 1173, 4854, -34, 10227, -2823, 7708, -2371, -3630, 2140, -2323, 5188,
+        -1181, 5338, 430, -1988, 5027, 3271, 7831, -4725, 4183, 2897, -2265, 4750,
+        2994, 8108, -1181, 5338, 430, -1988, 5027, 3271, 15911, 2457, 7649, 1409,
+        2044, 7338, 3479, 8972, -1181, 5338, 4261, -12449, 5027, 3271, 8108, -1181,
+        5338, 430, 1346, 5027, 139, 11869, -1181, 9350, -729, -1988, 3782, -681,
+        10144, 3775, 10294, 5386, 2968, 9983, 8227, 11694, -862, 8046, 6760, 1598,
+        8613, 6857, 13064, 3775, 10294, 5386, 2968, 9983, 8227, 20867, 7413, 12605,
+        6365, 7000, 12294, 8435, 13928, 3775, 10294, 9217, -7493, 9983, 8227, 13064,
+        3775, 10294, 5386, 6302, 9983, 5095, 17274, 4224, 14755, 4676, 3417, 9187,
+        4724, 4891, -1478, 5041, 133, -2285, 4730, 2974, 6441, -6115, 2793, 1507,
+        -3655, 3360, 1604, 7811, -1478, 5041, 133, -2285, 4730, 2974, 16917, 3463,
+        8655, 1382, 3050, 8344, 4485, 8675, -1478, 5041, 3964, -12746, 4730, 2974,
+        8697, -592, 5927, 1019, 1935, 5616, 728, 11572, -1478, 9053, -2991, -2285,
+        3485, -2379, 4369, -2000, 4519, -389, -2807, 4208, 2452, 5919, -6637, 2271,
+        985, -4720, 2838, 1082, 7289, -2000, 4519, -389, -2807, 4208, 2452, 15092,
+        1638, 6830, 590, 1225, 6519, 2660, 8153, -2000, 4519, 3442, -13268, 4208,
+        3155, 7289, -2000, 4519, -389, 527, 4208, -680, 11456, -1594, 8937, -1142,
+        -2401, 3369, -1094, 8356, 1987, 8506, 3598, 1180, 8195, 6439, 9906, -2650,
+        6258, 4972, -190, 6825, 5069, 11276, 1987, 8506, 3598, 1180, 8195, 6439,
+        19079, 5625, 10817, 4577, 5212, 10506, 6647, 12140, 1987, 8506, 7429, -9281,
+        8195, 6439, 11276, 1987, 8506, 3598, 4514, 8195, 3307, 16245, 3195, 13726,
+        3647, 2388, 8158, 3695, 5644, -725, 5794, 886, -1532, 5483, 3727, 7194,
+        -5362, 3546, 2260, -2902, 4113, 2357, 8564, -725, 5794, 886, -1532, 5483,
+        3727, 16367, 2913, 8105, 842, 2500, 7794, 3935, 9428, -725, 5794, 4717,
+        -11993, 5483, 3727, 10085, 796, 7315, 2407, 3323, 5850, 2116, 15569, 431,
+        10962, 883, -376, 5394, 931, -3657, -4435, 2084, -2824, -5242, 1773, 17,
+        6081, -6475, 2433, 1147, -4015, 3000, 1244, 7451, -1838, 4681, -227, -2645,
+        4370, 2614, 15254, 1800, 6992, -1897, 1387, 6681, 2822, 8315, -1838, 4681,
+        3604, -13106, 4370, 2614, 7451, -1838, 4681, -227, 689, 4370, -518, 9743,
+        -3307, 7224, -2855, -4114, 1656, -2807, 4704, -1665, 4854, -54, -2472, 4543,
+        2787, 6254, -6302, 2606, 1320, -3842, 3173, 1417, 7624, -1665, 4854, -54,
+        -2472, 4543, 2787, 15427, 1973, 7165, 925, 1560, 6854, 2995, 8488, -1665,
+        4854, 3777, -12933, 4543, 2787, 7624, -1665, 4854, -54, 862, 4543, -345,
+        11385, -1665, 8866, -1213, -2472, 3298, -1165, 9660, 3291, 9810, 4902, 2484,
+        9499, 7743, 11210, -1346, 7562, 6276, 1114, 8129, 6373, 12580, 3291, 9810,
+        4902, 2484, 9499, 7743, 20383, 6929, 12121, 5881, 6516, 11810, 7951, 13444,
+        3291, 9810, 8733, -7977, 9499, 7743, 12580, 3291, 9810, 4902, 5818, 9499,
+        4611, 16790, 3740, 14271, 4192, 2933, 8703, 4240, 4407, -1962, 4557, -351,
+        -2769, 4246, 2490, 5957, -6599, 2309, 1023, -4139, 2876, 1120, 7327, -1962,
+        4557, -351, -2769, 4246, 2490, 16433, 2979, 8171, 898, 2566, 7860, 4001,
+        8191, -1962, 4557, 3480, -13230, 4246, 2490, 8213, -1076, 5443, 535, 1451,
+        5132, 244, 11088, -1962, 8569, -3475, -2769, 3001, -2863, 3885, -2484, 4035,
+        -873, -3291, 3724, 1968, 5435, -7121, 1787, 501, -5204, 2354, 598, 6805,
+        -2484, 4035, -873, -3291, 3724, 1968, 14608, 1154, 6346, 106, 741, 6035,
+        2176, 7669, -2484, 4035, 2958, -13752, 3724, 2671, 6805, -2484, 4035, -873,
+        43, 3724, -1164, 10972, -2078, 8453, -1626, -2885, 2885, -1578, 7872, 1503,
+        8022, 3114, 696, 7711, 5955, 9422, -3134, 5774, 4488, -674, 6341, 4585,
+        10792, 1503, 8022, 3114, 696, 7711, 5955, 18595, 5141, 10333, 4093, 4728,
+        10022, 6163, 11656, 1503, 8022, 6945, -9765, 7711, 5955, 10792, 1503, 8022,
+        3114, 4030, 7711, 2823, 15761, 2711, 13242, 3163, 1904, 7674, 3211, 5160,
+        -1209, 5310, 402, -2016, 4999, 3243, 6710, -5846, 3062, 1776, -3386, 3629,
+        1873, 8080, -1209, 5310, 402, -2016, 4999, 3243, 15883, 2429, 7621, 358,
+        2016, 7310, 3451, 8944, -1209, 5310, 4233, -12477, 4999, 3243, 9601, 312,
+        6831, 1923, 2839, 5366, 1632, 14341, -797, 9734, -345, -1604, 4166, -297,
+        -3180, -3958, 2561, -2347, -4765, 2250, 494, 6558, -5998, 2910, 1624, -3538,
+        3477, 1721, 7928, -1361, 5158, 250, -2168, 4847, 3091, 14716, 1262, 6454,
+        -2435, 849, 6143, 2284, 8792, -1361, 5158, 4081, -12629, 4847, 3091, 8395,
+        -894, 5625, 717, 1633, 5314, 426, 10078, -2972, 7559, -2520, -3779, 1991,
+        -2472, 5181, -1188, 5331, 423, -1995, 5020, 3264, 6731, -5825, 3083, 1797,
+        -3365, 3650, 1894, 8101, -1188, 5331, 423, -1995, 5020, 3264, 15904, 2450,
+        7642, 1402, 2037, 7331, 3472, 8965, -1188, 5331, 4254, -12456, 5020, 3264,
+        8101, -1188, 5331, 423, 1339, 5020, 132, 11862, -1188, 9343, -736, -1995,
+        3775, -688, 10137, 3768, 10287, 5379, 2961, 9976, 8220, 11687, -869, 8039,
+        6753, 1591, 8606, 6850, 13057, 3768, 10287, 5379, 2961, 9976, 8220, 20860,
+        7406, 12598, 6358, 6993, 12287, 8428, 13921, 3768, 10287, 9210, -7500, 9976,
+        8220, 13057, 3768, 10287, 5379, 6295, 9976, 5088, 17267, 4217, 14748, 4669,
+        3410, 9180, 4717, 4884, -1485, 5034, 126, -2292, 4723, 2967, 6434, -6122,
+        2786, 1500, -3662, 3353, 1597, 7804, -1485, 5034, 126, -2292, 4723, 2967,
+        18505, 5051, 10243, 2970, 4638, 9932, 6073, 8668, -1485, 5034, 3957, -12753,
+        4723, 2967, 8690, -599, 5920, 1012, 1928, 5609, 721, 11565, -1485, 9046,
+        -2998, -2292, 3478, -2386, 4362, -2007, 4512, -396, -2814, 4201, 2445, 5912,
+        -6644, 2264, 978, -4727, 2831, 1075, 7282, -2007, 4512, -396, -2814, 4201,
+        2445, 15085, 1631, 6823, 583, 1218, 6512, 2653, 8146, -2007, 4512, 3435,
+        -13275, 4201, 3148, 7282, -2007, 4512, -396, 520, 4201, -687, 11449, -1601,
+        8930, -1149, -2408, 3362, -1101, 8349, 1980, 8499, 3591, 1173, 8188, 6432,
+        9899, -2657, 6251, 4965, -197, 6818, 5062, 11269, 1980, 8499, 3591, 1173,
+        8188, 6432, 19072, 5618, 10810, 4570, 5205, 10499, 6640, 12133, 1980, 8499,
+        7422, -9288, 8188, 6432, 11269, 1980, 8499, 3591, 4507, 8188, 3300, 16238,
+        3188, 13719, 3640, 2381, 8151, 3688, 5637, -732, 5787, 879, -1539, 5476,
+        3720, 7187, -5369, 3539, 2253, -2909, 4106, 2350, 8557, -732, 5787, 879,
+        -1539, 5476, 3720, 17529, 4075, 9267, 2004, 3662, 8956, 5097, 9421, -732,
+        5787, 4710, -12000, 5476, 3720, 10078, 789, 7308, 2400, 3316, 5843, 2109,
+        15622, 484, 11015, 936, -323, 5447, 984, -3154, -3932, 2587, -2321, -4739,
+        2276, 520, 6584, -5972, 2936, 1650, -3512, 3503, 1747, 7954, -1335, 5184,
+        276, -2142, 4873, 3117, 15757, 2303, 7495, -1394, 1890, 7184, 3325, 8818,
+        -1335, 5184, 4107, -12603, 4873, 3117, 7954, -1335, 5184, 276, 1192, 4873,
+        -15, 10246, -2804, 7727, -2352, -3611, 2159, -2304, 5207, -1162, 5357, 449,
+        -1969, 5046, 3290, 6757, -5799, 3109, 1823, -3339, 3676, 1920, 8127, -1162,
+        5357, 449, -1969, 5046, 3290, 15930, 2476, 7668, 1428, 2063, 7357, 3498,
+        8991, -1162, 5357, 4280, -12430, 5046, 3290, 8127, -1162, 5357, 449, 1365,
+        5046, 158, 11888, -1162, 9369, -710, -1969, 3801, -662, 10163, 3794, 10313,
+        5405, 2987, 10002, 8246, 11713, -843, 8065, 6779, 1617, 8632, 6876, 13083,
+        3794, 10313, 5405, 2987, 10002, 8246, 20886, 7432, 12624, 6384, 7019, 12313,
+        8454, 13947, 3794, 10313, 9236, -7474, 10002, 8246, 13083, 3794, 10313, 5405,
+        6321, 10002, 5114, 17293, 4243, 14774, 4695, 3436, 9206, 4743, 4910, -1459,
+        5060, 152, -2266, 4749, 2993, 6460, -6096, 2812, 1526, -3636, 3379, 1623,
+        7830, -1459, 5060, 152, -2266, 4749, 2993, 16936, 3482, 8674, 1401, 3069,
+        8363, 4504, 8694, -1459, 5060, 3983, -12727, 4749, 2993, 8716, -573, 5946,
+        1038, 1954, 5635, 747, 11591, -1459, 9072, -2972, -2266, 3504, -2360, 4388,
+        -1981, 4538, -370, -2788, 4227, 2471, 5938, -6618, 2290, 1004, -4701, 2857,
+        1101, 7308, -1981, 4538, -370, -2788, 4227, 2471, 15111, 1657, 6849, 609,
+        1244, 6538, 2679, 8172, -1981, 4538, 3461, -13249, 4227, 3174, 7308, -1981,
+        4538, -370, 546, 4227, -661, 11475, -1575, 8956, -1123, -2382, 3388, -1075,
+        8375, 2006, 8525, 3617, 1199, 8214, 6458, 9925, -2631, 6277, 4991, -171,
+        6844, 5088, 11295, 2006, 8525, 3617, 1199, 8214, 6458, 19098, 5644, 10836,
+        4596, 5231, 10525, 6666, 12159, 2006, 8525, 7448, -9262, 8214, 6458, 11295,
+        2006, 8525, 3617, 4533, 8214, 3326, 16264, 3214, 13745, 3666, 2407, 8177,
+        3714, 5663, -706, 5813, 905, -1513, 5502, 3746, 7213, -5343, 3565, 2279,
+        -2883, 4132, 2376, 8583, -706, 5813, 905, -1513, 5502, 3746, 16386, 2932,
+        8124, 861, 2519, 7813, 3954, 9447, -706, 5813, 4736, -11974, 5502, 3746,
+        10104, 815, 7334, 2426, 3342, 5869, 2135, 15588, 450, 10981, 902, -357,
+        5413, 950, -3012, -3790, 2729, -2179, -4597, 2418, 662, 6726, -5830, 3078,
+        1792, -3370, 3645, 1889, 8096, -1193, 5326, 418, -2000, 5015, 3259, 15899,
+        2445, 7637, -1252, 2032, 7326, 3467, 8960, -1193, 5326, 4249, -12461, 5015,
+        3259, 8096, -1193, 5326, 418, 1334, 5015, 127, 10388, -2662, 7869, -2210,
+        -3469, 2301, -2162, 5349, -1020, 5499, 591, -1827, 5188, 3432, 6899, -5657,
+        3251, 1965, -3197, 3818, 2062, 8269, -1020, 5499, 591, -1827, 5188, 3432,
+        16072, 2618, 7810, 1570, 2205, 7499, 3640, 9133, -1020, 5499, 4422, -12288,
+        5188, 3432, 8269, -1020, 5499, 591, 1507, 5188, 300, 12030, -1020, 9511,
+        -568, -1827, 3943, -520, 10305, 3936, 10455, 5547, 3129, 10144, 8388, 11855,
+        -701, 8207, 6921, 1759, 8774, 7018, 13225, 3936, 10455, 5547, 3129, 10144,
+        8388, 21028, 7574, 12766, 6526, 7161, 12455, 8596, 14089, 3936, 10455, 9378,
+        -7332, 10144, 8388, 13225, 3936, 10455, 5547, 6463, 10144, 5256, 17435, 4385,
+        14916, 4837, 3578, 9348, 4885, 5052, -1317, 5202, 294, -2124, 4891, 3135,
+        6602, -5954, 2954, 1668, -3494, 3521, 1765, 7972, -1317, 5202, 294, -2124,
+        4891, 3135, 17078, 3624, 8816, 1543, 3211, 8505, 4646, 8836, -1317, 5202,
+        4125, -12585, 4891, 3135, 8858, -431, 6088, 1180, 2096, 5777, 889, 11733,
+        -1317, 9214, -2830, -2124, 3646, -2218, 4530, -1839, 4680, -228, -2646, 4369,
+        2613, 6080, -6476, 2432, 1146, -4559, 2999, 1243, 7450, -1839, 4680, -228,
+        -2646, 4369, 2613, 15253, 1799, 6991, 751, 1386, 6680, 2821, 8314, -1839,
+        4680, 3603, -13107, 4369, 3316, 7450, -1839, 4680, -228, 688, 4369, -519,
+        11617, -1433, 9098, -981, -2240, 3530, -933, 8517, 2148, 8667, 3759, 1341,
+        8356, 6600, 10067, -2489, 6419, 5133, -29, 6986, 5230, 11437, 2148, 8667,
+        3759, 1341, 8356, 6600, 19240, 5786, 10978, 4738, 5373, 10667, 6808, 12301,
+        2148, 8667, 7590, -9120, 8356, 6600, 11437, 2148, 8667, 3759, 4675, 8356,
+        3468, 16593, 3543, 14074, 3995, 2736, 8506, 4043, 5805, -564, 5955, 1047,
+        -1371, 5644, 3888, 7355, -5201, 3707, 2421, -2741, 4274, 2518, 8725, -564,
+        5955, 1047, -1371, 5644, 3888, 16528, 3074, 8266, 1003, 2661, 7955, 4096,
+        9589, -564, 5955, 4878, -11832, 5644, 3888, 10246, 957, 7476, 2568, 3484,
+        6011, 2277, 15730, 592, 11123, 1044, -215, 5555, 1092, -3752, -4530, 1989,
+        -2919, -5337, 1678, -78, 5986, -6570, 2338, 1052, -4110, 2905, 1149, 7356,
+        -1933, 4586, -322, -2740, 4275, 2519, 15159, 1705, 6897, -1992, 1292, 6586,
+        2727, 8220, -1933, 4586, 3509, -13201, 4275, 2519, 7025, -2264, 4255, -653,
+        263, 3944, -944, 9258, -3792, 6739, -3340, -4599, 1171, -3292, 4609, -1760,
+        4759, -149, -2567, 4448, 2692, 6159, -6397, 2511, 1225, -3937, 3078, 1322,
+        7529, -1760, 4759, -149, -2567, 4448, 2692, 15332, 1878, 7070, 830, 1465,
+        6759, 2900, 8393, -1760, 4759, 3682, -13028, 4448, 2692, 7529, -1760, 4759,
+        -149, 767, 4448, -440, 11290, -1760, 8771, -1308, -2567, 3203, -1260, 9565,
+        3196, 9715, 4807, 2389, 9404, 7648, 11115, -1441, 7467, 6181, 1019, 8034,
+        6278, 12485, 3196, 9715, 4807, 2389, 9404, 7648, 20288, 6834, 12026, 5786,
+        6421, 11715, 7856, 13349, 3196, 9715, 8638, -8072, 9404, 7648, 12485, 3196,
+        9715, 4807, 5723, 9404, 4516, 16695, 3645, 14176, 4097, 2838, 8608, 4145,
+        4312, -2057, 4462, -446, -2864, 4151, 2395, 5862, -6694, 2214, 928, -4234,
+        2781, 1025, 7232, -2057, 4462, -446, -2864, 4151, 2395, 17336, 3882, 9074,
+        1801, 3469, 8763, 4904, 8096, -2057, 4462, 3385, -13325, 4151, 2395, 8118,
+        -1171, 5348, 440, 1356, 5037, 149, 10861, -2189, 8342, -3702, -2996, 2774,
+        -3090, 3790, -2579, 3940, -968, -3386, 3629, 1873, 5340, -7216, 1692, 406,
+        -5299, 2259, 503, 6710, -2579, 3940, -968, -3386, 3629, 1873, 14513, 1059,
+        6251, 11, 646, 5940, 2081, 7574, -2579, 3940, 2863, -13847, 3629, 2576,
+        6710, -2579, 3940, -968, -52, 3629, -1259, 10877, -2173, 8358, -1721, -2980,
+        2790, -1673, 7777, 1408, 7927, 3019, 601, 7616, 5860, 9327, -3229, 5679,
+        4393, -769, 6246, 4490, 10697, 1408, 7927, 3019, 601, 7616, 5860, 18500,
+        5046, 10238, 3998, 4633, 9927, 6068, 11561, 1408, 7927, 6850, -9860, 7616,
+        5860, 10697, 1408, 7927, 3019, 3935, 7616, 2728, 15666, 2616, 13147, 3068,
+        1809, 7579, 3116, 5065, -1304, 5215, 307, -2111, 4904, 3148, 6615, -5941,
+        2967, 1681, -3481, 3534, 1778, 7985, -1304, 5215, 307, -2111, 4904, 3148,
+        16104, 2650, 7842, 579, 2237, 7531, 3672, 8849, -1304, 5215, 4138, -12572,
+        4904, 3148, 10086, 797, 7316, 2408, 3324, 5851, 2117, 15792, 654, 11185,
+        1106, -153, 5617, 1154, 4267, 3489, 10008, 5100, 2682, 9697, 7941, 3214,
+        -9342, -434, -1720, -6882, 133, -697, 1372, -7917, -2371, -6306, -8724, -1709,
+        -3465, 9728, -3726, 1466, -7423, -4139, 1155, -2704, 5448, -4705, 1814, 737,
+        -15973, 1503, -253, 4584, -4705, 1814, -3094, -2178, 1503, -3385, 6876, -6174,
+        4357, -5722, -9017, -1211, -5408, 1837, -4532, 1987, -2921, -5339, 1676, -80,
+        3387, -11932, -261, -1547, -6709, 306, -524, 1545, -7744, -2198, -6133, -8551,
+        -1536, -3292, 11733, -1721, 3471, -2769, -2134, 3160, -699, 5621, -4532, 1987,
+        910, -15620, 1676, -80, 4757, -4532, 1987, -2921, -2005, 1676, -3212, 8518,
+        -4532, 5999, -4080, -7375, 431, -3766, 6793, 424, 6943, 2035, -383, 6632,
+        4876, 8343, -4213, 4695, 3409, -1753, 5262, 4432, 6501, -2788, 2758, -1177,
+        -3595, 3420, 1664, 16689, 3235, 8427, 2187, 2822, 8116, 4257, 10577, 424,
+        6943, 5866, -10844, 6632, 4876, 9713, 424, 6943, 2035, 2951, 6632, 1744,
+        13923, 873, 11404, 1325, -1970, 5836, 1639, 1540, -4829, 1690, -3218, -5636,
+        1379, -377, 3090, -9466, -558, -1844, -7006, 9, -821, 1248, -8041, -2495,
+        -6430, -8848, -1833, -3589, 12334, -1120, 4072, -7208, -1533, 3761, 528, 5324,
+        -4829, 1690, 613, -16097, 1379, -377, 5346, -3943, 2576, -2332, -1416, 2265,
+        -2623, 8221, -4829, 5702, -6835, -7672, 134, -3529, -1224, -7593, -1074, -5982,
+        -8400, -1385, -3141, 2568, -9988, -1080, -2366, -16227, -513, -1343, 726, -8563,
+        -3017, -6952, -9370, -2355, -4111, 10121, -3333, 1859, -4381, -3746, 1548, -2311,
+        4802, -5351, 1168, 91, -16619, 857, -196, 3938, -5351, 1168, -3740, -2824,
+        857, -4031, 9903, -3147, 7384, -2695, -5990, 1816, -2381, 5005, -1364, 5155,
+        247, -2171, 4844, 3088, 6555, -6001, 2907, 1621, -3541, 3474, 2644, 4713,
+        -4576, 970, -2965, -5383, 1632, -124, 14901, 1447, 6639, 399, 1034, 6328,
+        2469, 8789, -1364, 5155, 4078, -12632, 4844, 3088, 7925, -1364, 5155, 247,
+        1163, 4844, -44, 10492, -2558, 7973, -2106, -5401, 2405, -1792, 2293, -4076,
+        2443, -2465, -4883, 2132, 376, 3843, -8713, 195, -1091, -6253, 762, -68,
+        2001, -7288, -1742, -5677, -8095, -1080, -2836, 12189, -1265, 3927, -3336, -1678,
+        3616, -1816, 6077, -4076, 2443, 1366, -15344, 2132, 376, 7173, -2116, 4403,
+        -505, 411, 2938, -796, 15207, -411, 10120, 2487, -3254, 4552, 61, 8586,
+        7808, 14327, 9419, 7001, 14016, 12260, 6625, -5931, 2977, 1691, -3471, 3544,
+        2714, 4783, -4506, 1040, -2895, -5313, 1702, -54, 14971, 1517, 6709, -2180,
+        1104, 6398, 2539, 8859, -1294, 5225, 4148, -12562, 4914, 3158, 7995, -1294,
+        5225, 317, 1233, 4914, 26, 10287, -2763, 7768, -2311, -5606, 2200, -1997,
+        5248, -1121, 5398, 490, -1928, 5087, 3331, 7891, -7428, 4243, 2957, -2205,
+        4810, 3980, 4956, -4333, 1213, -2722, -5140, 1875, 119, 15144, 1690, 6882,
+        642, 1277, 6571, 2712, 9032, -1121, 5398, 4321, -12209, 5087, 3331, 8168,
+        -1121, 5398, 490, 1406, 5087, 199, 11929, -1121, 9410, -669, -3964, 3842,
+        -355, 10204, 3835, 10354, 5446, 3028, 10043, 8287, 11754, -802, 8106, 6820,
+        1658, 8673, 7843, 9912, 623, 6169, 2234, -184, 6831, 5075, 20100, 6646,
+        11838, 5598, 6233, 11527, 7668, 13988, 3835, 10354, 9277, -7433, 10043, 8287,
+        13124, 3835, 10354, 5446, 6362, 10043, 5155, 17334, 4284, 14815, 4736, 1441,
+        9247, 5050, 4951, -1418, 5101, 193, -2225, 4790, 3034, 6501, -6055, 2853,
+        1567, -3595, 3420, 2590, 4659, -4630, 916, -3019, -5437, 1578, -178, 16430,
+        2976, 8168, -3112, 2563, 7857, 4624, 8735, -1418, 5101, 4024, -12686, 4790,
+        3034, 8757, -532, 5987, 1079, 1995, 5676, 788, 11632, -1418, 9113, -3424,
+        -4261, 3545, -118, 2187, -4182, 2337, -2571, -4989, 2026, 270, 5979, -6577,
+        2331, 1045, -12816, 2898, 2068, 4137, -5152, 394, -3541, -5959, 1056, -700,
+        13532, 78, 5270, -970, -335, 4959, 1100, 8213, -1940, 4579, 3502, -13208,
+        4268, 3215, 7349, -1940, 4579, -329, 587, 4268, -620, 13314, 264, 10795,
+        716, -2579, 5227, 1030, 8416, 2047, 8566, 3658, 1240, 8255, 6499, 9966,
+        -2590, 6318, 5032, -130, 6885, 6055, 8124, -1165, 4381, 446, -1972, 5043,
+        3287, 18312, 4858, 10050, 3810, 4445, 9739, 5880, 12200, 2047, 8566, 7489,
+        -9221, 8255, 6499, 11336, 2047, 8566, 3658, 4574, 8255, 3367, 13903, 853,
+        11384, 1305, -1990, 5816, 1619, 5704, -665, 5854, 946, -1472, 5543, 3787,
+        7254, -5302, 3606, 2320, -2842, 4173, 3343, 5412, -3877, 1669, -2266, -4684,
+        2331, 575, 15600, 2146, 7338, 75, 1733, 7027, 1595, 9488, -665, 5854,
+        4777, -11933, 5543, 3787, 10584, 1295, 7814, 2906, 3822, 6349, 2615, 18283,
+        2665, 13196, 5563, -178, 7628, 3137, 8102, 7324, 13843, 8935, 6517, 13532,
+        11776, 6141, -6415, 2493, 1207, -3955, 3060, 2230, 4299, -4990, 556, -3379,
+        -5797, 1218, -538, 14487, 1033, 6225, -2664, 620, 5914, 2055, 8375, -1778,
+        4741, 3664, -13046, 4430, 2674, 7511, -1778, 4741, -167, 749, 4430, -458,
+        9803, -3247, 7284, -2795, -6090, 1716, -2481, 4764, -1605, 4914, 6, -2412,
+        4603, 2847, 6314, -9005, 2666, 1380, -3782, 3233, 2403, 4472, -4817, 729,
+        -3206, -5624, 1391, -365, 14660, 1206, 6398, 158, 793, 6087, 2228, 8548,
+        -1605, 4914, 3837, -12693, 4603, 2847, 7684, -1605, 4914, 6, 922, 4603,
+        -285, 11445, -1605, 8926, -1153, -4448, 3358, -839, 9720, 3351, 9870, 4962,
+        2544, 9559, 7803, 11270, -1286, 7622, 6336, 1174, 8189, 7359, 9428, 139,
+        5685, 1750, -668, 6347, 4591, 19616, 6162, 11354, 5114, 5749, 11043, 7184,
+        13504, 3351, 9870, 8793, -7917, 9559, 7803, 12640, 3351, 9870, 4962, 5878,
+        9559, 4671, 16850, 3800, 14331, 4252, 957, 8763, 4566, 4467, -1902, 4617,
+        -291, -2709, 4306, 2550, 6017, -6539, 2369, 1083, -4079, 2936, 2106, 4175,
+        -5114, 432, -3503, -5921, 1094, -662, 15946, 2492, 7684, -3596, 2079, 7373,
+        4140, 8251, -1902, 4617, 3540, -13170, 4306, 2550, 8273, -1016, 5503, 595,
+        1511, 5192, 304, 11148, -1902, 8629, -3908, -4745, 3061, -602, 1703, -4666,
+        1853, -3055, -5473, 1542, -214, 5495, -7061, 1847, 561, -13300, 2414, 1584,
+        3653, -5636, -90, -4025, -6443, 572, -1184, 13048, -406, 4786, -1454, -819,
+        4475, 616, 7729, -2424, 4095, 3018, -13692, 3784, 2731, 6865, -2424, 4095,
+        -813, 103, 3784, -1104, 12830, -220, 10311, 232, -3063, 4743, 546, 7932,
+        1563, 8082, 3174, 756, 7771, 6015, 9482, -3074, 5834, 4548, -614, 6401,
+        5571, 7640, -1649, 3897, -38, -2456, 4559, 2803, 17828, 4374, 9566, 3326,
+        3961, 9255, 5396, 11716, 1563, 8082, 7005, -9705, 7771, 6015, 10852, 1563,
+        8082, 3174, 4090, 7771, 2883, 13419, 369, 10900, 821, -2474, 5332, 1135,
+        5220, -1149, 5370, 462, -1956, 5059, 3303, 6770, -5786, 3122, 1836, -3326,
+        3689, 2859, 4928, -4361, 1185, -2750, -5168, 1847, 91, 15116, 1662, 6854,
+        -409, 1249, 6543, 1111, 9004, -1149, 5370, 4293, -12417, 5059, 3303, 10100,
+        811, 7330, 2422, 3338, 5865, 2131, 17055, 1437, 11968, 4335, -1406, 6400,
+        1909, 8579, 7801, 14320, 9412, 6994, 14009, 12253, 6618, -5938, 2970, 1684,
+        -3478, 3537, 2707, 4776, -4513, 1033, -2902, -5320, 1695, -61, 13949, 495,
+        5687, -3202, 82, 5376, 1517, 8852, -1301, 5218, 4141, -12569, 4907, 3151,
+        8455, -834, 5685, 777, 1693, 5374, 486, 10138, -2912, 7619, -2460, -5755,
+        2051, -2146, 5241, -1128, 5391, 483, -1935, 5080, 3324, 6791, -8528, 3143,
+        1857, -3305, 3710, 2880, 4949, -4340, 1206, -2729, -5147, 1868, 112, 15137,
+        1683, 6875, 635, 1270, 6564, 2705, 9025, -1128, 5391, 4314, -12216, 5080,
+        3324, 8161, -1128, 5391, 483, 1399, 5080, 192, 11922, -1128, 9403, -676,
+        -3971, 3835, -362, 10197, 3828, 10347, 5439, 3021, 10036, 8280, 11747, -809,
+        8099, 6813, 1651, 8666, 7836, 9905, 616, 6162, 2227, -191, 6824, 5068,
+        20093, 6639, 11831, 5591, 6226, 11520, 7661, 13981, 3828, 10347, 9270, -7440,
+        10036, 8280, 13117, 3828, 10347, 5439, 6355, 10036, 5148, 17327, 4277, 14808,
+        4729, 1434, 9240, 5043, 4944, -1425, 5094, 186, -2232, 4783, 3027, 6494,
+        -6062, 2846, 1560, -3602, 3413, 2583, 4652, -4637, 909, -3026, -5444, 1571,
+        -185, 18018, 4564, 9756, -1524, 4151, 9445, 6212, 8728, -1425, 5094, 4017,
+        -12693, 4783, 3027, 8750, -539, 5980, 1072, 1988, 5669, 781, 12969, -81,
+        10450, -2087, -2924, 4882, 1219, 2180, -4189, 2330, -2578, -4996, 2019, 263,
+        5972, -6584, 2324, 1038, -12823, 2891, 2061, 4130, -5159, 387, -3548, -5966,
+        1049, -707, 13525, 71, 5263, -977, -342, 4952, 1093, 8206, -1947, 4572,
+        3495, -13215, 4261, 3208, 7342, -1947, 4572, -336, 580, 4261, -627, 13307,
+        257, 10788, 709, -2586, 5220, 1023, 8409, 2040, 8559, 3651, 1233, 8248,
+        6492, 9959, -2597, 6311, 5025, -137, 6878, 6048, 8117, -1172, 4374, 439,
+        -1979, 5036, 3280, 18305, 4851, 10043, 3803, 4438, 9732, 5873, 12193, 2040,
+        8559, 7482, -9228, 8248, 6492, 11329, 2040, 8559, 3651, 4567, 8248, 3360,
+        13896, 846, 11377, 1298, -1997, 5809, 1612, 5697, -672, 5847, 939, -1479,
+        5536, 3780, 7247, -5309, 3599, 2313, -2849, 4166, 3336, 5405, -3884, 1662,
+        -2273, -4691, 2324, 568, 16762, 3308, 8500, 1237, 2895, 8189, 2757, 9481,
+        -672, 5847, 4770, -11940, 5536, 3780, 10577, 1288, 7807, 2899, 3815, 6342,
+        2608, 18959, 3341, 13872, 6239, 498, 8304, 3813, 8605, 7827, 14346, 9438,
+        7020, 14035, 12279, 6644, -5912, 2996, 1710, -3452, 3563, 2733, 4802, -4487,
+        1059, -2876, -5294, 1721, -35, 14990, 1536, 6728, -2161, 1123, 6417, 2558,
+        8878, -1275, 5244, 4167, -12543, 4933, 3177, 8014, -1275, 5244, 336, 1252,
+        4933, 45, 10306, -2744, 7787, -2292, -5587, 2219, -1978, 5267, -1102, 5417,
+        509, -1909, 5106, 3350, 6817, -8502, 3169, 1883, -3279, 3736, 2906, 4975,
+        -4314, 1232, -2703, -5121, 1894, 138, 15163, 1709, 6901, 661, 1296, 6590,
+        2731, 11843, 1690, 8209, 7132, -9398, 7898, 6142, 8187, -1102, 5417, 509,
+        1425, 5106, 218, 11948, -1102, 9429, -650, -3945, 3861, -336, 10223, 3854,
+        10373, 5465, 3047, 10062, 8306, 11773, -783, 8125, 6839, 1677, 8692, 7862,
+        9931, 642, 6188, 2253, -165, 6850, 5094, 20119, 6665, 11857, 5617, 6252,
+        11546, 7687, 14007, 3854, 10373, 9296, -7414, 10062, 8306, 13143, 3854, 10373,
+        5465, 6381, 10062, 5174, 17353, 4303, 14834, 4755, 1460, 9266, 5069, 4970,
+        -1399, 5120, 212, -2206, 4809, 3053, 6520, -6036, 2872, 1586, -3576, 3439,
+        2609, 4678, -4611, 935, -3000, -5418, 1597, -159, 16449, 2995, 8187, -3093,
+        2582, 7876, 4643, 8754, -1399, 5120, 4043, -12667, 4809, 3053, 8776, -513,
+        6006, 1098, 2014, 5695, 807, 11651, -1399, 9132, -3405, -4242, 3564, -99,
+        2206, -4163, 2356, -2552, -4970, 2045, 289, 6677, -5879, 3029, 1743, -12118,
+        3596, 2766, 4156, -5133, 413, -3522, -5940, 1075, -681, 13551, 97, 5289,
+        -951, -316, 4978, 1119, 8232, -1921, 4598, 3521, -13189, 4287, 3234, 7368,
+        -1921, 4598, -310, 606, 4287, -601, 13333, 283, 10814, 735, -2560, 5246,
+        1049, 8435, 2066, 8585, 3677, 1259, 8274, 6518, 9985, -2571, 6337, 5051,
+        -111, 6904, 6074, 8143, -1146, 4400, 465, -1953, 5062, 3306, 18331, 4877,
+        10069, 3829, 4464, 9758, 5899, 12219, 2066, 8585, 7508, -9202, 8274, 6518,
+        11355, 2066, 8585, 3677, 4593, 8274, 3386, 13922, 872, 11403, 1324, -1971,
+        5835, 1638, 5723, -646, 5873, 965, -1453, 5562, 3806, 7273, -5283, 3625,
+        2339, -2823, 4192, 3362, 5431, -3858, 1688, -2247, -4665, 2350, 594, 15619,
+        2165, 7357, 94, 1752, 7046, 1614, 9507, -646, 5873, 4796, -11914, 5562,
+        3806, 10603, 1314, 7833, 2925, 3841, 6368, 2634, 18889, 3271, 13802, 6169,
+        428, 8234, 3743, 8747, 7969, 14488, 9580, 7162, 14177, 12421, 6786, -5770,
+        3138, 1852, -3310, 3705, 2875, 4944, -4345, 1201, -2734, -5152, 1863, 107,
+        15132, 1678, 6870, -2019, 1265, 6559, 2700, 9020, -1133, 5386, 4309, -12401,
+        5075, 3319, 8156, -1133, 5386, 478, 1394, 5075, 187, 10448, -2602, 7929,
+        -2150, -5445, 2361, -1836, 5409, -960, 5559, 651, -1767, 5248, 3492, 6959,
+        -8360, 3311, 2025, -3137, 3878, 3048, 5117, -4172, 1374, -2561, -4979, 2036,
+        280, 15305, 1851, 7043, 803, 1438, 6732, 2873, 9193, -960, 5559, 4482,
+        -12048, 5248, 3492, 8329, -960, 5559, 651, 1567, 5248, 360, 12090, -960,
+        9571, -508, -3803, 4003, -194, 10365, 3996, 10515, 5607, 3189, 10204, 8448,
+        11915, -641, 8267, 6981, 1819, 8834, 8004, 10073, 784, 6330, 2395, -23,
+        6992, 5236, 20261, 6807, 11999, 5759, 6394, 11688, 7829, 14149, 3996, 10515,
+        9438, -7272, 10204, 8448, 13285, 3996, 10515, 5607, 6523, 10204, 5316, 17495,
+        4445, 14976, 4897, 1602, 9408, 5211, 5112, -1257, 5262, 354, -2064, 4951,
+        3195, 6662, -5894, 3014, 1728, -3434, 3581, 2751, 4820, -4469, 1077, -2858,
+        -5276, 1739, -17, 16591, 3137, 8329, -2951, 2724, 8018, 4785, 8896, -1257,
+        5262, 4185, -12525, 4951, 3195, 8918, -371, 6148, 1240, 2156, 5837, 949,
+        11793, -1257, 9274, -3263, -4100, 3706, 43, 2348, -4021, 2498, -2410, -4828,
+        2187, 431, 6140, -6416, 2492, 1206, -12655, 3059, 2229, 4298, -4991, 555,
+        -3380, -5798, 1217, -539, 13693, 239, 5431, -809, -174, 5120, 1261, 8374,
+        -1779, 4740, 3663, -13047, 4429, 3376, 7510, -1779, 4740, -168, 748, 4429,
+        -459, 13475, 425, 10956, 877, -2418, 5388, 1191, 8577, 2208, 8727, 3819,
+        1401, 8416, 6660, 10127, -2429, 6479, 5193, 31, 7046, 6216, 8285, -1004,
+        4542, 607, -1811, 5204, 3448, 18473, 5019, 10211, 3971, 4606, 9900, 6041,
+        12361, 2208, 8727, 7650, -9060, 8416, 6660, 11497, 2208, 8727, 3819, 4735,
+        8416, 3528, 14251, 1201, 11732, 1653, -1642, 6164, 1967, 5865, -504, 6015,
+        1107, -1311, 5704, 3948, 7415, -5141, 3767, 2481, -2681, 4334, 3504, 5573,
+        -3716, 1830, -2105, -4523, 2492, 736, 15761, 2307, 7499, 236, 1894, 7188,
+        1756, 9649, -504, 6015, 4938, -11772, 5704, 3948, 10745, 1456, 7975, 3067,
+        3983, 6510, 2776, 18444, 2826, 13357, 5724, -17, 7789, 3298, 8007, 7229,
+        13748, 8840, 6422, 13437, 11681, 6046, -6510, 2398, 1112, -4050, 2965, 2135,
+        4204, -5085, 461, -3474, -5892, 1123, -633, 14392, 938, 6130, -2759, 525,
+        5819, 1960, 8280, -1873, 4646, 3569, -13141, 4335, 2579, 7085, -2204, 4315,
+        -593, 323, 4004, -884, 9318, -3732, 6799, -3280, -6575, 1231, -2966, 4669,
+        -1700, 4819, -89, -2507, 4508, 2752, 6219, -9100, 2571, 1285, -3877, 3138,
+        2308, 4377, -4912, 634, -3301, -5719, 1296, -460, 14565, 1111, 6303, 63,
+        698, 5992, 2133, 8453, -1700, 4819, 3742, -12788, 4508, 2752, 7589, -1700,
+        4819, -89, 827, 4508, -380, 11350, -1700, 8831, -1248, -4543, 3263, -934,
+        9625, 3256, 9775, 4867, 2449, 9464, 7708, 11175, -1381, 7527, 6241, 1079,
+        8094, 7264, 9333, 44, 5590, 1655, -763, 6252, 4496, 19521, 6067, 11259,
+        5019, 5654, 10948, 7089, 13409, 3256, 9775, 8698, -8012, 9464, 7708, 12545,
+        3256, 9775, 4867, 5783, 9464, 4576, 16755, 3705, 14236, 4157, 862, 8668,
+        4471, 4372, -1997, 4522, -386, -2804, 4211, 2455, 5922, -6634, 2274, 988,
+        -4174, 2841, 2011, 4080, -5209, 337, -3598, -6016, 999, -757, 17846, 4392,
+        9584, -1696, 3979, 9273, 6040, 8156, -1997, 4522, 3445, -13265, 4211, 2455,
+        8178, -1111, 5408, 500, 1416, 5097, 209, 10921, -2129, 8402, -4135, -4972,
+        2834, -829, 1608, -4761, 1758, -3150, -5568, 1447, -309, 5400, -7156, 1752,
+        466, -13395, 2319, 1489, 3558, -5731, -185, -4120, -6538, 477, -1279, 12953,
+        -501, 4691, -1549, -914, 4380, 521, 7634, -2519, 4000, 2923, -13787, 3689,
+        2636, 6770, -2519, 4000, -908, 8, 3689, -1199, 12735, -315, 10216, 137,
+        -3158, 4648, 451, 7837, 1468, 7987, 3079, 661, 7676, 5920, 9387, -3169,
+        5739, 4453, -709, 6306, 5476, 7545, -1744, 3802, -133, -2551, 4464, 2708,
+        17733, 4279, 9471, 3231, 3866, 9160, 5301, 11621, 1468, 7987, 6910, -9800,
+        7676, 5920, 10757, 1468, 7987, 3079, 3995, 7676, 2788, 13805, 755, 11286,
+        1207, -2088, 5718, 1521, 5125, -1244, 5275, 367, -2051, 4964, 3208, 6675,
+        -5881, 3027, 1741, -3421, 3594, 2764, 4833, -4456, 1090, -2845, -5263, 1752,
+        -4, 17066, 3612, 8804, 1541, 3199, 8493, 3061, 8909, -1244, 5275, 4198,
+        -12512, 4964, 3208, 10585, 1296, 7815, 2907, 3823, 6350, 2616, 18852, 3234,
+        13765, 6132, 391, 8197, 3706, -4938, 6680, 13199, 8291, 5873, 12888, 11132,
+        2864, -9692, -784, -2070, -7232, -217, -1973, 11140, 1851, 8370, 3462, 1044,
+        8059, 6303, 12597, -857, 4335, -9208, 78, 4024, 3926, -1621, -11774, -5255,
+        -6332, -24848, -5566, -7322, 7873, -1416, 5103, -3190, 1111, 4792, -96, 7822,
+        -5228, 5303, -4776, -6035, -265, -8623, 4331, 10358, 16877, 11969, 9551, 16566,
+        14810, 3037, -9519, -611, -1897, -7059, -44, -1800, 11313, 2024, 8543, 3635,
+        1217, 8232, 6476, 14602, 1148, 6340, -4554, 2083, 6029, 5931, -1448, -11601,
+        -5082, -6159, -24675, -5393, -7149, 8046, -1243, 5276, -3017, 1284, 4965, 77,
+        8689, -4361, 6170, -3909, -5168, 602, -7756, 9287, 15314, 21833, 16925, 14507,
+        21522, 19766, 7993, -4563, 4345, 3059, -2103, 4912, 3156, 17267, 7978, 14497,
+        9589, 7171, 14186, 12430, 19558, 6104, 11296, 402, 7039, 10985, 10887, 3508,
+        -6645, -126, -1203, -19719, -437, -2193, 13002, 3713, 10232, 1939, 6240, 9921,
+        5033, 14094, 1044, 11575, 1496, 237, 6007, -2351, 4034, 10061, 16580, 11672,
+        9254, 16269, 14513, 2740, -9816, -908, -2194, -7356, -341, -2097, 11016, 1727,
+        8246, 3338, 920, 7935, 6179, 15309, 1855, 7047, -7061, 2790, 6736, 6031,
+        -1745, -11898, -5379, -6456, -24972, -5690, -7446, 8635, -654, 5865, -2428, 1873,
+        5554, 666, 8392, -4658, 5873, -6171, -5465, 305, -9454, 3512, 9539, 16058,
+        11150, 8732, 15747, 13991, 2218, -10338, -1430, -2716, -8421, -863, -2619, 10494,
+        1205, 7724, 2816, 398, 7413, 5657, 14202, 748, 5940, -4954, 1683, 5629,
+        5531, -2267, -12420, -5901, -6978, -25494, -6212, -7265, 7227, -2062, 4457, -3836,
+        465, 4146, -742, 8276, -4774, 5757, -4322, -5581, 189, -8169, 7499, 13526,
+        20045, 15137, 12719, 19734, 17978, 6205, -6351, 2557, 1271, -3891, 3124, 1368,
+        14481, 5192, 11711, 6803, 4385, 11400, 9644, 17770, 4316, 9508, -1386, 5251,
+        9197, 9099, 1720, -8433, -1914, -2991, -21507, -2225, -3981, 19549, 10260, 16779,
+        8486, 12787, 16468, 11580, 14622, 1572, 12103, 2024, 765, 6535, -1823, 4787,
+        10814, 17333, 12425, 10007, 17022, 15266, 3493, -9063, -155, -1441, -6603, 412,
+        -1344, 11769, 2480, 8999, 4091, 1673, 8688, 6932, 17722, 4268, 9460, -3423,
+        5203, 9149, 9051, -992, -11145, -4626, -5703, -24219, -4937, -6693, 10023, 734,
+        7253, -1040, 3261, 5788, 2054, 11822, -3316, 7215, -2864, -4123, -1957, -7432,
+        -619, 10999, 17518, 12610, 10192, 17207, 15451, 6275, -6281, 2627, 1341, -3821,
+        3194, 1438, 14551, 5262, 11781, 6873, 4455, 11470, 9714, 17840, 4386, 9578,
+        -3965, 5321, 9267, 9169, 1790, -8363, -1844, -2921, -21437, -2155, -3911, 11284,
+        1995, 8514, 221, 4522, 8203, 3315, 11233, -1817, 8714, -1365, -2624, 3146,
+        -5212, 7742, 13769, 20288, 15380, 12962, 19977, 18221, 7541, -5015, 3893, 2607,
+        -2555, 4460, 2704, 14724, 5435, 11954, 7046, 4628, 11643, 9887, 18013, 4559,
+        9751, -1143, 5494, 9440, 9342, 1963, -8190, -1671, -2748, -21264, -1982, -3738,
+        11457, 2168, 8687, 394, 4695, 8376, 3488, 12100, -950, 9581, -498, -1757,
+        4013, -4345, 12698, 18725, 25244, 20336, 17918, 24933, 23177, 11404, -1152, 7756,
+        6470, 1308, 8323, 6567, 20678, 11389, 17908, 13000, 10582, 17597, 15841, 22969,
+        9515, 14707, 3813, 10450, 14396, 14298, 6919, -3234, 3285, 2208, -16308, 2974,
+        1218, 16413, 7124, 13643, 5350, 9651, 13332, 8444, 17505, 4455, 14986, 4907,
+        3648, 9418, 1060, 7445, 13472, 19991, 15083, 12665, 19680, 17924, 6151, -6405,
+        2503, 1217, -3945, 3070, 1314, 14427, 5138, 11657, 6749, 4331, 11346, 9590,
+        18720, 5266, 10458, -3650, 6201, 10147, 9442, 1666, -8487, -1968, -3045, -21561,
+        -2279, -4035, 12046, 2757, 9276, 983, 5284, 8965, 4077, 11803, -1247, 9284,
+        -2760, -2054, 3716, -6043, 6923, 12950, 19469, 14561, 12143, 19158, 17402, 5629,
+        -6927, 1981, 695, -5010, 2548, 792, 13905, 4616, 11135, 6227, 3809, 10824,
+        9068, 17613, 4159, 9351, -1543, 5094, 9040, 8942, 1144, -9009, -2490, -3567,
+        -22083, -2801, -3854, 10638, 1349, 7868, -425, 3876, 7557, 2669, 11687, -1363,
+        9168, -911, -2170, 3600, -4758, 10910, 16937, 23456, 18548, 16130, 23145, 21389,
+        9616, -2940, 5968, 4682, -480, 6535, 4779, 17892, 8603, 15122, 10214, 7796,
+        14811, 13055, 21181, 7727, 12919, 2025, 8662, 12608, 12510, 5131, -5022, 1497,
+        420, -18096, 1186, -570, 22960, 13671, 20190, 11897, 16198, 19879, 14991, 17413,
+        4363, 14894, 4815, 3556, 9326, 968, 8198, 14225, 20744, 15836, 13418, 20433,
+        18677, 6904, -5652, 3256, 1970, -3192, 3823, 2067, 15180, 5891, 12410, 7502,
+        5084, 12099, 10343, 21133, 7679, 12871, -12, 8614, 12560, 12462, 2419, -7734,
+        -1215, -2292, -20808, -1526, -3282, 13434, 4145, 10664, 2371, 6672, 9199, 5465,
+        15008, -130, 10401, 322, -937, 1229, -4246, -1103, 10515, 17034, 12126, 9708,
+        16723, 14967, 5791, -6765, 2143, 857, -4305, 2710, 954, 14067, 4778, 11297,
+        6389, 3971, 10986, 9230, 17356, 3902, 9094, -4449, 4837, 8783, 8685, 1306,
+        -8847, -2328, -3405, -21921, -2639, -4395, 10800, 1511, 8030, -263, 4038, 7719,
+        2831, 10749, -2301, 8230, -1849, -3108, 2662, -5696, 7258, 13285, 19804, 14896,
+        12478, 19493, 17737, 5964, -6592, 2316, 1030, -4132, 2883, 1127, 14240, 4951,
+        11470, 6562, 4144, 11159, 9403, 17529, 4075, 9267, -1627, 5010, 8956, 8858,
+        1479, -8674, -2155, -3232, -21748, -2466, -4222, 10973, 1684, 8203, -90, 4211,
+        7892, 3004, 11616, -1434, 9097, -982, -2241, 3529, -4829, 12214, 18241, 24760,
+        19852, 17434, 24449, 22693, 10920, -1636, 7272, 5986, 824, 7839, 6083, 20194,
+        10905, 17424, 12516, 10098, 17113, 15357, 22485, 9031, 14223, 3329, 9966, 13912,
+        13814, 6435, -3718, 2801, 1724, -16792, 2490, 734, 15929, 6640, 13159, 4866,
+        9167, 12848, 7960, 17021, 3971, 14502, 4423, 3164, 8934, 576, 6961, 12988,
+        19507, 14599, 12181, 19196, 17440, 5667, -6889, 2019, 733, -4429, 2586, 830,
+        13943, 4654, 11173, 6265, 3847, 10862, 9106, 18236, 4782, 9974, -4134, 5717,
+        9663, 8958, 1182, -8971, -2452, -3529, -22045, -2763, -4519, 11562, 2273, 8792,
+        499, 4800, 8481, 3593, 11319, -1731, 8800, -3244, -2538, 3232, -6527, 6439,
+        12466, 18985, 14077, 11659, 18674, 16918, 5145, -7411, 1497, 211, -5494, 2064,
+        308, 13421, 4132, 10651, 5743, 3325, 10340, 8584, 17129, 3675, 8867, -2027,
+        4610, 8556, 8458, 660, -9493, -2974, -4051, -22567, -3285, -4338, 10154, 865,
+        7384, -909, 3392, 7073, 2185, 11203, -1847, 8684, -1395, -2654, 3116, -5242,
+        10426, 16453, 22972, 18064, 15646, 22661, 20905, 9132, -3424, 5484, 4198, -964,
+        6051, 4295, 17408, 8119, 14638, 9730, 7312, 14327, 12571, 20697, 7243, 12435,
+        1541, 8178, 12124, 12026, 4647, -5506, 1013, -64, -18580, 702, -1054, 22476,
+        13187, 19706, 11413, 15714, 19395, 14507, 16929, 3879, 14410, 4331, 3072, 8842,
+        484, 7714, 13741, 20260, 15352, 12934, 19949, 18193, 6420, -6136, 2772, 1486,
+        -3676, 3339, 1583, 14696, 5407, 11926, 7018, 4600, 11615, 9859, 20649, 7195,
+        12387, -496, 8130, 12076, 11978, 1935, -8218, -1699, -2776, -21292, -2010, -3766,
+        12950, 3661, 10180, 1887, 6188, 8715, 4981, 13780, -1358, 9173, -906, -2165,
+        1, -5474, -626, 10992, 17511, 12603, 10185, 17200, 15444, 6268, -6288, 2620,
+        1334, -3828, 3187, 1431, 14544, 5255, 11774, 6866, 4448, 11463, 9707, 16818,
+        3364, 8556, -4987, 4299, 8245, 8147, 1783, -8370, -1851, -2928, -21444, -2162,
+        -3918, 11744, 2455, 8974, 681, 4982, 8663, 3775, 11084, -1966, 8565, -1514,
+        -2773, 2997, -5361, 7735, 13762, 20281, 15373, 12955, 19970, 18214, 6441, -6115,
+        2793, 1507, -3655, 3360, 1604, 14717, 5428, 11947, 7039, 4621, 11636, 9880,
+        18006, 4552, 9744, -1150, 5487, 9433, 9335, 1956, -8197, -1678, -2755, -21271,
+        -1989, -3745, 11450, 2161, 8680, 387, 4688, 8369, 3481, 12093, -957, 9574,
+        -505, -1764, 4006, -4352, 12691, 18718, 25237, 20329, 17911, 24926, 23170, 11397,
+        -1159, 7749, 6463, 1301, 8316, 6560, 20671, 11382, 17901, 12993, 10575, 17590,
+        15834, 22962, 9508, 14700, 3806, 10443, 14389, 14291, 6912, -3241, 3278, 2201,
+        -16315, 2967, 1211, 16406, 7117, 13636, 5343, 9644, 13325, 8437, 17498, 4448,
+        14979, 4900, 3641, 9411, 1053, 7438, 13465, 19984, 15076, 12658, 19673, 17917,
+        6144, -6412, 2496, 1210, -3952, 3063, 1307, 14420, 5131, 11650, 6742, 4324,
+        11339, 9583, 20203, 6749, 11941, -2167, 7684, 11630, 10925, 1659, -8494, -1975,
+        -3052, -21568, -2286, -4042, 12039, 2750, 9269, 976, 5277, 8958, 4070, 11680,
+        -1370, 9161, -2883, -2177, 3593, -6166, 6916, 12943, 19462, 14554, 12136, 19151,
+        17395, 5622, -6934, 1974, 688, -5017, 2541, 785, 13898, 4609, 11128, 6220,
+        3802, 10817, 9061, 17606, 4152, 9344, -1550, 5087, 9033, 8935, 1137, -9016,
+        -2497, -3574, -22090, -2808, -3861, 10631, 1342, 7861, -432, 3869, 7550, 2662,
+        11680, -1370, 9161, -918, -2177, 3593, -4765, 10903, 16930, 23449, 18541, 16123,
+        23138, 21382, 9609, -2947, 5961, 4675, -487, 6528, 4772, 17885, 8596, 15115,
+        10207, 7789, 14804, 13048, 21174, 7720, 12912, 2018, 8655, 12601, 12503, 5124,
+        -5029, 1490, 413, -18103, 1179, -577, 22953, 13664, 20183, 11890, 16191, 19872,
+        14984, 17406, 4356, 14887, 4808, 3549, 9319, 961, 8191, 14218, 20737, 15829,
+        13411, 20426, 18670, 6897, -5659, 3249, 1963, -3199, 3816, 2060, 15173, 5884,
+        12403, 7495, 5077, 12092, 10336, 22295, 8841, 14033, 1150, 9776, 13722, 13624,
+        2412, -7741, -1222, -2299, -20815, -1533, -3289, 13427, 4138, 10657, 2364, 6665,
+        9192, 5458, 15061, -77, 10454, 375, -884, 1282, -4193, -600, 11018, 17537,
+        12629, 10211, 17226, 15470, 6294, -6262, 2646, 1360, -3802, 3213, 1457, 14570,
+        5281, 11800, 6892, 4474, 11489, 9733, 17859, 4405, 9597, -3946, 5340, 9286,
+        9188, 1809, -8344, -1825, -2902, -21418, -2136, -3892, 11303, 2014, 8533, 240,
+        4541, 8222, 3334, 11252, -1798, 8733, -1346, -2605, 3165, -5193, 7761, 13788,
+        20307, 15399, 12981, 19996, 18240, 6467, -6089, 2819, 1533, -3629, 3386, 1630,
+        14743, 5454, 11973, 7065, 4647, 11662, 9906, 18032, 4578, 9770, -1124, 5513,
+        9459, 9361, 1982, -8171, -1652, -2729, -21245, -1963, -3719, 11476, 2187, 8706,
+        413, 4714, 8395, 3507, 12119, -931, 9600, -479, -1738, 4032, -4326, 12717,
+        18744, 25263, 20355, 17937, 24952, 23196, 11423, -1133, 7775, 6489, 1327, 8342,
+        6586, 20697, 11408, 17927, 13019, 10601, 17616, 15860, 22988, 9534, 14726, 3832,
+        10469, 14415, 14317, 6938, -3215, 3304, 2227, -16289, 2993, 1237, 16432, 7143,
+        13662, 5369, 9670, 13351, 8463, 17524, 4474, 15005, 4926, 3667, 9437, 1079,
+        7464, 13491, 20010, 15102, 12684, 19699, 17943, 6170, -6386, 2522, 1236, -3926,
+        3089, 1333, 14446, 5157, 11676, 6768, 4350, 11365, 9609, 18739, 5285, 10477,
+        -3631, 6220, 10166, 9461, 1685, -8468, -1949, -3026, -21542, -2260, -4016, 12065,
+        2776, 9295, 1002, 5303, 8984, 4096, 11822, -1228, 9303, -2741, -2035, 3735,
+        -6024, 6942, 12969, 19488, 14580, 12162, 19177, 17421, 5648, -6908, 2000, 714,
+        -4991, 2567, 811, 13924, 4635, 11154, 6246, 3828, 10843, 9087, 17632, 4178,
+        9370, -1524, 5113, 9059, 8961, 1163, -8990, -2471, -3548, -22064, -2782, -3835,
+        10657, 1368, 7887, -406, 3895, 7576, 2688, 11706, -1344, 9187, -892, -2151,
+        3619, -4739, 10929, 16956, 23475, 18567, 16149, 23164, 21408, 9635, -2921, 5987,
+        4701, -461, 6554, 4798, 17911, 8622, 15141, 10233, 7815, 14830, 13074, 21200,
+        7746, 12938, 2044, 8681, 12627, 12529, 5150, -5003, 1516, 439, -18077, 1205,
+        -551, 22979, 13690, 20209, 11916, 16217, 19898, 15010, 17432, 4382, 14913, 4834,
+        3575, 9345, 987, 8217, 14244, 20763, 15855, 13437, 20452, 18696, 6923, -5633,
+        3275, 1989, -3173, 3842, 2086, 15199, 5910, 12429, 7521, 5103, 12118, 10362,
+        21152, 7698, 12890, 7, 8633, 12579, 12481, 2438, -7715, -1196, -2273, -20789,
+        -1507, -3263, 13453, 4164, 10683, 2390, 6691, 9218, 5484, 15027, -111, 10420,
+        341, -918, 1248, -4227, -458, 11160, 17679, 12771, 10353, 17368, 15612, 6436,
+        -6120, 2788, 1502, -3660, 3355, 1599, 14712, 5423, 11942, 7034, 4616, 11631,
+        9875, 18001, 4547, 9739, -3804, 5482, 9428, 9330, 1951, -8202, -1683, -2760,
+        -21276, -1994, -3750, 11445, 2156, 8675, 382, 4683, 8364, 3476, 11394, -1656,
+        8875, -1204, -2463, 3307, -5051, 7903, 13930, 20449, 15541, 13123, 20138, 18382,
+        6609, -5947, 2961, 1675, -3487, 3528, 1772, 14885, 5596, 12115, 7207, 4789,
+        11804, 10048, 18174, 4720, 9912, -982, 5655, 9601, 9503, 2124, -8029, -1510,
+        -2587, -21103, -1821, -3577, 11618, 2329, 8848, 555, 4856, 8537, 3649, 12261,
+        -789, 9742, -337, -1596, 4174, -4184, 12859, 18886, 25405, 20497, 18079, 25094,
+        23338, 11565, -991, 7917, 6631, 1469, 8484, 6728, 20839, 11550, 18069, 13161,
+        10743, 17758, 16002, 23130, 9676, 14868, 3974, 10611, 14557, 14459, 7080, -3073,
+        3446, 2369, -16147, 3135, 1379, 16574, 7285, 13804, 5511, 9812, 13493, 8605,
+        17666, 4616, 15147, 5068, 3809, 9579, 1221, 7606, 13633, 20152, 15244, 12826,
+        19841, 18085, 6312, -6244, 2664, 1378, -3784, 3231, 1475, 14588, 5299, 11818,
+        6910, 4492, 11507, 9751, 18881, 5427, 10619, -3489, 6362, 10308, 9603, 1827,
+        -8326, -1807, -2884, -21400, -2118, -3874, 12207, 2918, 9437, 1144, 5445, 9126,
+        4238, 11964, -1086, 9445, -2599, -1893, 3877, -5882, 7084, 13111, 19630, 14722,
+        12304, 19319, 17563, 5790, -6766, 2142, 856, -4849, 2709, 953, 14066, 4777,
+        11296, 6388, 3970, 10985, 9229, 17774, 4320, 9512, -1382, 5255, 9201, 9103,
+        1305, -8848, -2329, -3406, -21922, -2640, -3693, 10799, 1510, 8029, -264, 4037,
+        7718, 2830, 11848, -1202, 9329, -750, -2009, 3761, -4597, 11071, 17098, 23617,
+        18709, 16291, 23306, 21550, 9777, -2779, 6129, 4843, -319, 6696, 4940, 18053,
+        8764, 15283, 10375, 7957, 14972, 13216, 21342, 7888, 13080, 2186, 8823, 12769,
+        12671, 5292, -4861, 1658, 581, -17935, 1347, -409, 23121, 13832, 20351, 12058,
+        16359, 20040, 15152, 17761, 4711, 15242, 5163, 3904, 9674, 1316, 8359, 14386,
+        20905, 15997, 13579, 20594, 18838, 7065, -5491, 3417, 2131, -3031, 3984, 2228,
+        15341, 6052, 12571, 7663, 5245, 12260, 10504, 20431, 6977, 12169, -714, 7912,
+        11858, 11760, 2580, -7573, -1054, -2131, -20647, -1365, -3121, 13131, 3842, 10361,
+        2068, 6369, 8896, 5162, 15169, 31, 10562, 483, -776, 1390, -4085, -1198,
+        10420, 16939, 12031, 9613, 16628, 14872, 5696, -6860, 2048, 762, -4400, 2615,
+        859, 13972, 4683, 11202, 6294, 3876, 10891, 9135, 17261, 3807, 8999, -4544,
+        4742, 8688, 8590, 1211, -8942, -2423, -3500, -22016, -2734, -4490, 10374, 1085,
+        7604, -689, 3612, 7293, 2405, 10264, -2786, 7745, -2334, -3593, 2177, -6181,
+        7163, 13190, 19709, 14801, 12383, 19398, 17642, 5869, -6687, 2221, 935, -4227,
+        2788, 1032, 14145, 4856, 11375, 6467, 4049, 11064, 9308, 17434, 3980, 9172,
+        -1722, 4915, 8861, 8763, 1384, -8769, -2250, -3327, -21843, -2561, -4317, 10878,
+        1589, 8108, -185, 4116, 7797, 2909, 11521, -1529, 9002, -1077, -2336, 3434,
+        -4924, 12119, 18146, 24665, 19757, 17339, 24354, 22598, 10825, -1731, 7177, 5891,
+        729, 7744, 5988, 20099, 10810, 17329, 12421, 10003, 17018, 15262, 22390, 8936,
+        14128, 3234, 9871, 13817, 13719, 6340, -3813, 2706, 1629, -16887, 2395, 639,
+        15834, 6545, 13064, 4771, 9072, 12753, 7865, 16926, 3876, 14407, 4328, 3069,
+        8839, 481, 6866, 12893, 19412, 14504, 12086, 19101, 17345, 5572, -6984, 1924,
+        638, -4524, 2491, 735, 13848, 4559, 11078, 6170, 3752, 10767, 9011, 18635,
+        5181, 10373, -3735, 6116, 10062, 9357, 1087, -9066, -2547, -3624, -22140, -2858,
+        -4614, 11467, 2178, 8697, 404, 4705, 8386, 3498, 11314, -1736, 8795, -3249,
+        -2543, 3227, -6532, 6344, 12371, 18890, 13982, 11564, 18579, 16823, 5050, -7506,
+        1402, 116, -5589, 1969, 213, 13326, 4037, 10556, 5648, 3230, 10245, 8489,
+        17034, 3580, 8772, -2122, 4515, 8461, 8363, 565, -9588, -3069, -4146, -22662,
+        -3380, -4433, 10059, 770, 7289, -1004, 3297, 6978, 2090, 11108, -1942, 8589,
+        -1490, -2749, 3021, -5337, 10331, 16358, 22877, 17969, 15551, 22566, 20810, 9037,
+        -3519, 5389, 4103, -1059, 5956, 4200, 17313, 8024, 14543, 9635, 7217, 14232,
+        12476, 20602, 7148, 12340, 1446, 8083, 12029, 11931, 4552, -5601, 918, -159,
+        -18675, 607, -1149, 22381, 13092, 19611, 11318, 15619, 19300, 14412, 16834, 3784,
+        14315, 4236, 2977, 8747, 389, 7619, 13646, 20165, 15257, 12839, 19854, 18098,
+        6325, -6231, 2677, 1391, -3771, 3244, 1488, 14601, 5312, 11831, 6923, 4505,
+        11520, 9764, 20870, 7416, 12608, -275, 8351, 12297, 12199, 1840, -8313, -1794,
+        -2871, -21387, -2105, -3861, 12362, 3073, 9592, 1299, 5600, 8127, 4393, 15709,
+        571, 11102, 1023, -236, 1930, -3545, 3811, -2558, 3961, -947, -3365, 3650,
+        1894, 5361, -7195, 1713, 427, -4735, 2280, 524, 6731, -2558, 3961, -947,
+        -3365, 3650, 1894, 12702, -752, 4440, -4449, -1165, 4129, 1189, 6731, -2558,
+        3961, 2884, -12106, 3650, 1894, 6731, -2558, 3961, -947, -31, 3650, -1238,
+        9114, -3936, 6595, -3471, -4743, 561, -3554, 3984, -2385, 4134, -774, -3192,
+        3823, 2067, 5534, -7022, 1886, 600, -4562, 2453, 697, 6904, -2385, 4134,
+        -774, -3192, 3823, 2067, 14707, 1253, 6445, 205, 840, 6134, 3194, 6904,
+        -2385, 4134, 3057, -11933, 3823, 2067, 6904, -2385, 4134, -774, 142, 3823,
+        -1065, 10665, -2385, 8146, -1920, -3192, 2112, -2003, 8940, 2571, 9090, 4182,
+        1764, 8779, 7023, 10490, -2066, 6842, 5556, 394, 7409, 5653, 11860, 2571,
+        9090, 4182, 1764, 8779, 7023, 19663, 6209, 11401, 5161, 5796, 11090, 8150,
+        11860, 2571, 9090, 8013, -6977, 8779, 7023, 11860, 2571, 9090, 4182, 5098,
+        8779, 3891, 15621, 2571, 13102, 3036, 1764, 7068, 2953, 3574, -2795, 3724,
+        -1184, -3602, 3413, 1657, 5124, -7432, 1476, 190, -4972, 2043, 287, 6494,
+        -2795, 3724, -1184, -3602, 3413, 1657, 16758, 3304, 8496, 2256, 2891, 8185,
+        5245, 6494, -2795, 3724, 2647, -12343, 3413, 1657, 6494, -2795, 3724, -1184,
+        -268, 3413, -1475, 10255, -2795, 7736, -4295, -3602, 1702, -2413, 3165, -3204,
+        3315, -1593, -4011, 3004, 1248, 4715, -7841, 1067, -219, -5381, 1634, -122,
+        6085, -3204, 3315, -1593, -4011, 3004, 1248, 13888, 434, 5626, -614, 21,
+        5315, 2375, 6085, -3204, 3315, 2238, -12752, 3004, 1951, 6085, -3204, 3315,
+        -1593, -677, 3004, -1884, 10252, -2798, 7733, -2333, -3605, 1699, -2416, 7152,
+        783, 7302, 2394, -24, 6991, 5235, 8702, -3854, 5054, 3768, -1394, 5621,
+        3865, 10072, 783, 7302, 2394, -24, 6991, 5235, 17875, 4421, 9613, 3373,
+        4008, 9302, 6362, 10072, 783, 7302, 6225, -8765, 6991, 5235, 10072, 783,
+        7302, 2394, 3310, 6991, 2103, 13833, 783, 11314, 1248, -24, 5280, 1165,
+        4224, -2145, 4374, -534, -2952, 4063, 2307, 5774, -6782, 2126, 840, -4322,
+        2693, 937, 7144, -2145, 4374, -534, -2952, 4063, 2307, 14947, 1493, 6685,
+        -578, 1080, 6374, 3434, 7144, -2145, 4374, 3297, -11693, 4063, 2307, 7144,
+        -2145, 4374, -534, 382, 2909, -825, 12999, -2139, 8392, -1674, -2946, 2358,
+        -1757, 4856, -1513, 5006, 98, -2320, 4695, 2939, 6406, -6150, 2758, 1472,
+        -3690, 3325, 1569, 7776, -1513, 5006, 98, -2320, 4695, 2939, 15579, 2125,
+        7317, -1572, 1712, 7006, 4066, 7776, -1513, 5006, 3929, -11061, 4695, 2939,
+        7776, -1513, 5006, 98, 1014, 4695, -193, 10159, -2891, 7640, -2426, -3698,
+        1606, -2509, 5029, -1340, 5179, 271, -2147, 4868, 3112, 7672, -4884, 4024,
+        2738, -2424, 4591, 2835, 7949, -1340, 5179, 271, -2147, 4868, 3112, 15752,
+        2298, 7490, 1250, 1885, 7179, 4239, 7949, -1340, 5179, 4102, -10888, 4868,
+        3112, 7949, -1340, 5179, 271, 1187, 4868, -20, 11710, -1340, 9191, -875,
+        -2147, 3157, -958, 9985, 3616, 10135, 5227, 2809, 9824, 8068, 11535, -1021,
+        7887, 6601, 1439, 8454, 6698, 12905, 3616, 10135, 5227, 2809, 9824, 8068,
+        20708, 7254, 12446, 6206, 6841, 12135, 9195, 12905, 3616, 10135, 9058, -5932,
+        9824, 8068, 12905, 3616, 10135, 5227, 6143, 9824, 4936, 16666, 3616, 14147,
+        4081, 2809, 8113, 3998, 4619, -1750, 4769, -139, -2557, 4458, 2702, 6169,
+        -6387, 2521, 1235, -3927, 3088, 1332, 7539, -1750, 4769, -139, -2557, 4458,
+        2702, 17803, 4349, 9541, 3301, 3936, 9230, 6290, 7539, -1750, 4769, 3692,
+        -11298, 4458, 2702, 7539, -1750, 4769, -139, 777, 4458, -430, 11300, -1750,
+        8781, -3250, -2557, 2747, -1368, 4210, -2159, 4360, -548, -2966, 4049, 2293,
+        5760, -6796, 2112, 826, -4336, 2679, 923, 7130, -2159, 4360, -548, -2966,
+        4049, 2293, 14933, 1479, 6671, 431, 1066, 6360, 3420, 7130, -2159, 4360,
+        3283, -11707, 4049, 2996, 7130, -2159, 4360, -548, 368, 4049, -839, 11297,
+        -1753, 8778, -1288, -2560, 2744, -1371, 8197, 1828, 8347, 3439, 1021, 8036,
+        6280, 9747, -2809, 6099, 4813, -349, 6666, 4910, 11117, 1828, 8347, 3439,
+        1021, 8036, 6280, 18920, 5466, 10658, 4418, 5053, 10347, 7407, 11117, 1828,
+        8347, 7270, -7720, 8036, 6280, 11117, 1828, 8347, 3439, 4355, 8036, 3148,
+        14878, 1828, 12359, 2293, 1021, 6325, 2210, 5269, -1100, 5419, 511, -1907,
+        5108, 3352, 6819, -5737, 3171, 1885, -3277, 3738, 1982, 8189, -1100, 5419,
+        511, -1907, 5108, 3352, 15992, 2538, 7730, 467, 2125, 7419, 4479, 8189,
+        -1100, 5419, 4342, -10648, 5108, 3352, 8189, -1100, 5419, 511, 1427, 3954,
+        220, 14044, -1094, 9437, -629, -1901, 3403, -712, 4514, -1855, 4664, -244,
+        -2662, 4353, 2597, 6064, -6492, 2416, 1130, -4032, 2983, 1227, 7434, -1855,
+        4664, -244, -2662, 4353, 2597, 15237, 1783, 6975, -1914, 1370, 6664, 3724,
+        7434, -1855, 4664, 3587, -11403, 4353, 2597, 7434, -1855, 4664, -244, 672,
+        4353, -535, 9817, -3233, 7298, -2768, -4040, 1264, -2851, 4687, -1682, 4837,
+        -71, -2489, 4526, 2770, 6237, -6319, 2589, 1303, -3859, 3156, 1400, 7607,
+        -1682, 4837, -71, -2489, 4526, 2770, 15410, 1956, 7148, 908, 1543, 6837,
+        3897, 7607, -1682, 4837, 3760, -11230, 4526, 2770, 7607, -1682, 4837, -71,
+        845, 4526, -362, 11368, -1682, 8849, -1217, -2489, 2815, -1300, 9643, 3274,
+        9793, 4885, 2467, 9482, 7726, 11193, -1363, 7545, 6259, 1097, 8112, 6356,
+        12563, 3274, 9793, 4885, 2467, 9482, 7726, 20366, 6912, 12104, 5864, 6499,
+        11793, 8853, 12563, 3274, 9793, 8716, -6274, 9482, 7726, 12563, 3274, 9793,
+        4885, 5801, 9482, 4594, 16324, 3274, 13805, 3739, 2467, 7771, 3656, 4277,
+        -2092, 4427, -481, -2899, 4116, 2360, 5827, -6729, 2179, 893, -4269, 2746,
+        990, 7197, -2092, 4427, -481, -2899, 4116, 2360, 17461, 4007, 9199, 2959,
+        3594, 8888, 5948, 7197, -2092, 4427, 3350, -11640, 4116, 2360, 7197, -2092,
+        4427, -481, 435, 4116, -772, 10958, -2092, 8439, -3592, -2899, 2405, -1710,
+        3868, -2501, 4018, -890, -3308, 3707, 1951, 5418, -7138, 1770, 484, -4678,
+        2337, 581, 6788, -2501, 4018, -890, -3308, 3707, 1951, 14591, 1137, 6329,
+        89, 724, 6018, 3078, 6788, -2501, 4018, 2941, -12049, 3707, 2654, 6788,
+        -2501, 4018, -890, 26, 3707, -1181, 10955, -2095, 8436, -1630, -2902, 2402,
+        -1713, 7855, 1486, 8005, 3097, 679, 7694, 5938, 9405, -3151, 5757, 4471,
+        -691, 6324, 4568, 10775, 1486, 8005, 3097, 679, 7694, 5938, 18578, 5124,
+        10316, 4076, 4711, 10005, 7065, 10775, 1486, 8005, 6928, -8062, 7694, 5938,
+        10775, 1486, 8005, 3097, 4013, 7694, 2806, 14536, 1486, 12017, 1951, 679,
+        5983, 1868, 4927, -1442, 5077, 169, -2249, 4766, 3010, 6477, -6079, 2829,
+        1543, -3619, 3396, 1640, 7847, -1442, 5077, 169, -2249, 4766, 3010, 15650,
+        2196, 7388, 125, 1783, 7077, 4137, 7847, -1442, 5077, 4000, -10990, 4766,
+        3010, 7847, -1442, 5077, 169, 1085, 3612, -122, 13702, -1436, 9095, -971,
+        -2243, 3061, -1054, 4360, -2009, 4510, -398, -2816, 4199, 2443, 5910, -6646,
+        2262, 976, -4186, 2829, 1073, 7280, -2009, 4510, -398, -2816, 4199, 2443,
+        14068, 614, 5806, -3083, 201, 5495, 2555, 7280, -2009, 4510, 3433, -11557,
+        4199, 2443, 7747, -1542, 4977, 69, 985, 4666, -222, 9521, -3529, 7002,
+        -3064, -4336, 968, -3147, 4533, -1836, 4683, -225, -2643, 4372, 2616, 6083,
+        -6473, 2435, 1149, -4013, 3002, 1246, 7453, -1836, 4683, -225, -2643, 4372,
+        2616, 15256, 1802, 6994, 754, 1389, 6683, 3743, 7453, -1836, 4683, 3606,
+        -11384, 4372, 2616, 7453, -1836, 4683, -225, 691, 4372, -516, 11214, -1836,
+        8695, -1371, -2643, 2661, -1454, 9489, 3120, 9639, 4731, 2313, 9328, 7572,
+        11039, -1517, 7391, 6105, 943, 7958, 6202, 12409, 3120, 9639, 4731, 2313,
+        9328, 7572, 20212, 6758, 11950, 5710, 6345, 11639, 8699, 12409, 3120, 9639,
+        8562, -6428, 9328, 7572, 12409, 3120, 9639, 4731, 5647, 9328, 4440, 16170,
+        3120, 13651, 3585, 2313, 7617, 3502, 4123, -2246, 4273, -635, -3053, 3962,
+        2206, 5673, -6883, 2025, 739, -4423, 2592, 836, 7043, -2246, 4273, -635,
+        -3053, 3962, 2206, 17307, 3853, 9045, 2805, 3440, 8734, 5794, 7043, -2246,
+        4273, 3196, -11794, 3962, 2206, 7043, -2246, 4273, -635, 281, 3962, -926,
+        10804, -2246, 8285, -3746, -3053, 2251, -1864, 3714, -2655, 3864, -1044, -3462,
+        3553, 1797, 5264, -7292, 1616, 330, -4832, 2183, 427, 6634, -2655, 3864,
+        -1044, -3462, 3553, 1797, 14437, 983, 6175, -65, 570, 5864, 2924, 6634,
+        -2655, 3864, 2787, -12203, 3553, 2500, 6634, -2655, 3864, -1044, -128, 3553,
+        -1335, 10801, -2249, 8282, -1784, -3056, 2248, -1867, 7701, 1332, 7851, 2943,
+        525, 7540, 5784, 9251, -3305, 5603, 4317, -845, 6170, 4414, 10621, 1332,
+        7851, 2943, 525, 7540, 5784, 18424, 4970, 10162, 3922, 4557, 9851, 6911,
+        10621, 1332, 7851, 6774, -8216, 7540, 5784, 10621, 1332, 7851, 2943, 3859,
+        7540, 2652, 14382, 1332, 11863, 1797, 525, 5829, 1714, 4773, -1596, 4923,
+        15, -2403, 4612, 2856, 6323, -6233, 2675, 1389, -3773, 3242, 1486, 7693,
+        -1596, 4923, 15, -2403, 4612, 2856, 16665, 3211, 8403, 1140, 2798, 8092,
+        5152, 7693, -1596, 4923, 3846, -11144, 4612, 2856, 7693, -1596, 4923, 15,
+        931, 3458, -276, 13548, -1590, 8941, -1125, -2397, 2907, -1208, 4366, -2003,
+        4516, -392, -2810, 4205, 2449, 5916, -6640, 2268, 982, -4180, 2835, 1079,
+        7286, -2003, 4516, -392, -2810, 4205, 2449, 15089, 1635, 6827, -2062, 1222,
+        6516, 3576, 7286, -2003, 4516, 3439, -11551, 4205, 2449, 7286, -2003, 4516,
+        -392, 524, 4205, -683, 9669, -3381, 7150, -2916, -4188, 1116, -2999, 4539,
+        -1830, 4689, -219, -2637, 4378, 2622, 6089, -6467, 2441, 1155, -4007, 3008,
+        1252, 7459, -1830, 4689, -219, -2637, 4378, 2622, 15262, 1808, 7000, 760,
+        1395, 6689, 3749, 7459, -1830, 4689, 3612, -11378, 4378, 2622, 7459, -1830,
+        4689, -219, 697, 4378, -510, 11220, -1830, 8701, -1365, -2637, 2667, -1448,
+        9495, 3126, 9645, 4737, 2319, 9334, 7578, 11045, -1511, 7397, 6111, 949,
+        7964, 6208, 12415, 3126, 9645, 4737, 2319, 9334, 7578, 20218, 6764, 11956,
+        5716, 6351, 11645, 8705, 12415, 3126, 9645, 8568, -6422, 9334, 7578, 12415,
+        3126, 9645, 4737, 5653, 9334, 4446, 16176, 3126, 13657, 3591, 2319, 7623,
+        3508, 4129, -2240, 4279, -629, -3047, 3968, 2212, 5679, -6877, 2031, 745,
+        -4417, 2598, 842, 7049, -2240, 4279, -629, -3047, 3968, 2212, 17313, 3859,
+        9051, 2811, 3446, 8740, 5800, 7049, -2240, 4279, 3202, -11788, 3968, 2212,
+        7049, -2240, 4279, -629, 287, 3968, -920, 10810, -2240, 8291, -3740, -3047,
+        2257, -1858, 3720, -2649, 3870, -1038, -3456, 3559, 1803, 5270, -7286, 1622,
+        336, -4826, 2189, 433, 6640, -2649, 3870, -1038, -3456, 3559, 1803, 14443,
+        989, 6181, -59, 576, 5870, 2930, 6640, -2649, 3870, 2793, -12197, 3559,
+        2506, 6640, -2649, 3870, -1038, -122, 3559, -1329, 10807, -2243, 8288, -1778,
+        -3050, 2254, -1861, 7707, 1338, 7857, 2949, 531, 7546, 5790, 9257, -3299,
+        5609, 4323, -839, 6176, 4420, 10627, 1338, 7857, 2949, 531, 7546, 5790,
+        18430, 4976, 10168, 3928, 4563, 9857, 6917, 10627, 1338, 7857, 6780, -8210,
+        7546, 5790, 10627, 1338, 7857, 2949, 3865, 7546, 2658, 14388, 1338, 11869,
+        1803, 531, 5835, 1720, 4779, -1590, 4929, 21, -2397, 4618, 2862, 6329,
+        -6227, 2681, 1395, -3767, 3248, 1492, 7699, -1590, 4929, 21, -2397, 4618,
+        2862, 15502, 2048, 7240, -23, 1635, 6929, 3989, 7699, -1590, 4929, 3852,
+        -11138, 4618, 2862, 7699, -1590, 4929, 21, 937, 3464, -270, 13554, -1584,
+        8947, -1119, -2391, 2913, -1202, 5017, -1352, 5167, 259, -2159, 4856, 3100,
+        6567, -5989, 2919, 1633, -3529, 3486, 1730, 7937, -1352, 5167, 259, -2159,
+        4856, 3100, 15740, 2286, 7478, -1411, 1873, 7167, 4227, 7937, -1352, 5167,
+        4090, -10900, 4856, 3100, 7937, -1352, 5167, 259, 1175, 4856, -32, 10320,
+        -2730, 7801, -2265, -3537, 1767, -2348, 5190, -1179, 5340, 432, -1986, 5029,
+        3273, 6740, -5816, 3092, 1806, -3356, 3659, 1903, 8110, -1179, 5340, 432,
+        -1986, 5029, 3273, 15913, 2459, 7651, 1411, 2046, 7340, 4400, 8110, -1179,
+        5340, 4263, -10727, 5029, 3273, 8110, -1179, 5340, 432, 1348, 5029, 141,
+        11871, -1179, 9352, -714, -1986, 3318, -797, 10146, 3777, 10296, 5388, 2970,
+        9985, 8229, 11696, -860, 8048, 6762, 1600, 8615, 6859, 13066, 3777, 10296,
+        5388, 2970, 9985, 8229, 20869, 7415, 12607, 6367, 7002, 12296, 9356, 13066,
+        3777, 10296, 9219, -5771, 9985, 8229, 13066, 3777, 10296, 5388, 6304, 9985,
+        5097, 16827, 3777, 14308, 4242, 2970, 8274, 4159, 4780, -1589, 4930, 22,
+        -2396, 4619, 2863, 6330, -6226, 2682, 1396, -3766, 3249, 1493, 7700, -1589,
+        4930, 22, -2396, 4619, 2863, 17964, 4510, 9702, 3462, 4097, 9391, 6451,
+        7700, -1589, 4930, 3853, -11137, 4619, 2863, 7700, -1589, 4930, 22, 938,
+        4619, -269, 11461, -1589, 8942, -3089, -2396, 2908, -1207, 4371, -1998, 4521,
+        -387, -2805, 4210, 2454, 5921, -6635, 2273, 987, -4175, 2840, 1084, 7291,
+        -1998, 4521, -387, -2805, 4210, 2454, 15094, 1640, 6832, 592, 1227, 6521,
+        3581, 7291, -1998, 4521, 3444, -11546, 4210, 3157, 7291, -1998, 4521, -387,
+        529, 4210, -678, 11458, -1592, 8939, -1127, -2399, 2905, -1210, 8358, 1989,
+        8508, 3600, 1182, 8197, 6441, 9908, -2648, 6260, 4974, -188, 6827, 5071,
+        11278, 1989, 8508, 3600, 1182, 8197, 6441, 19081, 5627, 10819, 4579, 5214,
+        10508, 7568, 11278, 1989, 8508, 7431, -7559, 8197, 6441, 11278, 1989, 8508,
+        3600, 4516, 8197, 3309, 15226, 2176, 12707, 2641, 1369, 6673, 2558, 5430,
+        -939, 5580, 672, -1746, 5269, 3513, 6980, -5576, 3332, 2046, -3116, 3899,
+        2143, 8350, -939, 5580, 672, -1746, 5269, 3513, 16153, 2699, 7891, 628,
+        2286, 7580, 4640, 8350, -939, 5580, 4503, -10487, 5269, 3513, 8350, -939,
+        5580, 672, 1588, 4115, 381, 14205, -933, 9598, -468, -1740, 3564, -551,
+        4393, -1976, 4543, -365, -2783, 4232, 2476, 5943, -6613, 2295, 1009, -4153,
+        2862, 1106, 7313, -1976, 4543, -365, -2783, 4232, 2476, 15116, 1662, 6854,
+        -2035, 1249, 6543, 3603, 7313, -1976, 4543, 3466, -11524, 4232, 2476, 6982,
+        -2307, 4212, -696, 220, 3901, -987, 9306, -3744, 6787, -3279, -4551, 753,
+        -3362, 4566, -1803, 4716, -192, -2610, 4405, 2649, 6116, -6440, 2468, 1182,
+        -3980, 3035, 1279, 7486, -1803, 4716, -192, -2610, 4405, 2649, 15289, 1835,
+        7027, 787, 1422, 6716, 3776, 7486, -1803, 4716, 3639, -11351, 4405, 2649,
+        7486, -1803, 4716, -192, 724, 4405, -483, 11247, -1803, 8728, -1338, -2610,
+        2694, -1421, 9522, 3153, 9672, 4764, 2346, 9361, 7605, 11072, -1484, 7424,
+        6138, 976, 7991, 6235, 12442, 3153, 9672, 4764, 2346, 9361, 7605, 20245,
+        6791, 11983, 5743, 6378, 11672, 8732, 12442, 3153, 9672, 8595, -6395, 9361,
+        7605, 12442, 3153, 9672, 4764, 5680, 9361, 4473, 16203, 3153, 13684, 3618,
+        2346, 7650, 3535, 4156, -2213, 4306, -602, -3020, 3995, 2239, 5706, -6850,
+        2058, 772, -4390, 2625, 869, 7076, -2213, 4306, -602, -3020, 3995, 2239,
+        18338, 4884, 10076, 3836, 4471, 9765, 6825, 7076, -2213, 4306, 3229, -11761,
+        3995, 2239, 7076, -2213, 4306, -602, 314, 3995, -893, 10837, -2213, 8318,
+        -3713, -3020, 2284, -1831, 3747, -2622, 3897, -1011, -3429, 3586, 1830, 5297,
+        -7259, 1649, 363, -4799, 2216, 460, 6667, -2622, 3897, -1011, -3429, 3586,
+        1830, 14470, 1016, 6208, -32, 603, 5897, 2957, 6667, -2622, 3897, 2820,
+        -12170, 3586, 2533, 6667, -2622, 3897, -1011, -95, 3586, -1302, 10834, -2216,
+        8315, -1751, -3023, 2281, -1834, 7734, 1365, 7884, 2976, 558, 7573, 5817,
+        9284, -3272, 5636, 4350, -812, 6203, 4447, 10654, 1365, 7884, 2976, 558,
+        7573, 5817, 18457, 5003, 10195, 3955, 4590, 9884, 6944, 10654, 1365, 7884,
+        6807, -8183, 7573, 5817, 10654, 1365, 7884, 2976, 3892, 7573, 2685, 14415,
+        1365, 11896, 1830, 558, 5862, 1747, 4806, -1563, 4956, 48, -2370, 4645,
+        2889, 6356, -6200, 2708, 1422, -3740, 3275, 1519, 7726, -1563, 4956, 48,
+        -2370, 4645, 2889, 15529, 2075, 7267, 4, 1662, 6956, 4016, 7726, -1563,
+        4956, 3879, -11111, 4645, 2889, 8306, -983, 5536, 628, 1544, 4071, 337,
+        14610, -528, 10003, -63, -1335, 3969, -146, 15510, 9141, 15660, 10752, 8334,
+        15349, 13593, 5361, -7195, 1713, 427, -4735, 2280, 1450, 3519, -5770, -224,
+        -4159, -6577, 438, -1318, 11875, -1579, 3613, -5276, -1992, 3302, 362, 6731,
+        -2558, 3961, 2884, -12106, 3650, 1894, 6731, -2558, 3961, -947, -31, 3650,
+        -1238, 9114, -3936, 6595, -3471, -6779, 561, -3288, 3984, -2385, 4134, -774,
+        -3192, 3823, 2067, 5534, -9785, 1886, 600, -4562, 2453, 1623, 3692, -5597,
+        -51, -3986, -6404, 611, -1145, 13880, 426, 5618, -622, 13, 5307, 2367,
+        6904, -2385, 4134, 3057, -11753, 3823, 2067, 6904, -2385, 4134, -774, 142,
+        3823, -1065, 10665, -2385, 8146, -1920, -5228, 2112, -1737, 8940, 2571, 9090,
+        4182, 1764, 8779, 7023, 10490, -2066, 6842, 5556, 394, 7409, 6579, 8648,
+        -641, 4905, 970, -1448, 5567, 3811, 18836, 5382, 10574, 4334, 4969, 10263,
+        7323, 11860, 2571, 9090, 8013, -6977, 8779, 7023, 11860, 2571, 9090, 4182,
+        5098, 8779, 3891, 15621, 2571, 13102, 3036, -272, 7068, 3219, 3574, -2795,
+        3724, -1184, -3602, 3413, 1657, 5124, -7432, 1476, 190, -4972, 2043, 1213,
+        3282, -6007, -461, -4396, -6814, 201, -1555, 15526, 2072, 7264, -2983, 1659,
+        6953, 4639, 6494, -2795, 3724, 2647, -12343, 3413, 1657, 6494, -2795, 3724,
+        -1184, -268, 3413, -1475, 10255, -2795, 7736, -4788, -5638, 1702, -212, 923,
+        -5446, 1073, -3835, -6253, 762, -994, 4715, -7841, 1067, -219, -13537, 1634,
+        804, 2873, -6416, -870, -4805, -7223, -208, -1964, 12268, -1186, 4006, -2234,
+        -1599, 3695, 755, 6085, -3204, 3315, 2238, -12752, 3004, 1951, 6085, -3204,
+        3315, -1593, -677, 3004, -1884, 12050, -1000, 9531, -535, -3843, 3497, -352,
+        7152, 783, 7302, 2394, -24, 6991, 5235, 8702, -3854, 5054, 3768, -1394,
+        5621, 4791, 6860, -2429, 3117, -818, -3236, 3779, 2023, 17048, 3594, 8786,
+        2546, 3181, 8475, 5535, 10072, 783, 7302, 6225, -8765, 6991, 5235, 10072,
+        783, 7302, 2394, 3310, 6991, 2103, 11431, -1619, 8912, -1154, -4462, 2878,
+        -971, 4224, -2145, 4374, -534, -2952, 4063, 2307, 5774, -6782, 2126, 840,
+        -4322, 2693, 1863, 3932, -5357, 189, -3746, -6164, 851, -905, 14120, 666,
+        5858, -1405, 253, 5547, 1034, 7144, -2145, 4374, 3297, -11693, 4063, 2307,
+        7583, -1706, 4813, -95, 821, 3348, -386, 15763, 145, 10676, 3056, -2698,
+        4642, 499, 16555, 10186, 16705, 11797, 9379, 16394, 14638, 6406, -6150, 2758,
+        1472, -3690, 3325, 2495, 4564, -4725, 821, -3114, -5532, 1483, -273, 14752,
+        1298, 6490, -2399, 885, 6179, 3239, 7776, -1513, 5006, 3929, -11061, 4695,
+        2939, 7776, -1513, 5006, 98, 1014, 4695, -193, 10159, -2891, 7640, -2426,
+        -5734, 1606, -2243, 5029, -1340, 5179, 271, -2147, 4868, 3112, 7672, -7647,
+        4024, 2738, -2424, 4591, 3761, 4737, -4552, 994, -2941, -5359, 1656, -100,
+        14925, 1471, 6663, 423, 1058, 6352, 3412, 7949, -1340, 5179, 4102, -10708,
+        4868, 3112, 7949, -1340, 5179, 271, 1187, 4868, -20, 11710, -1340, 9191,
+        -875, -4183, 3157, -692, 9985, 3616, 10135, 5227, 2809, 9824, 8068, 11535,
+        -1021, 7887, 6601, 1439, 8454, 7624, 9693, 404, 5950, 2015, -403, 6612,
+        4856, 19881, 6427, 11619, 5379, 6014, 11308, 8368, 12905, 3616, 10135, 9058,
+        -5932, 9824, 8068, 12905, 3616, 10135, 5227, 6143, 9824, 4936, 16666, 3616,
+        14147, 4081, 773, 8113, 4264, 4619, -1750, 4769, -139, -2557, 4458, 2702,
+        6169, -6387, 2521, 1235, -3927, 3088, 2258, 4327, -4962, 584, -3351, -5769,
+        1246, -510, 17256, 3802, 8994, -1253, 3389, 8683, 6369, 7539, -1750, 4769,
+        3692, -11298, 4458, 2702, 7539, -1750, 4769, -139, 777, 4458, -430, 11300,
+        -1750, 8781, -3743, -4593, 2747, 833, 1968, -4401, 2118, -2790, -5208, 1807,
+        51, 5760, -6796, 2112, 826, -12492, 2679, 1849, 3918, -5371, 175, -3760,
+        -6178, 837, -919, 13313, -141, 5051, -1189, -554, 4740, 1800, 7130, -2159,
+        4360, 3283, -11707, 4049, 2996, 7130, -2159, 4360, -548, 368, 4049, -839,
+        13095, 45, 10576, 510, -2798, 4542, 693, 8197, 1828, 8347, 3439, 1021,
+        8036, 6280, 9747, -2809, 6099, 4813, -349, 6666, 5836, 7905, -1384, 4162,
+        227, -2191, 4824, 3068, 18093, 4639, 9831, 3591, 4226, 9520, 6580, 11117,
+        1828, 8347, 7270, -7720, 8036, 6280, 11117, 1828, 8347, 3439, 4355, 8036,
+        3148, 12476, -574, 9957, -109, -3417, 3923, 74, 5269, -1100, 5419, 511,
+        -1907, 5108, 3352, 6819, -5737, 3171, 1885, -3277, 3738, 2908, 4977, -4312,
+        1234, -2701, -5119, 1896, 140, 15165, 1711, 6903, -360, 1298, 6592, 2079,
+        8189, -1100, 5419, 4342, -10648, 5108, 3352, 8628, -661, 5858, 950, 1866,
+        4393, 659, 16698, 1080, 11611, 3991, -1763, 5577, 1434, 16213, 9844, 16363,
+        11455, 9037, 16052, 14296, 6064, -6492, 2416, 1130, -4032, 2983, 2153, 4222,
+        -5067, 479, -3456, -5874, 1141, -615, 14410, 956, 6148, -2741, 543, 5837,
+        2897, 7434, -1855, 4664, 3587, -11403, 4353, 2597, 7434, -1855, 4664, -244,
+        672, 4353, -535, 9817, -3233, 7298, -2768, -6076, 1264, -2585, 4687, -1682,
+        4837, -71, -2489, 4526, 2770, 6237, -9082, 2589, 1303, -3859, 3156, 2326,
+        4395, -4894, 652, -3283, -5701, 1314, -442, 14583, 1129, 6321, 81, 716,
+        6010, 3070, 7607, -1682, 4837, 3760, -11050, 4526, 2770, 7607, -1682, 4837,
+        -71, 845, 4526, -362, 11368, -1682, 8849, -1217, -4525, 2815, -1034, 9643,
+        3274, 9793, 4885, 2467, 9482, 7726, 11193, -1363, 7545, 6259, 1097, 8112,
+        7282, 9351, 62, 5608, 1673, -745, 6270, 4514, 19539, 6085, 11277, 5037,
+        5672, 10966, 8026, 12563, 3274, 9793, 8716, -6274, 9482, 7726, 12563, 3274,
+        9793, 4885, 5801, 9482, 4594, 16324, 3274, 13805, 3739, 431, 7771, 3922,
+        4277, -2092, 4427, -481, -2899, 4116, 2360, 5827, -6729, 2179, 893, -4269,
+        2746, 1916, 3985, -5304, 242, -3693, -6111, 904, -852, 16914, 3460, 8652,
+        -1595, 3047, 8341, 6027, 7197, -2092, 4427, 3350, -11640, 4116, 2360, 7197,
+        -2092, 4427, -481, 435, 4116, -772, 10958, -2092, 8439, -4085, -4935, 2405,
+        491, 1626, -4743, 1776, -3132, -5550, 1465, -291, 5418, -7138, 1770, 484,
+        -12834, 2337, 1507, 3576, -5713, -167, -4102, -6520, 495, -1261, 12971, -483,
+        4709, -1531, -896, 4398, 1458, 6788, -2501, 4018, 2941, -12049, 3707, 2654,
+        6788, -2501, 4018, -890, 26, 3707, -1181, 12753, -297, 10234, 168, -3140,
+        4200, 351, 7855, 1486, 8005, 3097, 679, 7694, 5938, 9405, -3151, 5757,
+        4471, -691, 6324, 5494, 7563, -1726, 3820, -115, -2533, 4482, 2726, 17751,
+        4297, 9489, 3249, 3884, 9178, 6238, 10775, 1486, 8005, 6928, -8062, 7694,
+        5938, 10775, 1486, 8005, 3097, 4013, 7694, 2806, 12134, -916, 9615, -451,
+        -3759, 3581, -268, 4927, -1442, 5077, 169, -2249, 4766, 3010, 6477, -6079,
+        2829, 1543, -3619, 3396, 2566, 4635, -4654, 892, -3043, -5461, 1554, -202,
+        14823, 1369, 6561, -702, 956, 6250, 1737, 7847, -1442, 5077, 4000, -10990,
+        4766, 3010, 8286, -1003, 5516, 608, 1524, 4051, 317, 16356, 738, 11269,
+        3649, -2105, 5235, 1092, 16059, 9690, 16209, 11301, 8883, 15898, 14142, 5910,
+        -6646, 2262, 976, -4186, 2829, 1999, 4068, -5221, 325, -3610, -6028, 987,
+        -769, 13241, -213, 4979, -3910, -626, 4668, 1728, 7280, -2009, 4510, 3433,
+        -11557, 4199, 2443, 7747, -1542, 4977, 69, 985, 4666, -222, 9521, -3529,
+        7002, -3064, -6372, 968, -2881, 4533, -1836, 4683, -225, -2643, 4372, 2616,
+        6083, -9236, 2435, 1149, -4013, 3002, 2172, 4241, -5048, 498, -3437, -5855,
+        1160, -596, 14429, 975, 6167, -73, 562, 5856, 2916, 7453, -1836, 4683,
+        3606, -11204, 4372, 2616, 7453, -1836, 4683, -225, 691, 4372, -516, 11214,
+        -1836, 8695, -1371, -4679, 2661, -1188, 9489, 3120, 9639, 4731, 2313, 9328,
+        7572, 11039, -1517, 7391, 6105, 943, 7958, 7128, 9197, -92, 5454, 1519,
+        -899, 6116, 4360, 19385, 5931, 11123, 4883, 5518, 10812, 7872, 12409, 3120,
+        9639, 8562, -6428, 9328, 7572, 12409, 3120, 9639, 4731, 5647, 9328, 4440,
+        16170, 3120, 13651, 3585, 277, 7617, 3768, 4123, -2246, 4273, -635, -3053,
+        3962, 2206, 5673, -6883, 2025, 739, -4423, 2592, 1762, 3831, -5458, 88,
+        -3847, -6265, 750, -1006, 16760, 3306, 8498, -1749, 2893, 8187, 5873, 7043,
+        -2246, 4273, 3196, -11794, 3962, 2206, 7043, -2246, 4273, -635, 281, 3962,
+        -926, 12148, -902, 9629, -2895, -3745, 3595, 1681, 1472, -4897, 1622, -3286,
+        -5704, 1311, -445, 5264, -7292, 1616, 330, -12988, 2183, 1353, 3422, -5867,
+        -321, -4256, -6674, 341, -1415, 12817, -637, 4555, -1685, -1050, 4244, 1304,
+        6634, -2655, 3864, 2787, -12203, 3553, 2500, 6634, -2655, 3864, -1044, -128,
+        3553, -1335, 12599, -451, 10080, 14, -3294, 4046, 197, 7701, 1332, 7851,
+        2943, 525, 7540, 5784, 9251, -3305, 5603, 4317, -845, 6170, 5340, 7409,
+        -1880, 3666, -269, -2687, 4328, 2572, 17597, 4143, 9335, 3095, 3730, 9024,
+        6084, 10621, 1332, 7851, 6774, -8216, 7540, 5784, 10621, 1332, 7851, 2943,
+        3859, 7540, 2652, 11980, -1070, 9461, -605, -3913, 3427, -422, 4773, -1596,
+        4923, 15, -2403, 4612, 2856, 6323, -6233, 2675, 1389, -3773, 3242, 2412,
+        4481, -4808, 738, -3197, -5615, 1400, -356, 15838, 2384, 7576, 313, 1971,
+        7265, 2752, 7693, -1596, 4923, 3846, -11144, 4612, 2856, 8132, -1157, 5362,
+        454, 1370, 3897, 163, 16825, 1207, 11738, 4118, -1636, 5704, 1561, 16065,
+        9696, 16215, 11307, 8889, 15904, 14148, 5916, -6640, 2268, 982, -4180, 2835,
+        2005, 4074, -5215, 331, -3604, -6022, 993, -763, 14262, 808, 6000, -2889,
+        395, 5689, 2749, 7286, -2003, 4516, 3439, -11551, 4205, 2449, 7286, -2003,
+        4516, -392, 524, 4205, -683, 9669, -3381, 7150, -2916, -6224, 1116, -2733,
+        4539, -1830, 4689, -219, -2637, 4378, 2622, 6089, -9230, 2441, 1155, -4007,
+        3008, 2178, 4247, -5042, 504, -3431, -5849, 1166, -590, 14435, 981, 6173,
+        -67, 568, 5862, 2922, 10251, 962, 7481, 6404, -8406, 7170, 5414, 7459,
+        -1830, 4689, -219, 697, 4378, -510, 11220, -1830, 8701, -1365, -4673, 2667,
+        -1182, 9495, 3126, 9645, 4737, 2319, 9334, 7578, 11045, -1511, 7397, 6111,
+        949, 7964, 7134, 9203, -86, 5460, 1525, -893, 6122, 4366, 19391, 5937,
+        11129, 4889, 5524, 10818, 7878, 12415, 3126, 9645, 8568, -6422, 9334, 7578,
+        12415, 3126, 9645, 4737, 5653, 9334, 4446, 16176, 3126, 13657, 3591, 283,
+        7623, 3774, 4129, -2240, 4279, -629, -3047, 3968, 2212, 5679, -6877, 2031,
+        745, -4417, 2598, 1768, 3837, -5452, 94, -3841, -6259, 756, -1000, 16766,
+        3312, 8504, -1743, 2899, 8193, 5879, 7049, -2240, 4279, 3202, -11788, 3968,
+        2212, 7049, -2240, 4279, -629, 287, 3968, -920, 10810, -2240, 8291, -4233,
+        -5083, 2257, 343, 1478, -4891, 1628, -3280, -5698, 1317, -439, 5949, -6607,
+        2301, 1015, -12303, 2868, 2038, 3428, -5861, -315, -4250, -6668, 347, -1409,
+        12823, -631, 4561, -1679, -1044, 4250, 1310, 6640, -2649, 3870, 2793, -12197,
+        3559, 2506, 6640, -2649, 3870, -1038, -122, 3559, -1329, 12605, -445, 10086,
+        20, -3288, 4052, 203, 7707, 1338, 7857, 2949, 531, 7546, 5790, 9257,
+        -3299, 5609, 4323, -839, 6176, 5346, 7415, -1874, 3672, -263, -2681, 4334,
+        2578, 17603, 4149, 9341, 3101, 3736, 9030, 6090, 10627, 1338, 7857, 6780,
+        -8210, 7546, 5790, 10627, 1338, 7857, 2949, 3865, 7546, 2658, 11986, -1064,
+        9467, -599, -3907, 3433, -416, 4779, -1590, 4929, 21, -2397, 4618, 2862,
+        6329, -6227, 2681, 1395, -3767, 3248, 2418, 4487, -4802, 744, -3191, -5609,
+        1406, -350, 14675, 1221, 6413, -850, 808, 6102, 1589, 7699, -1590, 4929,
+        3852, -11138, 4618, 2862, 8138, -1151, 5368, 460, 1376, 3903, 169, 16795,
+        1177, 11708, 4088, -1666, 5674, 1531, 16716, 10347, 16866, 11958, 9540, 16555,
+        14799, 6567, -5989, 2919, 1633, -3529, 3486, 2656, 4725, -4564, 982, -2953,
+        -5371, 1644, -112, 14913, 1459, 6651, -2238, 1046, 6340, 3400, 7937, -1352,
+        5167, 4090, -10900, 4856, 3100, 7937, -1352, 5167, 259, 1175, 4856, -32,
+        10320, -2730, 7801, -2265, -5573, 1767, -2082, 5190, -1179, 5340, 432, -1986,
+        5029, 3273, 6740, -8579, 3092, 1806, -3356, 3659, 2829, 4898, -4391, 1155,
+        -2780, -5198, 1817, 61, 15086, 1632, 6824, 584, 1219, 6513, 3573, 8110,
+        -1179, 5340, 4263, -10547, 5029, 3273, 8110, -1179, 5340, 432, 1348, 5029,
+        141, 11871, -1179, 9352, -714, -4022, 3318, -531, 10146, 3777, 10296, 5388,
+        2970, 9985, 8229, 11696, -860, 8048, 6762, 1600, 8615, 7785, 9854, 565,
+        6111, 2176, -242, 6773, 5017, 20042, 6588, 11780, 5540, 6175, 11469, 8529,
+        13066, 3777, 10296, 9219, -5771, 9985, 8229, 13066, 3777, 10296, 5388, 6304,
+        9985, 5097, 16827, 3777, 14308, 4242, 934, 8274, 4425, 4780, -1589, 4930,
+        22, -2396, 4619, 2863, 6330, -6226, 2682, 1396, -3766, 3249, 2419, 4488,
+        -4801, 745, -3190, -5608, 1407, -349, 17417, 3963, 9155, -1092, 3550, 8844,
+        6530, 7700, -1589, 4930, 3853, -11137, 4619, 2863, 7700, -1589, 4930, 22,
+        938, 4619, -269, 11461, -1589, 8942, -3582, -4432, 2908, 994, 2129, -4240,
+        2279, -2629, -5047, 1968, 212, 5921, -6635, 2273, 987, -12331, 2840, 2010,
+        4079, -5210, 336, -3599, -6017, 998, -758, 13474, 20, 5212, -1028, -393,
+        4901, 1961, 7291, -1998, 4521, 3444, -11546, 4210, 3157, 7291, -1998, 4521,
+        -387, 529, 4210, -678, 13256, 206, 10737, 671, -2637, 4703, 854, 8358,
+        1989, 8508, 3600, 1182, 8197, 6441, 9908, -2648, 6260, 4974, -188, 6827,
+        5997, 8066, -1223, 4323, 388, -2030, 4985, 3229, 18254, 4800, 9992, 3752,
+        4387, 9681, 6741, 11278, 1989, 8508, 7431, -7559, 8197, 6441, 11278, 1989,
+        8508, 3600, 4516, 8197, 3309, 12824, -226, 10305, 239, -3069, 4271, 422,
+        5430, -939, 5580, 672, -1746, 5269, 3513, 6980, -5576, 3332, 2046, -3116,
+        3899, 3069, 5138, -4151, 1395, -2540, -4958, 2057, 301, 15326, 1872, 7064,
+        -199, 1459, 6753, 2240, 8350, -939, 5580, 4503, -10487, 5269, 3513, 8789,
+        -500, 6019, 1111, 2027, 4554, 820, 16859, 1241, 11772, 4152, -1602, 5738,
+        1595, 16092, 9723, 16242, 11334, 8916, 15931, 14175, 5943, -6613, 2295, 1009,
+        -4153, 2862, 2032, 4101, -5188, 358, -3577, -5995, 1020, -736, 14289, 835,
+        6027, -2862, 422, 5716, 2776, 7313, -1976, 4543, 3466, -11524, 4232, 2476,
+        6982, -2307, 4212, -696, 220, 3901, -987, 9306, -3744, 6787, -3279, -6587,
+        753, -3096, 4566, -1803, 4716, -192, -2610, 4405, 2649, 6116, -9203, 2468,
+        1182, -3980, 3035, 2205, 4274, -5015, 531, -3404, -5822, 1193, -563, 14462,
+        1008, 6200, -40, 595, 5889, 2949, 7486, -1803, 4716, 3639, -11171, 4405,
+        2649, 7486, -1803, 4716, -192, 724, 4405, -483, 11247, -1803, 8728, -1338,
+        -4646, 2694, -1155, 9522, 3153, 9672, 4764, 2346, 9361, 7605, 11072, -1484,
+        7424, 6138, 976, 7991, 7161, 9230, -59, 5487, 1552, -866, 6149, 4393,
+        19418, 5964, 11156, 4916, 5551, 10845, 7905, 12442, 3153, 9672, 8595, -6395,
+        9361, 7605, 12442, 3153, 9672, 4764, 5680, 9361, 4473, 16203, 3153, 13684,
+        3618, 310, 7650, 3801, 4156, -2213, 4306, -602, -3020, 3995, 2239, 5706,
+        -6850, 2058, 772, -4390, 2625, 1795, 3864, -5425, 121, -3814, -6232, 783,
+        -973, 18788, 5334, 10526, 279, 4921, 10215, 7901, 7076, -2213, 4306, 3229,
+        -11761, 3995, 2239, 7076, -2213, 4306, -602, 314, 3995, -893, 10837, -2213,
+        8318, -4206, -5056, 2284, 370, 1505, -4864, 1655, -3253, -5671, 1344, -412,
+        5297, -7259, 1649, 363, -12955, 2216, 1386, 3455, -5834, -288, -4223, -6641,
+        374, -1382, 12850, -604, 4588, -1652, -1017, 4277, 1337, 6667, -2622, 3897,
+        2820, -12170, 3586, 2533, 6667, -2622, 3897, -1011, -95, 3586, -1302, 12632,
+        -418, 10113, 47, -3261, 4079, 230, 7734, 1365, 7884, 2976, 558, 7573,
+        5817, 9284, -3272, 5636, 4350, -812, 6203, 5373, 7442, -1847, 3699, -236,
+        -2654, 4361, 2605, 17630, 4176, 9368, 3128, 3763, 9057, 6117, 10654, 1365,
+        7884, 6807, -8183, 7573, 5817, 10654, 1365, 7884, 2976, 3892, 7573, 2685,
+        12494, -556, 9975, -91, -3399, 3941, 92, 4806, -1563, 4956, 48, -2370,
+        4645, 2889, 6356, -6200, 2708, 1422, -3740, 3275, 2445, 4514, -4775, 771,
+        -3164, -5582, 1433, -323, 16431, 2977, 8169, 906, 2564, 7858, 3345, 7726,
+        -1563, 4956, 3879, -11111, 4645, 2889, 8745, -544, 5975, 1067, 1983, 4510,
+        776, 17610, 1992, 12523, 4903, -851, 6489, 2346, 6365, 12392, 18911, 14003,
+        11585, 18600, 16844, 5071, -7485, 1423, 137, -5025, 1990, 234, 13347, 4058,
+        10577, 5669, 3251, 10266, 8510, 14804, 1350, 6542, -7001, 2285, 6231, 7052,
+        -278, -9567, -3048, -4125, -20921, -3359, -5115, 10080, 791, 7310, -983, 3318,
+        6999, 2111, 10120, -2930, 7601, -2465, -3737, 1567, -6443, 6538, 12565, 19084,
+        14176, 11758, 18773, 17017, 5244, -7312, 1596, 310, -4852, 2163, 407, 13520,
+        4231, 10750, 5842, 3424, 10439, 8683, 16809, 3355, 8547, -2347, 4290, 8236,
+        9057, -105, -9394, -2875, -3952, -20748, -3186, -4942, 10253, 964, 7483, -810,
+        3491, 7172, 2284, 10896, -2154, 8377, -1689, -2961, 2343, -5667, 11494, 17521,
+        24040, 19132, 16714, 23729, 21973, 10200, -2356, 6552, 5266, 104, 7119, 5363,
+        19474, 10185, 16704, 11796, 9378, 16393, 14637, 21765, 8311, 13503, 2609, 9246,
+        13192, 14013, 4851, -4438, 2081, 1004, -15792, 1770, 14, 15209, 5920, 12439,
+        4146, 8447, 12128, 7240, 15852, 2802, 13333, 3267, 1995, 7299, -711, 6128,
+        12155, 18674, 13766, 11348, 18363, 16607, 4834, -7722, 1186, -100, -5262, 1753,
+        -3, 13110, 3821, 10340, 5432, 3014, 10029, 8273, 18561, 5107, 10299, -2776,
+        6042, 9988, 10202, -515, -9804, -3285, -4362, -21158, -3596, -5352, 9843, 554,
+        7073, -1220, 3081, 6762, 1874, 10486, -2564, 7967, -4064, -3371, 1933, -6077,
+        5719, 11746, 18265, 13357, 10939, 17954, 16198, 4425, -8131, 777, -509, -5671,
+        1344, -412, 12701, 3412, 9931, 5023, 2605, 9620, 7864, 16409, 2955, 8147,
+        -2747, 3890, 7836, 8657, -924, -10213, -3694, -4771, -21567, -4005, -5058, 9434,
+        145, 6664, -1629, 2672, 6353, 1465, 10483, -2567, 7964, -2102, -3374, 1930,
+        -6080, 9706, 15733, 22252, 17344, 14926, 21941, 20185, 8412, -4144, 4764, 3478,
+        -1684, 5331, 3575, 16688, 7399, 13918, 9010, 6592, 13607, 11851, 19977, 6523,
+        11715, 821, 7458, 11404, 12225, 3063, -6226, 293, -784, -17580, -18, -1774,
+        21756, 12467, 18986, 10693, 14994, 18675, 13787, 15621, 2571, 13102, 3036, 1764,
+        7068, -942, 6778, 12805, 19324, 14416, 11998, 19013, 17257, 5484, -7072, 1836,
+        550, -4612, 2403, 647, 13760, 4471, 10990, 6082, 3664, 10679, 8923, 19713,
+        6259, 11451, -1432, 7194, 11140, 11961, 135, -9154, -2635, -3712, -20508, -2946,
+        -4702, 10493, 1204, 7723, -570, 3731, 6258, 2524, 12438, -2700, 7831, -2235,
+        -3507, -1807, -6934, 7410, 13437, 19956, 15048, 12630, 19645, 17889, 6116, -6440,
+        2468, 1182, -3980, 3035, 1279, 14392, 5103, 11622, 6714, 4296, 11311, 9555,
+        17681, 4227, 9419, -4124, 5162, 9108, 9929, 767, -8522, -2003, -3080, -19876,
+        -2314, -4070, 11125, 1836, 8355, 62, 4363, 8044, 3156, 11165, -1885, 8646,
+        -1420, -2692, 2612, -5398, 7583, 13610, 20129, 15221, 12803, 19818, 18062, 7382,
+        -5174, 3734, 2448, -2714, 4301, 2545, 14565, 5276, 11795, 6887, 4469, 11484,
+        9728, 17854, 4400, 9592, -1302, 5335, 9281, 10102, 940, -8349, -1830, -2907,
+        -19703, -2141, -3897, 11298, 2009, 8528, 235, 4536, 8217, 3329, 11941, -1109,
+        9422, -644, -1916, 3388, -4622, 12539, 18566, 25085, 20177, 17759, 24774, 23018,
+        11245, -1311, 7597, 6311, 1149, 8164, 6408, 20519, 11230, 17749, 12841, 10423,
+        17438, 15682, 22810, 9356, 14548, 3654, 10291, 14237, 15058, 5896, -3393, 3126,
+        2049, -14747, 2815, 1059, 16254, 6965, 13484, 5191, 9492, 13173, 8285, 16897,
+        3847, 14378, 4312, 3040, 8344, 334, 7173, 13200, 19719, 14811, 12393, 19408,
+        17652, 5879, -6677, 2231, 945, -4217, 2798, 1042, 14155, 4866, 11385, 6477,
+        4059, 11074, 9318, 19606, 6152, 11344, -1731, 7087, 11033, 11247, 530, -8759,
+        -2240, -3317, -20113, -2551, -4307, 10888, 1599, 8118, -175, 4126, 7807, 2919,
+        11531, -1519, 9012, -3019, -2326, 2978, -5032, 6764, 12791, 19310, 14402, 11984,
+        18999, 17243, 5470, -7086, 1822, 536, -4626, 2389, 633, 13746, 4457, 10976,
+        6068, 3650, 10665, 8909, 17454, 4000, 9192, -1702, 4935, 8881, 9702, 121,
+        -9168, -2649, -3726, -20522, -2960, -4013, 10479, 1190, 7709, -584, 3717, 7398,
+        2510, 11528, -1522, 9009, -1057, -2329, 2975, -5035, 10751, 16778, 23297, 18389,
+        15971, 22986, 21230, 9457, -3099, 5809, 4523, -639, 6376, 4620, 17733, 8444,
+        14963, 10055, 7637, 14652, 12896, 21022, 7568, 12760, 1866, 8503, 12449, 13270,
+        4108, -5181, 1338, 261, -16535, 1027, -729, 22801, 13512, 20031, 11738, 16039,
+        19720, 14832, 16046, 2996, 13527, 3461, 2189, 7493, -517, 7823, 13850, 20369,
+        15461, 13043, 20058, 18302, 6529, -6027, 2881, 1595, -3567, 3448, 1692, 14805,
+        5516, 12035, 7127, 4709, 11724, 9968, 20758, 7304, 12496, -387, 8239, 12185,
+        13006, 1180, -8109, -1590, -2667, -19463, -1901, -3657, 11538, 2249, 8768, 475,
+        4776, 7303, 3569, 13483, -1655, 8876, -1190, -2462, -762, -5889, 7068, 13095,
+        19614, 14706, 12288, 19303, 17547, 5774, -6782, 2126, 840, -4322, 2693, 937,
+        14050, 4761, 11280, 6372, 3954, 10969, 9213, 17339, 3885, 9077, -4466, 4820,
+        8766, 9587, 425, -8864, -2345, -3422, -20218, -2656, -4412, 10783, 1494, 8013,
+        -280, 4021, 7702, 2814, 10823, -2227, 8304, -1762, -3034, 2270, -5740, 7241,
+        13268, 19787, 14879, 12461, 19476, 17720, 5947, -6609, 2299, 1013, -4149, 2866,
+        1110, 14223, 4934, 11453, 6545, 4127, 11142, 9386, 17512, 4058, 9250, -1644,
+        4993, 8939, 9760, 598, -8691, -2172, -3249, -20045, -2483, -4239, 10956, 1667,
+        8186, -107, 4194, 7875, 2987, 11599, -1451, 9080, -986, -2258, 3046, -4964,
+        12197, 18224, 24743, 19835, 17417, 24432, 22676, 10903, -1653, 7255, 5969, 807,
+        7822, 6066, 20177, 10888, 17407, 12499, 10081, 17096, 15340, 22468, 9014, 14206,
+        3312, 9949, 13895, 14716, 5554, -3735, 2784, 1707, -15089, 2473, 717, 15912,
+        6623, 13142, 4849, 9150, 12831, 7943, 16555, 3505, 14036, 3970, 2698, 8002,
+        -8, 6831, 12858, 19377, 14469, 12051, 19066, 17310, 5537, -7019, 1889, 603,
+        -4559, 2456, 700, 13813, 4524, 11043, 6135, 3717, 10732, 8976, 19264, 5810,
+        11002, -2073, 6745, 10691, 10905, 188, -9101, -2582, -3659, -20455, -2893, -4649,
+        10546, 1257, 7776, -517, 3784, 7465, 2577, 11189, -1861, 8670, -3361, -2668,
+        2636, -5374, 6422, 12449, 18968, 14060, 11642, 18657, 16901, 5128, -7428, 1480,
+        194, -4968, 2047, 291, 13404, 4115, 10634, 5726, 3308, 10323, 8567, 17112,
+        3658, 8850, -2044, 4593, 8539, 9360, -221, -9510, -2991, -4068, -20864, -3302,
+        -4355, 10137, 848, 7367, -926, 3375, 7056, 2168, 11186, -1864, 8667, -1399,
+        -2671, 2633, -5377, 10409, 16436, 22955, 18047, 15629, 22644, 20888, 9115, -3441,
+        5467, 4181, -981, 6034, 4278, 17391, 8102, 14621, 9713, 7295, 14310, 12554,
+        20680, 7226, 12418, 1524, 8161, 12107, 12928, 3766, -5523, 996, -81, -16877,
+        685, -1071, 22459, 13170, 19689, 11396, 15697, 19378, 14490, 15704, 2654, 13185,
+        3119, 1847, 7151, -859, 7481, 13508, 20027, 15119, 12701, 19716, 17960, 6187,
+        -6369, 2539, 1253, -3909, 3106, 1350, 14463, 5174, 11693, 6785, 4367, 11382,
+        9626, 20416, 6962, 12154, -729, 7897, 11843, 12664, 838, -8451, -1932, -3009,
+        -19805, -2243, -3999, 11196, 1907, 8426, 133, 4434, 6961, 3227, 13141, -1997,
+        8534, -1532, -2804, -1104, -6231, 6914, 12941, 19460, 14552, 12134, 19149, 17393,
+        5620, -6936, 1972, 686, -4476, 2539, 783, 13896, 4607, 11126, 6218, 3800,
+        10815, 9059, 16170, 2716, 7908, -5635, 3651, 7597, 8418, 271, -9018, -2499,
+        -3576, -20372, -2810, -4566, 11096, 1807, 8326, 33, 4334, 8015, 3127, 10527,
+        -2523, 8008, -2058, -3330, 1974, -6036, 7087, 13114, 19633, 14725, 12307, 19322,
+        17566, 5793, -6763, 2145, 859, -4303, 2712, 956, 14069, 4780, 11299, 6391,
+        3973, 10988, 9232, 17358, 3904, 9096, -1798, 4839, 8785, 9606, 444, -8845,
+        -2326, -3403, -20199, -2637, -4393, 10802, 1513, 8032, -261, 4040, 7721, 2833,
+        11445, -1605, 8926, -1140, -2412, 2892, -5118, 12043, 18070, 24589, 19681, 17263,
+        24278, 22522, 10749, -1807, 7101, 5815, 653, 7668, 5912, 20023, 10734, 17253,
+        12345, 9927, 16942, 15186, 22314, 8860, 14052, 3158, 9795, 13741, 14562, 5400,
+        -3889, 2630, 1553, -15243, 2319, 563, 15758, 6469, 12988, 4695, 8996, 12677,
+        7789, 16401, 3351, 13882, 3816, 2544, 7848, -162, 6677, 12704, 19223, 14315,
+        11897, 18912, 17156, 5383, -7173, 1735, 449, -4713, 2302, 546, 13659, 4370,
+        10889, 5981, 3563, 10578, 8822, 19005, 5551, 10743, -2332, 6486, 10432, 10646,
+        34, -9255, -2736, -3813, -20609, -3047, -4803, 10392, 1103, 7622, -671, 3630,
+        7311, 2423, 10919, -2131, 8400, -3631, -2938, 2366, -5644, 6268, 12295, 18814,
+        13906, 11488, 18503, 16747, 4974, -7582, 1326, 40, -5122, 1893, 137, 13250,
+        3961, 10480, 5572, 3154, 10169, 8413, 16958, 3504, 8696, -2198, 4439, 8385,
+        9206, -375, -9664, -3145, -4222, -21018, -3456, -4509, 9983, 694, 7213, -1080,
+        3221, 6902, 2014, 11032, -2018, 8513, -1553, -2825, 2479, -5531, 10255, 16282,
+        22801, 17893, 15475, 22490, 20734, 8961, -3595, 5313, 4027, -1135, 5880, 4124,
+        17237, 7948, 14467, 9559, 7141, 14156, 12400, 20526, 7072, 12264, 1370, 8007,
+        11953, 12774, 3612, -5677, 842, -235, -17031, 531, -1225, 22305, 13016, 19535,
+        11242, 15543, 19224, 14336, 15550, 2500, 13031, 2965, 1693, 6997, -1013, 7327,
+        13354, 19873, 14965, 12547, 19562, 17806, 6033, -6523, 2385, 1099, -4063, 2952,
+        1196, 14309, 5020, 11539, 6631, 4213, 11228, 9472, 21431, 7977, 13169, 286,
+        8912, 12858, 13679, 684, -8605, -2086, -3163, -19959, -2397, -4153, 11042, 1753,
+        8272, -21, 4280, 6807, 3073, 12987, -2151, 8380, -1686, -2958, -1258, -6385,
+        6920, 12947, 19466, 14558, 12140, 19155, 17399, 5626, -6930, 1978, 692, -4470,
+        2545, 789, 13902, 4613, 11132, 6224, 3806, 10821, 9065, 17191, 3737, 8929,
+        -4614, 4672, 8618, 9439, 277, -9012, -2493, -3570, -20366, -2804, -4560, 10635,
+        1346, 7865, -428, 3873, 7554, 2666, 10675, -2375, 8156, -1910, -3182, 2122,
+        -5888, 7093, 13120, 19639, 14731, 12313, 19328, 17572, 5799, -6757, 2151, 865,
+        -4297, 2718, 962, 14075, 4786, 11305, 6397, 3979, 10994, 9238, 17364, 3910,
+        9102, -1792, 4845, 8791, 9612, 450, -8839, -2320, -3397, -20193, -2631, -4387,
+        10808, 1519, 8038, -255, 4046, 7727, 2839, 11451, -1599, 8932, -1134, -2406,
+        2898, -5112, 12049, 18076, 24595, 19687, 17269, 24284, 22528, 10755, -1801, 7107,
+        5821, 659, 7674, 5918, 20029, 10740, 17259, 12351, 9933, 16948, 15192, 22320,
+        8866, 14058, 3164, 9801, 13747, 14568, 5406, -3883, 2636, 1559, -15237, 2325,
+        569, 15764, 6475, 12994, 4701, 9002, 12683, 7795, 16407, 3357, 13888, 3822,
+        2550, 7854, -156, 6683, 12710, 19229, 14321, 11903, 18918, 17162, 5389, -7167,
+        1741, 455, -4707, 2308, 552, 13665, 4376, 10895, 5987, 3569, 10584, 8828,
+        19116, 5662, 10854, -2221, 6597, 10543, 10757, 40, -9249, -2730, -3807, -20603,
+        -3041, -4797, 10398, 1109, 7628, -665, 3636, 7317, 2429, 11041, -2009, 8522,
+        -3509, -2816, 2488, -5522, 6274, 12301, 18820, 13912, 11494, 18509, 16753, 4980,
+        -7576, 1332, 46, -5116, 1899, 143, 13256, 3967, 10486, 5578, 3160, 10175,
+        8419, 16964, 3510, 8702, -2192, 4445, 8391, 9212, -369, -9658, -3139, -4216,
+        -21012, -3450, -4503, 9989, 700, 7219, -1074, 3227, 6908, 2020, 11038, -2012,
+        8519, -1547, -2819, 2485, -5525, 10261, 16288, 22807, 17899, 15481, 22496, 20740,
+        8967, -3589, 5319, 4033, -1129, 5886, 4130, 17243, 7954, 14473, 9565, 7147,
+        14162, 12406, 20532, 7078, 12270, 1376, 8013, 11959, 12780, 3618, -5671, 848,
+        -229, -17025, 537, -1219, 22311, 13022, 19541, 11248, 15549, 19230, 14342, 15556,
+        2506, 13037, 2971, 1699, 7003, -1007, 7333, 13360, 19879, 14971, 12553, 19568,
+        17812, 6039, -6517, 2391, 1105, -4057, 2958, 1202, 14315, 5026, 11545, 6637,
+        4219, 11234, 9478, 20268, 6814, 12006, -877, 7749, 11695, 12516, 690, -8599,
+        -2080, -3157, -19953, -2391, -4147, 11048, 1759, 8278, -15, 4286, 6813, 3079,
+        12993, -2145, 8386, -1680, -2952, -1252, -6379, 7571, 13598, 20117, 15209, 12791,
+        19806, 18050, 6277, -6279, 2629, 1343, -3819, 3196, 1440, 14553, 5264, 11783,
+        6875, 4457, 11472, 9716, 17842, 4388, 9580, -3963, 5323, 9269, 10090, 928,
+        -8361, -1842, -2919, -19715, -2153, -3909, 11286, 1997, 8516, 223, 4524, 8205,
+        3317, 11326, -1724, 8807, -1259, -2531, 2773, -5237, 7744, 13771, 20290, 15382,
+        12964, 19979, 18223, 6450, -6106, 2802, 1516, -3646, 3369, 1613, 14726, 5437,
+        11956, 7048, 4630, 11645, 9889, 18015, 4561, 9753, -1141, 5496, 9442, 10263,
+        1101, -8188, -1669, -2746, -19542, -1980, -3736, 11459, 2170, 8689, 396, 4697,
+        8378, 3490, 12102, -948, 9583, -483, -1755, 3549, -4461, 12700, 18727, 25246,
+        20338, 17920, 24935, 23179, 11406, -1150, 7758, 6472, 1310, 8325, 6569, 20680,
+        11391, 17910, 13002, 10584, 17599, 15843, 22971, 9517, 14709, 3815, 10452, 14398,
+        15219, 6057, -3232, 3287, 2210, -14586, 2976, 1220, 16415, 7126, 13645, 5352,
+        9653, 13334, 8446, 17058, 4008, 14539, 4473, 3201, 8505, 495, 7334, 13361,
+        19880, 14972, 12554, 19569, 17813, 6040, -6516, 2392, 1106, -4056, 2959, 1203,
+        14316, 5027, 11546, 6638, 4220, 11235, 9479, 19767, 6313, 11505, -1570, 7248,
+        11194, 11408, 691, -8598, -2079, -3156, -19952, -2390, -4146, 11049, 1760, 8279,
+        -14, 4287, 7968, 3080, 11692, -1358, 9173, -2858, -2165, 3139, -4871, 6925,
+        12952, 19471, 14563, 12145, 19160, 17404, 5631, -6925, 1983, 697, -4465, 2550,
+        794, 13907, 4618, 11137, 6229, 3811, 10826, 9070, 17615, 4161, 9353, -1541,
+        5096, 9042, 9863, 282, -9007, -2488, -3565, -20361, -2799, -3852, 10640, 1351,
+        7870, -423, 3878, 7559, 2671, 11689, -1361, 9170, -896, -2168, 3136, -4874,
+        10912, 16939, 23458, 18550, 16132, 23147, 21391, 9618, -2938, 5970, 4684, -478,
+        6537, 4781, 17894, 8605, 15124, 10216, 7798, 14813, 13057, 21183, 7729, 12921,
+        2027, 8664, 12610, 13431, 4269, -5020, 1499, 422, -16374, 1188, -568, 22962,
+        13673, 20192, 11899, 16200, 19881, 14993, 16394, 3344, 13875, 3809, 2537, 7841,
+        -169, 7984, 14011, 20530, 15622, 13204, 20219, 18463, 6690, -5866, 3042, 1756,
+        -3406, 3609, 1853, 14966, 5677, 12196, 7288, 4870, 11885, 10129, 20056, 6602,
+        11794, -1089, 7537, 11483, 12304, 1341, -7948, -1429, -2506, -19302, -1740, -3496,
+        11235, 1946, 8465, 172, 4473, 7000, 3266, 13644, -1494, 9037, -1029, -2301,
+        -601, -5728, 6947, 12974, 19493, 14585, 12167, 19182, 17426, 5653, -6903, 2005,
+        719, -4443, 2572, 816, 13929, 4640, 11159, 6251, 3833, 10848, 9092, 17218,
+        3764, 8956, -4587, 4699, 8645, 9466, 304, -8985, -2466, -3543, -20339, -2777,
+        -4533, 10331, 1042, 7561, -732, 3569, 7250, 2362, 10312, -2738, 7793, -2273,
+        -3545, 1759, -6251, 7120, 13147, 19666, 14758, 12340, 19355, 17599, 5826, -6730,
+        2178, 892, -4270, 2745, 989, 14102, 4813, 11332, 6424, 4006, 11021, 9265,
+        17391, 3937, 9129, -1765, 4872, 8818, 9639, 477, -8812, -2293, -3370, -20166,
+        -2604, -4360, 10835, 1546, 8065, -228, 4073, 7754, 2866, 11478, -1572, 8959,
+        -1107, -2379, 2925, -5085, 12076, 18103, 24622, 19714, 17296, 24311, 22555, 10782,
+        -1774, 7134, 5848, 686, 7701, 5945, 20056, 10767, 17286, 12378, 9960, 16975,
+        15219, 22347, 8893, 14085, 3191, 9828, 13774, 14595, 5433, -3856, 2663, 1586,
+        -15210, 2352, 596, 15791, 6502, 13021, 4728, 9029, 12710, 7822, 16434, 3384,
+        13915, 3849, 2577, 7881, -129, 6710, 12737, 19256, 14348, 11930, 18945, 17189,
+        5416, -7140, 1768, 482, -4680, 2335, 579, 13692, 4403, 10922, 6014, 3596,
+        10611, 8855, 19637, 6183, 11375, -1700, 7118, 11064, 11278, 67, -9222, -2703,
+        -3780, -20576, -3014, -4770, 10425, 1136, 7655, -638, 3663, 7344, 2456, 11290,
+        -1760, 8771, -3260, -2567, 2737, -5273, 6301, 12328, 18847, 13939, 11521, 18536,
+        16780, 5007, -7549, 1359, 73, -5089, 1926, 170, 13283, 3994, 10513, 5605,
+        3187, 10202, 8446, 16991, 3537, 8729, -2165, 4472, 8418, 9239, -342, -9631,
+        -3112, -4189, -20985, -3423, -4476, 10016, 727, 7246, -1047, 3254, 6935, 2047,
+        11065, -1985, 8546, -1520, -2792, 2512, -5498, 10288, 16315, 22834, 17926, 15508,
+        22523, 20767, 8994, -3562, 5346, 4060, -1102, 5913, 4157, 17270, 7981, 14500,
+        9592, 7174, 14189, 12433, 20559, 7105, 12297, 1403, 8040, 11986, 12807, 3645,
+        -5644, 875, -202, -16998, 564, -1192, 22338, 13049, 19568, 11275, 15576, 19257,
+        14369, 15583, 2533, 13064, 2998, 1726, 7030, -980, 7360, 13387, 19906, 14998,
+        12580, 19595, 17839, 6066, -6490, 2418, 1132, -4030, 2985, 1229, 14342, 5053,
+        11572, 6664, 4246, 11261, 9505, 20295, 6841, 12033, -850, 7776, 11722, 12543,
+        717, -8572, -2053, -3130, -19926, -2364, -4120, 10582, 1293, 7812, -481, 3820,
+        6347, 2613, 14527, -611, 9920, -146, -1418, 282, -4845, 7711, 1342, 7861,
+        2953, 535, 7550, 5794, 6296, -6260, 2648, 1362, -3800, 3215, 1459, 7666,
+        -1623, 4896, -12, -2430, 4585, 2829, 13637, 183, 5375, -3514, -230, 5064,
+        2277, 7666, -1623, 4896, 3819, -11171, 4585, 2829, 7666, -1623, 4896, -12,
+        904, 4585, -303, 10049, -3001, 7530, -1390, -3808, 1315, -3758, 4919, -1450,
+        5069, 161, -2257, 4758, 3002, 6469, -6087, 2821, 1535, -3627, 3388, 1632,
+        7839, -1450, 5069, 161, -2257, 4758, 3002, 15642, 2188, 7380, 1140, 1775,
+        7069, 4282, 7839, -1450, 5069, 3992, -10998, 4758, 3002, 7839, -1450, 5069,
+        161, 1077, 4758, -130, 11600, -1450, 9081, 161, -2257, 2866, -2207, 9875,
+        3506, 10025, 5117, 2699, 9714, 7958, 11425, -1131, 7777, 6491, 1329, 8344,
+        6588, 12795, 3506, 10025, 5117, 2699, 9714, 7958, 20598, 7144, 12336, 6096,
+        6731, 12025, 9238, 12795, 3506, 10025, 8948, -6042, 9714, 7958, 12795, 3506,
+        10025, 5117, 6033, 9714, 4826, 16556, 3506, 14037, 5117, 2699, 7822, 2749,
+        4509, -1860, 4659, -249, -2667, 4348, 2592, 6059, -6497, 2411, 1125, -4037,
+        2978, 1222, 7429, -1860, 4659, -249, -2667, 4348, 2592, 17693, 4239, 9431,
+        3191, 3826, 9120, 6333, 7429, -1860, 4659, 3582, -11408, 4348, 2592, 7429,
+        -1860, 4659, -249, 667, 4348, -540, 10894, -2156, 8375, -2510, -2963, 2160,
+        -2913, 5859, -510, 6009, 1101, -1317, 5698, 3942, 9260, -3296, 5612, 4326,
+        -836, 6179, 4423, 8779, -510, 6009, 1101, -1317, 5698, 3942, 16582, 3128,
+        8320, 2080, 2715, 8009, 5222, 9683, 394, 6913, 5836, -9154, 6602, 5549,
+        8779, -510, 6009, 1101, 2017, 5698, 810, 11926, -1124, 9407, 487, -1931,
+        3192, -1881, 8087, 1718, 8237, 3329, 911, 7926, 6170, 9637, -2919, 5989,
+        4703, -459, 6556, 4800, 11007, 1718, 8237, 3329, 911, 7926, 6170, 18810,
+        5356, 10548, 4308, 4943, 10237, 7450, 11007, 1718, 8237, 7160, -7830, 7926,
+        6170, 11007, 1718, 8237, 3329, 4245, 7926, 3038, 14768, 1718, 12249, 3329,
+        911, 6034, 961, 5159, -1210, 5309, 401, -2017, 4998, 3242, 6709, -5847,
+        3061, 1775, -3387, 3628, 1872, 8079, -1210, 5309, 401, -2017, 4998, 3242,
+        16333, 2879, 8071, 808, 2466, 7760, 4973, 8079, -1210, 5309, 4232, -10758,
+        4998, 3242, 8079, -1210, 5309, 401, 1317, 3844, 110, 13934, -1204, 9327,
+        407, -2011, 3112, -1961, 8756, 2387, 8906, 3998, 1580, 8595, 6839, 7341,
+        -5215, 3693, 2407, -2755, 4260, 2504, 8711, -578, 5941, 1033, -1385, 5630,
+        3874, 16514, 3060, 8252, -637, 2647, 7941, 5154, 8711, -578, 5941, 4864,
+        -10126, 5630, 3874, 8711, -578, 5941, 1033, 1949, 5630, 742, 11094, -1956,
+        8575, -345, -2763, 2360, -2713, 5964, -405, 6114, 1206, -1212, 5803, 4047,
+        8607, -3949, 4959, 3673, -1489, 5526, 3770, 8884, -405, 6114, 1206, -1212,
+        5803, 4047, 16687, 3233, 8425, 2185, 2820, 8114, 5327, 8884, -405, 6114,
+        5037, -9953, 5803, 4047, 8884, -405, 6114, 1206, 2122, 5803, 915, 12645,
+        -405, 10126, 1206, -1212, 3911, -1162, 10920, 4551, 11070, 6162, 3744, 10759,
+        9003, 12470, -86, 8822, 7536, 2374, 9389, 7633, 13840, 4551, 11070, 6162,
+        3744, 10759, 9003, 21643, 8189, 13381, 7141, 7776, 13070, 10283, 13840, 4551,
+        11070, 9993, -4997, 10759, 9003, 13840, 4551, 11070, 6162, 7078, 10759, 5871,
+        17601, 4551, 15082, 6162, 3744, 8867, 3794, 5554, -815, 5704, 796, -1622,
+        5393, 3637, 7104, -5452, 3456, 2170, -2992, 4023, 2267, 8474, -815, 5704,
+        796, -1622, 5393, 3637, 18738, 5284, 10476, 4236, 4871, 10165, 7378, 8474,
+        -815, 5704, 4627, -10363, 5393, 3637, 8474, -815, 5704, 796, 1712, 5393,
+        505, 11939, -1111, 9420, -1465, -1918, 3205, -1868, 6904, 535, 7054, 2146,
+        -272, 6743, 4987, 10305, -2251, 6657, 5371, 209, 7224, 5468, 9824, 535,
+        7054, 2146, -272, 6743, 4987, 17627, 4173, 9365, 3125, 3760, 9054, 6267,
+        11210, 1921, 8440, 7363, -7627, 8129, 7076, 9824, 535, 7054, 2146, 3062,
+        6743, 1855, 12971, -79, 10452, 1532, -886, 4237, -836, 9132, 2763, 9282,
+        4374, 1956, 8971, 7215, 10682, -1874, 7034, 5748, 586, 7601, 5845, 12052,
+        2763, 9282, 4374, 1956, 8971, 7215, 19855, 6401, 11593, 5353, 5988, 11282,
+        8495, 12052, 2763, 9282, 8205, -6785, 8971, 7215, 12052, 2763, 9282, 4374,
+        5290, 8971, 4083, 15813, 2763, 13294, 4374, 1956, 7079, 2006, 6204, -165,
+        6354, 1446, -972, 6043, 4287, 7754, -4802, 4106, 2820, -2342, 4673, 2917,
+        9124, -165, 6354, 1446, -972, 6043, 4287, 17378, 3924, 9116, 1853, 3511,
+        8805, 6018, 9124, -165, 6354, 5277, -9713, 6043, 4287, 9124, -165, 6354,
+        1446, 2362, 4889, 1155, 14979, -159, 10372, 1452, -966, 4157, -916, 8414,
+        2045, 8564, 3656, 1238, 8253, 6497, 6999, -5557, 3351, 2065, -3097, 3918,
+        2162, 8369, -920, 5599, 691, -1727, 5288, 3532, 16172, 2718, 7910, -979,
+        2305, 7599, 4812, 8369, -920, 5599, 4522, -10468, 5288, 3532, 8369, -920,
+        5599, 691, 1607, 5288, 400, 10752, -2298, 8233, -687, -3105, 2018, -3055,
+        5622, -747, 5772, 864, -1554, 5461, 3705, 7172, -5384, 3524, 2238, -2924,
+        4091, 2335, 8542, -747, 5772, 864, -1554, 5461, 3705, 16345, 2891, 8083,
+        1843, 2478, 7772, 4985, 8542, -747, 5772, 4695, -10295, 5461, 3705, 8542,
+        -747, 5772, 864, 1780, 5461, 573, 12303, -747, 9784, 864, -1554, 3569,
+        -1504, 10578, 4209, 10728, 5820, 3402, 10417, 8661, 12128, -428, 8480, 7194,
+        2032, 9047, 7291, 13498, 4209, 10728, 5820, 3402, 10417, 8661, 21301, 7847,
+        13039, 6799, 7434, 12728, 9941, 13498, 4209, 10728, 9651, -5339, 10417, 8661,
+        13498, 4209, 10728, 5820, 6736, 10417, 5529, 17259, 4209, 14740, 5820, 3402,
+        8525, 3452, 5212, -1157, 5362, 454, -1964, 5051, 3295, 6762, -5794, 3114,
+        1828, -3334, 3681, 1925, 8132, -1157, 5362, 454, -1964, 5051, 3295, 18396,
+        4942, 10134, 3894, 4529, 9823, 7036, 8132, -1157, 5362, 4285, -10705, 5051,
+        3295, 8132, -1157, 5362, 454, 1370, 5051, 163, 11597, -1453, 9078, -1807,
+        -2260, 2863, -2210, 6562, 193, 6712, 1804, -614, 6401, 4645, 9963, -2593,
+        6315, 5029, -133, 6882, 5126, 9482, 193, 6712, 1804, -614, 6401, 4645,
+        17285, 3831, 9023, 2783, 3418, 8712, 5925, 10386, 1097, 7616, 6539, -8451,
+        7305, 6252, 9482, 193, 6712, 1804, 2720, 6401, 1513, 12629, -421, 10110,
+        1190, -1228, 3895, -1178, 8790, 2421, 8940, 4032, 1614, 8629, 6873, 10340,
+        -2216, 6692, 5406, 244, 7259, 5503, 11710, 2421, 8940, 4032, 1614, 8629,
+        6873, 19513, 6059, 11251, 5011, 5646, 10940, 8153, 11710, 2421, 8940, 7863,
+        -7127, 8629, 6873, 11710, 2421, 8940, 4032, 4948, 8629, 3741, 15471, 2421,
+        12952, 4032, 1614, 6737, 1664, 5862, -507, 6012, 1104, -1314, 5701, 3945,
+        7412, -5144, 3764, 2478, -2684, 4331, 2575, 8782, -507, 6012, 1104, -1314,
+        5701, 3945, 17036, 3582, 8774, 1511, 3169, 8463, 5676, 8782, -507, 6012,
+        4935, -10055, 5701, 3945, 8782, -507, 6012, 1104, 2020, 4547, 813, 14637,
+        -501, 10030, 1110, -1308, 3815, -1258, 8260, 1891, 8410, 3502, 1084, 8099,
+        6343, 6845, -5711, 3197, 1911, -3251, 3764, 2008, 8215, -1074, 5445, 537,
+        -1881, 5134, 3378, 15003, 1549, 6741, -2148, 1136, 6430, 3643, 8215, -1074,
+        5445, 4368, -10622, 5134, 3378, 8682, -607, 5912, 1004, 1920, 5601, 713,
+        10456, -2594, 7937, -983, -3401, 1722, -3351, 5468, -901, 5618, 710, -1708,
+        5307, 3551, 7018, -5538, 3370, 2084, -3078, 3937, 2181, 8388, -901, 5618,
+        710, -1708, 5307, 3551, 16191, 2737, 7929, 1689, 2324, 7618, 4831, 8388,
+        -901, 5618, 4541, -10449, 5307, 3551, 8388, -901, 5618, 710, 1626, 5307,
+        419, 12149, -901, 9630, 710, -1708, 3415, -1658, 10424, 4055, 10574, 5666,
+        3248, 10263, 8507, 11974, -582, 8326, 7040, 1878, 8893, 7137, 13344, 4055,
+        10574, 5666, 3248, 10263, 8507, 21147, 7693, 12885, 6645, 7280, 12574, 9787,
+        13344, 4055, 10574, 9497, -5493, 10263, 8507, 13344, 4055, 10574, 5666, 6582,
+        10263, 5375, 17105, 4055, 14586, 5666, 3248, 8371, 3298, 5058, -1311, 5208,
+        300, -2118, 4897, 3141, 6608, -5948, 2960, 1674, -3488, 3527, 1771, 7978,
+        -1311, 5208, 300, -2118, 4897, 3141, 18242, 4788, 9980, 3740, 4375, 9669,
+        6882, 7978, -1311, 5208, 4131, -10859, 4897, 3141, 7978, -1311, 5208, 300,
+        1216, 4897, 9, 11375, -1675, 8856, -2029, -2482, 2641, -2432, 6408, 39,
+        6558, 1650, -768, 6247, 4491, 9809, -2747, 6161, 4875, -287, 6728, 4972,
+        9328, 39, 6558, 1650, -768, 6247, 4491, 17131, 3677, 8869, 2629, 3264,
+        8558, 5771, 10232, 943, 7462, 6385, -8605, 7151, 6098, 9328, 39, 6558,
+        1650, 2566, 6247, 1359, 12475, -575, 9956, 1036, -1382, 3741, -1332, 8636,
+        2267, 8786, 3878, 1460, 8475, 6719, 10186, -2370, 6538, 5252, 90, 7105,
+        5349, 11556, 2267, 8786, 3878, 1460, 8475, 6719, 19359, 5905, 11097, 4857,
+        5492, 10786, 7999, 11556, 2267, 8786, 7709, -7281, 8475, 6719, 11556, 2267,
+        8786, 3878, 4794, 8475, 3587, 15317, 2267, 12798, 3878, 1460, 6583, 1510,
+        5708, -661, 5858, 950, -1468, 5547, 3791, 7258, -5298, 3610, 2324, -2838,
+        4177, 2421, 8628, -661, 5858, 950, -1468, 5547, 3791, 18251, 4797, 9989,
+        2726, 4384, 9678, 6891, 8628, -661, 5858, 4781, -10209, 5547, 3791, 8628,
+        -661, 5858, 950, 1866, 4393, 659, 14483, -655, 9876, 956, -1462, 3661,
+        -1412, 8266, 1897, 8416, 3508, 1090, 8105, 6349, 6851, -5705, 3203, 1917,
+        -3245, 3770, 2014, 8221, -1068, 5451, 543, -1875, 5140, 3384, 16024, 2570,
+        7762, -1127, 2157, 7451, 4664, 8221, -1068, 5451, 4374, -10616, 5140, 3384,
+        8221, -1068, 5451, 543, 1459, 5140, 252, 10604, -2446, 8085, -835, -3253,
+        1870, -3203, 5474, -895, 5624, 716, -1702, 5313, 3557, 7024, -5532, 3376,
+        2090, -3072, 3943, 2187, 8394, -895, 5624, 716, -1702, 5313, 3557, 16197,
+        2743, 7935, 1695, 2330, 7624, 4837, 8394, -895, 5624, 4547, -10443, 5313,
+        3557, 8394, -895, 5624, 716, 1632, 5313, 425, 12155, -895, 9636, 716,
+        -1702, 3421, -1652, 10430, 4061, 10580, 5672, 3254, 10269, 8513, 11980, -576,
+        8332, 7046, 1884, 8899, 7143, 13350, 4061, 10580, 5672, 3254, 10269, 8513,
+        21153, 7699, 12891, 6651, 7286, 12580, 9793, 13350, 4061, 10580, 9503, -5487,
+        10269, 8513, 13350, 4061, 10580, 5672, 6588, 10269, 5381, 17111, 4061, 14592,
+        5672, 3254, 8377, 3304, 5064, -1305, 5214, 306, -2112, 4903, 3147, 6614,
+        -5942, 2966, 1680, -3482, 3533, 1777, 7984, -1305, 5214, 306, -2112, 4903,
+        3147, 18248, 4794, 9986, 3746, 4381, 9675, 6888, 7984, -1305, 5214, 4137,
+        -10853, 4903, 3147, 7984, -1305, 5214, 306, 1222, 4903, 15, 11449, -1601,
+        8930, -1955, -2408, 2715, -2358, 6414, 45, 6564, 1656, -762, 6253, 4497,
+        9815, -2741, 6167, 4881, -281, 6734, 4978, 9334, 45, 6564, 1656, -762,
+        6253, 4497, 17137, 3683, 8875, 2635, 3270, 8564, 5777, 10238, 949, 7468,
+        6391, -8599, 7157, 6104, 9334, 45, 6564, 1656, 2572, 6253, 1365, 12481,
+        -569, 9962, 1042, -1376, 3747, -1326, 8642, 2273, 8792, 3884, 1466, 8481,
+        6725, 10192, -2364, 6544, 5258, 96, 7111, 5355, 11562, 2273, 8792, 3884,
+        1466, 8481, 6725, 19365, 5911, 11103, 4863, 5498, 10792, 8005, 11562, 2273,
+        8792, 7715, -7275, 8481, 6725, 11562, 2273, 8792, 3884, 4800, 8481, 3593,
+        15323, 2273, 12804, 3884, 1466, 6589, 1516, 5714, -655, 5864, 956, -1462,
+        5553, 3797, 7264, -5292, 3616, 2330, -2832, 4183, 2427, 8634, -655, 5864,
+        956, -1462, 5553, 3797, 16888, 3434, 8626, 1363, 3021, 8315, 5528, 8634,
+        -655, 5864, 4787, -10203, 5553, 3797, 8634, -655, 5864, 956, 1872, 4399,
+        665, 14489, -649, 9882, 962, -1456, 3667, -1406, 8917, 2548, 9067, 4159,
+        1741, 8756, 7000, 7502, -5054, 3854, 2568, -2594, 4421, 2665, 8872, -417,
+        6102, 1194, -1224, 5791, 4035, 16675, 3221, 8413, -476, 2808, 8102, 5315,
+        8872, -417, 6102, 5025, -9965, 5791, 4035, 8872, -417, 6102, 1194, 2110,
+        5791, 903, 11255, -1795, 8736, -184, -2602, 2521, -2552, 6125, -244, 6275,
+        1367, -1051, 5964, 4208, 7675, -4881, 4027, 2741, -2421, 4594, 2838, 9045,
+        -244, 6275, 1367, -1051, 5964, 4208, 16848, 3394, 8586, 2346, 2981, 8275,
+        5488, 9045, -244, 6275, 5198, -9792, 5964, 4208, 9045, -244, 6275, 1367,
+        2283, 5964, 1076, 12806, -244, 10287, 1367, -1051, 4072, -1001, 11081, 4712,
+        11231, 6323, 3905, 10920, 9164, 12631, 75, 8983, 7697, 2535, 9550, 7794,
+        14001, 4712, 11231, 6323, 3905, 10920, 9164, 21804, 8350, 13542, 7302, 7937,
+        13231, 10444, 14001, 4712, 11231, 10154, -4836, 10920, 9164, 14001, 4712, 11231,
+        6323, 7239, 10920, 6032, 17762, 4712, 15243, 6323, 3905, 9028, 3955, 5715,
+        -654, 5865, 957, -1461, 5554, 3798, 7265, -5291, 3617, 2331, -2831, 4184,
+        2428, 8635, -654, 5865, 957, -1461, 5554, 3798, 18899, 5445, 10637, 4397,
+        5032, 10326, 7539, 8635, -654, 5865, 4788, -10202, 5554, 3798, 8635, -654,
+        5865, 957, 1873, 5554, 666, 12100, -950, 9581, -1304, -1757, 3366, -1707,
+        7065, 696, 7215, 2307, -111, 6904, 5148, 10466, -2090, 6818, 5532, 370,
+        7385, 5629, 9985, 696, 7215, 2307, -111, 6904, 5148, 17788, 4334, 9526,
+        3286, 3921, 9215, 6428, 10889, 1600, 8119, 7042, -7948, 7808, 6755, 9985,
+        696, 7215, 2307, 3223, 6904, 2016, 13132, 82, 10613, 1693, -725, 4398,
+        -675, 9293, 2924, 9443, 4535, 2117, 9132, 7376, 10843, -1713, 7195, 5909,
+        747, 7762, 6006, 12213, 2924, 9443, 4535, 2117, 9132, 7376, 20016, 6562,
+        11754, 5514, 6149, 11443, 8656, 12213, 2924, 9443, 8366, -6624, 9132, 7376,
+        12213, 2924, 9443, 4535, 5451, 9132, 4244, 16161, 3111, 13642, 4722, 2304,
+        7427, 2354, 6365, -4, 6515, 1607, -811, 6204, 4448, 7915, -4641, 4267,
+        2981, -2181, 4834, 3078, 9285, -4, 6515, 1607, -811, 6204, 4448, 17539,
+        4085, 9277, 2014, 3672, 8966, 6179, 9285, -4, 6515, 5438, -9552, 6204,
+        4448, 9285, -4, 6515, 1607, 2523, 5050, 1316, 15140, 2, 10533, 1613,
+        -805, 4318, -755, 8293, 1924, 8443, 3535, 1117, 8132, 6376, 6878, -5678,
+        3230, 1944, -3218, 3797, 2041, 8248, -1041, 5478, 570, -1848, 5167, 3411,
+        16051, 2597, 7789, -1100, 2184, 7478, 4691, 8248, -1041, 5478, 4401, -10589,
+        5167, 3411, 7917, -1372, 5147, 239, 1155, 4836, -52, 10241, -2809, 7722,
+        -1198, -3616, 1507, -3566, 5501, -868, 5651, 743, -1675, 5340, 3584, 7051,
+        -5505, 3403, 2117, -3045, 3970, 2214, 8421, -868, 5651, 743, -1675, 5340,
+        3584, 16224, 2770, 7962, 1722, 2357, 7651, 4864, 8421, -868, 5651, 4574,
+        -10416, 5340, 3584, 8421, -868, 5651, 743, 1659, 5340, 452, 12182, -868,
+        9663, 743, -1675, 3448, -1625, 10457, 4088, 10607, 5699, 3281, 10296, 8540,
+        12007, -549, 8359, 7073, 1911, 8926, 7170, 13377, 4088, 10607, 5699, 3281,
+        10296, 8540, 21180, 7726, 12918, 6678, 7313, 12607, 9820, 13377, 4088, 10607,
+        9530, -5460, 10296, 8540, 13377, 4088, 10607, 5699, 6615, 10296, 5408, 17138,
+        4088, 14619, 5699, 3281, 8404, 3331, 5091, -1278, 5241, 333, -2085, 4930,
+        3174, 6641, -5915, 2993, 1707, -3455, 3560, 1804, 8011, -1278, 5241, 333,
+        -2085, 4930, 3174, 19273, 5819, 11011, 4771, 5406, 10700, 7913, 8011, -1278,
+        5241, 4164, -10826, 4930, 3174, 8011, -1278, 5241, 333, 1249, 4930, 42,
+        11725, -1325, 9206, -1679, -2132, 2991, -2082, 6441, 72, 6591, 1683, -735,
+        6280, 4524, 9842, -2714, 6194, 4908, -254, 6761, 5005, 9361, 72, 6591,
+        1683, -735, 6280, 4524, 17164, 3710, 8902, 2662, 3297, 8591, 5804, 10265,
+        976, 7495, 6418, -8572, 7184, 6131, 9361, 72, 6591, 1683, 2599, 6280,
+        1392, 12508, -542, 9989, 1069, -1349, 3774, -1299, 8669, 2300, 8819, 3911,
+        1493, 8508, 6752, 10219, -2337, 6571, 5285, 123, 7138, 5382, 11589, 2300,
+        8819, 3911, 1493, 8508, 6752, 19392, 5938, 11130, 4890, 5525, 10819, 8032,
+        11589, 2300, 8819, 7742, -7248, 8508, 6752, 11589, 2300, 8819, 3911, 4827,
+        8508, 3620, 15350, 2300, 12831, 3911, 1493, 6616, 1543, 5741, -628, 5891,
+        983, -1435, 5580, 3824, 7291, -5265, 3643, 2357, -2805, 4210, 2454, 8661,
+        -628, 5891, 983, -1435, 5580, 3824, 16915, 3461, 8653, 1390, 3048, 8342,
+        5555, 8661, -628, 5891, 4814, -10176, 5580, 3824, 9241, -48, 6471, 1563,
+        2479, 5006, 1272, 15826, 688, 11219, 2299, -119, 5004, -69, 17648, 11279,
+        17798, 12890, 10472, 17487, 15731, 4534, -8022, 886, -400, -5562, 1453, 623,
+        2692, -6597, -1051, -4986, -7404, -389, -2145, 11048, -2406, 2786, -6103, -2819,
+        2475, -312, 5904, -3385, 3134, 2057, -12933, 2823, 1067, 5904, -3385, 3134,
+        -1774, -858, 2823, -2065, 8287, -4763, 5768, -3152, -7606, -447, -5254, 3157,
+        -3212, 3307, -1601, -4019, 2996, 1240, 4707, -10612, 1059, -227, -5389, 1626,
+        796, 2865, -6424, -878, -4813, -7231, -216, -1972, 13053, -401, 4791, -1449,
+        -814, 4480, 1693, 6077, -3212, 3307, 2230, -12580, 2996, 1240, 6077, -3212,
+        3307, -1601, -685, 2996, -1892, 9838, -3212, 7319, -1601, -6055, 1104, -3703,
+        8113, 1744, 8263, 3355, 937, 7952, 6196, 9663, -2893, 6015, 4729, -433,
+        6582, 5752, 7821, -1468, 4078, 143, -2275, 4740, 2984, 18009, 4555, 9747,
+        3507, 4142, 9436, 6649, 11033, 1744, 8263, 7186, -7804, 7952, 6196, 11033,
+        1744, 8263, 3355, 4271, 7952, 3064, 14794, 1744, 12275, 3355, -1099, 6060,
+        1253, 2747, -3622, 2897, -2011, -4429, 2586, 830, 4297, -8259, 649, -637,
+        -5799, 1216, 386, 2455, -6834, -1288, -5223, -7641, -626, -2382, 14699, 1245,
+        6437, -3810, 832, 6126, 3965, 5667, -3622, 2897, 1820, -13170, 2586, 830,
+        5667, -3622, 2897, -2011, -1095, 2586, -2302, 9132, -3918, 6613, -4765, -6761,
+        398, -2474, 1855, -4514, 2005, -2903, -5321, 1694, -62, 7498, -5058, 3850,
+        2564, -10754, 4417, 3587, 3805, -5484, 62, -3873, -6291, 724, -1032, 13200,
+        -254, 4938, -1302, -667, 4627, 1840, 7921, -1368, 5151, 4074, -10916, 4840,
+        3787, 7017, -2272, 4247, -661, 255, 3936, -952, 11962, -1088, 9443, 523,
+        -3931, 3228, -1579, 6325, -44, 6475, 1567, -851, 6164, 4408, 7875, -4681,
+        4227, 2941, -2221, 4794, 3964, 6033, -3256, 2290, -1645, -4063, 2952, 1196,
+        16221, 2767, 7959, 1719, 2354, 7648, 4861, 9245, -44, 6475, 5398, -9592,
+        6164, 4408, 9245, -44, 6475, 1567, 2483, 6164, 1276, 10604, -2446, 8085,
+        -835, -5289, 1870, -2937, 3397, -2972, 3547, -1361, -3779, 3236, 1480, 4947,
+        -7609, 1299, 13, -5149, 1866, 1036, 3105, -6184, -638, -4573, -6991, 24,
+        -1732, 13744, 290, 5482, -1781, -123, 5171, 811, 6317, -2972, 3547, 2470,
+        -12520, 3236, 1480, 6756, -2533, 3986, -922, -6, 2521, -1213, 14936, -682,
+        9849, 3375, -3525, 3634, -1467, 18693, 12324, 18843, 13935, 11517, 18532, 16776,
+        5579, -6977, 1931, 645, -4517, 2498, 1668, 3737, -5552, -6, -3941, -6359,
+        656, -1100, 13925, 471, 5663, -3226, 58, 5352, 2565, 6949, -2340, 4179,
+        3102, -11888, 3868, 2112, 6949, -2340, 4179, -729, 187, 3868, -1020, 9332,
+        -3718, 6813, -2107, -6561, 598, -4209, 4202, -2167, 4352, -556, -2974, 4041,
+        2285, 6845, -8474, 3197, 1911, -3251, 3764, 2934, 3910, -5379, 167, -3768,
+        -6186, 829, -927, 14098, 644, 5836, -404, 231, 5525, 2738, 7122, -2167,
+        4352, 3275, -11535, 4041, 2285, 7122, -2167, 4352, -556, 360, 4041, -847,
+        10883, -2167, 8364, -556, -5010, 2149, -2658, 9158, 2789, 9308, 4400, 1982,
+        8997, 7241, 10708, -1848, 7060, 5774, 612, 7627, 6797, 8866, -423, 5123,
+        1188, -1230, 5785, 4029, 19054, 5600, 10792, 4552, 5187, 10481, 7694, 12078,
+        2789, 9308, 8231, -6759, 8997, 7241, 12078, 2789, 9308, 4400, 5316, 8997,
+        4109, 15839, 2789, 13320, 4400, -54, 7105, 2298, 3792, -2577, 3942, -966,
+        -3384, 3631, 1875, 5342, -7214, 1694, 408, -4754, 2261, 1431, 3500, -5789,
+        -243, -4178, -6596, 419, -1337, 16429, 2975, 8167, -2080, 2562, 7856, 5695,
+        6712, -2577, 3942, 2865, -12125, 3631, 1875, 6712, -2577, 3942, -966, -50,
+        3631, -1257, 10177, -2873, 7658, -3720, -5716, 1443, -1429, 2900, -3469, 3050,
+        -1858, -4276, 2739, 983, 8543, -4013, 4895, 3609, -9709, 5462, 4632, 4850,
+        -4439, 1107, -2828, -5246, 1769, 13, 14245, 791, 5983, -257, 378, 5672,
+        2885, 9448, 159, 6678, 5601, -9389, 6367, 5314, 8062, -1227, 5292, 384,
+        1300, 4981, 93, 13007, -43, 10488, 1568, -2886, 4273, -534, 7370, 1001,
+        7520, 2612, 194, 7209, 5453, 8920, -3636, 5272, 3986, -1176, 5839, 5009,
+        7078, -2211, 3335, -600, -3018, 3997, 2241, 17266, 3812, 9004, 2764, 3399,
+        8693, 5906, 10290, 1001, 7520, 6443, -8547, 7209, 5453, 10290, 1001, 7520,
+        2612, 3528, 7209, 2321, 11649, -1401, 9130, 210, -4244, 2915, -1892, 4442,
+        -1927, 4592, -316, -2734, 4281, 2525, 5992, -6564, 2344, 1058, -4104, 2911,
+        2081, 4150, -5139, 407, -3528, -5946, 1069, -687, 14789, 1335, 6527, -736,
+        922, 6216, 1856, 7362, -1927, 4592, 3515, -11475, 4281, 2525, 7801, -1488,
+        5031, 123, 1039, 3566, -168, 15871, 253, 10784, 4310, -2590, 4569, -532,
+        18351, 11982, 18501, 13593, 11175, 18190, 16434, 5237, -7319, 1589, 303, -4859,
+        2156, 1326, 3395, -5894, -348, -4283, -6701, 314, -1442, 13583, 129, 5321,
+        -3568, -284, 5010, 2223, 6607, -2682, 3837, 2760, -12230, 3526, 1770, 6607,
+        -2682, 3837, -1071, -155, 3526, -1362, 8990, -4060, 6471, -2449, -6903, 256,
+        -4551, 3860, -2509, 4010, -898, -3316, 3699, 1943, 5410, -9909, 1762, 476,
+        -4686, 2329, 1499, 3568, -5721, -175, -4110, -6528, 487, -1269, 13756, 302,
+        5494, -746, -111, 5183, 2396, 6780, -2509, 4010, 2933, -11877, 3699, 1943,
+        6780, -2509, 4010, -898, 18, 3699, -1189, 10541, -2509, 8022, -898, -5352,
+        1807, -3000, 8816, 2447, 8966, 4058, 1640, 8655, 6899, 10366, -2190, 6718,
+        5432, 270, 7285, 6455, 8524, -765, 4781, 846, -1572, 5443, 3687, 18712,
+        5258, 10450, 4210, 4845, 10139, 7352, 11736, 2447, 8966, 7889, -7101, 8655,
+        6899, 11736, 2447, 8966, 4058, 4974, 8655, 3767, 15497, 2447, 12978, 4058,
+        -396, 6763, 1956, 3450, -2919, 3600, -1308, -3726, 3289, 1533, 5000, -7556,
+        1352, 66, -5096, 1919, 1089, 3158, -6131, -585, -4520, -6938, 77, -1679,
+        16087, 2633, 7825, -2422, 2220, 7514, 5353, 6370, -2919, 3600, 2523, -12467,
+        3289, 1533, 6370, -2919, 3600, -1308, -392, 3289, -1599, 9835, -3215, 7316,
+        -4062, -6058, 1101, -1771, 2558, -3811, 2708, -2200, -4618, 2397, 641, 8201,
+        -4355, 4553, 3267, -10051, 5120, 4290, 4508, -4781, 765, -3170, -5588, 1427,
+        -329, 13903, 449, 5641, -599, 36, 5330, 2543, 8624, -665, 5854, 4777,
+        -10213, 5543, 4490, 7720, -1569, 4950, 42, 958, 4639, -249, 12665, -385,
+        10146, 1226, -3228, 3931, -876, 7028, 659, 7178, 2270, -148, 6867, 5111,
+        8578, -3978, 4930, 3644, -1518, 5497, 4667, 6736, -2553, 2993, -942, -3360,
+        3655, 1899, 16924, 3470, 8662, 2422, 3057, 8351, 5564, 9948, 659, 7178,
+        6101, -8889, 6867, 5111, 9948, 659, 7178, 2270, 3186, 6867, 1979, 11307,
+        -1743, 8788, -132, -4586, 2573, -2234, 4100, -2269, 4250, -658, -3076, 3939,
+        2183, 5650, -6906, 2002, 716, -4446, 2569, 1739, 3808, -5481, 65, -3870,
+        -6288, 727, -1029, 14447, 993, 6185, -1078, 580, 5874, 1514, 7020, -2269,
+        4250, 3173, -11817, 3939, 2183, 7459, -1830, 4689, -219, 697, 3224, -510,
+        15529, -89, 10442, 3968, -2932, 4227, -874, 18197, 11828, 18347, 13439, 11021,
+        18036, 16280, 5083, -7473, 1435, 149, -5013, 2002, 1172, 3241, -6048, -502,
+        -4437, -6855, 160, -1596, 12414, -1040, 4152, -4737, -1453, 3841, 1054, 6453,
+        -2836, 3683, 2606, -12384, 3372, 1616, 6920, -2369, 4150, -758, 158, 3839,
+        -1049, 8694, -4356, 6175, -2745, -7199, -40, -4847, 3706, -2663, 3856, -1052,
+        -3470, 3545, 1789, 5256, -10063, 1608, 322, -4840, 2175, 1345, 3414, -5875,
+        -329, -4264, -6682, 333, -1423, 13602, 148, 5340, -900, -265, 5029, 2242,
+        6626, -2663, 3856, 2779, -12031, 3545, 1789, 6626, -2663, 3856, -1052, -136,
+        3545, -1343, 10387, -2663, 7868, -1052, -5506, 1653, -3154, 8662, 2293, 8812,
+        3904, 1486, 8501, 6745, 10212, -2344, 6564, 5278, 116, 7131, 6301, 8370,
+        -919, 4627, 692, -1726, 5289, 3533, 18558, 5104, 10296, 4056, 4691, 9985,
+        7198, 11582, 2293, 8812, 7735, -7255, 8501, 6745, 11582, 2293, 8812, 3904,
+        4820, 8501, 3613, 15343, 2293, 12824, 3904, -550, 6609, 1802, 3296, -3073,
+        3446, -1462, -3880, 3135, 1379, 4846, -7710, 1198, -88, -5250, 1765, 935,
+        3004, -6285, -739, -4674, -7092, -77, -1833, 15933, 2479, 7671, -2576, 2066,
+        7360, 5199, 6216, -3073, 3446, 2369, -12621, 3135, 1379, 6216, -3073, 3446,
+        -1462, -546, 3135, -1753, 10957, -2093, 8438, -2940, -4936, 2223, -649, 2404,
+        -3965, 2554, -2354, -4772, 2243, 487, 8047, -4509, 4399, 3113, -10205, 4966,
+        4136, 4354, -4935, 611, -3324, -5742, 1273, -483, 13749, 295, 5487, -753,
+        -118, 5176, 2389, 8470, -819, 5700, 4623, -10367, 5389, 4336, 7566, -1723,
+        4796, -112, 804, 4485, -403, 12511, -539, 9992, 1072, -3382, 3777, -1030,
+        6874, 505, 7024, 2116, -302, 6713, 4957, 8424, -4132, 4776, 3490, -1672,
+        5343, 4513, 6582, -2707, 2839, -1096, -3514, 3501, 1745, 16770, 3316, 8508,
+        2268, 2903, 8197, 5410, 9794, 505, 7024, 5947, -9043, 6713, 4957, 9794,
+        505, 7024, 2116, 3032, 6713, 1825, 11153, -1897, 8634, -286, -4740, 2419,
+        -2388, 3946, -2423, 4096, -812, -3230, 3785, 2029, 5496, -7060, 1848, 562,
+        -4600, 2415, 1585, 3654, -5635, -89, -4024, -6442, 573, -1183, 15662, 2208,
+        7400, 137, 1795, 7089, 2729, 6866, -2423, 4096, 3019, -11971, 3785, 2029,
+        7305, -1984, 4535, -373, 543, 3070, -664, 15998, 380, 10911, 4437, -2463,
+        4696, -405, 18203, 11834, 18353, 13445, 11027, 18042, 16286, 5089, -7467, 1441,
+        155, -5007, 2008, 1178, 3247, -6042, -496, -4431, -6849, 166, -1590, 13435,
+        -19, 5173, -3716, -432, 4862, 2075, 6459, -2830, 3689, 2612, -12378, 3378,
+        1622, 6459, -2830, 3689, -1219, -303, 3378, -1510, 8842, -4208, 6323, -2597,
+        -7051, 108, -4699, 3712, -2657, 3862, -1046, -3464, 3551, 1795, 5262, -10057,
+        1614, 328, -4834, 2181, 1351, 3420, -5869, -323, -4258, -6676, 339, -1417,
+        13608, 154, 5346, -894, -259, 5035, 2248, 9424, 135, 6654, 5577, -9233,
+        6343, 4587, 6632, -2657, 3862, -1046, -130, 3551, -1337, 10393, -2657, 7874,
+        -1046, -5500, 1659, -3148, 8668, 2299, 8818, 3910, 1492, 8507, 6751, 10218,
+        -2338, 6570, 5284, 122, 7137, 6307, 8376, -913, 4633, 698, -1720, 5295,
+        3539, 18564, 5110, 10302, 4062, 4697, 9991, 7204, 11588, 2299, 8818, 7741,
+        -7249, 8507, 6751, 11588, 2299, 8818, 3910, 4826, 8507, 3619, 15349, 2299,
+        12830, 3910, -544, 6615, 1808, 3302, -3067, 3452, -1456, -3874, 3141, 1385,
+        4852, -7704, 1204, -82, -5244, 1771, 941, 3010, -6279, -733, -4668, -7086,
+        -71, -1827, 15939, 2485, 7677, -2570, 2072, 7366, 5205, 6222, -3067, 3452,
+        2375, -12615, 3141, 1385, 6222, -3067, 3452, -1456, -540, 3141, -1747, 9687,
+        -3363, 7168, -4210, -6206, 953, -1919, 2410, -3959, 2560, -2348, -4766, 2249,
+        493, 8732, -3824, 5084, 3798, -9520, 5651, 4821, 4360, -4929, 617, -3318,
+        -5736, 1279, -477, 13755, 301, 5493, -747, -112, 5182, 2395, 8476, -813,
+        5706, 4629, -10361, 5395, 4342, 7572, -1717, 4802, -106, 810, 4491, -397,
+        12517, -533, 9998, 1078, -3376, 3783, -1024, 6880, 511, 7030, 2122, -296,
+        6719, 4963, 8430, -4126, 4782, 3496, -1666, 5349, 4519, 6588, -2701, 2845,
+        -1090, -3508, 3507, 1751, 16776, 3322, 8514, 2274, 2909, 8203, 5416, 9800,
+        511, 7030, 5953, -9037, 6719, 4963, 9800, 511, 7030, 2122, 3038, 6719,
+        1831, 11159, -1891, 8640, -280, -4734, 2425, -2382, 3952, -2417, 4102, -806,
+        -3224, 3791, 2035, 5502, -7054, 1854, 568, -4594, 2421, 1591, 3660, -5629,
+        -83, -4018, -6436, 579, -1177, 14299, 845, 6037, -1226, 432, 5726, 1366,
+        6872, -2417, 4102, 3025, -11965, 3791, 2035, 7311, -1978, 4541, -367, 549,
+        3076, -658, 15968, 350, 10881, 4407, -2493, 4666, -435, 18854, 12485, 19004,
+        14096, 11678, 18693, 16937, 5740, -6816, 2092, 806, -4356, 2659, 1829, 3898,
+        -5391, 155, -3780, -6198, 817, -939, 14086, 632, 5824, -3065, 219, 5513,
+        2726, 7110, -2179, 4340, 3263, -11727, 4029, 2273, 7110, -2179, 4340, -568,
+        348, 4029, -859, 9493, -3557, 6974, -1946, -6400, 759, -4048, 4363, -2006,
+        4513, -395, -2813, 4202, 2446, 5913, -9406, 2265, 979, -4183, 2832, 2002,
+        4071, -5218, 328, -3607, -6025, 990, -766, 14259, 805, 5997, -243, 392,
+        5686, 2899, 7283, -2006, 4513, 3436, -11374, 4202, 2446, 7283, -2006, 4513,
+        -395, 521, 4202, -686, 11044, -2006, 8525, -395, -4849, 2310, -2497, 9319,
+        2950, 9469, 4561, 2143, 9158, 7402, 10869, -1687, 7221, 5935, 773, 7788,
+        6958, 9027, -262, 5284, 1349, -1069, 5946, 4190, 19215, 5761, 10953, 4713,
+        5348, 10642, 7855, 12239, 2950, 9469, 8392, -6598, 9158, 7402, 12239, 2950,
+        9469, 4561, 5477, 9158, 4270, 16000, 2950, 13481, 4561, 107, 7266, 2459,
+        3953, -2416, 4103, -805, -3223, 3792, 2036, 5503, -7053, 1855, 569, -4593,
+        2422, 1592, 3661, -5628, -82, -4017, -6435, 580, -1176, 16590, 3136, 8328,
+        -1919, 2723, 8017, 5856, 6873, -2416, 4103, 3026, -11964, 3792, 2036, 6873,
+        -2416, 4103, -805, 111, 3792, -1096, 10338, -2712, 7819, -3559, -5555, 1604,
+        -1268, 3061, -3308, 3211, -1697, -4115, 2900, 1144, 8704, -3852, 5056, 3770,
+        -9548, 5623, 4793, 5011, -4278, 1268, -2667, -5085, 1930, 174, 14406, 952,
+        6144, -96, 539, 5833, 3046, 9127, -162, 6357, 5280, -9710, 6046, 4993,
+        8223, -1066, 5453, 545, 1461, 5142, 254, 13168, 118, 10649, 1729, -2725,
+        4434, -373, 7531, 1162, 7681, 2773, 355, 7370, 5614, 9081, -3475, 5433,
+        4147, -1015, 6000, 5170, 7239, -2050, 3496, -439, -2857, 4158, 2402, 17427,
+        3973, 9165, 2925, 3560, 8854, 6067, 10451, 1162, 7681, 6604, -8386, 7370,
+        5614, 10451, 1162, 7681, 2773, 3689, 7370, 2482, 11997, -1053, 9478, 558,
+        -3896, 3263, -1544, 4603, -1766, 4753, -155, -2573, 4442, 2686, 6153, -6403,
+        2505, 1219, -3943, 3072, 2242, 4311, -4978, 568, -3367, -5785, 1230, -526,
+        14950, 1496, 6688, -575, 1083, 6377, 2017, 7523, -1766, 4753, 3676, -11314,
+        4442, 2686, 7962, -1327, 5192, 284, 1200, 3727, -7, 16032, 414, 10945,
+        4471, -2429, 4730, -371, 18230, 11861, 18380, 13472, 11054, 18069, 16313, 5116,
+        -7440, 1468, 182, -4980, 2035, 1205, 3274, -6015, -469, -4404, -6822, 193,
+        -1563, 13462, 8, 5200, -3689, -405, 4889, 2102, 6486, -2803, 3716, 2639,
+        -12351, 3405, 1649, 6155, -3134, 3385, -1523, -607, 3074, -1814, 8479, -4571,
+        5960, -2960, -7414, -255, -5062, 3739, -2630, 3889, -1019, -3437, 3578, 1822,
+        5289, -10030, 1641, 355, -4807, 2208, 1378, 3447, -5842, -296, -4231, -6649,
+        366, -1390, 13635, 181, 5373, -867, -232, 5062, 2275, 6659, -2630, 3889,
+        2812, -11998, 3578, 1822, 6659, -2630, 3889, -1019, -103, 3578, -1310, 10420,
+        -2630, 7901, -1019, -5473, 1686, -3121, 8695, 2326, 8845, 3937, 1519, 8534,
+        6778, 10245, -2311, 6597, 5311, 149, 7164, 6334, 8403, -886, 4660, 725,
+        -1693, 5322, 3566, 18591, 5137, 10329, 4089, 4724, 10018, 7231, 11615, 2326,
+        8845, 7768, -7222, 8534, 6778, 11615, 2326, 8845, 3937, 4853, 8534, 3646,
+        15376, 2326, 12857, 3937, -517, 6642, 1835, 3329, -3040, 3479, -1429, -3847,
+        3168, 1412, 4879, -7677, 1231, -55, -5217, 1798, 968, 3037, -6252, -706,
+        -4641, -7059, -44, -1800, 17961, 4507, 9699, -548, 4094, 9388, 7227, 6249,
+        -3040, 3479, 2402, -12588, 3168, 1412, 6249, -3040, 3479, -1429, -513, 3168,
+        -1720, 9963, -3087, 7444, -3934, -5930, 1229, -1643, 2437, -3932, 2587, -2321,
+        -4739, 2276, 520, 8080, -4476, 4432, 3146, -10172, 4999, 4169, 4387, -4902,
+        644, -3291, -5709, 1306, -450, 13782, 328, 5520, -720, -85, 5209, 2422,
+        8503, -786, 5733, 4656, -10334, 5422, 4369, 7599, -1690, 4829, -79, 837,
+        4518, -370, 12544, -506, 10025, 1105, -3349, 3810, -997, 6907, 538, 7057,
+        2149, -269, 6746, 4990, 8457, -4099, 4809, 3523, -1639, 5376, 4546, 6615,
+        -2674, 2872, -1063, -3481, 3534, 1778, 16803, 3349, 8541, 2301, 2936, 8230,
+        5443, 9827, 538, 7057, 5980, -9010, 6746, 4990, 9827, 538, 7057, 2149,
+        3065, 6746, 1858, 11667, -1383, 9148, 228, -4226, 2933, -1874, 3979, -2390,
+        4129, -779, -3197, 3818, 2062, 5529, -7027, 1881, 595, -4567, 2448, 1618,
+        3687, -5602, -56, -3991, -6409, 606, -1150, 16055, 2601, 7793, 530, 2188,
+        7482, 3122, 6899, -2390, 4129, 3052, -11938, 3818, 2062, 7918, -1371, 5148,
+        240, 1156, 3683, -51, 17064, 1446, 11977, 5503, -1397, 5762, 661, 10265,
+        16292, 22811, 17903, 15485, 22500, 20744, 6006, -6550, 2358, 1072, -4090, 2925,
+        1169, 14282, 4993, 11512, 6604, 4186, 11201, 9445, 15739, 2285, 7477, -6066,
+        3220, 7166, 8140, 657, -8632, -2113, -3190, -19986, -2424, -4180, 11015, 1726,
+        8245, -48, 4253, 7934, 3046, 11055, -1995, 8536, -384, -2802, 2321, -6647,
+        7473, 13500, 20019, 15111, 12693, 19708, 17952, 6179, -6377, 2531, 1245, -3917,
+        3098, 1342, 14455, 5166, 11685, 6777, 4359, 11374, 9618, 17744, 4290, 9482,
+        -1412, 5225, 9171, 10145, 830, -8459, -1940, -3017, -19813, -2251, -4007, 11188,
+        1899, 8418, 125, 4426, 8107, 3219, 11831, -1219, 9312, 392, -2026, 3097,
+        -5871, 12429, 18456, 24975, 20067, 17649, 24664, 22908, 11135, -1421, 7487, 6201,
+        1039, 8054, 6298, 20409, 11120, 17639, 12731, 10313, 17328, 15572, 22700, 9246,
+        14438, 3544, 10181, 14127, 15101, 5786, -3503, 3016, 1939, -14857, 2705, 949,
+        16144, 6855, 13374, 5081, 9382, 13063, 8175, 16787, 3737, 14268, 5348, 2930,
+        8053, -915, 7063, 13090, 19609, 14701, 12283, 19298, 17542, 5769, -6787, 2121,
+        835, -4327, 2688, 932, 14045, 4756, 11275, 6367, 3949, 10964, 9208, 19496,
+        6042, 11234, -1841, 6977, 10923, 11290, 420, -8869, -2350, -3427, -20223, -2661,
+        -4417, 10778, 1489, 8008, -285, 4016, 7697, 2809, 11125, -1925, 8606, -2279,
+        -2732, 2391, -6577, 8413, 14440, 20959, 16051, 13633, 20648, 18892, 8970, -3586,
+        5322, 4036, -1126, 5889, 4133, 15395, 6106, 12625, 7717, 5299, 12314, 10558,
+        19103, 5649, 10841, -53, 6584, 10530, 11504, 2674, -6615, -96, -1173, -17969,
+        -407, -1460, 12128, 2839, 9358, 1065, 5366, 9047, 4159, 12157, -893, 9638,
+        718, -1700, 3423, -5545, 10641, 16668, 23187, 18279, 15861, 22876, 21120, 9347,
+        -3209, 5699, 4413, -749, 6266, 4510, 17623, 8334, 14853, 9945, 7527, 14542,
+        12786, 20912, 7458, 12650, 1756, 8393, 12339, 13313, 3998, -5291, 1228, 151,
+        -16645, 917, -839, 22691, 13402, 19921, 11628, 15929, 19610, 14722, 16556, 3506,
+        14037, 5117, 2699, 7822, -1146, 7713, 13740, 20259, 15351, 12933, 19948, 18192,
+        6419, -6137, 2771, 1485, -3677, 3338, 1582, 14695, 5406, 11925, 7017, 4599,
+        11614, 9858, 21099, 7645, 12837, -46, 8580, 12526, 13500, 1070, -8219, -1700,
+        -2777, -19573, -2011, -3767, 11428, 2139, 8658, 365, 4666, 7193, 3459, 13373,
+        -1765, 8766, -154, -2572, -1053, -7138, 11310, 17337, 23856, 18948, 16530, 23545,
+        21789, 7051, -5505, 3403, 2117, -3045, 3970, 2214, 15327, 6038, 12557, 7649,
+        5231, 12246, 10490, 18616, 5162, 10354, -3189, 6097, 10043, 11017, 1702, -7587,
+        -1068, -2145, -18941, -1379, -3135, 12060, 2771, 9290, 997, 5298, 8979, 4091,
+        12100, -950, 9581, 661, -1757, 3366, -5602, 8518, 14545, 21064, 16156, 13738,
+        20753, 18997, 8317, -4239, 4669, 3383, -1779, 5236, 3480, 15500, 6211, 12730,
+        7822, 5404, 12419, 10663, 18789, 5335, 10527, -367, 6270, 10216, 11190, 1875,
+        -7414, -895, -1972, -18768, -1206, -2962, 12233, 2944, 9463, 1170, 5471, 9152,
+        4264, 12876, -174, 10357, 1437, -981, 4142, -4826, 13474, 19501, 26020, 21112,
+        18694, 25709, 23953, 12180, -376, 8532, 7246, 2084, 9099, 7343, 21454, 12165,
+        18684, 13776, 11358, 18373, 16617, 23745, 10291, 15483, 4589, 11226, 15172, 16146,
+        6831, -2458, 4061, 2984, -13812, 3750, 1994, 17189, 7900, 14419, 6126, 10427,
+        14108, 9220, 17832, 4782, 15313, 6393, 3975, 9098, 130, 8108, 14135, 20654,
+        15746, 13328, 20343, 18587, 6814, -5742, 3166, 1880, -3282, 3733, 1977, 15090,
+        5801, 12320, 7412, 4994, 12009, 10253, 20541, 7087, 12279, -796, 8022, 11968,
+        12335, 1465, -7824, -1305, -2382, -19178, -1616, -3372, 11823, 2534, 9053, 760,
+        5061, 8742, 3854, 12170, -880, 9651, -1234, -1687, 3436, -5532, 9458, 15485,
+        22004, 17096, 14678, 21693, 19937, 10015, -2541, 6367, 5081, -81, 6934, 5178,
+        16440, 7151, 13670, 8762, 6344, 13359, 11603, 20148, 6694, 11886, 992, 7629,
+        11575, 12549, 4201, -5088, 1431, 354, -16442, 1120, 67, 13173, 3884, 10403,
+        2110, 6411, 10092, 5204, 13202, 152, 10683, 1763, -655, 4468, -4500, 11686,
+        17713, 24232, 19324, 16906, 23921, 22165, 10392, -2164, 6744, 5458, 296, 7311,
+        5555, 18668, 9379, 15898, 10990, 8572, 15587, 13831, 21957, 8503, 13695, 2801,
+        9438, 13384, 14358, 5043, -4246, 2273, 1196, -15600, 1962, 206, 23736, 14447,
+        20966, 12673, 16974, 20655, 15767, 16981, 3931, 14462, 5542, 3124, 8247, -721,
+        8758, 14785, 21304, 16396, 13978, 20993, 19237, 7464, -5092, 3816, 2530, -2632,
+        4383, 2627, 15740, 6451, 12970, 8062, 5644, 12659, 10903, 22144, 8690, 13882,
+        999, 9625, 13571, 14545, 2115, -7174, -655, -1732, -18528, -966, -2722, 12473,
+        3184, 9703, 1410, 5711, 8238, 4504, 14418, -720, 9811, 891, -1527, -8,
+        -6093, 10968, 16995, 23514, 18606, 16188, 23203, 21447, 6709, -5847, 3061, 1775,
+        -3387, 3628, 1872, 14985, 5696, 12215, 7307, 4889, 11904, 10148, 18274, 4820,
+        10012, -3531, 5755, 9701, 10675, 1360, -7929, -1410, -2487, -19283, -1721, -3477,
+        11718, 2429, 8948, 655, 4956, 8637, 3749, 11758, -1292, 9239, 319, -2099,
+        3024, -5944, 8176, 14203, 20722, 15814, 13396, 20411, 18655, 6882, -5674, 3234,
+        1948, -3214, 3801, 2045, 15158, 5869, 12388, 7480, 5062, 12077, 10321, 18447,
+        4993, 10185, -709, 5928, 9874, 10848, 1533, -7756, -1237, -2314, -19110, -1548,
+        -3304, 11891, 2602, 9121, 828, 5129, 8810, 3922, 12534, -516, 10015, 1095,
+        -1323, 3800, -5168, 13132, 19159, 25678, 20770, 18352, 25367, 23611, 11838, -718,
+        8190, 6904, 1742, 8757, 7001, 21112, 11823, 18342, 13434, 11016, 18031, 16275,
+        23403, 9949, 15141, 4247, 10884, 14830, 15804, 6489, -2800, 3719, 2642, -14154,
+        3408, 1652, 16847, 7558, 14077, 5784, 10085, 13766, 8878, 17490, 4440, 14971,
+        6051, 3633, 8756, -212, 7766, 13793, 20312, 15404, 12986, 20001, 18245, 6472,
+        -6084, 2824, 1538, -3624, 3391, 1635, 14748, 5459, 11978, 7070, 4652, 11667,
+        9911, 20199, 6745, 11937, -1138, 7680, 11626, 11993, 1123, -8166, -1647, -2724,
+        -19520, -1958, -3714, 11481, 2192, 8711, 418, 4719, 8400, 3512, 11828, -1222,
+        9309, -1576, -2029, 3094, -5874, 9116, 15143, 21662, 16754, 14336, 21351, 19595,
+        9673, -2883, 6025, 4739, -423, 6592, 4836, 16098, 6809, 13328, 8420, 6002,
+        13017, 11261, 19806, 6352, 11544, 650, 7287, 11233, 12207, 3377, -5912, 607,
+        -470, -17266, 296, -757, 12831, 3542, 10061, 1768, 6069, 9750, 4862, 12860,
+        -190, 10341, 1421, -997, 4126, -4842, 11344, 17371, 23890, 18982, 16564, 23579,
+        21823, 10050, -2506, 6402, 5116, -46, 6969, 5213, 18326, 9037, 15556, 10648,
+        8230, 15245, 13489, 21615, 8161, 13353, 2459, 9096, 13042, 14016, 4701, -4588,
+        1931, 854, -15942, 1620, -136, 23394, 14105, 20624, 12331, 16632, 20313, 15425,
+        16639, 3589, 14120, 5200, 2782, 7905, -1063, 8416, 14443, 20962, 16054, 13636,
+        20651, 18895, 7122, -5434, 3474, 2188, -2974, 4041, 2285, 15398, 6109, 12628,
+        7720, 5302, 12317, 10561, 21802, 8348, 13540, 657, 9283, 13229, 14203, 1773,
+        -7516, -997, -2074, -18870, -1308, -3064, 12131, 2842, 9361, 1068, 5369, 7896,
+        4162, 14076, -1062, 9469, 549, -1869, -350, -6435, 10814, 16841, 23360, 18452,
+        16034, 23049, 21293, 6555, -6001, 2907, 1621, -3541, 3474, 1718, 14831, 5542,
+        12061, 7153, 4735, 11750, 9994, 17105, 3651, 8843, -4700, 4586, 8532, 9506,
+        1206, -8083, -1564, -2641, -19437, -1875, -3631, 12031, 2742, 9261, 968, 5269,
+        8950, 4062, 11462, -1588, 8943, 23, -2395, 2728, -6240, 8022, 14049, 20568,
+        15660, 13242, 20257, 18501, 6728, -5828, 3080, 1794, -3368, 3647, 1891, 15004,
+        5715, 12234, 7326, 4908, 11923, 10167, 18293, 4839, 10031, -863, 5774, 9720,
+        10694, 1379, -7910, -1391, -2468, -19264, -1702, -3458, 11737, 2448, 8967, 674,
+        4975, 8656, 3768, 12380, -670, 9861, 941, -1477, 3646, -5322, 12978, 19005,
+        25524, 20616, 18198, 25213, 23457, 11684, -872, 8036, 6750, 1588, 8603, 6847,
+        20958, 11669, 18188, 13280, 10862, 17877, 16121, 23249, 9795, 14987, 4093, 10730,
+        14676, 15650, 6335, -2954, 3565, 2488, -14308, 3254, 1498, 16693, 7404, 13923,
+        5630, 9931, 13612, 8724, 17336, 4286, 14817, 5897, 3479, 8602, -366, 7612,
+        13639, 20158, 15250, 12832, 19847, 18091, 6318, -6238, 2670, 1384, -3778, 3237,
+        1481, 14594, 5305, 11824, 6916, 4498, 11513, 9757, 19940, 6486, 11678, -1397,
+        7421, 11367, 11734, 969, -8320, -1801, -2878, -19674, -2112, -3868, 11327, 2038,
+        8557, 264, 4565, 8246, 3358, 11490, -1560, 8971, -1914, -2367, 2756, -6212,
+        8962, 14989, 21508, 16600, 14182, 21197, 19441, 9519, -3037, 5871, 4585, -577,
+        6438, 4682, 15944, 6655, 13174, 8266, 5848, 12863, 11107, 19652, 6198, 11390,
+        496, 7133, 11079, 12053, 3223, -6066, 453, -624, -17420, 142, -911, 12677,
+        3388, 9907, 1614, 5915, 9596, 4708, 12706, -344, 10187, 1267, -1151, 3972,
+        -4996, 11190, 17217, 23736, 18828, 16410, 23425, 21669, 9896, -2660, 6248, 4962,
+        -200, 6815, 5059, 18172, 8883, 15402, 10494, 8076, 15091, 13335, 21461, 8007,
+        13199, 2305, 8942, 12888, 13862, 4547, -4742, 1777, 700, -16096, 1466, -290,
+        23240, 13951, 20470, 12177, 16478, 20159, 15271, 16485, 3435, 13966, 5046, 2628,
+        7751, -1217, 8262, 14289, 20808, 15900, 13482, 20497, 18741, 6968, -5588, 3320,
+        2034, -3128, 3887, 2131, 15244, 5955, 12474, 7566, 5148, 12163, 10407, 23017,
+        9563, 14755, 1872, 10498, 14444, 15418, 1619, -7670, -1151, -2228, -19024, -1462,
+        -3218, 11977, 2688, 9207, 914, 5215, 7742, 4008, 13922, -1216, 9315, 395,
+        -2023, -504, -6589, 10820, 16847, 23366, 18458, 16040, 23055, 21299, 6561, -5995,
+        2913, 1627, -3535, 3480, 1724, 14837, 5548, 12067, 7159, 4741, 11756, 10000,
+        18126, 4672, 9864, -3679, 5607, 9553, 10527, 1212, -8077, -1558, -2635, -19431,
+        -1869, -3625, 11570, 2281, 8800, 507, 4808, 8489, 3601, 11610, -1440, 9091,
+        171, -2247, 2876, -6092, 8028, 14055, 20574, 15666, 13248, 20263, 18507, 6734,
+        -5822, 3086, 1800, -3362, 3653, 1897, 15010, 5721, 12240, 7332, 4914, 11929,
+        10173, 18299, 4845, 10037, -857, 5780, 9726, 10700, 1385, -7904, -1385, -2462,
+        -19258, -1696, -3452, 11743, 2454, 8973, 680, 4981, 8662, 3774, 12386, -664,
+        9867, 947, -1471, 3652, -5316, 12984, 19011, 25530, 20622, 18204, 25219, 23463,
+        11690, -866, 8042, 6756, 1594, 8609, 6853, 20964, 11675, 18194, 13286, 10868,
+        17883, 16127, 23255, 9801, 14993, 4099, 10736, 14682, 15656, 6341, -2948, 3571,
+        2494, -14302, 3260, 1504, 16699, 7410, 13929, 5636, 9937, 13618, 8730, 17342,
+        4292, 14823, 5903, 3485, 8608, -360, 7618, 13645, 20164, 15256, 12838, 19853,
+        18097, 6324, -6232, 2676, 1390, -3772, 3243, 1487, 14600, 5311, 11830, 6922,
+        4504, 11519, 9763, 20051, 6597, 11789, -1286, 7532, 11478, 11845, 975, -8314,
+        -1795, -2872, -19668, -2106, -3862, 11333, 2044, 8563, 270, 4571, 8252, 3364,
+        11680, -1370, 9161, -1724, -2177, 2946, -6022, 8968, 14995, 21514, 16606, 14188,
+        21203, 19447, 9525, -3031, 5877, 4591, -571, 6444, 4688, 15950, 6661, 13180,
+        8272, 5854, 12869, 11113, 19658, 6204, 11396, 502, 7139, 11085, 12059, 3229,
+        -6060, 459, -618, -17414, 148, -905, 12683, 3394, 9913, 1620, 5921, 9602,
+        4714, 12712, -338, 10193, 1273, -1145, 3978, -4990, 11196, 17223, 23742, 18834,
+        16416, 23431, 21675, 9902, -2654, 6254, 4968, -194, 6821, 5065, 18178, 8889,
+        15408, 10500, 8082, 15097, 13341, 21467, 8013, 13205, 2311, 8948, 12894, 13868,
+        4553, -4736, 1783, 706, -16090, 1472, -284, 23246, 13957, 20476, 12183, 16484,
+        20165, 15277, 16491, 3441, 13972, 5052, 2634, 7757, -1211, 8268, 14295, 20814,
+        15906, 13488, 20503, 18747, 6974, -5582, 3326, 2040, -3122, 3893, 2137, 15250,
+        5961, 12480, 7572, 5154, 12169, 10413, 21654, 8200, 13392, 509, 9135, 13081,
+        14055, 1625, -7664, -1145, -2222, -19018, -1456, -3212, 11983, 2694, 9213, 920,
+        5221, 7748, 4014, 13928, -1210, 9321, 401, -2017, -498, -6583, 11471, 17498,
+        24017, 19109, 16691, 23706, 21950, 7212, -5344, 3564, 2278, -2884, 4131, 2375,
+        15488, 6199, 12718, 7810, 5392, 12407, 10651, 18777, 5323, 10515, -3028, 6258,
+        10204, 11178, 1863, -7426, -907, -1984, -18780, -1218, -2974, 12221, 2932, 9451,
+        1158, 5459, 9140, 4252, 12261, -789, 9742, 822, -1596, 3527, -5441, 8679,
+        14706, 21225, 16317, 13899, 20914, 19158, 7385, -5171, 3737, 2451, -2711, 4304,
+        2548, 15661, 6372, 12891, 7983, 5565, 12580, 10824, 18950, 5496, 10688, -206,
+        6431, 10377, 11351, 2036, -7253, -734, -1811, -18607, -1045, -2801, 12394, 3105,
+        9624, 1331, 5632, 9313, 4425, 13037, -13, 10518, 1598, -820, 4303, -4665,
+        13635, 19662, 26181, 21273, 18855, 25870, 24114, 12341, -215, 8693, 7407, 2245,
+        9260, 7504, 21615, 12326, 18845, 13937, 11519, 18534, 16778, 23906, 10452, 15644,
+        4750, 11387, 15333, 16307, 6992, -2297, 4222, 3145, -13651, 3911, 2155, 17350,
+        8061, 14580, 6287, 10588, 14269, 9381, 17993, 4943, 15474, 6554, 4136, 9259,
+        291, 8269, 14296, 20815, 15907, 13489, 20504, 18748, 6975, -5581, 3327, 2041,
+        -3121, 3894, 2138, 15251, 5962, 12481, 7573, 5155, 12170, 10414, 20702, 7248,
+        12440, -635, 8183, 12129, 12496, 1626, -7663, -1144, -2221, -19017, -1455, -3211,
+        11984, 2695, 9214, 921, 5222, 8903, 4015, 12331, -719, 9812, -1073, -1526,
+        3597, -5371, 9619, 15646, 22165, 17257, 14839, 21854, 20098, 10176, -2380, 6528,
+        5242, 80, 7095, 5339, 16601, 7312, 13831, 8923, 6505, 13520, 11764, 20309,
+        6855, 12047, 1153, 7790, 11736, 12710, 3880, -5409, 1110, 33, -16763, 799,
+        -254, 13334, 4045, 10564, 2271, 6572, 10253, 5365, 13363, 313, 10844, 1924,
+        -494, 4629, -4339, 11847, 17874, 24393, 19485, 17067, 24082, 22326, 10553, -2003,
+        6905, 5619, 457, 7472, 5716, 18829, 9540, 16059, 11151, 8733, 15748, 13992,
+        22118, 8664, 13856, 2962, 9599, 13545, 14519, 5204, -4085, 2434, 1357, -15439,
+        2123, 367, 23897, 14608, 21127, 12834, 17135, 20816, 15928, 17329, 4279, 14810,
+        5890, 3472, 8595, -373, 8919, 14946, 21465, 16557, 14139, 21154, 19398, 7625,
+        -4931, 3977, 2691, -2471, 4544, 2788, 15901, 6612, 13131, 8223, 5805, 12820,
+        11064, 21442, 7988, 13180, 297, 8923, 12869, 13843, 2276, -7013, -494, -1571,
+        -18367, -805, -2561, 12170, 2881, 9400, 1107, 5408, 7935, 4201, 14579, -559,
+        9972, 1052, -1366, 153, -5932, 10847, 16874, 23393, 18485, 16067, 23082, 21326,
+        6588, -5968, 2940, 1654, -3508, 3507, 1751, 14864, 5575, 12094, 7186, 4768,
+        11783, 10027, 18153, 4699, 9891, -3652, 5634, 9580, 10554, 1239, -8050, -1531,
+        -2608, -19404, -1842, -3598, 11266, 1977, 8496, 203, 4504, 8185, 3297, 11247,
+        -1803, 8728, -192, -2610, 2513, -6455, 8055, 14082, 20601, 15693, 13275, 20290,
+        18534, 6761, -5795, 3113, 1827, -3335, 3680, 1924, 15037, 5748, 12267, 7359,
+        4941, 11956, 10200, 18326, 4872, 10064, -830, 5807, 9753, 10727, 1412, -7877,
+        -1358, -2435, -19231, -1669, -3425, 11770, 2481, 9000, 707, 5008, 8689, 3801,
+        12413, -637, 9894, 974, -1444, 3679, -5289, 13011, 19038, 25557, 20649, 18231,
+        25246, 23490, 11717, -839, 8069, 6783, 1621, 8636, 6880, 20991, 11702, 18221,
+        13313, 10895, 17910, 16154, 23282, 9828, 15020, 4126, 10763, 14709, 15683, 6368,
+        -2921, 3598, 2521, -14275, 3287, 1531, 16726, 7437, 13956, 5663, 9964, 13645,
+        8757, 17369, 4319, 14850, 5930, 3512, 8635, -333, 7645, 13672, 20191, 15283,
+        12865, 19880, 18124, 6351, -6205, 2703, 1417, -3745, 3270, 1514, 14627, 5338,
+        11857, 6949, 4531, 11546, 9790, 20572, 7118, 12310, -765, 8053, 11999, 12366,
+        1002, -8287, -1768, -2845, -19641, -2079, -3835, 11360, 2071, 8590, 297, 4598,
+        8279, 3391, 12178, -872, 9659, -1226, -1679, 3444, -5524, 8995, 15022, 21541,
+        16633, 14215, 21230, 19474, 9552, -3004, 5904, 4618, -544, 6471, 4715, 15977,
+        6688, 13207, 8299, 5881, 12896, 11140, 19685, 6231, 11423, 529, 7166, 11112,
+        12086, 3256, -6033, 486, -591, -17387, 175, -878, 12710, 3421, 9940, 1647,
+        5948, 9629, 4741, 12739, -311, 10220, 1300, -1118, 4005, -4963, 11223, 17250,
+        23769, 18861, 16443, 23458, 21702, 9929, -2627, 6281, 4995, -167, 6848, 5092,
+        18205, 8916, 15435, 10527, 8109, 15124, 13368, 21494, 8040, 13232, 2338, 8975,
+        12921, 13895, 4580, -4709, 1810, 733, -16063, 1499, -257, 23273, 13984, 20503,
+        12210, 16511, 20192, 15304, 16518, 3468, 13999, 5079, 2661, 7784, -1184, 8295,
+        14322, 20841, 15933, 13515, 20530, 18774, 7001, -5555, 3353, 2067, -3095, 3920,
+        2164, 15277, 5988, 12507, 7599, 5181, 12196, 10440, 21681, 8227, 13419, 536,
+        9162, 13108, 14082, 1652, -7637, -1118, -2195, -18991, -1429, -3185, 11517, 2228,
+        8747, 454, 4755, 7282, 3548, 15743, 605, 11136, 2216, -202, 1317, -4768,
+        -4921, -5699, 820, -4088, -6506, 509, -1247, 5725, -6831, 2077, 791, -4371,
+        2644, 888, 7095, -2194, 4325, -583, -3001, 4014, 2258, 13066, -388, 4804,
+        -4085, -801, 4493, 634, 7959, -2194, 4325, 3248, -13462, 4014, 2258, 7095,
+        -2194, 4325, -583, 333, 4014, -874, 9387, -3663, 6868, -3211, -4470, 1300,
+        -3163, 4348, -2021, 4498, -410, -2828, 4187, 2431, 5898, -6658, 2250, 964,
+        -4198, 2817, 1061, 7268, -2021, 4498, -410, -2828, 4187, 2431, 15071, 1617,
+        6809, 569, 1204, 6498, 2639, 8132, -2021, 4498, 3421, -13289, 4187, 2431,
+        7268, -2021, 4498, -410, 506, 4187, -701, 11029, -2021, 8510, -1569, -2828,
+        2942, -1521, 9304, 2935, 9454, 4546, 2128, 9143, 7387, 10854, -1702, 7206,
+        5920, 758, 7773, 6017, 12224, 2935, 9454, 4546, 2128, 9143, 7387, 20027,
+        6573, 11765, 5525, 6160, 11454, 7595, 13088, 2935, 9454, 8377, -8333, 9143,
+        7387, 12224, 2935, 9454, 4546, 5462, 9143, 4255, 16434, 3384, 13915, 3836,
+        2577, 8347, 3884, 4051, -2318, 4201, -707, -3125, 3890, 2134, 5601, -6955,
+        1953, 667, -4495, 2520, 764, 6971, -2318, 4201, -707, -3125, 3890, 2134,
+        16077, 2623, 7815, 542, 2210, 7504, 3645, 7835, -2318, 4201, 3124, -13586,
+        3890, 2134, 7857, -1432, 5087, 179, 1095, 4776, -112, 10732, -2318, 8213,
+        -3831, -3125, 2645, -3219, 3529, -2840, 3679, -1229, -3647, 3368, 1612, 5079,
+        -7477, 1431, 145, -5560, 1998, 242, 6449, -2840, 3679, -1229, -3647, 3368,
+        1612, 14252, 798, 5990, -250, 385, 5679, 1820, 7313, -2840, 3679, 2602,
+        -14108, 3368, 2315, 6449, -2840, 3679, -1229, -313, 3368, -1520, 10616, -2434,
+        8097, -1982, -3241, 2529, -1934, 7516, 1147, 7666, 2758, 340, 7355, 5599,
+        9066, -3490, 5418, 4132, -1030, 5985, 4229, 10436, 1147, 7666, 2758, 340,
+        7355, 5599, 18239, 4785, 9977, 3737, 4372, 9666, 5807, 11300, 1147, 7666,
+        6589, -10121, 7355, 5599, 10436, 1147, 7666, 2758, 3674, 7355, 2467, 15405,
+        2355, 12886, 2807, 1548, 7318, 2855, 4804, -1565, 4954, 46, -2372, 4643,
+        2887, 6354, -6202, 2706, 1420, -3742, 3273, 1517, 7724, -1565, 4954, 46,
+        -2372, 4643, 2887, 15527, 2073, 7265, 2, 1660, 6954, 3095, 8588, -1565,
+        4954, 3877, -12833, 4643, 2887, 9245, -44, 6475, 1567, 2483, 5010, 1276,
+        14954, -184, 10347, 268, -991, 4779, 316, -2968, -3746, 2773, -2135, -4553,
+        2462, 706, 6770, -5786, 3122, 1836, -3326, 3689, 1933, 8140, -1149, 5370,
+        462, -1956, 5059, 3303, 15943, 2489, 7681, -1208, 2076, 7370, 3511, 9004,
+        -1149, 5370, 4293, -12417, 5059, 3303, 8140, -1149, 5370, 462, 1378, 5059,
+        171, 10432, -2618, 7913, -2166, -3425, 2345, -2118, 5393, -976, 5543, 635,
+        -1783, 5232, 3476, 8036, -4520, 4388, 3102, -2060, 4955, 3199, 8313, -976,
+        5543, 635, -1783, 5232, 3476, 16116, 2662, 7854, 1614, 2249, 7543, 3684,
+        9177, -976, 5543, 4466, -12244, 5232, 3476, 8313, -976, 5543, 635, 1551,
+        5232, 344, 12074, -976, 9555, -524, -1783, 3987, -476, 10349, 3980, 10499,
+        5591, 3173, 10188, 8432, 11899, -657, 8251, 6965, 1803, 8818, 7062, 13269,
+        3980, 10499, 5591, 3173, 10188, 8432, 21072, 7618, 12810, 6570, 7205, 12499,
+        8640, 14133, 3980, 10499, 9422, -7288, 10188, 8432, 13269, 3980, 10499, 5591,
+        6507, 10188, 5300, 17479, 4429, 14960, 4881, 3622, 9392, 4929, 5096, -1273,
+        5246, 338, -2080, 4935, 3179, 6646, -5910, 2998, 1712, -3450, 3565, 1809,
+        8016, -1273, 5246, 338, -2080, 4935, 3179, 17122, 3668, 8860, 1587, 3255,
+        8549, 4690, 8880, -1273, 5246, 4169, -12541, 4935, 3179, 8902, -387, 6132,
+        1224, 2140, 5821, 933, 11777, -1273, 9258, -2786, -2080, 3690, -2174, 4574,
+        -1795, 4724, -184, -2602, 4413, 2657, 6124, -6432, 2476, 1190, -4515, 3043,
+        1287, 7494, -1795, 4724, -184, -2602, 4413, 2657, 15297, 1843, 7035, 795,
+        1430, 6724, 2865, 8358, -1795, 4724, 3647, -13063, 4413, 3360, 7494, -1795,
+        4724, -184, 732, 4413, -475, 11661, -1389, 9142, -937, -2196, 3574, -889,
+        8561, 2192, 8711, 3803, 1385, 8400, 6644, 10111, -2445, 6463, 5177, 15,
+        7030, 5274, 11481, 2192, 8711, 3803, 1385, 8400, 6644, 19284, 5830, 11022,
+        4782, 5417, 10711, 6852, 12345, 2192, 8711, 7634, -9076, 8400, 6644, 11481,
+        2192, 8711, 3803, 4719, 8400, 3512, 16450, 3400, 13931, 3852, 2593, 8363,
+        3900, 5849, -520, 5999, 1091, -1327, 5688, 3932, 7399, -5157, 3751, 2465,
+        -2697, 4318, 2562, 8769, -520, 5999, 1091, -1327, 5688, 3932, 16572, 3118,
+        8310, 1047, 2705, 7999, 4140, 9633, -520, 5999, 4922, -11788, 5688, 3932,
+        10290, 1001, 7520, 2612, 3528, 6055, 2321, 15774, 636, 11167, 1088, -171,
+        5599, 1136, -3310, -4088, 2431, -2477, -4895, 2120, 364, 6428, -6128, 2780,
+        1494, -3668, 3347, 1591, 7798, -1491, 5028, 120, -2298, 4717, 2961, 15601,
+        2147, 7339, -1550, 1734, 7028, 3169, 8662, -1491, 5028, 3951, -12759, 4717,
+        2961, 7798, -1491, 5028, 120, 1036, 4717, -171, 10090, -2960, 7571, -2508,
+        -3767, 2003, -2460, 5051, -1318, 5201, 293, -2125, 4890, 3134, 6601, -5955,
+        2953, 1667, -3495, 3520, 1764, 7971, -1318, 5201, 293, -2125, 4890, 3134,
+        15774, 2320, 7512, 1272, 1907, 7201, 3342, 8835, -1318, 5201, 4124, -12586,
+        4890, 3134, 7971, -1318, 5201, 293, 1209, 4890, 2, 11732, -1318, 9213,
+        -866, -2125, 3645, -818, 10007, 3638, 10157, 5249, 2831, 9846, 8090, 11557,
+        -999, 7909, 6623, 1461, 8476, 6720, 12927, 3638, 10157, 5249, 2831, 9846,
+        8090, 20730, 7276, 12468, 6228, 6863, 12157, 8298, 13791, 3638, 10157, 9080,
+        -7630, 9846, 8090, 12927, 3638, 10157, 5249, 6165, 9846, 4958, 17137, 4087,
+        14618, 4539, 3280, 9050, 4587, 4754, -1615, 4904, -4, -2422, 4593, 2837,
+        6304, -6252, 2656, 1370, -3792, 3223, 1467, 7674, -1615, 4904, -4, -2422,
+        4593, 2837, 16780, 3326, 8518, 1245, 2913, 8207, 4348, 8538, -1615, 4904,
+        3827, -12883, 4593, 2837, 8560, -729, 5790, 882, 1798, 5479, 591, 11435,
+        -1615, 8916, -3128, -2422, 3348, -2516, 4232, -2137, 4382, -526, -2944, 4071,
+        2315, 5782, -6774, 2134, 848, -4857, 2701, 945, 7152, -2137, 4382, -526,
+        -2944, 4071, 2315, 14955, 1501, 6693, 453, 1088, 6382, 2523, 8016, -2137,
+        4382, 3305, -13405, 4071, 3018, 7152, -2137, 4382, -526, 390, 4071, -817,
+        11319, -1731, 8800, -1279, -2538, 3232, -1231, 8219, 1850, 8369, 3461, 1043,
+        8058, 6302, 9769, -2787, 6121, 4835, -327, 6688, 4932, 11139, 1850, 8369,
+        3461, 1043, 8058, 6302, 18942, 5488, 10680, 4440, 5075, 10369, 6510, 12003,
+        1850, 8369, 7292, -9418, 8058, 6302, 11139, 1850, 8369, 3461, 4377, 8058,
+        3170, 16108, 3058, 13589, 3510, 2251, 8021, 3558, 5507, -862, 5657, 749,
+        -1669, 5346, 3590, 7057, -5499, 3409, 2123, -3039, 3976, 2220, 8427, -862,
+        5657, 749, -1669, 5346, 3590, 16230, 2776, 7968, 705, 2363, 7657, 3798,
+        9291, -862, 5657, 4580, -12130, 5346, 3590, 9948, 659, 7178, 2270, 3186,
+        5713, 1979, 14688, -450, 10081, 2, -1257, 4513, 50, -3464, -4242, 2277,
+        -2631, -5049, 1966, 210, 6274, -6282, 2626, 1340, -3822, 3193, 1437, 7644,
+        -1645, 4874, -34, -2452, 4563, 2807, 14432, 978, 6170, -2719, 565, 5859,
+        2000, 8508, -1645, 4874, 3797, -12913, 4563, 2807, 8111, -1178, 5341, 433,
+        1349, 5030, 142, 9794, -3256, 7275, -2804, -4063, 1707, -2756, 4897, -1472,
+        5047, 139, -2279, 4736, 2980, 6447, -6109, 2799, 1513, -3649, 3366, 1610,
+        7817, -1472, 5047, 139, -2279, 4736, 2980, 15620, 2166, 7358, 1118, 1753,
+        7047, 3188, 8681, -1472, 5047, 3970, -12740, 4736, 2980, 7817, -1472, 5047,
+        139, 1055, 4736, -152, 11578, -1472, 9059, -1020, -2279, 3491, -972, 9853,
+        3484, 10003, 5095, 2677, 9692, 7936, 11403, -1153, 7755, 6469, 1307, 8322,
+        6566, 12773, 3484, 10003, 5095, 2677, 9692, 7936, 20576, 7122, 12314, 6074,
+        6709, 12003, 8144, 13637, 3484, 10003, 8926, -7784, 9692, 7936, 12773, 3484,
+        10003, 5095, 6011, 9692, 4804, 16983, 3933, 14464, 4385, 3126, 8896, 4433,
+        4600, -1769, 4750, -158, -2576, 4439, 2683, 6150, -6406, 2502, 1216, -3946,
+        3069, 1313, 7520, -1769, 4750, -158, -2576, 4439, 2683, 18221, 4767, 9959,
+        2686, 4354, 9648, 5789, 8384, -1769, 4750, 3673, -13037, 4439, 2683, 8406,
+        -883, 5636, 728, 1644, 5325, 437, 11281, -1769, 8762, -3282, -2576, 3194,
+        -2670, 4078, -2291, 4228, -680, -3098, 3917, 2161, 5628, -6928, 1980, 694,
+        -5011, 2547, 791, 6998, -2291, 4228, -680, -3098, 3917, 2161, 14801, 1347,
+        6539, 299, 934, 6228, 2369, 7862, -2291, 4228, 3151, -13559, 3917, 2864,
+        6998, -2291, 4228, -680, 236, 3917, -971, 11165, -1885, 8646, -1433, -2692,
+        3078, -1385, 8065, 1696, 8215, 3307, 889, 7904, 6148, 9615, -2941, 5967,
+        4681, -481, 6534, 4778, 10985, 1696, 8215, 3307, 889, 7904, 6148, 18788,
+        5334, 10526, 4286, 4921, 10215, 6356, 11849, 1696, 8215, 7138, -9572, 7904,
+        6148, 10985, 1696, 8215, 3307, 4223, 7904, 3016, 15954, 2904, 13435, 3356,
+        2097, 7867, 3404, 5353, -1016, 5503, 595, -1823, 5192, 3436, 6903, -5653,
+        3255, 1969, -3193, 3822, 2066, 8273, -1016, 5503, 595, -1823, 5192, 3436,
+        17245, 3791, 8983, 1720, 3378, 8672, 4813, 9137, -1016, 5503, 4426, -12284,
+        5192, 3436, 9794, 505, 7024, 2116, 3032, 5559, 1825, 15338, 200, 10731,
+        652, -607, 5163, 700, -3458, -4236, 2283, -2625, -5043, 1972, 216, 6280,
+        -6276, 2632, 1346, -3816, 3199, 1443, 7650, -1639, 4880, -28, -2446, 4569,
+        2813, 15453, 1999, 7191, -1698, 1586, 6880, 3021, 8514, -1639, 4880, 3803,
+        -12907, 4569, 2813, 7650, -1639, 4880, -28, 888, 4569, -319, 9942, -3108,
+        7423, -2656, -3915, 1855, -2608, 4903, -1466, 5053, 145, -2273, 4742, 2986,
+        6453, -6103, 2805, 1519, -3643, 3372, 1616, 7823, -1466, 5053, 145, -2273,
+        4742, 2986, 15626, 2172, 7364, 1124, 1759, 7053, 3194, 8687, -1466, 5053,
+        3976, -12734, 4742, 2986, 7823, -1466, 5053, 145, 1061, 4742, -146, 11584,
+        -1466, 9065, -1014, -2273, 3497, -966, 9859, 3490, 10009, 5101, 2683, 9698,
+        7942, 11409, -1147, 7761, 6475, 1313, 8328, 6572, 12779, 3490, 10009, 5101,
+        2683, 9698, 7942, 20582, 7128, 12320, 6080, 6715, 12009, 8150, 13643, 3490,
+        10009, 8932, -7778, 9698, 7942, 12779, 3490, 10009, 5101, 6017, 9698, 4810,
+        16989, 3939, 14470, 4391, 3132, 8902, 4439, 4606, -1763, 4756, -152, -2570,
+        4445, 2689, 6156, -6400, 2508, 1222, -3940, 3075, 1319, 7526, -1763, 4756,
+        -152, -2570, 4445, 2689, 16632, 3178, 8370, 1097, 2765, 8059, 4200, 8390,
+        -1763, 4756, 3679, -13031, 4445, 2689, 8412, -877, 5642, 734, 1650, 5331,
+        443, 11287, -1763, 8768, -3276, -2570, 3200, -2664, 4084, -2285, 4234, -674,
+        -3092, 3923, 2167, 5634, -6922, 1986, 700, -5005, 2553, 797, 7004, -2285,
+        4234, -674, -3092, 3923, 2167, 14807, 1353, 6545, 305, 940, 6234, 2375,
+        7868, -2285, 4234, 3157, -13553, 3923, 2870, 7004, -2285, 4234, -674, 242,
+        3923, -965, 11171, -1879, 8652, -1427, -2686, 3084, -1379, 8071, 1702, 8221,
+        3313, 895, 7910, 6154, 9621, -2935, 5973, 4687, -475, 6540, 4784, 10991,
+        1702, 8221, 3313, 895, 7910, 6154, 18794, 5340, 10532, 4292, 4927, 10221,
+        6362, 11855, 1702, 8221, 7144, -9566, 7910, 6154, 10991, 1702, 8221, 3313,
+        4229, 7910, 3022, 15960, 2910, 13441, 3362, 2103, 7873, 3410, 5359, -1010,
+        5509, 601, -1817, 5198, 3442, 6909, -5647, 3261, 1975, -3187, 3828, 2072,
+        8279, -1010, 5509, 601, -1817, 5198, 3442, 16082, 2628, 7820, 557, 2215,
+        7509, 3650, 9143, -1010, 5509, 4432, -12278, 5198, 3442, 9800, 511, 7030,
+        2122, 3038, 5565, 1831, 15284, 146, 10677, 598, -661, 5109, 646, -2807,
+        -3585, 2934, -1974, -4392, 2623, 867, 6931, -5625, 3283, 1997, -3165, 3850,
+        2094, 8301, -988, 5531, 623, -1795, 5220, 3464, 16104, 2650, 7842, -1047,
+        2237, 7531, 3672, 9165, -988, 5531, 4454, -12256, 5220, 3464, 8301, -988,
+        5531, 623, 1539, 5220, 332, 10593, -2457, 8074, -2005, -3264, 2506, -1957,
+        5554, -815, 5704, 796, -1622, 5393, 3637, 7104, -5452, 3456, 2170, -2992,
+        4023, 2267, 8474, -815, 5704, 796, -1622, 5393, 3637, 16277, 2823, 8015,
+        1775, 2410, 7704, 3845, 9338, -815, 5704, 4627, -12083, 5393, 3637, 8474,
+        -815, 5704, 796, 1712, 5393, 505, 12235, -815, 9716, -363, -1622, 4148,
+        -315, 10510, 4141, 10660, 5752, 3334, 10349, 8593, 12060, -496, 8412, 7126,
+        1964, 8979, 7223, 13430, 4141, 10660, 5752, 3334, 10349, 8593, 21233, 7779,
+        12971, 6731, 7366, 12660, 8801, 14294, 4141, 10660, 9583, -7127, 10349, 8593,
+        13430, 4141, 10660, 5752, 6668, 10349, 5461, 17640, 4590, 15121, 5042, 3783,
+        9553, 5090, 5257, -1112, 5407, 499, -1919, 5096, 3340, 6807, -5749, 3159,
+        1873, -3289, 3726, 1970, 8177, -1112, 5407, 499, -1919, 5096, 3340, 17283,
+        3829, 9021, 1748, 3416, 8710, 4851, 9041, -1112, 5407, 4330, -12380, 5096,
+        3340, 9063, -226, 6293, 1385, 2301, 5982, 1094, 11938, -1112, 9419, -2625,
+        -1919, 3851, -2013, 4735, -1634, 4885, -23, -2441, 4574, 2818, 6285, -6271,
+        2637, 1351, -4354, 3204, 1448, 7655, -1634, 4885, -23, -2441, 4574, 2818,
+        15458, 2004, 7196, 956, 1591, 6885, 3026, 8519, -1634, 4885, 3808, -12902,
+        4574, 3521, 7655, -1634, 4885, -23, 893, 4574, -314, 11822, -1228, 9303,
+        -776, -2035, 3735, -728, 8722, 2353, 8872, 3964, 1546, 8561, 6805, 10272,
+        -2284, 6624, 5338, 176, 7191, 5435, 11642, 2353, 8872, 3964, 1546, 8561,
+        6805, 19445, 5991, 11183, 4943, 5578, 10872, 7013, 12506, 2353, 8872, 7795,
+        -8915, 8561, 6805, 11642, 2353, 8872, 3964, 4880, 8561, 3673, 16798, 3748,
+        14279, 4200, 2941, 8711, 4248, 6010, -359, 6160, 1252, -1166, 5849, 4093,
+        7560, -4996, 3912, 2626, -2536, 4479, 2723, 8930, -359, 6160, 1252, -1166,
+        5849, 4093, 16733, 3279, 8471, 1208, 2866, 8160, 4301, 9794, -359, 6160,
+        5083, -11627, 5849, 4093, 10451, 1162, 7681, 2773, 3689, 6216, 2482, 15935,
+        797, 11328, 1249, -10, 5760, 1297, -3431, -4209, 2310, -2598, -5016, 1999,
+        243, 6307, -6249, 2659, 1373, -3789, 3226, 1470, 7677, -1612, 4907, -1,
+        -2419, 4596, 2840, 15480, 2026, 7218, -1671, 1613, 6907, 3048, 8541, -1612,
+        4907, 3830, -12880, 4596, 2840, 7346, -1943, 4576, -332, 584, 4265, -623,
+        9579, -3471, 7060, -3019, -4278, 1492, -2971, 4930, -1439, 5080, 172, -2246,
+        4769, 3013, 6480, -6076, 2832, 1546, -3616, 3399, 1643, 7850, -1439, 5080,
+        172, -2246, 4769, 3013, 15653, 2199, 7391, 1151, 1786, 7080, 3221, 8714,
+        -1439, 5080, 4003, -12707, 4769, 3013, 7850, -1439, 5080, 172, 1088, 4769,
+        -119, 11611, -1439, 9092, -987, -2246, 3524, -939, 9886, 3517, 10036, 5128,
+        2710, 9725, 7969, 11436, -1120, 7788, 6502, 1340, 8355, 6599, 12806, 3517,
+        10036, 5128, 2710, 9725, 7969, 20609, 7155, 12347, 6107, 6742, 12036, 8177,
+        13670, 3517, 10036, 8959, -7751, 9725, 7969, 12806, 3517, 10036, 5128, 6044,
+        9725, 4837, 17016, 3966, 14497, 4418, 3159, 8929, 4466, 4633, -1736, 4783,
+        -125, -2543, 4472, 2716, 6183, -6373, 2535, 1249, -3913, 3102, 1346, 7553,
+        -1736, 4783, -125, -2543, 4472, 2716, 17657, 4203, 9395, 2122, 3790, 9084,
+        5225, 8417, -1736, 4783, 3706, -13004, 4472, 2716, 8439, -850, 5669, 761,
+        1677, 5358, 470, 11182, -1868, 8663, -3381, -2675, 3095, -2769, 4111, -2258,
+        4261, -647, -3065, 3950, 2194, 5661, -6895, 2013, 727, -4978, 2580, 824,
+        7031, -2258, 4261, -647, -3065, 3950, 2194, 14834, 1380, 6572, 332, 967,
+        6261, 2402, 7895, -2258, 4261, 3184, -13526, 3950, 2897, 7031, -2258, 4261,
+        -647, 269, 3950, -938, 11198, -1852, 8679, -1400, -2659, 3111, -1352, 8098,
+        1729, 8248, 3340, 922, 7937, 6181, 9648, -2908, 6000, 4714, -448, 6567,
+        4811, 11018, 1729, 8248, 3340, 922, 7937, 6181, 18821, 5367, 10559, 4319,
+        4954, 10248, 6389, 11882, 1729, 8248, 7171, -9539, 7937, 6181, 11018, 1729,
+        8248, 3340, 4256, 7937, 3049, 15987, 2937, 13468, 3389, 2130, 7900, 3437,
+        5386, -983, 5536, 628, -1790, 5225, 3469, 6936, -5620, 3288, 2002, -3160,
+        3855, 2099, 8306, -983, 5536, 628, -1790, 5225, 3469, 16425, 2971, 8163,
+        900, 2558, 7852, 3993, 9170, -983, 5536, 4459, -12251, 5225, 3469, 10407,
+        1118, 7637, 2729, 3645, 6172, 2438, 16113, 975, 11506, 1427, 168, 5938,
+        1475, 6838, 6060, 12579, 7671, 5253, 12268, 10512, 5785, -6771, 2137, 851,
+        -4311, 2704, 1874, 3943, -5346, 200, -3735, -6153, 862, -894, 12299, -1155,
+        4037, -4852, -1568, 3726, -133, 8019, -2134, 4385, 3308, -13402, 4074, 2318,
+        7155, -2134, 4385, -523, 393, 4074, -814, 9447, -3603, 6928, -3151, -6446,
+        1360, -2837, 4408, -1961, 4558, -350, -2768, 4247, 2491, 5958, -9361, 2310,
+        1024, -4138, 2877, 2047, 4116, -5173, 373, -3562, -5980, 1035, -721, 14304,
+        850, 6042, -198, 437, 5731, 1872, 8192, -1961, 4558, 3481, -13049, 4247,
+        2491, 7328, -1961, 4558, -350, 566, 4247, -641, 11089, -1961, 8570, -1509,
+        -4804, 3002, -1195, 9364, 2995, 9514, 4606, 2188, 9203, 7447, 10914, -1642,
+        7266, 5980, 818, 7833, 7003, 9072, -217, 5329, 1394, -1024, 5991, 4235,
+        19260, 5806, 10998, 4758, 5393, 10687, 6828, 13148, 2995, 9514, 8437, -8273,
+        9203, 7447, 12284, 2995, 9514, 4606, 5522, 9203, 4315, 16494, 3444, 13975,
+        3896, 601, 8407, 4210, 4111, -2258, 4261, -647, -3065, 3950, 2194, 5661,
+        -6895, 2013, 727, -4435, 2580, 1750, 3819, -5470, 76, -3859, -6277, 738,
+        -1018, 14905, 1451, 6643, -4637, 1038, 6332, 3099, 7895, -2258, 4261, 3184,
+        -13526, 3950, 2194, 7917, -1372, 5147, 239, 1155, 4836, -52, 10792, -2258,
+        8273, -4264, -5101, 2705, -958, 1347, -5022, 1497, -3411, -5829, 1186, -570,
+        5139, -7417, 1491, 205, -13656, 2058, 1228, 3297, -5992, -446, -4381, -6799,
+        216, -1540, 12692, -762, 4430, -1810, -1175, 4119, 260, 7373, -2780, 3739,
+        2662, -14048, 3428, 2375, 6509, -2780, 3739, -1169, -253, 3428, -1460, 12474,
+        -576, 9955, -124, -3419, 4387, 190, 7576, 1207, 7726, 2818, 400, 7415,
+        5659, 9126, -3430, 5478, 4192, -970, 6045, 5215, 7284, -2005, 3541, -394,
+        -2812, 4203, 2447, 17472, 4018, 9210, 2970, 3605, 8899, 5040, 11360, 1207,
+        7726, 6649, -10061, 7415, 5659, 10496, 1207, 7726, 2818, 3734, 7415, 2527,
+        13063, 13, 10544, 465, -2830, 4976, 779, 4864, -1505, 5014, 106, -2312,
+        4703, 2947, 6414, -6142, 2766, 1480, -3682, 3333, 2503, 4572, -4717, 829,
+        -3106, -5524, 1491, -265, 14760, 1306, 6498, -765, 893, 6187, 755, 8648,
+        -1505, 5014, 3937, -12773, 4703, 2947, 9744, 455, 6974, 2066, 2982, 5509,
+        1775, 17778, 2160, 12691, 5058, -683, 7123, 2632, 8791, 8013, 14532, 9624,
+        7206, 14221, 12465, 6830, -5726, 3182, 1896, -3266, 3749, 2919, 4988, -4301,
+        1245, -2690, -5108, 1907, 151, 15176, 1722, 6914, -1975, 1309, 6603, 2744,
+        9064, -1089, 5430, 4353, -12357, 5119, 3363, 8200, -1089, 5430, 522, 1438,
+        5119, 231, 10492, -2558, 7973, -2106, -5401, 2405, -1792, 5453, -916, 5603,
+        695, -1723, 5292, 3536, 8096, -7223, 4448, 3162, -2000, 5015, 4185, 5161,
+        -4128, 1418, -2517, -4935, 2080, 324, 15349, 1895, 7087, 847, 1482, 6776,
+        2917, 9237, -916, 5603, 4526, -12004, 5292, 3536, 8373, -916, 5603, 695,
+        1611, 5292, 404, 12134, -916, 9615, -464, -3759, 4047, -150, 10409, 4040,
+        10559, 5651, 3233, 10248, 8492, 11959, -597, 8311, 7025, 1863, 8878, 8048,
+        10117, 828, 6374, 2439, 21, 7036, 5280, 20305, 6851, 12043, 5803, 6438,
+        11732, 7873, 14193, 4040, 10559, 9482, -7228, 10248, 8492, 13329, 4040, 10559,
+        5651, 6567, 10248, 5360, 17539, 4489, 15020, 4941, 1646, 9452, 5255, 5156,
+        -1213, 5306, 398, -2020, 4995, 3239, 6706, -5850, 3058, 1772, -3390, 3625,
+        2795, 4864, -4425, 1121, -2814, -5232, 1783, 27, 16635, 3181, 8373, -2907,
+        2768, 8062, 4829, 8940, -1213, 5306, 4229, -12481, 4995, 3239, 8962, -327,
+        6192, 1284, 2200, 5881, 993, 11837, -1213, 9318, -3219, -4056, 3750, 87,
+        2392, -3977, 2542, -2366, -4784, 2231, 475, 6184, -6372, 2536, 1250, -12611,
+        3103, 2273, 4342, -4947, 599, -3336, -5754, 1261, -495, 13737, 283, 5475,
+        -765, -130, 5164, 1305, 8418, -1735, 4784, 3707, -13003, 4473, 3420, 7554,
+        -1735, 4784, -124, 792, 4473, -415, 13519, 469, 11000, 921, -2374, 5432,
+        1235, 8621, 2252, 8771, 3863, 1445, 8460, 6704, 10171, -2385, 6523, 5237,
+        75, 7090, 6260, 8329, -960, 4586, 651, -1767, 5248, 3492, 18517, 5063,
+        10255, 4015, 4650, 9944, 6085, 12405, 2252, 8771, 7694, -9016, 8460, 6704,
+        11541, 2252, 8771, 3863, 4779, 8460, 3572, 14108, 1058, 11589, 1510, -1785,
+        6021, 1824, 5909, -460, 6059, 1151, -1267, 5748, 3992, 7459, -5097, 3811,
+        2525, -2637, 4378, 3548, 5617, -3672, 1874, -2061, -4479, 2536, 780, 15805,
+        2351, 7543, 280, 1938, 7232, 1800, 9693, -460, 6059, 4982, -11728, 5748,
+        3992, 10789, 1500, 8019, 3111, 4027, 6554, 2820, 18488, 2870, 13401, 5768,
+        27, 7833, 3342, 8449, 7671, 14190, 9282, 6864, 13879, 12123, 6488, -6068,
+        2840, 1554, -3608, 3407, 2577, 4646, -4643, 903, -3032, -5450, 1565, -191,
+        14834, 1380, 6572, -2317, 967, 6261, 2402, 8722, -1431, 5088, 4011, -12699,
+        4777, 3021, 7858, -1431, 5088, 180, 1096, 4777, -111, 10150, -2900, 7631,
+        -2448, -5743, 2063, -2134, 5111, -1258, 5261, 353, -2065, 4950, 3194, 6661,
+        -8658, 3013, 1727, -3435, 3580, 2750, 4819, -4470, 1076, -2859, -5277, 1738,
+        -18, 15007, 1553, 6745, 505, 1140, 6434, 2575, 8895, -1258, 5261, 4184,
+        -12346, 4950, 3194, 8031, -1258, 5261, 353, 1269, 4950, 62, 11792, -1258,
+        9273, -806, -4101, 3705, -492, 10067, 3698, 10217, 5309, 2891, 9906, 8150,
+        11617, -939, 7969, 6683, 1521, 8536, 7706, 9775, 486, 6032, 2097, -321,
+        6694, 4938, 19963, 6509, 11701, 5461, 6096, 11390, 7531, 13851, 3698, 10217,
+        9140, -7570, 9906, 8150, 12987, 3698, 10217, 5309, 6225, 9906, 5018, 17197,
+        4147, 14678, 4599, 1304, 9110, 4913, 4814, -1555, 4964, 56, -2362, 4653,
+        2897, 6364, -6192, 2716, 1430, -3732, 3283, 2453, 4522, -4767, 779, -3156,
+        -5574, 1441, -315, 16293, 2839, 8031, -3249, 2426, 7720, 4487, 8598, -1555,
+        4964, 3887, -12823, 4653, 2897, 8620, -669, 5850, 942, 1858, 5539, 651,
+        11495, -1555, 8976, -3561, -4398, 3408, -255, 2050, -4319, 2200, -2708, -5126,
+        1889, 133, 5842, -6714, 2194, 908, -12953, 2761, 1931, 4000, -5289, 257,
+        -3678, -6096, 919, -837, 13395, -59, 5133, -1107, -472, 4822, 963, 8076,
+        -2077, 4442, 3365, -13345, 4131, 3078, 7212, -2077, 4442, -466, 450, 4131,
+        -757, 13177, 127, 10658, 579, -2716, 5090, 893, 8279, 1910, 8429, 3521,
+        1103, 8118, 6362, 9829, -2727, 6181, 4895, -267, 6748, 5918, 7987, -1302,
+        4244, 309, -2109, 4906, 3150, 18175, 4721, 9913, 3673, 4308, 9602, 5743,
+        12063, 1910, 8429, 7352, -9358, 8118, 6362, 11199, 1910, 8429, 3521, 4437,
+        8118, 3230, 13766, 716, 11247, 1168, -2127, 5679, 1482, 5567, -802, 5717,
+        809, -1609, 5406, 3650, 7117, -5439, 3469, 2183, -2979, 4036, 3206, 5275,
+        -4014, 1532, -2403, -4821, 2194, 438, 15463, 2009, 7201, -62, 1596, 6890,
+        1458, 9351, -802, 5717, 4640, -12070, 5406, 3650, 10447, 1158, 7677, 2769,
+        3685, 6212, 2478, 17402, 1784, 12315, 4682, -1059, 6747, 2256, 8295, 7517,
+        14036, 9128, 6710, 13725, 11969, 6334, -6222, 2686, 1400, -3762, 3253, 2423,
+        4492, -4797, 749, -3186, -5604, 1411, -345, 13665, 211, 5403, -3486, -202,
+        5092, 1233, 8568, -1585, 4934, 3857, -12853, 4623, 2867, 8171, -1118, 5401,
+        493, 1409, 5090, 202, 9854, -3196, 7335, -2744, -6039, 1767, -2430, 4957,
+        -1412, 5107, 199, -2219, 4796, 3040, 6507, -8812, 2859, 1573, -3589, 3426,
+        2596, 4665, -4624, 922, -3013, -5431, 1584, -172, 14853, 1399, 6591, 351,
+        986, 6280, 2421, 8741, -1412, 5107, 4030, -12500, 4796, 3040, 7877, -1412,
+        5107, 199, 1115, 4796, -92, 11638, -1412, 9119, -960, -4255, 3551, -646,
+        9913, 3544, 10063, 5155, 2737, 9752, 7996, 11463, -1093, 7815, 6529, 1367,
+        8382, 7552, 9621, 332, 5878, 1943, -475, 6540, 4784, 19809, 6355, 11547,
+        5307, 5942, 11236, 7377, 13697, 3544, 10063, 8986, -7724, 9752, 7996, 12833,
+        3544, 10063, 5155, 6071, 9752, 4864, 17043, 3993, 14524, 4445, 1150, 8956,
+        4759, 4660, -1709, 4810, -98, -2516, 4499, 2743, 6210, -6346, 2562, 1276,
+        -3886, 3129, 2299, 4368, -4921, 625, -3310, -5728, 1287, -469, 17734, 4280,
+        9472, -1808, 3867, 9161, 5928, 8444, -1709, 4810, 3733, -12977, 4499, 2743,
+        8466, -823, 5696, 788, 1704, 5385, 497, 12685, -365, 10166, -2371, -3208,
+        4598, 935, 1896, -4473, 2046, -2862, -5280, 1735, -21, 5688, -6868, 2040,
+        754, -13107, 2607, 1777, 3846, -5443, 103, -3832, -6250, 765, -991, 13241,
+        -213, 4979, -1261, -626, 4668, 809, 7922, -2231, 4288, 3211, -13499, 3977,
+        2924, 7058, -2231, 4288, -620, 296, 3977, -911, 13023, -27, 10504, 425,
+        -2870, 4936, 739, 8125, 1756, 8275, 3367, 949, 7964, 6208, 9675, -2881,
+        6027, 4741, -421, 6594, 5764, 7833, -1456, 4090, 155, -2263, 4752, 2996,
+        18021, 4567, 9759, 3519, 4154, 9448, 5589, 11909, 1756, 8275, 7198, -9512,
+        7964, 6208, 11045, 1756, 8275, 3367, 4283, 7964, 3076, 13612, 562, 11093,
+        1014, -2281, 5525, 1328, 5413, -956, 5563, 655, -1763, 5252, 3496, 6963,
+        -5593, 3315, 2029, -3133, 3882, 3052, 5121, -4168, 1378, -2557, -4975, 2040,
+        284, 16478, 3024, 8216, 953, 2611, 7905, 2473, 9197, -956, 5563, 4486,
+        -12224, 5252, 3496, 10293, 1004, 7523, 2615, 3531, 6058, 2324, 18675, 3057,
+        13588, 5955, 214, 8020, 3529, 8301, 7523, 14042, 9134, 6716, 13731, 11975,
+        6340, -6216, 2692, 1406, -3756, 3259, 2429, 4498, -4791, 755, -3180, -5598,
+        1417, -339, 14686, 1232, 6424, -2465, 819, 6113, 2254, 8574, -1579, 4940,
+        3863, -12847, 4629, 2873, 7710, -1579, 4940, 32, 948, 4629, -259, 10002,
+        -3048, 7483, -2596, -5891, 1915, -2282, 4963, -1406, 5113, 205, -2213, 4802,
+        3046, 6513, -8806, 2865, 1579, -3583, 3432, 2602, 4671, -4618, 928, -3007,
+        -5425, 1590, -166, 14859, 1405, 6597, 357, 992, 6286, 2427, 11539, 1386,
+        7905, 6828, -9702, 7594, 5838, 7883, -1406, 5113, 205, 1121, 4802, -86,
+        11644, -1406, 9125, -954, -4249, 3557, -640, 9919, 3550, 10069, 5161, 2743,
+        9758, 8002, 11469, -1087, 7821, 6535, 1373, 8388, 7558, 9627, 338, 5884,
+        1949, -469, 6546, 4790, 19815, 6361, 11553, 5313, 5948, 11242, 7383, 13703,
+        3550, 10069, 8992, -7718, 9758, 8002, 12839, 3550, 10069, 5161, 6077, 9758,
+        4870, 17049, 3999, 14530, 4451, 1156, 8962, 4765, 4666, -1703, 4816, -92,
+        -2510, 4505, 2749, 6216, -6340, 2568, 1282, -3880, 3135, 2305, 4374, -4915,
+        631, -3304, -5722, 1293, -463, 16145, 2691, 7883, -3397, 2278, 7572, 4339,
+        8450, -1703, 4816, 3739, -12971, 4505, 2749, 8472, -817, 5702, 794, 1710,
+        5391, 503, 11347, -1703, 8828, -3709, -4546, 3260, -403, 1902, -4467, 2052,
+        -2856, -5274, 1741, -15, 6373, -6183, 2725, 1439, -12422, 3292, 2462, 3852,
+        -5437, 109, -3826, -6244, 771, -985, 13247, -207, 4985, -1255, -620, 4674,
+        815, 7928, -2225, 4294, 3217, -13493, 3983, 2930, 7064, -2225, 4294, -614,
+        302, 3983, -905, 13029, -21, 10510, 431, -2864, 4942, 745, 8131, 1762,
+        8281, 3373, 955, 7970, 6214, 9681, -2875, 6033, 4747, -415, 6600, 5770,
+        7839, -1450, 4096, 161, -2257, 4758, 3002, 18027, 4573, 9765, 3525, 4160,
+        9454, 5595, 11915, 1762, 8281, 7204, -9506, 7970, 6214, 11051, 1762, 8281,
+        3373, 4289, 7970, 3082, 13618, 568, 11099, 1020, -2275, 5531, 1334, 5419,
+        -950, 5569, 661, -1757, 5258, 3502, 6969, -5587, 3321, 2035, -3127, 3888,
+        3058, 5127, -4162, 1384, -2551, -4969, 2046, 290, 15315, 1861, 7053, -210,
+        1448, 6742, 1310, 9203, -950, 5569, 4492, -12218, 5258, 3502, 10299, 1010,
+        7529, 2621, 3537, 6064, 2330, 18585, 2967, 13498, 5865, 124, 7930, 3439,
+        8952, 8174, 14693, 9785, 7367, 14382, 12626, 6991, -5565, 3343, 2057, -3105,
+        3910, 3080, 5149, -4140, 1406, -2529, -4947, 2068, 312, 15337, 1883, 7075,
+        -1814, 1470, 6764, 2905, 9225, -928, 5591, 4514, -12196, 5280, 3524, 8361,
+        -928, 5591, 683, 1599, 5280, 392, 10653, -2397, 8134, -1945, -5240, 2566,
+        -1631, 5614, -755, 5764, 856, -1562, 5453, 3697, 7164, -8155, 3516, 2230,
+        -2932, 4083, 3253, 5322, -3967, 1579, -2356, -4774, 2241, 485, 15510, 2056,
+        7248, 1008, 1643, 6937, 3078, 9398, -755, 5764, 4687, -11843, 5453, 3697,
+        8534, -755, 5764, 856, 1772, 5453, 565, 12295, -755, 9776, -303, -3598,
+        4208, 11, 10570, 4201, 10720, 5812, 3394, 10409, 8653, 12120, -436, 8472,
+        7186, 2024, 9039, 8209, 10278, 989, 6535, 2600, 182, 7197, 5441, 20466,
+        7012, 12204, 5964, 6599, 11893, 8034, 14354, 4201, 10720, 9643, -7067, 10409,
+        8653, 13490, 4201, 10720, 5812, 6728, 10409, 5521, 17700, 4650, 15181, 5102,
+        1807, 9613, 5416, 5317, -1052, 5467, 559, -1859, 5156, 3400, 6867, -5689,
+        3219, 1933, -3229, 3786, 2956, 5025, -4264, 1282, -2653, -5071, 1944, 188,
+        16796, 3342, 8534, -2746, 2929, 8223, 4990, 9101, -1052, 5467, 4390, -12320,
+        5156, 3400, 9123, -166, 6353, 1445, 2361, 6042, 1154, 11998, -1052, 9479,
+        -3058, -3895, 3911, 248, 2553, -3816, 2703, -2205, -4623, 2392, 636, 6345,
+        -6211, 2697, 1411, -12450, 3264, 2434, 4503, -4786, 760, -3175, -5593, 1422,
+        -334, 13898, 444, 5636, -604, 31, 5325, 1466, 8579, -1574, 4945, 3868,
+        -12842, 4634, 3581, 7715, -1574, 4945, 37, 953, 4634, -254, 13680, 630,
+        11161, 1082, -2213, 5593, 1396, 8782, 2413, 8932, 4024, 1606, 8621, 6865,
+        10332, -2224, 6684, 5398, 236, 7251, 6421, 8490, -799, 4747, 812, -1606,
+        5409, 3653, 18678, 5224, 10416, 4176, 4811, 10105, 6246, 12566, 2413, 8932,
+        7855, -8855, 8621, 6865, 11702, 2413, 8932, 4024, 4940, 8621, 3733, 14456,
+        1406, 11937, 1858, -1437, 6369, 2172, 6070, -299, 6220, 1312, -1106, 5909,
+        4153, 7620, -4936, 3972, 2686, -2476, 4539, 3709, 5778, -3511, 2035, -1900,
+        -4318, 2697, 941, 15966, 2512, 7704, 441, 2099, 7393, 1961, 9854, -299,
+        6220, 5143, -11567, 5909, 4153, 10950, 1661, 8180, 3272, 4188, 6715, 2981,
+        18649, 3031, 13562, 5929, 188, 7994, 3503, 8328, 7550, 14069, 9161, 6743,
+        13758, 12002, 6367, -6189, 2719, 1433, -3729, 3286, 2456, 4525, -4764, 782,
+        -3153, -5571, 1444, -312, 14713, 1259, 6451, -2438, 846, 6140, 2281, 8601,
+        -1552, 4967, 3890, -12820, 4656, 2900, 7406, -1883, 4636, -272, 644, 4325,
+        -563, 9639, -3411, 7120, -2959, -6254, 1552, -2645, 4990, -1379, 5140, 232,
+        -2186, 4829, 3073, 6540, -8779, 2892, 1606, -3556, 3459, 2629, 4698, -4591,
+        955, -2980, -5398, 1617, -139, 14886, 1432, 6624, 384, 1019, 6313, 2454,
+        8774, -1379, 5140, 4063, -12467, 4829, 3073, 7910, -1379, 5140, 232, 1148,
+        4829, -59, 11671, -1379, 9152, -927, -4222, 3584, -613, 9946, 3577, 10096,
+        5188, 2770, 9785, 8029, 11496, -1060, 7848, 6562, 1400, 8415, 7585, 9654,
+        365, 5911, 1976, -442, 6573, 4817, 19842, 6388, 11580, 5340, 5975, 11269,
+        7410, 13730, 3577, 10096, 9019, -7691, 9785, 8029, 12866, 3577, 10096, 5188,
+        6104, 9785, 4897, 17076, 4026, 14557, 4478, 1183, 8989, 4792, 4693, -1676,
+        4843, -65, -2483, 4532, 2776, 6243, -6313, 2595, 1309, -3853, 3162, 2332,
+        4401, -4888, 658, -3277, -5695, 1320, -436, 18167, 4713, 9905, -1375, 4300,
+        9594, 6361, 8477, -1676, 4843, 3766, -12944, 4532, 2776, 8499, -790, 5729,
+        821, 1737, 5418, 530, 11242, -1808, 8723, -3814, -4651, 3155, -508, 1929,
+        -4440, 2079, -2829, -5247, 1768, 12, 5721, -6835, 2073, 787, -13074, 2640,
+        1810, 3879, -5410, 136, -3799, -6217, 798, -958, 13274, -180, 5012, -1228,
+        -593, 4701, 842, 7955, -2198, 4321, 3244, -13466, 4010, 2957, 7091, -2198,
+        4321, -587, 329, 4010, -878, 13056, 6, 10537, 458, -2837, 4969, 772,
+        8158, 1789, 8308, 3400, 982, 7997, 6241, 9708, -2848, 6060, 4774, -388,
+        6627, 5797, 7866, -1423, 4123, 188, -2230, 4785, 3029, 18054, 4600, 9792,
+        3552, 4187, 9481, 5622, 11942, 1789, 8308, 7231, -9479, 7997, 6241, 11078,
+        1789, 8308, 3400, 4316, 7997, 3109, 14126, 1076, 11607, 1528, -1767, 6039,
+        1842, 5446, -923, 5596, 688, -1730, 5285, 3529, 6996, -5560, 3348, 2062,
+        -3100, 3915, 3085, 5154, -4135, 1411, -2524, -4942, 2073, 317, 17387, 3933,
+        9125, 1862, 3520, 8814, 3382, 9230, -923, 5596, 4519, -12191, 5285, 3529,
+        10906, 1617, 8136, 3228, 4144, 6671, 2937, 19173, 3555, 14086, 6453, 712,
+        8518, 4027, -2367, 9251, 15770, 10862, 8444, 15459, 13703, 5435, -7121, 1787,
+        501, -4661, 2354, 598, 13711, 4422, 10941, 6033, 3615, 10630, 8874, 15168,
+        1714, 6906, -6637, 2649, 6595, 6497, 950, -9203, -2684, -3761, -22277, -2995,
+        -4751, 10444, 1155, 7674, -619, 3682, 7363, 2475, 10393, -2657, 7874, -2205,
+        -3464, 2306, -6052, 6902, 12929, 19448, 14540, 12122, 19137, 17381, 5608, -6948,
+        1960, 674, -4488, 2527, 771, 13884, 4595, 11114, 6206, 3788, 10803, 9047,
+        17173, 3719, 8911, -1983, 4654, 8600, 8502, 1123, -9030, -2511, -3588, -22104,
+        -2822, -4578, 10617, 1328, 7847, -446, 3855, 7536, 2648, 11260, -1790, 8741,
+        -1338, -2597, 3173, -5185, 11858, 17885, 24404, 19496, 17078, 24093, 22337, 10564,
+        -1992, 6916, 5630, 468, 7483, 5727, 19838, 10549, 17068, 12160, 9742, 16757,
+        15001, 22129, 8675, 13867, 2973, 9610, 13556, 13458, 6079, -4074, 2445, 1368,
+        -17148, 2134, 378, 15573, 6284, 12803, 4510, 8811, 12492, 7604, 16665, 3615,
+        14146, 4067, 2808, 8578, 220, 6605, 12632, 19151, 14243, 11825, 18840, 17084,
+        5311, -7245, 1663, 377, -4785, 2230, 474, 13587, 4298, 10817, 5909, 3491,
+        10506, 8750, 17880, 4426, 9618, -4490, 5361, 9307, 8602, 826, -9327, -2808,
+        -3885, -22401, -3119, -4875, 11206, 1917, 8436, 143, 4444, 8125, 3237, 10963,
+        -2087, 8444, -3600, -2894, 2876, -6883, 6083, 12110, 18629, 13721, 11303, 18318,
+        16562, 4789, -7767, 1141, -145, -5850, 1708, -48, 13065, 3776, 10295, 5387,
+        2969, 9984, 8228, 16773, 3319, 8511, -2383, 4254, 8200, 8102, 304, -9849,
+        -3330, -4407, -22923, -3641, -4694, 9798, 509, 7028, -1265, 3036, 6717, 1829,
+        10847, -2203, 8328, -1751, -3010, 2760, -5598, 10070, 16097, 22616, 17708, 15290,
+        22305, 20549, 8776, -3780, 5128, 3842, -1320, 5695, 3939, 17052, 7763, 14282,
+        9374, 6956, 13971, 12215, 20341, 6887, 12079, 1185, 7822, 11768, 11670, 4291,
+        -5862, 657, -420, -18936, 346, -1410, 22120, 12831, 19350, 11057, 15358, 19039,
+        14151, 17193, 4143, 14674, 4595, 3336, 9106, 748, 7358, 13385, 19904, 14996,
+        12578, 19593, 17837, 6064, -6492, 2416, 1130, -4032, 2983, 1227, 14340, 5051,
+        11570, 6662, 4244, 11259, 9503, 20293, 6839, 12031, -852, 7774, 11720, 11622,
+        1579, -8574, -2055, -3132, -21648, -2366, -4122, 12594, 3305, 9824, 1531, 5832,
+        8359, 4625, 14393, -745, 9786, -293, -1552, 614, -4861, -414, 11204, 17723,
+        12815, 10397, 17412, 15656, 6480, -6076, 2832, 1546, -3616, 3399, 1643, 14756,
+        5467, 11986, 7078, 4660, 11675, 9919, 18045, 4591, 9783, -3760, 5526, 9472,
+        9374, 1995, -8158, -1639, -2716, -21232, -1950, -3706, 11489, 2200, 8719, 426,
+        4727, 8408, 3520, 11438, -1612, 8919, -1160, -2419, 3351, -5007, 7947, 13974,
+        20493, 15585, 13167, 20182, 18426, 7746, -4810, 4098, 2812, -2350, 4665, 2909,
+        14929, 5640, 12159, 7251, 4833, 11848, 10092, 18218, 4764, 9956, -938, 5699,
+        9645, 9547, 2168, -7985, -1466, -2543, -21059, -1777, -3533, 11662, 2373, 8892,
+        599, 4900, 8581, 3693, 12305, -745, 9786, -293, -1552, 4218, -4140, 12903,
+        18930, 25449, 20541, 18123, 25138, 23382, 11609, -947, 7961, 6675, 1513, 8528,
+        6772, 20883, 11594, 18113, 13205, 10787, 17802, 16046, 23174, 9720, 14912, 4018,
+        10655, 14601, 14503, 7124, -3029, 3490, 2413, -16103, 3179, 1423, 16618, 7329,
+        13848, 5555, 9856, 13537, 8649, 17710, 4660, 15191, 5112, 3853, 9623, 1265,
+        7650, 13677, 20196, 15288, 12870, 19885, 18129, 6356, -6200, 2708, 1422, -3740,
+        3275, 1519, 14632, 5343, 11862, 6954, 4536, 11551, 9795, 18925, 5471, 10663,
+        -3445, 6406, 10352, 9647, 1871, -8282, -1763, -2840, -21356, -2074, -3830, 12251,
+        2962, 9481, 1188, 5489, 9170, 4282, 12008, -1042, 9489, -2555, -1849, 3921,
+        -5838, 7128, 13155, 19674, 14766, 12348, 19363, 17607, 5834, -6722, 2186, 900,
+        -4805, 2753, 997, 14110, 4821, 11340, 6432, 4014, 11029, 9273, 17818, 4364,
+        9556, -1338, 5299, 9245, 9147, 1349, -8804, -2285, -3362, -21878, -2596, -3649,
+        10843, 1554, 8073, -220, 4081, 7762, 2874, 11892, -1158, 9373, -706, -1965,
+        3805, -4553, 11115, 17142, 23661, 18753, 16335, 23350, 21594, 9821, -2735, 6173,
+        4887, -275, 6740, 4984, 18097, 8808, 15327, 10419, 8001, 15016, 13260, 21386,
+        7932, 13124, 2230, 8867, 12813, 12715, 5336, -4817, 1702, 625, -17891, 1391,
+        -365, 23165, 13876, 20395, 12102, 16403, 20084, 15196, 17618, 4568, 15099, 5020,
+        3761, 9531, 1173, 8403, 14430, 20949, 16041, 13623, 20638, 18882, 7109, -5447,
+        3461, 2175, -2987, 4028, 2272, 15385, 6096, 12615, 7707, 5289, 12304, 10548,
+        21338, 7884, 13076, 193, 8819, 12765, 12667, 2624, -7529, -1010, -2087, -20603,
+        -1321, -3077, 13639, 4350, 10869, 2576, 6877, 9404, 5670, 15213, 75, 10606,
+        527, -732, 1434, -4041, -756, 10862, 17381, 12473, 10055, 17070, 15314, 6138,
+        -6418, 2490, 1204, -3958, 3057, 1301, 14414, 5125, 11644, 6736, 4318, 11333,
+        9577, 17703, 4249, 9441, -4102, 5184, 9130, 9032, 1653, -8500, -1981, -3058,
+        -21574, -2292, -4048, 11147, 1858, 8377, 84, 4385, 8066, 3178, 11096, -1954,
+        8577, -1502, -2761, 3009, -5349, 7605, 13632, 20151, 15243, 12825, 19840, 18084,
+        6311, -6245, 2663, 1377, -3785, 3230, 1474, 14587, 5298, 11817, 6909, 4491,
+        11506, 9750, 17876, 4422, 9614, -1280, 5357, 9303, 9205, 1826, -8327, -1808,
+        -2885, -21401, -2119, -3875, 11320, 2031, 8550, 257, 4558, 8239, 3351, 11963,
+        -1087, 9444, -635, -1894, 3876, -4482, 12561, 18588, 25107, 20199, 17781, 24796,
+        23040, 11267, -1289, 7619, 6333, 1171, 8186, 6430, 20541, 11252, 17771, 12863,
+        10445, 17460, 15704, 22832, 9378, 14570, 3676, 10313, 14259, 14161, 6782, -3371,
+        3148, 2071, -16445, 2837, 1081, 16276, 6987, 13506, 5213, 9514, 13195, 8307,
+        17368, 4318, 14849, 4770, 3511, 9281, 923, 7308, 13335, 19854, 14946, 12528,
+        19543, 17787, 6014, -6542, 2366, 1080, -4082, 2933, 1177, 14290, 5001, 11520,
+        6612, 4194, 11209, 9453, 18583, 5129, 10321, -3787, 6064, 10010, 9305, 1529,
+        -8624, -2105, -3182, -21698, -2416, -4172, 11909, 2620, 9139, 846, 5147, 8828,
+        3940, 11666, -1384, 9147, -2897, -2191, 3579, -6180, 6786, 12813, 19332, 14424,
+        12006, 19021, 17265, 5492, -7064, 1844, 558, -5147, 2411, 655, 13768, 4479,
+        10998, 6090, 3672, 10687, 8931, 17476, 4022, 9214, -1680, 4957, 8903, 8805,
+        1007, -9146, -2627, -3704, -22220, -2938, -3991, 10501, 1212, 7731, -562, 3739,
+        7420, 2532, 11550, -1500, 9031, -1048, -2307, 3463, -4895, 10773, 16800, 23319,
+        18411, 15993, 23008, 21252, 9479, -3077, 5831, 4545, -617, 6398, 4642, 17755,
+        8466, 14985, 10077, 7659, 14674, 12918, 21044, 7590, 12782, 1888, 8525, 12471,
+        12373, 4994, -5159, 1360, 283, -18233, 1049, -707, 22823, 13534, 20053, 11760,
+        16061, 19742, 14854, 17276, 4226, 14757, 4678, 3419, 9189, 831, 8061, 14088,
+        20607, 15699, 13281, 20296, 18540, 6767, -5789, 3119, 1833, -3329, 3686, 1930,
+        15043, 5754, 12273, 7365, 4947, 11962, 10206, 20996, 7542, 12734, -149, 8477,
+        12423, 12325, 2282, -7871, -1352, -2429, -20945, -1663, -3419, 13297, 4008, 10527,
+        2234, 6535, 9062, 5328, 14127, -1011, 9520, -559, -1818, 348, -5127, -910,
+        10708, 17227, 12319, 9901, 16916, 15160, 5984, -6572, 2336, 1050, -4112, 2903,
+        1147, 14260, 4971, 11490, 6582, 4164, 11179, 9423, 16534, 3080, 8272, -5271,
+        4015, 7961, 7863, 1499, -8654, -2135, -3212, -21728, -2446, -4202, 11460, 2171,
+        8690, 397, 4698, 8379, 3491, 10800, -2250, 8281, -1798, -3057, 2713, -5645,
+        7451, 13478, 19997, 15089, 12671, 19686, 17930, 6157, -6399, 2509, 1223, -3939,
+        3076, 1320, 14433, 5144, 11663, 6755, 4337, 11352, 9596, 17722, 4268, 9460,
+        -1434, 5203, 9149, 9051, 1672, -8481, -1962, -3039, -21555, -2273, -4029, 11166,
+        1877, 8396, 103, 4404, 8085, 3197, 11809, -1241, 9290, -789, -2048, 3722,
+        -4636, 12407, 18434, 24953, 20045, 17627, 24642, 22886, 11113, -1443, 7465, 6179,
+        1017, 8032, 6276, 20387, 11098, 17617, 12709, 10291, 17306, 15550, 22678, 9224,
+        14416, 3522, 10159, 14105, 14007, 6628, -3525, 2994, 1917, -16599, 2683, 927,
+        16122, 6833, 13352, 5059, 9360, 13041, 8153, 17214, 4164, 14695, 4616, 3357,
+        9127, 769, 7154, 13181, 19700, 14792, 12374, 19389, 17633, 5860, -6696, 2212,
+        926, -4236, 2779, 1023, 14136, 4847, 11366, 6458, 4040, 11055, 9299, 19919,
+        6465, 11657, -2451, 7400, 11346, 10641, 1375, -8778, -2259, -3336, -21852, -2570,
+        -4326, 11755, 2466, 8985, 692, 4993, 8674, 3786, 11396, -1654, 8877, -3167,
+        -2461, 3309, -6450, 6632, 12659, 19178, 14270, 11852, 18867, 17111, 5338, -7218,
+        1690, 404, -5301, 2257, 501, 13614, 4325, 10844, 5936, 3518, 10533, 8777,
+        17322, 3868, 9060, -1834, 4803, 8749, 8651, 853, -9300, -2781, -3858, -22374,
+        -3092, -4145, 10347, 1058, 7577, -716, 3585, 7266, 2378, 11396, -1654, 8877,
+        -1202, -2461, 3309, -5049, 10619, 16646, 23165, 18257, 15839, 22854, 21098, 9325,
+        -3231, 5677, 4391, -771, 6244, 4488, 17601, 8312, 14831, 9923, 7505, 14520,
+        12764, 20890, 7436, 12628, 1734, 8371, 12317, 12219, 4840, -5313, 1206, 129,
+        -18387, 895, -861, 22669, 13380, 19899, 11606, 15907, 19588, 14700, 17122, 4072,
+        14603, 4524, 3265, 9035, 677, 7907, 13934, 20453, 15545, 13127, 20142, 18386,
+        6613, -5943, 2965, 1679, -3483, 3532, 1776, 14889, 5600, 12119, 7211, 4793,
+        11808, 10052, 22011, 8557, 13749, 866, 9492, 13438, 13340, 2128, -8025, -1506,
+        -2583, -21099, -1817, -3573, 13143, 3854, 10373, 2080, 6381, 8908, 5174, 14777,
+        -361, 10170, 91, -1168, 998, -4477, -904, 10714, 17233, 12325, 9907, 16922,
+        15166, 5990, -6566, 2342, 1056, -4106, 2909, 1153, 14266, 4977, 11496, 6588,
+        4170, 11185, 9429, 17555, 4101, 9293, -4250, 5036, 8982, 8884, 1505, -8648,
+        -2129, -3206, -21722, -2440, -4196, 10999, 1710, 8229, -64, 4237, 7918, 3030,
+        10948, -2102, 8429, -1650, -2909, 2861, -5497, 7457, 13484, 20003, 15095, 12677,
+        19692, 17936, 6163, -6393, 2515, 1229, -3933, 3082, 1326, 14439, 5150, 11669,
+        6761, 4343, 11358, 9602, 17728, 4274, 9466, -1428, 5209, 9155, 9057, 1678,
+        -8475, -1956, -3033, -21549, -2267, -4023, 11172, 1883, 8402, 109, 4410, 8091,
+        3203, 11815, -1235, 9296, -783, -2042, 3728, -4630, 12413, 18440, 24959, 20051,
+        17633, 24648, 22892, 11119, -1437, 7471, 6185, 1023, 8038, 6282, 20393, 11104,
+        17623, 12715, 10297, 17312, 15556, 22684, 9230, 14422, 3528, 10165, 14111, 14013,
+        6634, -3519, 3000, 1923, -16593, 2689, 933, 16128, 6839, 13358, 5065, 9366,
+        13047, 8159, 17220, 4170, 14701, 4622, 3363, 9133, 775, 7160, 13187, 19706,
+        14798, 12380, 19395, 17639, 5866, -6690, 2218, 932, -4230, 2785, 1029, 14142,
+        4853, 11372, 6464, 4046, 11061, 9305, 18435, 4981, 10173, -3935, 5916, 9862,
+        9157, 1381, -8772, -2253, -3330, -21846, -2564, -4320, 11761, 2472, 8991, 698,
+        4999, 8680, 3792, 11518, -1532, 8999, -3045, -2339, 3431, -6328, 6638, 12665,
+        19184, 14276, 11858, 18873, 17117, 5344, -7212, 1696, 410, -5295, 2263, 507,
+        13620, 4331, 10850, 5942, 3524, 10539, 8783, 17328, 3874, 9066, -1828, 4809,
+        8755, 8657, 859, -9294, -2775, -3852, -22368, -3086, -4139, 10353, 1064, 7583,
+        -710, 3591, 7272, 2384, 11402, -1648, 8883, -1196, -2455, 3315, -5043, 10625,
+        16652, 23171, 18263, 15845, 22860, 21104, 9331, -3225, 5683, 4397, -765, 6250,
+        4494, 17607, 8318, 14837, 9929, 7511, 14526, 12770, 20896, 7442, 12634, 1740,
+        8377, 12323, 12225, 4846, -5307, 1212, 135, -18381, 901, -855, 22675, 13386,
+        19905, 11612, 15913, 19594, 14706, 17128, 4078, 14609, 4530, 3271, 9041, 683,
+        7913, 13940, 20459, 15551, 13133, 20148, 18392, 6619, -5937, 2971, 1685, -3477,
+        3538, 1782, 14895, 5606, 12125, 7217, 4799, 11814, 10058, 20848, 7394, 12586,
+        -297, 8329, 12275, 12177, 2134, -8019, -1500, -2577, -21093, -1811, -3567, 13149,
+        3860, 10379, 2086, 6387, 8914, 5180, 14723, -415, 10116, 37, -1222, 944,
+        -4531, -253, 11365, 17884, 12976, 10558, 17573, 15817, 6641, -5915, 2993, 1707,
+        -3455, 3560, 1804, 14917, 5628, 12147, 7239, 4821, 11836, 10080, 18206, 4752,
+        9944, -3599, 5687, 9633, 9535, 2156, -7997, -1478, -2555, -21071, -1789, -3545,
+        11650, 2361, 8880, 587, 4888, 8569, 3681, 11599, -1451, 9080, -999, -2258,
+        3512, -4846, 8108, 14135, 20654, 15746, 13328, 20343, 18587, 6814, -5742, 3166,
+        1880, -3282, 3733, 1977, 15090, 5801, 12320, 7412, 4994, 12009, 10253, 18379,
+        4925, 10117, -777, 5860, 9806, 9708, 2329, -7824, -1305, -2382, -20898, -1616,
+        -3372, 11823, 2534, 9053, 760, 5061, 8742, 3854, 12466, -584, 9947, -132,
+        -1391, 4379, -3979, 13064, 19091, 25610, 20702, 18284, 25299, 23543, 11770, -786,
+        8122, 6836, 1674, 8689, 6933, 21044, 11755, 18274, 13366, 10948, 17963, 16207,
+        23335, 9881, 15073, 4179, 10816, 14762, 14664, 7285, -2868, 3651, 2574, -15942,
+        3340, 1584, 16779, 7490, 14009, 5716, 10017, 13698, 8810, 17871, 4821, 15352,
+        5273, 4014, 9784, 1426, 7811, 13838, 20357, 15449, 13031, 20046, 18290, 6517,
+        -6039, 2869, 1583, -3579, 3436, 1680, 14793, 5504, 12023, 7115, 4697, 11712,
+        9956, 19086, 5632, 10824, -3284, 6567, 10513, 9808, 2032, -8121, -1602, -2679,
+        -21195, -1913, -3669, 12412, 3123, 9642, 1349, 5650, 9331, 4443, 12169, -881,
+        9650, -2394, -1688, 4082, -5677, 7289, 13316, 19835, 14927, 12509, 19524, 17768,
+        5995, -6561, 2347, 1061, -4644, 2914, 1158, 14271, 4982, 11501, 6593, 4175,
+        11190, 9434, 17979, 4525, 9717, -1177, 5460, 9406, 9308, 1510, -8643, -2124,
+        -3201, -21717, -2435, -3488, 11004, 1715, 8234, -59, 4242, 7923, 3035, 12053,
+        -997, 9534, -545, -1804, 3966, -4392, 11276, 17303, 23822, 18914, 16496, 23511,
+        21755, 9982, -2574, 6334, 5048, -114, 6901, 5145, 18258, 8969, 15488, 10580,
+        8162, 15177, 13421, 21547, 8093, 13285, 2391, 9028, 12974, 12876, 5497, -4656,
+        1863, 786, -17730, 1552, -204, 23326, 14037, 20556, 12263, 16564, 20245, 15357,
+        17966, 4916, 15447, 5368, 4109, 9879, 1521, 8564, 14591, 21110, 16202, 13784,
+        20799, 19043, 7270, -5286, 3622, 2336, -2826, 4189, 2433, 15546, 6257, 12776,
+        7868, 5450, 12465, 10709, 20636, 7182, 12374, -509, 8117, 12063, 11965, 2785,
+        -7368, -849, -1926, -20442, -1160, -2916, 13336, 4047, 10566, 2273, 6574, 9101,
+        5367, 15374, 236, 10767, 688, -571, 1595, -3880, -877, 10741, 17260, 12352,
+        9934, 16949, 15193, 6017, -6539, 2369, 1083, -4079, 2936, 1180, 14293, 5004,
+        11523, 6615, 4197, 11212, 9456, 17582, 4128, 9320, -4223, 5063, 9009, 8911,
+        1532, -8621, -2102, -3179, -21695, -2413, -4169, 10695, 1406, 7925, -368, 3933,
+        7614, 2726, 10585, -2465, 8066, -2013, -3272, 2498, -5860, 7484, 13511, 20030,
+        15122, 12704, 19719, 17963, 6190, -6366, 2542, 1256, -3906, 3109, 1353, 14466,
+        5177, 11696, 6788, 4370, 11385, 9629, 17755, 4301, 9493, -1401, 5236, 9182,
+        9084, 1705, -8448, -1929, -3006, -21522, -2240, -3996, 11199, 1910, 8429, 136,
+        4437, 8118, 3230, 11842, -1208, 9323, -756, -2015, 3755, -4603, 12440, 18467,
+        24986, 20078, 17660, 24675, 22919, 11146, -1410, 7498, 6212, 1050, 8065, 6309,
+        20420, 11131, 17650, 12742, 10324, 17339, 15583, 22711, 9257, 14449, 3555, 10192,
+        14138, 14040, 6661, -3492, 3027, 1950, -16566, 2716, 960, 16155, 6866, 13385,
+        5092, 9393, 13074, 8186, 17247, 4197, 14728, 4649, 3390, 9160, 802, 7187,
+        13214, 19733, 14825, 12407, 19422, 17666, 5893, -6663, 2245, 959, -4203, 2812,
+        1056, 14169, 4880, 11399, 6491, 4073, 11088, 9332, 18956, 5502, 10694, -3414,
+        6437, 10383, 9678, 1408, -8745, -2226, -3303, -21819, -2537, -4293, 11788, 2499,
+        9018, 725, 5026, 8707, 3819, 11635, -1415, 9116, -2928, -2222, 3548, -6211,
+        6665, 12692, 19211, 14303, 11885, 18900, 17144, 5371, -7185, 1723, 437, -5268,
+        2290, 534, 13647, 4358, 10877, 5969, 3551, 10566, 8810, 17355, 3901, 9093,
+        -1801, 4836, 8782, 8684, 886, -9267, -2748, -3825, -22341, -3059, -4112, 10380,
+        1091, 7610, -683, 3618, 7299, 2411, 11429, -1621, 8910, -1169, -2428, 3342,
+        -5016, 10652, 16679, 23198, 18290, 15872, 22887, 21131, 9358, -3198, 5710, 4424,
+        -738, 6277, 4521, 17634, 8345, 14864, 9956, 7538, 14553, 12797, 20923, 7469,
+        12661, 1767, 8404, 12350, 12252, 4873, -5280, 1239, 162, -18354, 928, -828,
+        22702, 13413, 19932, 11639, 15940, 19621, 14733, 17155, 4105, 14636, 4557, 3298,
+        9068, 710, 7940, 13967, 20486, 15578, 13160, 20175, 18419, 6646, -5910, 2998,
+        1712, -3450, 3565, 1809, 14922, 5633, 12152, 7244, 4826, 11841, 10085, 21191,
+        7737, 12929, 46, 8672, 12618, 12520, 2161, -7992, -1473, -2550, -21066, -1784,
+        -3540, 12683, 3394, 9913, 1620, 5921, 8448, 4714, 16030, 892, 11423, 1344,
+        85, 2251, -3224
+      };
+
+      constexpr Weight TAIL_SCORES[] = {
+        -1218, -831, -831, -1084, -744, -584, -1337, -2039, -1652, -1652, -1905, -1565,
+        -1405, -2158, -387, 0, 0, -253, 87, 247, -506, -1625, -1238, -1238,
+        -1491, -1151, -991, -1744, -1186, -799, -799, -1052, -712, -552, -1305, 152,
+        539, 539, 286, 626, 786, 33, 192, 579, 579, 326, 666, 826,
+        73, -1218, -831, -831, -1084, -744, -584, -1337, -387, 0, 0, -253,
+        87, 247, -506, -387, 0, 0, -253, 87, 247, -506, -1625, -1238,
+        -1238, -1491, -1151, -991, -1744, -1186, -799, -799, -1052, -712, -552, -1305,
+        152, 539, 539, 286, 626, 786, 33, -74, 313, 313, 60, 400,
+        560, -193, -1218, -831, -831, -1084, -744, -584, -1337, -387, 0, 0,
+        -253, 87, 247, -506, -387, 0, 0, -253, 87, 247, -506, -1625,
+        -1238, -1238, -1491, -1151, -991, -1744, -1186, -799, -799, -1052, -712, -552,
+        -1305, 152, 539, 539, 286, 626, 786, 33, -74, 313, 313, 60,
+        400, 560, -193, -1164, -831, -831, -1084, -744, -584, -1337, -387, 0,
+        0, -253, 87, 247, -506, -387, 0, 0, -253, 87, 247, -506,
+        -969, -1238, -1238, 6, -1151, -991, -1423, -1186, -799, -799, -1052, -712,
+        -552, -1305, 152, 539, 539, 286, 626, 786, 33, -2699, 12, 12,
+        -241, 99, 259, 201, -1218, -831, -831, -1084, -744, -584, -1337, -387,
+        0, 0, -253, 4932, 247, -506, -387, 0, 0, -253, 87, 247,
+        -506, -1625, -1238, -1238, -1491, -1151, -991, -1744, 1576, 5349, 1963, 1710,
+        5115, 2210, 1457, 152, 539, 539, 286, 626, 786, 33, -74, 313,
+        313, 60, 400, 560, -193, -1218, -831, -831, -1084, -744, 257, -1337,
+        -387, 0, 0, -253, 87, 247, -506, -387, 0, 0, -253, 87,
+        247, -506, -1625, -1238, -1238, -1491, -1151, -991, -1744, -107, 280, 280,
+        27, 367, 527, -226, 4186, 4573, 4573, 4320, 4660, 5481, 3826, -74,
+        313, 313, 261, 400, 560, -598, -5447, -5060, -5060, -5313, -4973, -4813,
+        -5120, -387, 0, 0, -253, 87, 247, -506, -1694, -1307, -1307, -1560,
+        -1220, -1060, -1813, -999, -612, -612, -186, -525, -365, -314, -1907, -1520,
+        -1520, -1773, -1433, -1273, -2026, 152, 539, 539, 286, 626, 786, 33,
+        1591, 1309, 1491, 2400, 1761, 1434, 600, -1218, -831, -831, -1084, -744,
+        -584, -1337, -2039, -1652, -1652, -1905, -1565, -1405, -2158, -387, 0, 0,
+        -253, 87, 247, -506, -1625, -1238, -1238, -1491, -1151, -991, -1744, -1186,
+        -799, -799, -1052, -712, -552, -1305, 152, 539, 539, 286, 626, 786,
+        33, 192, 579, 579, 326, 666, 826, 73, -1218, -831, -831, -1084,
+        -744, -584, -1337, -681, -294, -294, -547, -207, -47, -800, -387, 0,
+        0, -253, 87, 247, -506, -1625, -1238, -1238, -1491, -1151, -991, -1744,
+        -1186, -799, -799, -1052, -712, -552, -1305, 152, 539, 539, 286, 626,
+        786, 33, -74, 313, 313, 60, 400, 560, -193, -1218, -831, -831,
+        -1084, -744, -584, -1337, -387, 0, 0, -253, 87, 247, -506, -387,
+        0, 0, -253, 87, 247, -506, -1625, -1238, -1238, -1491, -1151, -991,
+        -1744, -1186, -799, -799, -1052, -712, -552, -1305, 152, 539, 539, 286,
+        626, 786, 33, -74, 313, 313, 60, 400, 560, -193, -1164, -831,
+        -831, -1084, -744, -584, -1337, -387, 0, 0, -253, 87, 247, -506,
+        -387, 0, 0, -253, 87, 247, -506, -969, -1238, -1238, 6, -1151,
+        -991, -1423, -1186, -799, -799, -1052, -712, -552, -1305, 152, 539, 539,
+        286, 626, 786, 33, -2699, 12, 12, -241, 99, 259, 201, -1218,
+        -831, -831, -1084, -744, -584, -1337, -387, 0, 0, -253, 4932, 247,
+        -506, -387, 0, 0, -253, 87, 247, -506, -1625, -1238, -1238, -1491,
+        -1151, -991, -1744, 1576, 5349, 1963, 1710, 5115, 2210, 1457, 152, 539,
+        539, 286, 626, 786, 33, -74, 313, 313, 60, 400, 560, -193,
+        -1218, -831, -831, -1084, -744, 257, -1337, -387, 0, 0, -253, 87,
+        247, -506, -387, 0, 0, -253, 87, 247, -506, -1625, -1238, -1238,
+        -1491, -1151, -991, -1744, -107, 280, 280, 27, 367, 527, -226, 4186,
+        4573, 4573, 4320, 4660, 5481, 3826, -74, 313, 313, 261, 400, 560,
+        -598, -2054, -1667, -1667, -1920, -1580, -1420, -1727, -387, 0, 0, -253,
+        87, 247, -506, -1694, -1307, -1307, -1560, -1220, -1060, -1813, -999, -612,
+        -612, -186, -525, -365, -314, -1907, -1520, -1520, -1773, -1433, -1273, -2026,
+        152, 539, 539, 286, 626, 786, 33, 1591, 1309, 1491, 2400, 1761,
+        1434, 600, -1218, -831, -831, -1084, -744, -584, -1337, -2039, -1652, -1652,
+        -1905, -1565, -1405, -2158, -387, 0, 0, -253, 87, 247, -506, -1625,
+        -1238, -1238, -1491, -1151, -991, -1744, -1186, -799, -799, -1052, -712, -552,
+        -1305, 152, 539, 539, 286, 626, 786, 33, 192, 579, 579, 326,
+        666, 826, 73, -1218, -831, -831, -1084, -744, -584, -1337, -387, 0,
+        0, -253, 87, 247, -506, -387, 0, 0, -253, 87, 247, -506,
+        -1625, -1238, -1238, -1491, -1151, -991, -1744, -1186, -799, -799, -1052, -712,
+        -552, -1305, 152, 539, 539, 286, 626, 786, 33, -74, 313, 313,
+        60, 400, 560, -193, -556, -169, -169, -422, -82, 78, -675, -387,
+        0, 0, -253, 87, 247, -506, -387, 0, 0, -253, 87, 247,
+        -506, -1625, -1238, -1238, -1491, -1151, -991, -1744, -1186, -799, -799, -1052,
+        -712, -552, -1305, 152, 539, 539, 286, 626, 786, 33, -1763, -1376,
+        -1376, -1629, -1289, -1129, -1882, -1164, -831, -831, -1084, -744, -584, -1337,
+        -387, 0, 0, -253, 87, 247, -506, -387, 0, 0, -253, 87,
+        247, -506, -969, -1238, -1238, 6, -1151, -991, -1423, -1186, -799, -799,
+        -1052, -712, -552, -1305, 152, 539, 539, 286, 626, 786, 33, -2699,
+        12, 12, -241, 99, 259, 201, -1218, -831, -831, -1084, -744, -584,
+        -1337, -387, 0, 0, -253, 4932, 247, -506, -387, 0, 0, -253,
+        87, 247, -506, -1625, -1238, -1238, -1491, -1151, -991, -1744, 1576, 5349,
+        1963, 1710, 5115, 2210, 1457, 152, 539, 539, 286, 626, 786, 33,
+        -74, 313, 313, 60, 400, 560, -193, -1218, -831, -831, -1084, -744,
+        257, -1337, -387, 0, 0, -253, 87, 247, -506, -387, 0, 0,
+        -253, 87, 247, -506, -1625, -1238, -1238, -1491, -1151, -991, -1744, -107,
+        280, 280, 27, 367, 527, -226, 4186, 4573, 4573, 4320, 4660, 5481,
+        3826, -74, 313, 313, 261, 400, 560, -598, -2054, -1667, -1667, -1920,
+        -1580, -1420, -1727, -387, 0, 0, -253, 87, 247, -506, -1694, -1307,
+        -1307, -1560, -1220, -1060, -1813, -999, -612, -612, -186, -525, -365, -314,
+        -1907, -1520, -1520, -1773, -1433, -1273, -2026, 152, 539, 539, 286, 626,
+        786, 33, 1591, 1309, 1491, 2400, 1761, 1434, 600, -1218, -831, -831,
+        -1084, -744, -584, -1337, -2039, -1652, -1652, -1905, -1565, -1405, -2158, -387,
+        0, 0, -253, 87, 247, -506, -2167, -1780, -1780, -2033, -1693, -1533,
+        -2286, -1186, -799, -799, -1052, -712, -552, -1305, 152, 539, 539, 286,
+        626, 786, 33, 192, 579, 579, 326, 666, 826, 73, -1218, -831,
+        -831, -1084, -744, -584, -1337, -387, 0, 0, -253, 87, 247, -506,
+        -387, 0, 0, -253, 87, 247, -506, -1625, -1238, -1238, -1491, -1151,
+        -991, -1744, -1186, -799, -799, -1052, -712, -552, -1305, 152, 539, 539,
+        286, 626, 786, 33, -74, 313, 313, 60, 400, 560, -193, -1218,
+        -831, -831, -1084, -744, -584, -1337, -387, 0, 0, -253, 87, 247,
+        -506, -387, 0, 0, -253, 87, 247, -506, -1625, -1238, -1238, -1491,
+        -1151, -991, -1744, -1186, -799, -799, -1052, -712, -552, -1305, 152, 539,
+        539, 286, 626, 786, 33, -74, 313, 313, 60, 400, 560, -193,
+        -1164, -831, -831, -1084, -744, -584, -1337, -387, 0, 0, -253, 87,
+        247, -506, -387, 0, 0, -253, 87, 247, -506, -969, -1238, -1238,
+        6, -1151, -991, -1423, -1186, -799, -799, -1052, -712, -552, -1305, -883,
+        -496, -496, -749, -409, -249, -1002, -3524, -813, -813, -1066, -726, -566,
+        -624, -1218, -831, -831, -1084, -744, -584, -1337, -387, 0, 0, -253,
+        4932, 247, -506, -387, 0, 0, -253, 87, 247, -506, -1625, -1238,
+        -1238, -1491, -1151, -991, -1744, 1576, 5349, 1963, 1710, 5115, 2210, 1457,
+        152, 539, 539, 286, 626, 786, 33, -74, 313, 313, 60, 400,
+        560, -193, -1218, -831, -831, -1084, -744, 257, -1337, -387, 0, 0,
+        -253, 87, 247, -506, -387, 0, 0, -253, 87, 247, -506, -1625,
+        -1238, -1238, -1491, -1151, -991, -1744, -107, 280, 280, 27, 367, 527,
+        -226, 4186, 4573, 4573, 4320, 4660, 5481, 3826, -74, 313, 313, 261,
+        400, 560, -598, -3989, -3602, -3602, -3855, -3515, -3355, -3662, -387, 0,
+        0, -253, 87, 247, -506, -1694, -1307, -1307, -1560, -1220, -1060, -1813,
+        -4040, -3653, -3653, -3227, -3566, -3406, -3355, -1907, -1520, -1520, -1773, -1433,
+        -1273, -2026, 152, 539, 539, 286, 626, 786, 33, 1719, 1437, 1619,
+        2528, 1889, 1562, 728, -1218, -831, -831, -1084, -744, -584, -1337, -2039,
+        -1652, -1652, -1905, -1565, -1405, -2158, -387, 0, 0, -253, 87, 247,
+        -506, -1625, -1238, -1238, -1491, -1151, -991, -1744, -2195, -1808, -1808, -2061,
+        -1721, -1561, -2314, 152, 539, 539, 286, 626, 786, 33, 192, 579,
+        579, 326, 666, 826, 73, -1218, -831, -831, -1084, -744, -584, -1337,
+        -387, 0, 0, -253, 87, 247, -506, -387, 0, 0, -253, 87,
+        247, -506, -1625, -1238, -1238, -1491, -1151, -991, -1744, -1186, -799, -799,
+        -1052, -712, -552, -1305, 152, 539, 539, 286, 626, 786, 33, -74,
+        313, 313, 60, 400, 560, -193, -1218, -831, -831, -1084, -744, -584,
+        -1337, -387, 0, 0, -253, 87, 247, -506, -387, 0, 0, -253,
+        87, 247, -506, -1625, -1238, -1238, -1491, -1151, -991, -1744, -1186, -799,
+        -799, -1052, -712, -552, -1305, 152, 539, 539, 286, 626, 786, 33,
+        -74, 313, 313, 60, 400, 560, -193, -1164, -831, -831, -1084, -744,
+        -584, -1337, -387, 0, 0, -253, 87, 247, -506, -387, 0, 0,
+        -253, 87, 247, -506, -969, -1238, -1238, 6, -1151, -991, -1423, -1186,
+        -799, -799, -1052, -712, -552, -1305, 152, 539, 539, 286, 626, 786,
+        33, -2699, 12, 12, -241, 99, 259, 201, -1218, -831, -831, -1084,
+        -744, -584, -1337, 104, 491, 491, 238, 5423, 738, -15, -387, 0,
+        0, -253, 87, 247, -506, -1625, -1238, -1238, -1491, -1151, -991, -1744,
+        1576, 5349, 1963, 1710, 5115, 2210, 1457, 152, 539, 539, 286, 626,
+        786, 33, -1291, -904, -904, -1157, -817, -657, -1410, -1218, -831, -831,
+        -1084, -744, 257, -1337, -387, 0, 0, -253, 87, 247, -506, -387,
+        0, 0, -253, 87, 247, -506, -1625, -1238, -1238, -1491, -1151, -991,
+        -1744, -107, 280, 280, 27, 367, 527, -226, 4186, 4573, 4573, 4320,
+        4660, 5481, 3826, -74, 313, 313, 261, 400, 560, -598, -2054, -1667,
+        -1667, -1920, -1580, -1420, -1727, -387, 0, 0, -253, 87, 247, -506,
+        -1694, -1307, -1307, -1560, -1220, -1060, -1813, -999, -612, -612, -186, -525,
+        -365, -314, -1907, -1520, -1520, -1773, -1433, -1273, -2026, 152, 539, 539,
+        286, 626, 786, 33, 375, 93, 275, 1184, 545, 218, -616, -1218,
+        -831, -831, -1084, -744, -584, -1337, -2039, -1652, -1652, -1905, -1565, -1405,
+        -2158, -387, 0, 0, -253, 87, 247, -506, -1625, -1238, -1238, -1491,
+        -1151, -991, -1744, -1186, -799, -799, -1052, -712, -552, -1305, 152, 539,
+        539, 286, 626, 786, 33, 192, 579, 579, 326, 666, 826, 73,
+        -1218, -831, -831, -1084, -744, -584, -1337, -387, 0, 0, -253, 87,
+        247, -506, -387, 0, 0, -253, 87, 247, -506, -1625, -1238, -1238,
+        -1491, -1151, -991, -1744, -1186, -799, -799, -1052, -712, -552, -1305, 152,
+        539, 539, 286, 626, 786, 33, -74, 313, 313, 60, 400, 560,
+        -193, -1218, -831, -831, -1084, -744, -584, -1337, -387, 0, 0, -253,
+        87, 247, -506, -387, 0, 0, -253, 87, 247, -506, -1625, -1238,
+        -1238, -1491, -1151, -991, -1744, -1186, -799, -799, -1052, -712, -552, -1305,
+        152, 539, 539, 286, 626, 786, 33, -74, 313, 313, 60, 400,
+        560, -193, -1164, -831, -831, -1084, -744, -584, -1337, -387, 0, 0,
+        -253, 87, 247, -506, -387, 0, 0, -253, 87, 247, -506, -969,
+        -1238, -1238, 6, -1151, -991, -1423, -1186, -799, -799, -1052, -712, -552,
+        -1305, 152, 539, 539, 286, 626, 786, 33, -2699, 12, 12, -241,
+        99, 259, 201, -1218, -831, -831, -1084, -744, -584, -1337, -387, 0,
+        0, -253, 4932, 247, -506, -387, 0, 0, -253, 87, 247, -506,
+        -1625, -1238, -1238, -1491, -1151, -991, -1744, 1576, 5349, 1963, 1710, 5115,
+        2210, 1457, 152, 539, 539, 286, 626, 786, 33, -74, 313, 313,
+        60, 400, 560, -193, -1218, -831, -831, -1084, -744, 257, -1337, -387,
+        0, 0, -253, 87, 247, -506, -387, 0, 0, -253, 87, 247,
+        -506, -1625, -1238, -1238, -1491, -1151, -991, -1744, -107, 280, 280, 27,
+        367, 527, -226, 4186, 4573, 4573, 4320, 4660, 5481, 3826, -545, -158,
+        -158, -210, -71, 89, -1069, -1931, -1544, -1544, -1797, -1457, -1297, -1604,
+        -387, 0, 0, -253, 87, 247, -506, -1694, -1307, -1307, -1560, -1220,
+        -1060, -1813, -999, -612, -612, -186, -525, -365, -314, -1907, -1520, -1520,
+        -1773, -1433, -1273, -2026, -305, 82, 82, -171, 169, 329, -424, -1103,
+        -1385, -1203, -294, -933, -1260, -2094, -1218, -831, -831, -1084, -744, -584,
+        -1337, -2039, -1652, -1652, -1905, -1565, -1405, -2158, -387, 0, 0, -253,
+        87, 247, -506, -1625, -1238, -1238, -1491, -1151, -991, -1744, -1186, -799,
+        -799, -1052, -712, -552, -1305, 152, 539, 539, 286, 626, 786, 33,
+        -1294, -907, -907, -1160, -820, -660, -1413, -1218, -831, -831, -1084, -744,
+        -584, -1337, -387, 0, 0, -253, 87, 247, -506, -387, 0, 0,
+        -253, 87, 247, -506, -1625, -1238, -1238, -1491, -1151, -991, -1744, -1186,
+        -799, -799, -1052, -712, -552, -1305, 152, 539, 539, 286, 626, 786,
+        33, -74, 313, 313, 60, 400, 560, -193, -1218, -831, -831, -1084,
+        -744, -584, -1337, -387, 0, 0, -253, 87, 247, -506, -387, 0,
+        0, -253, 87, 247, -506, -1625, -1238, -1238, -1491, -1151, -991, -1744,
+        -1186, -799, -799, -1052, -712, -552, -1305, 152, 539, 539, 286, 626,
+        786, 33, -74, 313, 313, 60, 400, 560, -193, -1164, -831, -831,
+        -1084, -744, -584, -1337, -387, 0, 0, -253, 87, 247, -506, -387,
+        0, 0, -253, 87, 247, -506, -2057, -2326, -2326, -1082, -2239, -2079,
+        -2511, -455, -68, -68, -321, 19, 179, -574, 152, 539, 539, 286,
+        626, 786, 33, -2699, 12, 12, -241, 99, 259, 201, -1218, -831,
+        -831, -1084, -744, -584, -1337, -387, 0, 0, -253, 4932, 247, -506,
+        -387, 0, 0, -253, 87, 247, -506, -1625, -1238, -1238, -1491, -1151,
+        -991, -1744, 1576, 5349, 1963, 1710, 5115, 2210, 1457, 152, 539, 539,
+        286, 626, 786, 33, -74, 313, 313, 60, 400, 560, -193, -1218,
+        -831, -831, -1084, -744, 257, -1337, -387, 0, 0, -253, 87, 247,
+        -506, -387, 0, 0, -253, 87, 247, -506, -1625, -1238, -1238, -1491,
+        -1151, -991, -1744, -107, 280, 280, 27, 367, 527, -226, 4186, 4573,
+        4573, 4320, 4660, 5481, 3826, -74, 313, 313, 261, 400, 560, -598,
+        -2054, -1667, -1667, -1920, -1580, -1420, -1727, -387, 0, 0, -253, 87,
+        247, -506, -1694, -1307, -1307, -1560, -1220, -1060, -1813, -1340, -953, -953,
+        -527, -866, -706, -655, -1907, -1520, -1520, -1773, -1433, -1273, -2026, 152,
+        539, 539, 286, 626, 786, 33, 1937, 1655, 1837, 2746, 2107, 1780,
+        946
+      };
+
+      constexpr uint32_t WORD_SEEDS[] = {
+        0, 30, 0, 0, 0, 0, 3, 63, 2, 104, 6, 19,
+        27, 6, 1, 14, 20, 8, 0, 37, 12, 202, 0, 8,
+        1, 75, 46, 0, 5, 37, 2, 0, 131, 174, 8, 345,
+        52, 12, 50, 0, 128, 79, 12, 24, 41, 84, 0, 34,
+        252, 54, 13, 62, 3, 244, 1, 79, 237, 1, 0, 18,
+        13, 26, 4, 9, 372, 277, 26, 0, 65, 28, 309, 0,
+        32, 2, 73, 97, 26, 35, 4, 0, 14, 12, 59, 163,
+        112, 20, 2, 8, 50, 98, 18, 68, 0, 23, 17, 55,
+        37, 130, 1, 18, 2, 0, 471, 22, 161, 2, 29, 22,
+        24, 311, 125, 12, 17, 64, 27, 71, 102, 557, 0, 9,
+        26, 16, 8, 26, 22, 0, 12, 272, 47, 6, 278, 2,
+        118, 0, 74, 210, 163, 6, 0, 684, 2, 65, 294, 536,
+        11, 45, 507, 84, 21, 999, 5, 27, 19, 392, 4, 2,
+        11, 2, 6, 3, 0, 580, 17, 294, 1, 86, 13, 59,
+        121, 2, 76, 5, 34, 12, 232, 7, 157, 0, 29, 809,
+        321, 0, 220, 4, 17, 184, 831, 551, 163, 19, 272, 12,
+        4, 60, 298, 215, 29, 133, 133, 12, 10, 24, 0, 288,
+        43, 6, 78, 19, 0, 6, 18, 0, 1371, 2, 3, 0,
+        31, 3453, 364, 370, 161, 223, 107, 685, 575, 7, 129, 878,
+        1205, 230, 251, 1, 0, 0, 1684, 39, 374, 4, 71, 387,
+        1263, 286, 3534, 488, 1, 22, 2, 2247, 135, 2674, 200, 0,
+        305, 171, 1, 2394, 0, 2, 77, 1801, 4633, 333, 95, 12721,
+        7, 99, 220, 1, 598
+      };
+
+      constexpr PerfectHashSlot WORD_SLOTS[] = {
+        {688527026u, 3593}, {2414947418u, -1060}, {1554224131u, 6144}, {3708667061u, 306}, {308394851u, -829}, {3931063773u, -2991},
+        {3498996956u, -268}, {144459628u, -2311}, {790485369u, 914}, {559444373u, 7767}, {4010228000u, -1734}, {4126335686u, 401},
+        {2793412469u, 810}, {330223136u, 1251}, {2710072579u, 7379}, {965905456u, -5882}, {1151171558u, 939}, {1785671737u, 2405},
+        {2912888387u, 4858}, {1200544707u, 1452}, {1079765752u, 727}, {3959035759u, 551}, {1962958805u, 2093}, {2548271214u, 1199},
+        {877865492u, -1444}, {3408928997u, -1835}, {1502513470u, -1368}, {4121338852u, -645}, {2555997424u, 3041}, {2475600102u, 2120},
+        {1540271325u, -1566}, {2312313999u, -1264}, {2410185539u, -669}, {923632837u, 940}, {2765009028u, -7068}, {3525411878u, 1479},
+        {3277511901u, -1635}, {913144672u, 5433}, {3013478028u, 156}, {713900008u, 811}, {895209226u, -2155}, {3861501765u, 4589},
+        {3484163564u, 1777}, {2154268174u, -899}, {755993490u, -1549}, {3712932721u, 461}, {2597034743u, -800}, {2728699926u, 8576},
+        {166886247u, -910}, {1287067749u, 6499}, {1342963035u, -3850}, {847822331u, 2056}, {4197000752u, 601}, {2817495988u, -743},
+        {2050037415u, 600}, {3040464269u, -813}, {1684738636u, 306}, {4155786193u, 974}, {1446772119u, 101}, {1483104118u, -1659},
+        {3566241553u, -423}, {1784086071u, 1200}, {490440567u, 1349}, {1692723488u, -675}, {4154160976u, -730}, {2568594584u, 1454},
+        {3536085335u, 1255}, {3089558026u, -307}, {4238875852u, -123}, {3807852818u, -744}, {1114205731u, 484}, {2419411255u, -724},
+        {739343287u, -856}, {931536120u, 7410}, {1049462794u, -2094}, {4280881973u, 1764}, {214950045u, -3637}, {123671602u, -273},
+        {3446095615u, -3973}, {3173516903u, -1276}, {1207167151u, -735}, {4242695461u, 1620}, {1323232604u, 874}, {710773230u, -814},
+        {1956872377u, -1073}, {4139034288u, -1815}, {2408971240u, -1212}, {1426264481u, 1073}, {2873494660u, 3015}, {242851927u, -206},
+        {2583816894u, 1026}, {1328664037u, 542}, {1694991168u, -201}, {4024857857u, -1073}, {2218958141u, -1033}, {608340865u, -2314},
+        {2359672321u, 970}, {1597987829u, 2145}, {1577018047u, -1397}, {1246684402u, -3714}, {2067646039u, -13175}, {710330384u, 602},
+        {306909772u, -202}, {1108602661u, -792}, {1655589673u, -850}, {2757525542u, 1319}, {3429080300u, -1410}, {3775228953u, -5516},
+        {2628966220u, -681}, {4129617811u, -2087}, {4101684865u, 302}, {3159624904u, -7758}, {3314949181u, -11870}, {1093096046u, -802},
+        {1268341551u, 854}, {1610029127u, -787}, {675167416u, 1287}, {2129353193u, 492}, {3015843063u, -1212}, {14277280u, -208},
+        {2239423407u, -654}, {3284733694u, -1310}, {2523316045u, -1682}, {3611092639u, 1850}, {135764718u, -843}, {1090759916u, 156},
+        {2375100975u, -2171}, {798602614u, 3588}, {977188086u, 1647}, {3214232077u, 551}, {3337480228u, -1081}, {157666112u, -521},
+        {1528373375u, -3744}, {4071918041u, 4098}, {890542655u, 2857}, {1308582546u, -2112}, {2343804393u, -4761}, {2776268707u, -4430},
+        {3178522078u, -837}, {2819752251u, -1611}, {3707972483u, -1843}, {2832287752u, -813}, {893775516u, -485}, {781932179u, -600},
+        {2460752765u, 4056}, {389482223u, -689}, {2351207176u, -5228}, {657476243u, -673}, {2421661101u, -861}, {468857092u, 218},
+        {474913570u, 8875}, {3160283405u, -4864}, {1863333996u, -14896}, {1924626691u, -1504}, {344310319u, -1248}, {3179606588u, 2600},
+        {599166994u, 853}, {524899104u, 1792}, {2493198804u, 854}, {2143392357u, -960}, {4183236552u, -856}, {3491586897u, 1158},
+        {4102048062u, 541}, {378665860u, 561}, {3713090698u, 2171}, {3991602382u, -3821}, {4264730938u, 3029}, {611908182u, 2104},
+        {98801396u, -1489}, {1300830239u, 1413}, {2082060679u, -2355}, {269867317u, -695}, {2484718675u, 4889}, {3043887710u, -7059},
+        {3201294729u, -2297}, {3806741674u, 2670}, {761727306u, -120}, {1965148194u, 1905}, {4057687747u, 568}, {987988821u, -1273},
+        {1240908036u, 1013}, {546299374u, -852}, {915075536u, 2145}, {2095980269u, -878}, {2032659093u, 465}, {144252346u, 6620},
+        {3788841176u, -1350}, {3568250260u, 642}, {1250989286u, -1255}, {4136529414u, 3372}, {2397399129u, -3370}, {2115012676u, -931},
+        {4015391656u, -1050}, {4065943851u, -343}, {883385146u, -121}, {939815002u, -2516}, {3328487094u, -422}, {2836760752u, -1353},
+        {4031129364u, 1940}, {94539405u, 1389}, {2770036662u, 189}, {2389584161u, -541}, {1708928903u, 929}, {654963725u, 364},
+        {1916039662u, -645}, {2605956143u, 1860}, {1969067725u, -714}, {1842556888u, -5046}, {1194133665u, -1537}, {2634515467u, -1021},
+        {4140834334u, -809}, {3617794044u, 362}, {420299994u, -3794}, {1680351614u, -6041}, {2463238519u, -635}, {3609081956u, 1691},
+        {2350827722u, -1619}, {2590054317u, 2066}, {1505030321u, -14943}, {680000137u, -3637}, {1220593988u, 788}, {932535536u, -8669},
+        {3111267625u, -1508}, {3080261541u, 4533}, {3373347256u, 2448}, {4215647667u, 3818}, {3683432581u, 1826}, {83878153u, 1345},
+        {3933611546u, 1620}, {1743741841u, 1113}, {2213673792u, 1337}, {3479232203u, -744}, {123353188u, 1117}, {3210162718u, -3065},
+        {2707419828u, -790}, {2009965564u, -1186}, {2340147734u, 361}, {1391916252u, 5168}, {3985154847u, 6457}, {2900880706u, 848},
+        {243413168u, 2368}, {3949692709u, -3025}, {2024605224u, 1219}, {3653816356u, 1023}, {369107025u, -1350}, {509711130u, -783},
+        {1123096736u, -368}, {2876713736u, -2667}, {3873712325u, 601}, {98004410u, -852}, {1542017391u, 383}, {1548375192u, -939},
+        {1918918281u, 134}, {4165824273u, 831}, {395093372u, 1816}, {3958002744u, 728}, {4116448740u, 1711}, {2801202579u, 6665},
+        {3142156767u, 4798}, {2632263576u, 1895}, {2551011775u, 4270}, {1757858726u, -1184}, {2932581416u, -2788}, {981587811u, -1347},
+        {822153340u, 1327}, {3661733884u, -11822}, {1715986378u, -1250}, {4002874402u, -1051}, {2547595644u, -851}, {1919638939u, -2716},
+        {3471701380u, -913}, {2485808038u, 2135}, {1305128115u, -1413}, {3844865434u, -11870}, {3418022893u, 1192}, {2640005295u, 419},
+        {1681318645u, 2586}, {1442674909u, 188}, {3082051412u, -805}, {1027491377u, 785}, {551165262u, -871}, {1773318791u, 2181},
+        {1926739446u, -5156}, {2622703487u, 725}, {2283013618u, -236}, {759447719u, 3094}, {2964928649u, -4482}, {469027892u, 2009},
+        {3334936487u, -941}, {283069009u, -939}, {633165154u, 1044}, {231741234u, 195}, {3925987282u, 887}, {2777345630u, 3445},
+        {2177555865u, 1302}, {601704342u, 2551}, {637963360u, -2423}, {3131874230u, 227}, {2011176935u, 2438}, {4220205184u, 672},
+        {452839011u, 3508}, {802382509u, 1375}, {3577450807u, -2488}, {1407860467u, -1659}, {3863710291u, 2201}, {3160597554u, -694},
+        {371791050u, 1822}, {3580885165u, -463}, {2714972700u, -2604}, {1334020238u, -1336}, {2086396326u, -123}, {2206487248u, 5408},
+        {1369908131u, -2194}, {2109121547u, -722}, {2007109988u, -4314}, {1383412633u, 4573}, {3558632455u, 1063}, {1300046799u, 227},
+        {2088998627u, 1789}, {3572884142u, 1941}, {376062677u, -594}, {3219311274u, -630}, {3055213132u, -4855}, {3968846110u, 729},
+        {2396375300u, 1109}, {1784828071u, 1232}, {3603491854u, 2230}, {222622963u, -3752}, {1933632196u, 522}, {1760021412u, 3930},
+        {3174522839u, -994}, {3823589677u, 665}, {2102204238u, 6240}, {4147996342u, -1286}, {766041624u, 4889}, {2631426852u, -2064},
+        {3955312449u, 787}, {595794449u, 553}, {2514197444u, -3857}, {4135887904u, 1219}, {1073101091u, -4098}, {2783421065u, 845},
+        {1335671653u, -3216}, {3218677349u, 374}, {1271668202u, 7396}, {604687300u, 3846}, {3743528400u, -800}, {1954775440u, -2514},
+        {4109427493u, 874}, {2759429709u, -4134}, {1403704702u, -135}, {4050905206u, 3271}, {2001105678u, -1462}, {879719813u, -1528},
+        {3890367210u, 1384}, {2215757640u, -4371}, {1121800739u, -1038}, {2354204917u, -1694}, {2154165742u, 1082}, {2765893075u, -1057},
+        {4280746425u, -4688}, {3110450134u, 1004}, {1237574172u, -587}, {1103763879u, 2079}, {2377996999u, 2857}, {361630935u, -403},
+        {424541092u, -4570}, {320186356u, -1224}, {451935282u, 584}, {301803681u, -829}, {1671152170u, -4802}, {3701600959u, 760},
+        {895412501u, 921}, {1785239301u, -1982}, {3585952184u, -882}, {57483928u, 921}, {1542308605u, 704}, {3590466659u, 300},
+        {2368029928u, -822}, {1812084464u, 331}, {1409635491u, -2721}, {2270664625u, -2363}, {1727918316u, 5905}, {734009075u, -4866},
+        {2414200899u, 842}, {3237512329u, -253}, {2111569047u, -2869}, {1014456203u, 798}, {1656420292u, -470}, {785235734u, 4513},
+        {1455734687u, 653}, {2426693066u, 5156}, {2452747009u, -786}, {148172728u, 302}, {315159647u, 3145}, {1389429612u, 3066},
+        {992638434u, 965}, {3333313236u, -903}, {1840911425u, 2454}, {455623364u, 13150}, {1579114692u, -1886}, {2985235142u, -1682},
+        {1602795906u, 916}, {3957548092u, 3798}, {3117740907u, -1127}, {1096588422u, 5807}, {3773509488u, -149}, {2372561706u, 782},
+        {876183639u, 4098}, {1900469568u, 1645}, {3320119426u, -402}, {3405200730u, 1639}, {3514686429u, 808}, {1662749751u, -1262},
+        {2395449809u, -299}, {1643024292u, -1500}, {1497807740u, -731}, {1929161728u, -3828}, {1779105989u, 5827}, {378639163u, -7236},
+        {3796511576u, -3573}, {3829943924u, 1319}, {1318125154u, 752}, {314412627u, -1282}, {308863715u, 1001}, {476403165u, -1544},
+        {378004079u, -718}, {4036444917u, -6509}, {1592975879u, 2095}, {3136686421u, 4999}, {1085162822u, -2213}, {3419620342u, 3685},
+        {3994738288u, 13168}, {4043447316u, 544}, {3608146685u, 3640}, {1927993017u, -1185}, {555076956u, 976}, {3879434979u, 1682},
+        {1001795521u, 2182}, {2487291598u, -442}, {1233071456u, -4193}, {2568567026u, -1432}, {1981364515u, -5055}, {3883708013u, 571},
+        {3332079075u, 1109}, {3049071831u, 521}, {3259349056u, -6125}, {378503872u, -1310}, {1558363869u, 5865}, {1395570028u, 2745},
+        {320548178u, -901}, {3717491063u, -496}, {2203643855u, 786}, {3969941744u, -727}, {2100143775u, -8097}, {4285800606u, 2163},
+        {1978784094u, 2558}, {1624239544u, 2641}, {1459110036u, -949}, {3540178364u, 201}, {2584769194u, 401}, {1259595988u, 1129},
+        {2720522981u, -2696}, {4206263233u, -758}, {2734787794u, 1816}, {223490312u, 2416}, {888481704u, -395}, {2362702662u, 1464},
+        {1925185149u, -847}, {1390133379u, -1759}, {1549372354u, -1746}, {3542700807u, 2608}, {3851585508u, 1758}, {805662060u, 2255},
+        {2870487647u, -1355}, {2076467130u, 1829}, {2744062993u, 1437}, {466346129u, -605}, {3919406310u, -4556}, {620573317u, 4169},
+        {3842411098u, 788}, {4265968786u, 1771}, {969091403u, -867}, {3210174455u, 540}, {2746571162u, 2099}, {600554142u, -800},
+        {1107496188u, -135}, {2142282056u, -662}, {2489241755u, 363}, {2013404867u, 504}, {1273535132u, 6293}, {667507335u, 3930},
+        {4226377135u, 2318}, {2441525520u, 5308}, {4105226639u, -446}, {117102827u, 1557}, {725884055u, -548}, {516748017u, -5483},
+        {6652558u, -2666}, {4231814819u, -1519}, {1990340327u, 1977}, {3081114049u, -1043}, {297135479u, 741}, {2758524096u, -1304},
+        {1264692776u, -724}, {4280728847u, 1868}, {1946893019u, 121}, {3049841869u, 1853}, {3573315072u, 1516}, {827501697u, 1623},
+        {1131290605u, -11877}, {2177430740u, 974}, {2424398824u, -1584}, {2583900132u, 932}, {2347753909u, -1021}, {3897474388u, 1205},
+        {1697296774u, 3095}, {3064688027u, -268}, {2989337601u, -8392}, {4291226795u, -1819}, {2008203193u, -1626}, {3853196744u, -1136},
+        {2495976263u, -1350}, {3950611673u, -665}, {1129963910u, -1153}, {2553979665u, -853}, {512991369u, 808}, {2957645232u, 5713},
+        {2165417431u, -361}, {2261380558u, 357}, {3450148791u, 1743}, {2582953091u, -483}, {323842489u, 3815}, {505784359u, -4353},
+        {123362311u, -135}, {1405980454u, 1273}, {2238894161u, 2026}, {1557633471u, 1890}, {352095670u, -990}, {1795325775u, 651},
+        {3815415106u, 1374}, {2091066875u, 456}, {153553582u, -2013}, {2912629055u, -579}, {1275180694u, 2958}, {1494090673u, 4231},
+        {857751950u, 990}, {3013249533u, -1768}, {3202668757u, 1449}, {1112657569u, 922}, {1775846042u, -137}, {2556805203u, -1267},
+        {1432124664u, 855}, {3292272315u, 535}, {2920961132u, -1512}, {709713533u, -1100}, {1336564114u, 660}, {177797051u, -417},
+        {3871337674u, 388}, {2598971003u, 786}, {3054465645u, 1955}, {1410148754u, -343}, {3002891652u, 660}, {4011599488u, 1883},
+        {3158865037u, -724}, {3388164207u, 1655}, {1226972406u, -2613}, {2480079004u, 792}, {1498586705u, 2748}, {1695154465u, -2565},
+        {3145242529u, 6067}, {1493410273u, 1337}, {556611322u, 571}, {2699066313u, -4841}, {293596119u, -792}, {1685540480u, -1033},
+        {3473509974u, 730}, {2259298996u, 2666}, {3635815548u, -697}, {3612865109u, -495}, {4248877576u, -1006}, {1775746592u, 1104},
+        {2817582748u, 365}, {539525237u, -514}, {581596524u, -9066}, {3675813607u, -1387}, {2599404972u, 1201}, {3777976577u, -763},
+        {2951673763u, 978}, {2844826981u, -640}, {1036263890u, 278}, {1557713201u, 2369}, {796509407u, 2490}, {3472826846u, -1872},
+        {4256444920u, 4547}, {2380678665u, 2475}, {897786397u, 1527}, {2460282816u, -200}, {4068391563u, -1479}, {1503503403u, -302},
+        {2027375514u, -913}, {1751702465u, 965}, {955058949u, -2233}, {271862746u, -3102}, {3513790305u, 812}, {1497911359u, 8875},
+        {3959482292u, 974}, {3004364284u, 2614}, {867428538u, -518}, {842971930u, 1796}, {3789047403u, 3350}, {2785649986u, 457},
+        {1124364675u, -1200}, {1014261197u, 1004}, {2973373712u, 1249}, {2434465620u, 6154}, {4195957029u, 2016}, {3468266362u, -32768},
+        {1309880896u, 451}, {3393277975u, -3198}, {1259770556u, 7901}, {1194461804u, 1233}, {1564005179u, 792}, {2879388596u, 1624},
+        {446514694u, 970}, {3219666214u, -185}, {742980953u, 1127}, {3478979641u, -3030}, {525082142u, 1983}, {2552315425u, 6167},
+        {1922244102u, -3485}, {2484426863u, 1618}, {3075716096u, -190}, {1059335617u, 1763}, {2805074375u, -1384}, {2093205056u, -1113},
+        {3100026717u, 6820}, {1047264318u, -913}, {1820445627u, -412}, {1710705973u, -127}, {3775646982u, -10713}, {163160709u, -1256},
+        {2857657516u, -1482}, {351377776u, 4292}, {3221270379u, -1519}, {2933770385u, 3906}, {2820771418u, 1835}, {2965013842u, 1198},
+        {264338538u, 1555}, {2005878966u, -2287}, {1788338983u, 755}, {3683229087u, 7313}, {2687438239u, 573}, {599864219u, -2049},
+        {4009657585u, 4555}, {926779121u, -2082}, {2195811527u, 5034}, {3135587623u, -270}, {2347483243u, 1010}, {2347520698u, -502},
+        {817354949u, -1615}, {110182119u, -6621}, {1540157776u, -2784}, {2209303728u, -673}, {2413759621u, 1347}, {4244489300u, -733},
+        {3218891864u, -2309}, {1206349158u, 1093}, {1322153256u, -1880}, {786387198u, 1155}, {917845911u, 521}, {2373301126u, 878},
+        {888381374u, -460}, {2718175777u, -402}, {2547035926u, -1101}, {1046810226u, 3873}, {2114723962u, -2922}, {3717852726u, 2937},
+        {1324298717u, -1528}, {1821090625u, 2286}, {10491061u, -2009}, {1493122329u, 1574}, {749522434u, -1313}, {3332324775u, -912},
+        {1495291888u, 2468}, {1325989445u, -1030}, {1951080048u, -1253}, {1374693388u, 584}, {3167990144u, 1591}, {944723176u, -1764},
+        {1754357519u, -4229}, {1743057730u, 2596}, {3793155679u, 3663}, {2425378644u, -681}, {1080483967u, -4734}, {3350064134u, -727},
+        {4284181553u, 5600}, {915351516u, -242}, {3814370721u, -1481}, {1927299564u, -981}, {1782204299u, 872}, {3230402982u, -2069},
+        {526287520u, 1006}, {1059946922u, -1804}, {2916276284u, -1609}, {3310949727u, 428}, {1030745820u, 4612}, {1793630316u, 1261},
+        {1186505733u, -543}, {2391330290u, -2670}, {709987027u, 509}, {3136977642u, -1798}, {2179660137u, 1097}, {3167206560u, -9726},
+        {2127159072u, 1681}, {3517348279u, 1215}, {4243618922u, 649}, {1083988711u, -1169}, {289914505u, -547}, {1025988764u, 841},
+        {2468902494u, -127}, {2056806914u, 1889}, {874955599u, -5730}, {654754164u, -1296}, {1313001475u, -2348}, {4053837891u, 465},
+        {1811135491u, -4258}, {835284498u, 2613}, {2955635935u, 5078}, {704974262u, -2757}, {3378379155u, 4646}, {157070618u, 483},
+        {791610591u, 4404}, {2085526568u, -1183}, {1905123962u, -2378}, {2900322858u, 838}, {3802100334u, -912}, {1118629026u, -1116},
+        {1707607990u, 169}, {611632756u, 505}, {1623793509u, -2697}, {1828445599u, 1538}, {2972959146u, 527}, {904317828u, -881},
+        {847346889u, -3885}, {1511598684u, 6520}, {2960148809u, -4915}, {2743633026u, -2279}, {2296992797u, 8578}, {2509201552u, -2715},
+        {936102229u, -792}, {426691180u, 776}, {1122684006u, 1910}, {1221691851u, 4265}, {2190953173u, -669}, {3347481192u, -601},
+        {1619841452u, 2997}, {3954207853u, -1207}, {1455607955u, 798}, {1851679373u, -669}, {2733175374u, -3414}, {3105279196u, 5543},
+        {151782872u, -4143}, {982253489u, -1433}, {2163939906u, -553}, {2019057788u, 5792}, {4053199890u, 1522}, {2072118686u, 3887},
+        {1038810602u, 1314}, {1551994685u, -1783}, {1728083211u, -2113}, {3469772046u, 1833}, {2994743282u, -7194}, {4015821335u, -4517},
+        {1903890717u, 1067}, {1336072644u, -501}, {4154522641u, 6943}, {2136460428u, -3552}, {1629861987u, -3912}, {805691114u, 1682},
+        {1696719598u, 606}, {3225649051u, -1650}, {883601088u, 1356}, {946635267u, 1500}, {2375089911u, 1516}, {852090467u, 1906},
+        {3668869510u, -408}, {2291467427u, 1497}, {2852615116u, -2762}, {2358539068u, -1011}, {158966360u, -2506}, {3461121671u, 979},
+        {152606301u, 1036}, {2601377671u, -1052}, {807949995u, -545}, {4198467013u, 2864}, {1628603815u, -18}, {3471755304u, -1375},
+        {754240978u, 720}, {834925359u, -1834}, {703511295u, 1199}, {2530493048u, -241}, {3597960968u, -1356}, {2862009014u, -1291},
+        {2118231067u, 1682}, {2377774635u, 865}, {3884653196u, -949}, {1991772556u, 727}, {2636577845u, 6521}, {2431286659u, -619},
+        {979573865u, -1543}, {3832844594u, -4977}, {2313574700u, -1000}, {2909808752u, -1328}, {3551958596u, 505}, {2427136537u, -856},
+        {1173654391u, -793}, {1422392987u, 4114}, {3989345814u, 892}, {2532153817u, -503}, {522331153u, 663}, {2742039845u, -3116},
+        {2115929168u, 3508}, {1973770977u, 647}, {1432159916u, 2771}, {2928449526u, -3977}, {507292498u, 722}, {2455202814u, -1163},
+        {3833246806u, -4748}, {236724273u, -1257}, {3441268649u, 241}, {919162323u, 3562}, {375436597u, 1895}, {2069599913u, -466},
+        {2918952718u, 4437}, {1051288937u, -538}, {2676691463u, -2471}, {720458065u, 854}, {2479054877u, -302}, {4123065336u, -1018},
+        {3470002881u, 187}, {4174006098u, 3197}, {1778743661u, -1193}, {95064108u, 3879}, {3474933096u, -1165}, {683641423u, 849},
+        {3421414786u, -2006}, {847946815u, 2266}, {1561824923u, 1141}, {243435814u, -2056}, {2024638318u, 3994}, {411921323u, 1454},
+        {3112238931u, 4125}, {1934191045u, -951}, {1621720014u, 568}, {661550906u, -360}, {3898526931u, 1404}, {2058526760u, 2217},
+        {1473530509u, -661}, {3760137039u, -1740}, {1523867882u, 3351}, {2225673387u, -2604}, {3776049872u, 1091}, {1968503847u, -5989},
+        {3051355185u, 719}, {1710799882u, -496}, {3237413895u, -968}, {801812166u, -4066}, {2901442749u, 749}, {542084495u, 4517},
+        {3225418114u, 1529}, {1301249553u, 3463}, {2654298939u, -292}, {896331829u, -244}, {3055456421u, 529}, {386079696u, -4376},
+        {3899221581u, -278}, {1790100907u, 3099}, {3973786308u, 871}, {147145814u, 2342}, {4133631650u, -2344}, {864334206u, 300},
+        {779086667u, 844}, {3879903919u, -241}, {89771357u, -3794}, {3777143548u, -3399}, {3958003506u, 241}, {1153477673u, -1286},
+        {3628020227u, -2900}, {3807875467u, -724}, {2312829959u, -1947}, {1995233320u, 2742}, {746118612u, -180}, {2925769331u, -463},
+        {2691989040u, -299}, {3470098499u, -270}, {1054518742u, -578}, {981632390u, -1185}, {4063762314u, -513}, {1670513271u, 363},
+        {4259953425u, -562}, {276428274u, 2670}, {904258620u, 624}, {357814610u, 181}, {49291789u, -1045}, {2891936026u, 1542},
+        {2837864091u, 451}, {1398405149u, 240}, {1095296999u, 831}, {3201822991u, 2163}, {1746964210u, -4371}, {700080266u, 1882},
+        {1528768510u, 1557}, {1249563676u, 1785}, {2472377827u, -2055}, {1457860500u, 1375}, {987218186u, -1769}, {3555023875u, 3426},
+        {570332093u, -2150}, {3390695937u, 52}, {1409730741u, -2094}, {1763908489u, 6006}, {294101569u, -865}, {3517936837u, 1078},
+        {3519138192u, 312}, {1417942301u, -291}, {562278105u, 1200}, {122239867u, -960}, {3995839034u, -1371}, {2205708043u, -428},
+        {1264650454u, -4657}, {1795157752u, -3941}, {3739766296u, 990}, {4009100994u, -1000}, {869903179u, 2795}, {1095852635u, -4268},
+        {4070527542u, -411}, {1940287603u, 1287}, {3852464936u, -724}, {1645961757u, -403}, {3450898105u, -6247}, {4130412694u, -141},
+        {3069655244u, -1612}, {3418550551u, 3798}, {2095359805u, 1605}, {1750774152u, 530}, {2929738049u, 327}, {1495070952u, 2145},
+        {852787424u, 4752}, {1215724351u, 1163}, {144952204u, 5388}, {390329626u, 3472}, {819363357u, 1979}, {3208158584u, -3654},
+        {502890926u, 1146}, {4001633705u, 278}, {2649986298u, -4384}, {803555844u, 1813}, {464344287u, 950}, {2254141674u, -1263},
+        {1774009979u, -1723}, {2621189882u, 548}, {3503468026u, 1782}, {2300814458u, 805}, {322958718u, -3788}, {2906574087u, 3222},
+        {3486117584u, 1671}, {3394045332u, 2295}, {626256192u, -507}, {1897440032u, 1067}, {965397930u, -11388}, {3102123716u, 182},
+        {3461851803u, 5409}, {2214272403u, -105}, {3274655665u, 1922}, {840583216u, 856}, {3951068692u, 463}, {617110283u, 1122},
+        {749405810u, 130}, {2573819044u, -3874}, {4217686742u, -997}, {490724546u, 1811}, {867542092u, 8576}, {945659440u, -421},
+        {358326856u, -1984}, {2439218152u, -1316}, {3442454905u, -4817}, {3149201843u, -871}, {166116939u, -944}, {869629935u, -3110},
+        {1970891956u, 1798}, {314574874u, 1837}, {172538489u, -514}, {1668650720u, -602}, {125232048u, 1789}, {3680211456u, 1224},
+        {3484229117u, 502}, {3824617933u, 600}, {3488805746u, 866}, {1637494707u, -277}, {244107542u, -1897}, {2673381624u, -3435},
+        {1752473849u, 429}, {1530124326u, 4249}, {1966356832u, 974}, {1720179376u, -488}, {596139304u, 241}, {798576438u, 2210},
+        {4040268355u, 1505}, {3728138448u, -73}, {3890212889u, -2439}, {797160266u, 530}, {1506842288u, 3519}, {3320632657u, -856},
+        {3035020681u, -386}, {1410406602u, 1498}, {2852305958u, -4203}, {300780706u, 306}, {3242443910u, -3153}, {3031145327u, -1008},
+        {734262543u, 2773}, {19318292u, 2201}, {1341605661u, -2352}, {4079988563u, 753}, {1879901924u, 1191}, {2735158133u, -2434},
+        {2121679575u, -1597}, {2072305997u, 972}, {413776077u, 2024}, {1348457070u, 1749}, {770945845u, 3426}, {3229489613u, 672},
+        {3544389104u, 1591}, {2716555356u, -1049}, {2412276233u, -2532}, {1883223890u, -4115}, {11393983u, 727}, {1585279136u, 4664},
+        {261618674u, 2083}, {2085803511u, 792}, {2759299772u, -4479}, {1315989905u, -758}, {4187977191u, -881}, {327679065u, -937},
+        {511372084u, -3149}, {2612784334u, -1014}, {204602442u, -541}, {1243263548u, -3246}, {3468281487u, -983}, {3700184506u, -740},
+        {3145113652u, 208}, {1497259401u, -409}, {2578074741u, -3543}, {451795549u, -1566}, {846752254u, 860}, {2892608602u, -1291},
+        {1690355291u, -4681}, {1719051572u, 1971}, {2898114851u, 731}, {173985880u, -910}, {2517800839u, -2352}, {2391496494u, 4091},
+        {1744743723u, 7397}, {3999657851u, 421}, {69461798u, -788}, {2927412436u, -789}, {127697057u, -1058}, {2799778132u, 1051},
+        {1193754996u, -195}, {3947662648u, -1635}, {2453507012u, 2644}, {3372684466u, 2323}, {968296313u, -587}, {2594826632u, 3145},
+        {130254460u, -4003}, {2193555273u, 360}
+      };
+
+      constexpr uint64_t FILTER_WORDS[] = {
+        0x0000000000000000ULL, 0x0008100000c07000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0400800020004000ULL, 0x1200004200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000011200022021ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000011000200040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000028000014ULL, 0x0000000000000000ULL, 0x8020000000200004ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0800000002002080ULL, 0x1010400004000000ULL, 0x0040800000001800ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2802808209220300ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1040000200000000ULL, 0x0000000000000000ULL, 0x00a0400000000020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004000800041ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000088100800000ULL, 0x2510140080886611ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00c0800000400000ULL, 0x0000000000000000ULL, 0x0000400040008503ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0005401000380080ULL, 0x0000000000000000ULL, 0x4000000004000082ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000044004080000ULL, 0x0002000005040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404002000000100ULL, 0x0000000000000000ULL, 0x2001002080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0xec08844000188012ULL,
+        0x0000000000000000ULL, 0x8810000040000000ULL, 0x0000000000000000ULL, 0x2000108010000000ULL, 0x8000000820002000ULL, 0x0000002000080084ULL, 0x0000000000000000ULL, 0x0000800050000400ULL, 0x0005400004000000ULL, 0x8182011000000020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002040004080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000100230000ULL, 0x0000000000000000ULL, 0x0000400080050000ULL, 0x0000000000000000ULL, 0x0002014100000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000148002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040010001020000ULL, 0x0008c00004000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00080000a0800000ULL, 0x0083000001000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000800400400000ULL,
+        0x0010000000090000ULL, 0x0000000000000000ULL, 0x0004000900120806ULL, 0x0000000000000000ULL, 0x0010841200100804ULL, 0x0000c00012000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001420000400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004201028000220ULL,
+        0x0000000208440000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0400001004040000ULL, 0x0104010200049000ULL, 0x0000040000014200ULL, 0x0002010000200100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2808004081040483ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000a100000000001ULL, 0x0000000000000000ULL, 0x0000004900000200ULL, 0x8300040400800020ULL, 0x0000000000000000ULL, 0x0000400048100000ULL, 0x0000000000000000ULL, 0x4043880854450020ULL, 0x0000200000100220ULL,
+        0x0000000000000000ULL, 0x0820800020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2000400420000000ULL, 0x0180004000001000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0300800000000080ULL, 0x0080008050000000ULL, 0x0020003000000010ULL, 0x0000000000000000ULL, 0x0040090008000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000200048080ULL, 0x0000000080020208ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0800010000280000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020080820ULL, 0x0000000000000000ULL, 0x0000100400004004ULL, 0x0000000000000000ULL,
+        0x4000000088040000ULL, 0x0040000000000a04ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010010810000ULL, 0x0000000000000000ULL, 0x0004000110000000ULL, 0x0100050000008000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000880000009ULL, 0x0000000000000000ULL, 0x0020000408000800ULL, 0x1080004080280040ULL, 0x0000000000000000ULL, 0x0002000022000200ULL, 0x1006000800000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0210000400000001ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020000a00000010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0180000000000010ULL, 0x0000100020000802ULL, 0x0000100080008400ULL, 0x0890100000010108ULL,
+        0x0002004000012000ULL, 0x0000000000000000ULL, 0x0010000400108000ULL, 0x0000000000000000ULL, 0x4802000841802000ULL, 0x0800001000081000ULL, 0x0012000181102400ULL, 0x0808280002200008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004001040000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000202010100ULL, 0x0000000000000000ULL, 0x04000e0000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x000001000ea40800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1000000001000102ULL, 0x0000040000401040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4000008020400000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080010002080000ULL, 0x0000000000000000ULL, 0x0000409008820000ULL, 0x0000000000000000ULL, 0x4008200020000000ULL, 0x0000000080800201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2000000000000121ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1800207000808000ULL, 0x000018805100a000ULL, 0x8080800000040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0083080000000000ULL, 0x1081000140200009ULL, 0x0000000000000000ULL,
+        0x1004000200005182ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008106082c40201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0800200000040010ULL, 0x0000000120000440ULL, 0x0200000080000802ULL, 0x0000000000000000ULL, 0x0000000608020000ULL,
+        0x0000000000000000ULL, 0x0040040000004040ULL, 0x0000000000000000ULL, 0x0040002004020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0520a01004100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x5000000040000800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8100200000000001ULL, 0x0000000000000000ULL, 0x0022000008000400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x001000c100001910ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x004c100900000c00ULL, 0x2000018004000000ULL, 0x0000008402000800ULL, 0x0000000000000000ULL, 0x21000000000000a0ULL, 0x0000080003040000ULL, 0x1002040000000800ULL, 0x0140424429101000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0120004000020000ULL,
+        0x0000000000000000ULL, 0x0408200001006002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000500000008001ULL, 0x0000000000000000ULL, 0x0000000420800800ULL, 0x2200000080000004ULL, 0x0020800000006000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0410400100000000ULL, 0x0101004020260200ULL, 0x0080000041000004ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020010102ULL, 0x0000801000010004ULL, 0x0000000000000000ULL, 0x3000000004040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0003200020120004ULL,
+        0x0a0d020300000000ULL, 0x0011000040080000ULL, 0x0000040602000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000104100008ULL, 0x2020000000000208ULL, 0x0081000000002004ULL, 0x0000000000000000ULL, 0x0701800200400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0880000042000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x7c00000004080002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040000100000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2000100050000000ULL, 0x0200000040020001ULL, 0x0080800140000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000080080084ULL, 0x0008341410180c00ULL, 0x0004044020000000ULL, 0x0004000040000082ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4100000000004200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0100200000400020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2100020002402810ULL,
+        0x0000000000000000ULL, 0x0000004000204001ULL, 0x0410000000000040ULL, 0x0000000000000000ULL, 0x0500000004080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x80a0880000001081ULL, 0x0000000000000000ULL, 0x0100000010000044ULL, 0x0122008000006800ULL, 0x1010082040089d20ULL,
+        0x0000000000000000ULL, 0x0040008020000100ULL, 0x8802008000000000ULL, 0x0000000000000000ULL, 0x0000800020080200ULL, 0x0000000000000000ULL, 0x4000004000802000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000200000080120ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x8000000000800200ULL, 0x0000000000000000ULL, 0x4000000000102040ULL, 0x2020000000208000ULL, 0x0000000008400804ULL, 0x0000800102010000ULL, 0x0000000000000000ULL, 0x0300000000300000ULL, 0x1000410000004000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0800002004000040ULL, 0x0000000000000000ULL, 0x0001002000400001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0240040009140000ULL, 0x0000000000000000ULL, 0x0400000080004100ULL, 0x4000000040040010ULL, 0x0000000000000000ULL,
+        0x0001000800000820ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x20c0000800000000ULL, 0x0004008200000020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4006000000100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2a02018000008400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001000420000040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1000012020000824ULL, 0x0000000000000000ULL, 0x1000200000004020ULL,
+        0x0000000000000000ULL, 0x0001200400000001ULL, 0x0000000000000000ULL, 0x2080800000000400ULL, 0x1000042004000000ULL, 0x0220000000000021ULL, 0x4404000080000000ULL, 0x0000000000000000ULL, 0x0200110000100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x3000804400208002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080022101080120ULL, 0x0802000860828000ULL, 0x0000000000000000ULL, 0x1000020400000000ULL, 0x0000000000000000ULL, 0x1001000042000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0400401000000004ULL, 0x0000000000000000ULL, 0x0020400602400402ULL, 0x0402020061000408ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1000100014000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010091000ULL, 0x0000000000000000ULL, 0x0001000200000004ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0200010600000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x008c000002000000ULL, 0x0000000000000000ULL, 0x2100080200000000ULL, 0x0000000000000000ULL, 0x0000002011400000ULL, 0x0000000000000000ULL, 0x0060800400000000ULL, 0x0000000000000000ULL, 0x00800000c0000000ULL,
+        0x0000200000002480ULL, 0x0096000002000008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080002080000ULL, 0x0080005000020000ULL, 0x0900038010000820ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2100000000004002ULL, 0x0000000000000000ULL, 0x0040600020000000ULL, 0x8400241200018000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2000000000014004ULL, 0x0000810800004000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1800080001000000ULL, 0x0000000000000000ULL, 0x00000a0800000800ULL, 0x4040842000002810ULL, 0x0000800010004002ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000200000110040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1004042000000000ULL, 0x0000000000000000ULL,
+        0x00110000000a0000ULL, 0x0080000000c3020aULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4000202000080000ULL, 0x0000000000000000ULL, 0x0104000000000800ULL, 0x0000000000000000ULL, 0x0000040400080010ULL,
+        0x001810000004002cULL, 0x0001800000300000ULL, 0x0000000000000000ULL, 0x0000001008004002ULL, 0x0000000000000000ULL, 0x0080001102000000ULL, 0x0000000000000000ULL, 0x0000001080000200ULL, 0x0000000000000000ULL, 0x0000000000408210ULL, 0x2a04001008030022ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0800100000002008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408000101840080ULL, 0x0200000002000202ULL, 0x0000000000000000ULL, 0x0008000010010100ULL, 0x0008000000090800ULL,
+        0x0000000000000000ULL, 0x0004010040010000ULL, 0x0000000000000000ULL, 0x8000008000000408ULL, 0x0020240002300028ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0010401080000000ULL, 0x0000000000000000ULL, 0x0080000400808000ULL, 0x02280000080c0808ULL, 0x0000000000000000ULL, 0x0000800280001000ULL, 0x1000008000001200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8026004010000020ULL, 0xd002020000904000ULL,
+        0x0000000000000000ULL, 0x3008000008028082ULL, 0x0000000000000000ULL, 0x0041000800440404ULL, 0x0012000000000200ULL, 0x4000002018000000ULL, 0x0000000000000000ULL, 0x42000400010040d0ULL, 0x0008110221120000ULL, 0x0000000240000100ULL, 0x0000000000000000ULL, 0x1800000000400008ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080000000860000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001100080020ULL, 0x0000010020400002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000001000120001ULL, 0x080602440a000490ULL, 0x00a1800001240040ULL, 0x0040181000000000ULL, 0x2000000000190000ULL, 0x0000000000000000ULL, 0x8008200000000800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808000001001000ULL, 0x0208000000200200ULL, 0x1100020000000002ULL, 0x4002000000110000ULL, 0x0400008020020000ULL, 0x0000010000800102ULL, 0x0000880020400000ULL, 0x0000000000000000ULL, 0x0108200104002028ULL, 0x0000000000000000ULL, 0x6800880040820000ULL, 0x0000000000000000ULL,
+        0x0800001080000000ULL, 0x0000000000000000ULL, 0x0024000000002040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020000084000010ULL, 0x0000000000000000ULL, 0x0008500000100000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102002000000004ULL, 0x0000100400001001ULL, 0x0000000000000000ULL, 0x0004200000400001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000081010000200ULL, 0x080b000048000024ULL, 0x0000000000000000ULL, 0x0001010000001020ULL, 0x0200880000004000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0208010000080000ULL, 0x0000000400141000ULL, 0x0100600000000040ULL, 0x0000000000000000ULL, 0x08c800800500021cULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1200080800000000ULL, 0x4002000108000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000000a0040040ULL, 0x1040040000000000ULL, 0x0008000082000040ULL, 0x0b80200a00100000ULL, 0x0000000000000000ULL, 0x0200000100100004ULL,
+        0x0024000400001000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040000400088ULL, 0x0000000802804000ULL, 0x0042000001004000ULL, 0x0000000000000000ULL, 0x0000800100010800ULL, 0x0010810020000000ULL, 0x0000000000000000ULL, 0x0000001000020018ULL, 0x0000000000000000ULL,
+        0x1000102000000010ULL, 0x0000801008000400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0100020000008004ULL, 0x00800800000000a0ULL, 0x3150000100001800ULL,
+        0x0000860001000000ULL, 0x0200001008000400ULL, 0x0000002020800040ULL, 0x0000000000000000ULL, 0x0000084200090013ULL, 0x0000000000000000ULL, 0x0900050000000000ULL, 0x0000000000000000ULL, 0x0480000143000000ULL, 0x0000000000000000ULL, 0x0040000880100000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8800004000200000ULL, 0x0000000000000000ULL, 0x2828440400000020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000048008008000ULL, 0x0000000000000000ULL, 0x0400400002100000ULL,
+        0x0000000000000000ULL, 0x0440000104001420ULL, 0x0000000000000000ULL, 0x0000088000100010ULL, 0x0000000840080020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0030041008850000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010044200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000040054000ULL, 0x0000004400000082ULL, 0x0000000000000000ULL, 0x2004220000a00202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0420000080008000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000008004120ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0801000010000002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0281000800802208ULL, 0x0002000100102000ULL, 0x1000020000000402ULL, 0x0000000000015080ULL, 0x0000000004080081ULL, 0x0800000010000102ULL, 0x0000000000000000ULL, 0x0040000000080050ULL, 0x0000000000000000ULL, 0x1000008008000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4004000000000082ULL, 0x2001200000010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008040080000200ULL, 0x0000000000000000ULL, 0xc040208000d52000ULL, 0x0000000000000000ULL, 0x0800110000004000ULL,
+        0x0000200000000130ULL, 0x8980000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000108004002ULL, 0x0000000000000000ULL, 0x0400000a01042804ULL, 0x0000010000080280ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1001020928040000ULL, 0x0000000000000000ULL, 0x0310180020000808ULL, 0x5000800402020801ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004002001200000ULL, 0x0480100000000004ULL,
+        0x0000000210010001ULL, 0x0000000000000000ULL, 0x0000002820008000ULL, 0x4000000004020001ULL, 0x0000000000000000ULL, 0x0000004005000000ULL, 0x0000000000000000ULL, 0x0000020020000018ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001604000000000ULL, 0x0000000000000000ULL, 0x0000040800420000ULL, 0x0081000001000040ULL, 0x0040000008800080ULL, 0x0000000000000000ULL, 0x0004002000005000ULL, 0x0010200000800008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000c80c0062000ULL, 0x0000000000000000ULL, 0x8000080200000020ULL, 0x0000000000000000ULL, 0x4000101400000000ULL, 0x0000000000000000ULL, 0x4080000010800000ULL, 0x0000000000000000ULL, 0x0802000400000040ULL, 0x0000000000000000ULL,
+        0x0000040004800080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000022008010000ULL, 0x0808000000420000ULL, 0x2002400000004000ULL, 0x0000000000000000ULL,
+        0x0028000000020000ULL, 0x2040010000000080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1004021000400408ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0800008800000004ULL, 0x000a000000002100ULL, 0xb400001080040100ULL, 0x0000000000000000ULL,
+        0x0004008840000000ULL, 0x0000000000000000ULL, 0x0020001000002400ULL, 0x0020440000002000ULL, 0x0800800400200000ULL, 0x0000000000000000ULL, 0x0000480004000008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000080002100000ULL,
+        0x4088308020020006ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1000002010010000ULL, 0x0020008000000401ULL, 0x0200000000000620ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0208000008004000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0400000000000844ULL, 0x1000102840808008ULL, 0x0000000000000000ULL, 0x00a0000000000210ULL, 0x0082001000000800ULL, 0x0000000000000000ULL, 0x0000000040800012ULL, 0x0008200000021000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020040010010000ULL, 0x4002001000000000ULL, 0x0000000000000000ULL, 0x0010004001020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x01100c0401008400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0840000000004100ULL, 0x0000000000000000ULL, 0x08000c4820000020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1000001040000010ULL, 0x00800000b0000000ULL,
+        0x0000008480200000ULL, 0x0012100002000000ULL, 0x0001120044a00000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0800204880009080ULL, 0x0000000000000000ULL, 0x0860800420008008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000400050040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000100882000000ULL, 0x0000000000000000ULL, 0x2002000000800010ULL,
+        0x2000014002820040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4010000400400000ULL, 0x0004000000000904ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040080080000ULL,
+        0x0000000000000000ULL, 0xc098001000204000ULL, 0x0000000000000000ULL, 0x08a0200000000000ULL, 0x0000000000000000ULL, 0x400204001a002000ULL, 0x0004000000042010ULL, 0x0000000000000000ULL, 0x0440000000480000ULL, 0x2004800080040002ULL, 0x103c202200018006ULL, 0x0000000000000000ULL,
+        0x8244804c80022020ULL, 0x0000000000000000ULL, 0x0002440001000000ULL, 0x0002000010300000ULL, 0x0000000000000000ULL, 0x0020301408000820ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2220000000020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0100000008020002ULL,
+        0x000000a080008000ULL, 0x000104a000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2841008000084001ULL, 0x0900800000408040ULL, 0x8420000000800000ULL, 0x0001000000280000ULL, 0x0100000400020040ULL,
+        0x0002084000010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0082000800000000ULL, 0x0000000000000000ULL, 0x0080000400080800ULL, 0x0000000000000000ULL,
+        0x21000080060080c0ULL, 0x0000000002800204ULL, 0x0200000801000800ULL, 0x1000100008008000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2000000000090000ULL, 0x0000304088000801ULL, 0x0002000300603002ULL, 0x00010000000c0010ULL, 0x00002a0000000010ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0800200000008010ULL, 0x0000000000000000ULL, 0x0402220000201090ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0900000000400800ULL, 0x8800080100000000ULL, 0x0388400080040000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2000000200008100ULL, 0x0200002020006006ULL, 0x4010400800804024ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040058004084800ULL,
+        0x0000000000000000ULL, 0x0801000000030000ULL, 0x0000000000000000ULL, 0x00001c0800000000ULL, 0x0000000000000000ULL, 0x0809200000001015ULL, 0x0000004020000900ULL, 0x0000000000000000ULL, 0x0200004080400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0402800000080000ULL, 0x0000000000000000ULL, 0x2200020000000400ULL, 0x0000000000000000ULL, 0x0504020000000000ULL, 0x0004000000120200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4000000048100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0040020000000300ULL, 0x0520000000002000ULL, 0x0000000440000040ULL, 0x0008a84200400008ULL, 0x1508008040800100ULL, 0x0300020002100041ULL, 0x0000000000000000ULL, 0x0101181400200000ULL, 0x0108021408000100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x00001a0001080060ULL, 0x0400000480000200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000980080ULL, 0x0000000000000000ULL, 0x0000400008000048ULL, 0x0000000000000000ULL, 0x0000100000290000ULL, 0x2200002200000000ULL, 0x0000000000000000ULL, 0x0000800001000880ULL,
+        0x0000000000000000ULL, 0x0000002000206000ULL, 0x0000200000010044ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0828000000000040ULL, 0x0000800210000400ULL, 0x0000000000000000ULL, 0x0100940000042004ULL,
+        0x0000000000000000ULL, 0x0006818818000402ULL, 0x8010000100800000ULL, 0x0000000000000000ULL, 0x0000800200002020ULL, 0x0000000000000000ULL, 0x0000a00080004402ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000840210024410ULL, 0x0000040020041000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0800028020020408ULL, 0x0000000000000000ULL, 0xa001800001028040ULL, 0xe000040000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000263802200000ULL, 0x0000000000000000ULL, 0x0004000000001802ULL,
+        0x0428108010515000ULL, 0x0000000000000000ULL, 0x0400600000000000ULL, 0x00000000a0080001ULL, 0x0420000000040001ULL, 0x0008200001000020ULL, 0x0000000000000000ULL, 0x8040000008000200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010048200000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000801000400000ULL, 0x0001800112500001ULL, 0x0000000482200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010264000020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1400001aa2001000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008002100000002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8040041004002400ULL, 0x0000010005010000ULL, 0x1040900000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080040000001002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000006004000000ULL,
+        0x0102200100000000ULL, 0x93008a0000248080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000048020002000ULL, 0x0820200040000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0002200021000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00108004c0000020ULL, 0x0000000108000088ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080000002800800ULL, 0x2004000000004200ULL, 0x0000000000000000ULL, 0x0100001000002020ULL, 0x0000000000000000ULL, 0x0004080008004000ULL, 0x0800020000021000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4000102000010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000490000000100ULL, 0x0000040080020020ULL, 0x0000000000000000ULL, 0x0000500000020001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0446100014808040ULL, 0x1000000000000031ULL, 0x0000000000000000ULL, 0x2800140082000080ULL, 0x0010802000040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x010000402000002dULL, 0x0000140000000880ULL, 0x0000000000000000ULL, 0x0000802000000208ULL,
+        0x0000000000000000ULL, 0x4100000000000404ULL, 0x0000000000000000ULL, 0x1000210004000000ULL, 0x0004010010002000ULL, 0x0010090000001000ULL, 0x0488800000000000ULL, 0x0400000010000048ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0400000090000000ULL,
+        0x0010006020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x5000200000000800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000208200008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000040000001140ULL, 0x0001000000000a10ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000200002100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002400018000ULL, 0x0104001001000000ULL, 0x0000122000010000ULL,
+        0x0800200800800000ULL, 0x0000000000000000ULL, 0x201201000002800cULL, 0x0000808100000002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0898000000000000ULL, 0x1010000000400020ULL, 0x0010020200000004ULL, 0x0800022000000010ULL, 0x400080200c042100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0100400800002000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001040040200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0800000000200880ULL, 0x0400040000000082ULL, 0x0000000000000000ULL, 0x0200000000800210ULL, 0x0000000000000000ULL, 0x0210000110000000ULL, 0x0000000000000000ULL, 0x0000081080008000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0800100000040400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002001000800002ULL, 0x0000000000000000ULL, 0x0000008000205881ULL, 0x0000018000880000ULL, 0x0400080400200000ULL, 0x0000000000000000ULL, 0x0200000004000004ULL, 0x0000000000000000ULL,
+        0x0000000140000101ULL, 0x0204460041000000ULL, 0x2124402203208001ULL, 0x0004100000040020ULL, 0x0000000000000000ULL, 0x0015000000008000ULL, 0x4a01008100180c11ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000100000441ULL, 0x0000000000000000ULL, 0x0002002100002000ULL, 0x0000000000000000ULL, 0x0000001420040000ULL, 0x0000101001100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0200008010000040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040004080100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000800000003000ULL, 0x0000002002044000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1030001000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000061000800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002200020000100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001800000000102ULL, 0x2082040000000000ULL,
+        0x0180040000080000ULL, 0x2802001101008004ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8408220040020004ULL, 0x008000c002300204ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001010800000800ULL, 0x000880a000000000ULL, 0x0000000000000000ULL, 0x0200805001005001ULL,
+        0x0000031000000400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040081000000080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080008000820000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0180000000001040ULL, 0x0000000000000000ULL, 0x0800004701008000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000080000020204ULL, 0x0208000000002080ULL, 0x0008100008000004ULL, 0x0204012040000112ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8000110016800200ULL, 0x00000000c8000080ULL, 0x0040110000000008ULL, 0x200000420480200cULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010004000021000ULL, 0x0000000000000000ULL,
+        0x0010090040400410ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4500000180110000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0224608089084040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x010000000000c002ULL, 0x0000102280000000ULL, 0x0100481800100020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0012000012000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040080040004ULL, 0x0000000000000000ULL, 0x8000080100000040ULL, 0x0000000000000000ULL, 0x8000045000448800ULL, 0x0000010000840800ULL, 0x0000000000000000ULL, 0x0200000820000001ULL, 0x000080a043000040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008001120000ULL, 0x0201406000000080ULL, 0x0000000000000000ULL, 0x0000000004000440ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0490000001000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0202000000040001ULL,
+        0x0000000005020020ULL, 0x0000005020000020ULL, 0x0000000000000000ULL, 0x0e45891204000120ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x6000080000400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4002000000008800ULL,
+        0x0000000820200001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0800100000040080ULL, 0x0200000801000040ULL, 0x0000000000000000ULL, 0x000a000000000820ULL, 0x0000000188000004ULL, 0x894000000c010080ULL, 0x0000000000000000ULL, 0x000008c010041800ULL,
+        0x0020248000200121ULL, 0x0820000050000000ULL, 0x000102a000000000ULL, 0x0000000000000000ULL, 0x0000020000c00400ULL, 0x1001000008000004ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000005080002000ULL, 0x0000000000000000ULL, 0x0000020100003000ULL, 0x0800001000000082ULL,
+        0x0000000800200030ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020041008ULL, 0x0000000000000000ULL, 0x0000200c00040000ULL, 0x0000000000000000ULL, 0x0200480000000100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080002200028002ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000010000008044ULL, 0x0000000000000000ULL, 0x0000004005040000ULL, 0x0400000000001002ULL, 0x2002220a00088000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x8000008002100000ULL, 0x0000000000000000ULL, 0x0280000000040004ULL, 0x0000000000000000ULL,
+        0x8401280010040020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2a0201a100000000ULL, 0x0000000000000000ULL, 0x0308000000000001ULL, 0x0000000000000000ULL, 0x2000100000880000ULL, 0x0002080010000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x4000020000100002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0841102110000200ULL, 0x0000000000000000ULL, 0x0202000880804800ULL, 0x0000080004020004ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4000040880000000ULL, 0x0400080080002000ULL,
+        0x0000000100800402ULL, 0x0000011050000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000800000100000cULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2000004000004800ULL, 0x0040101000010000ULL, 0x0000000000000000ULL, 0x1902000240000008ULL, 0x2040000000040040ULL, 0x0000000000000000ULL, 0x0000908004240048ULL, 0x0000000000000000ULL, 0x8010000410000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000400000100801ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00a5000100000180ULL, 0x0000000000000000ULL, 0x00000000010a0040ULL, 0x0880000400800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010088000004ULL,
+        0x0041100002000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0100040000002000ULL, 0x0000000000000000ULL, 0x0b02020100000040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040040000000021ULL, 0x0100020200010000ULL, 0x0000000000000000ULL, 0x0000400000090400ULL,
+        0x2004000080004000ULL, 0x0000000000000000ULL, 0x0001420000002000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000204104ULL, 0x0000000000000000ULL, 0x0400026000500dc0ULL,
+        0x0000000002500000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0840000200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004000400000018ULL, 0x0008002100004000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x000000000000a808ULL, 0x0000000000000000ULL, 0x0408040080000000ULL, 0x2400002000822006ULL, 0x0109010804800400ULL, 0x0000000000000000ULL, 0x0400280000000040ULL, 0x0000000000000000ULL, 0x2090004000088010ULL, 0x0000802400400000ULL, 0x000d001000000000ULL, 0x00a0000000c00000ULL,
+        0x0000000000000000ULL, 0x0150800048008000ULL, 0x4200001800000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2000000000100410ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002002004000040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x042000c004002008ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002000102000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002200000100080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0200400000100100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00042201d4000000ULL, 0x0000000000000000ULL, 0x0010004010000008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010040000420ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0804020000000000ULL,
+        0x0008020048000000ULL, 0x1340800020008001ULL, 0x0000400060005880ULL, 0x0000000000000000ULL, 0x0002000010800001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000800001410ULL, 0x0000000000000000ULL, 0x0800101000004000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x10a0102800008800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2064000020880004ULL, 0x0880040020000000ULL, 0x0400004200080000ULL, 0x0000000000000000ULL, 0x0100040008000020ULL, 0x0000000000000000ULL, 0x4010000a4490c020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010000400028ULL, 0x0000000000000000ULL, 0x0088000010000002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000082001000004ULL, 0x8000000120000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4022000000100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2000240000000400ULL, 0x0001002000080400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000c0000402000ULL, 0x8080000002002000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8000000102000100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0200040000000006ULL, 0x0000000000000000ULL, 0x1050200000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0100000040001100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0800008201000000ULL, 0x000000000040008aULL, 0x0020200000001004ULL, 0x0000100020200800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x1000080060000000ULL, 0x0800000050002000ULL, 0x0000000000000000ULL,
+        0x0204002080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0200000400000420ULL, 0x0004000011100000ULL, 0x0008010020041a01ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002000012000400ULL, 0x0011000000081000ULL,
+        0x00000042000c0000ULL, 0x0000000000000000ULL, 0x0100100000000900ULL, 0x0044000861000110ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0030100040000000ULL, 0x0008000202010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8000000200001000ULL, 0x0000044008000004ULL, 0x0008040008000002ULL, 0x0000000000000000ULL, 0x0000800100030000ULL, 0x0000000000000000ULL, 0x0008020008020000ULL, 0x1000000400830184ULL, 0x0000000000000000ULL, 0x0000068000981020ULL, 0x0000000200402002ULL, 0x0000000000000000ULL,
+        0x0800002000804000ULL, 0x0000000000000000ULL, 0x4000000040220000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0085028900220180ULL, 0x0100000140400000ULL, 0x0020004800001000ULL, 0x8000001000020400ULL, 0x0000000000000000ULL, 0x0000000041001080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4000003000001000ULL, 0x0000000000000000ULL, 0x0000000010001008ULL, 0x000a42000800a400ULL, 0x0000000000000000ULL, 0x0100000008600000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0401000000000110ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2000010000200200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0011040090080800ULL, 0x0000000000000000ULL, 0x0000050000400000ULL, 0x2a00180040040020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002020000110000ULL, 0x0000200100000240ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404000000002000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2100000100001000ULL, 0xc000000020040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0400000042000800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040000042804460ULL, 0x0800008010000004ULL, 0x0000000000000000ULL, 0x0808002000600021ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x2000000600000020ULL, 0x9000000020001000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000020000080001ULL, 0x0000000290000080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x4001000008020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000200000008208ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000042000000000cULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000104000020400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810000004200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001000422000000ULL,
+        0x9000001040131000ULL, 0x5081b2a000008300ULL, 0x0000000000000000ULL, 0x0000100000002408ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000048204000000ULL, 0x000880c028010080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002000510000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0108040020000000ULL, 0x0000000000000000ULL, 0x1001000004008000ULL, 0x2000000000480008ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0120000000000410ULL, 0x0000000000000000ULL, 0x0080002088000000ULL, 0x0000000000000000ULL, 0x1400000000040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004080000040040ULL,
+        0x0000200110000004ULL, 0x2040000000000042ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008080000410ULL, 0x0000000000000000ULL, 0x0000000000021410ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808000030000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080000020000820ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0108000004002301ULL
+      };
+
+      constexpr int TERM_ORDER[] = {
+        4, 14, 7, 3, 8, 12, 10, 2, 6, 11, 13, 9,
+        1, 5, 0
+      };
+
+      constexpr int TERM_MIN_REST[] = {
+        -138344, -105576, -80082, -65139, -50243, -45188, -40930, -32833, -27317, -22402, -16155, -10708,
+        -6027, -2153, -941, 0
+      };
+
+      constexpr int TERM_MAX_REST[] = {
+        107136, 103617, 77436, 64268, 51118, 42243, 33667, 29794, 22027, 14648, 13334, 7853,
+        5827, 2682, 871, 0
+      };
+
+      constexpr ModelTables TABLES = {
+        CHAR_NUM, CHAR_PAGES, CHAR_PAGE_IDS, 17920,
+        CHAR_CODES, UNIGRAM_SCORES, CLASS_SCORES, TAIL_SCORES,
+        WORD_SEEDS, WORD_SLOTS, 1076,
+        FILTER_WORDS, 2048,
+        TERM_ORDER, TERM_MIN_REST, TERM_MAX_REST
+      };
+    }
+  }
+}
+
+#endif /* TINYSEGMENTERXX_TABLES_H */
@@ -13,6 +13,9 @@
  *
  */
 
+#ifndef TINYSEGMENTERXX_TRAIN_H
+#define TINYSEGMENTERXX_TRAIN_H
+
 /* C++ code produced by gperf version 3.0.3 */
 /* Command-line: gperf -CGtD -Z TrainHash -L C++ -e '	'  */
 /* Computed positions: -k'1-3,6-8,10,$' */
@@ -2368,3 +2371,5 @@ TrainHash::in_word_set (register const char *str, register unsigned int len)
     }
   return 0;
 }
+
+#endif /* TINYSEGMENTERXX_TRAIN_H */